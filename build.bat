@@ -5,9 +5,13 @@ set ProjectRoot=%CD%
 if not exist build md build
 pushd build
 
-set CompileFlags=/nologo /W4 /Zi /O2 /I%ProjectRoot%\include /FeWin32SmoothSizing
+set CompileFlags=/nologo /W4 /Zi /O2 /DGLAD_MX /I%ProjectRoot%\include /FeWin32SmoothSizing
+
+set cmd=cl %CompileFlags% %ProjectRoot%\src\main.c %ProjectRoot%\src\batch.c %ProjectRoot%\src\command_list.c %ProjectRoot%\src\damage.c %ProjectRoot%\src\frame_graph.c %ProjectRoot%\src\gl_capture.c %ProjectRoot%\src\gl_caps.c %ProjectRoot%\src\mesh_arena.c %ProjectRoot%\src\vertex_format.c %ProjectRoot%\src\gl_state.c %ProjectRoot%\src\program_cache.c %ProjectRoot%\src\raster.c %ProjectRoot%\src\shader_compiler.c %ProjectRoot%\src\stream_buffer.c %ProjectRoot%\src\texture_stream.c %ProjectRoot%\src\glad.c %ProjectRoot%\src\glad_exts.c %ProjectRoot%\src\glad_wgl.c
+
+rem The Vulkan renderer is built when the Vulkan SDK is installed
+if defined VULKAN_SDK set cmd=%cmd% /DVULKAN_RENDERER /I"%VULKAN_SDK%\Include" %ProjectRoot%\src\vulkan_renderer.c
 
-set cmd=cl %CompileFlags% %ProjectRoot%\src\main.c %ProjectRoot%\src\glad.c %ProjectRoot%\src\glad_wgl.c
 echo %cmd%
 %cmd%
 
@@ -7,16 +7,22 @@
     APIs: gl=3.3
     Profile: core
     Extensions:
-        
+        GL_ARB_get_program_binary,
+        GL_KHR_parallel_shader_compile,
+        GL_ARB_base_instance,
+        GL_ARB_buffer_storage,
+        GL_ARB_direct_state_access,
+        GL_ARB_draw_indirect,
+        GL_ARB_multi_draw_indirect
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile,GL_ARB_base_instance,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_draw_indirect,GL_ARB_multi_draw_indirect"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_get_program_binary&extensions=GL_KHR_parallel_shader_compile&extensions=GL_ARB_base_instance&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_direct_state_access&extensions=GL_ARB_draw_indirect&extensions=GL_ARB_multi_draw_indirect
 */
 
 
@@ -80,12 +86,33 @@ typedef void* (* GLADloadproc)(const char *name);
 # endif
 #endif
 
-GLAPI struct gladGLversionStruct GLVersion;
+#include <glad/glad_exts.h>
+
 
 GLAPI int gladLoadGL(void);
+GLAPI void gladUnloadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Lazy loading: every entry point starts as a stub that resolves and patches
+   itself on its first call, except the ones named in hot_list, which are
+   resolved up front. Version and extension flags are set as for eager loading,
+   and only entry points they cover get a stub, so a pointer is non-NULL for
+   the same entry points as after an eager load. A stub whose entry point the
+   driver doesn't export reports it and aborts. gladLoadGLLazy keeps the GL
+   library open so the stubs can resolve later. */
+GLAPI int gladLoadGLLazy(const char *const *hot_list, int hot_count);
+
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc, const char *const *hot_list, int hot_count);
+
+/* Number of stubs resolved since the last lazy load */
+GLAPI int gladGetLazyResolveCount(void);
+
+/* Extensions of the context that was current for the last load. Kept until the next load. */
+GLAPI int gladHasExtension(const char *ext);
+
+GLAPI const GladExtensionSet *gladGetExtensions(void);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -951,1177 +978,2087 @@ typedef void (APIENTRY *GLVULKANPROCNV)(void);
 #define GL_TIME_ELAPSED 0x88BF
 #define GL_TIMESTAMP 0x8E28
 #define GL_INT_2_10_10_10_REV 0x8D9F
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_PROGRAM_BINARY_FORMATS 0x87FF
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
+#define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
+#define GL_BUFFER_STORAGE_FLAGS 0x8220
+#define GL_TEXTURE_TARGET 0x1006
+#define GL_QUERY_TARGET 0x82EA
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#define GL_DRAW_INDIRECT_BUFFER_BINDING 0x8F43
 #ifndef GL_VERSION_1_0
 #define GL_VERSION_1_0 1
-GLAPI int GLAD_GL_VERSION_1_0;
 typedef void (APIENTRYP PFNGLCULLFACEPROC)(GLenum mode);
-GLAPI PFNGLCULLFACEPROC glad_glCullFace;
 #define glCullFace glad_glCullFace
 typedef void (APIENTRYP PFNGLFRONTFACEPROC)(GLenum mode);
-GLAPI PFNGLFRONTFACEPROC glad_glFrontFace;
 #define glFrontFace glad_glFrontFace
 typedef void (APIENTRYP PFNGLHINTPROC)(GLenum target, GLenum mode);
-GLAPI PFNGLHINTPROC glad_glHint;
 #define glHint glad_glHint
 typedef void (APIENTRYP PFNGLLINEWIDTHPROC)(GLfloat width);
-GLAPI PFNGLLINEWIDTHPROC glad_glLineWidth;
 #define glLineWidth glad_glLineWidth
 typedef void (APIENTRYP PFNGLPOINTSIZEPROC)(GLfloat size);
-GLAPI PFNGLPOINTSIZEPROC glad_glPointSize;
 #define glPointSize glad_glPointSize
 typedef void (APIENTRYP PFNGLPOLYGONMODEPROC)(GLenum face, GLenum mode);
-GLAPI PFNGLPOLYGONMODEPROC glad_glPolygonMode;
 #define glPolygonMode glad_glPolygonMode
 typedef void (APIENTRYP PFNGLSCISSORPROC)(GLint x, GLint y, GLsizei width, GLsizei height);
-GLAPI PFNGLSCISSORPROC glad_glScissor;
 #define glScissor glad_glScissor
 typedef void (APIENTRYP PFNGLTEXPARAMETERFPROC)(GLenum target, GLenum pname, GLfloat param);
-GLAPI PFNGLTEXPARAMETERFPROC glad_glTexParameterf;
 #define glTexParameterf glad_glTexParameterf
 typedef void (APIENTRYP PFNGLTEXPARAMETERFVPROC)(GLenum target, GLenum pname, const GLfloat *params);
-GLAPI PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv;
 #define glTexParameterfv glad_glTexParameterfv
 typedef void (APIENTRYP PFNGLTEXPARAMETERIPROC)(GLenum target, GLenum pname, GLint param);
-GLAPI PFNGLTEXPARAMETERIPROC glad_glTexParameteri;
 #define glTexParameteri glad_glTexParameteri
 typedef void (APIENTRYP PFNGLTEXPARAMETERIVPROC)(GLenum target, GLenum pname, const GLint *params);
-GLAPI PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv;
 #define glTexParameteriv glad_glTexParameteriv
 typedef void (APIENTRYP PFNGLTEXIMAGE1DPROC)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels);
-GLAPI PFNGLTEXIMAGE1DPROC glad_glTexImage1D;
 #define glTexImage1D glad_glTexImage1D
 typedef void (APIENTRYP PFNGLTEXIMAGE2DPROC)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
-GLAPI PFNGLTEXIMAGE2DPROC glad_glTexImage2D;
 #define glTexImage2D glad_glTexImage2D
 typedef void (APIENTRYP PFNGLDRAWBUFFERPROC)(GLenum buf);
-GLAPI PFNGLDRAWBUFFERPROC glad_glDrawBuffer;
 #define glDrawBuffer glad_glDrawBuffer
 typedef void (APIENTRYP PFNGLCLEARPROC)(GLbitfield mask);
-GLAPI PFNGLCLEARPROC glad_glClear;
 #define glClear glad_glClear
 typedef void (APIENTRYP PFNGLCLEARCOLORPROC)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
-GLAPI PFNGLCLEARCOLORPROC glad_glClearColor;
 #define glClearColor glad_glClearColor
 typedef void (APIENTRYP PFNGLCLEARSTENCILPROC)(GLint s);
-GLAPI PFNGLCLEARSTENCILPROC glad_glClearStencil;
 #define glClearStencil glad_glClearStencil
 typedef void (APIENTRYP PFNGLCLEARDEPTHPROC)(GLdouble depth);
-GLAPI PFNGLCLEARDEPTHPROC glad_glClearDepth;
 #define glClearDepth glad_glClearDepth
 typedef void (APIENTRYP PFNGLSTENCILMASKPROC)(GLuint mask);
-GLAPI PFNGLSTENCILMASKPROC glad_glStencilMask;
 #define glStencilMask glad_glStencilMask
 typedef void (APIENTRYP PFNGLCOLORMASKPROC)(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
-GLAPI PFNGLCOLORMASKPROC glad_glColorMask;
 #define glColorMask glad_glColorMask
 typedef void (APIENTRYP PFNGLDEPTHMASKPROC)(GLboolean flag);
-GLAPI PFNGLDEPTHMASKPROC glad_glDepthMask;
 #define glDepthMask glad_glDepthMask
 typedef void (APIENTRYP PFNGLDISABLEPROC)(GLenum cap);
-GLAPI PFNGLDISABLEPROC glad_glDisable;
 #define glDisable glad_glDisable
 typedef void (APIENTRYP PFNGLENABLEPROC)(GLenum cap);
-GLAPI PFNGLENABLEPROC glad_glEnable;
 #define glEnable glad_glEnable
 typedef void (APIENTRYP PFNGLFINISHPROC)(void);
-GLAPI PFNGLFINISHPROC glad_glFinish;
 #define glFinish glad_glFinish
 typedef void (APIENTRYP PFNGLFLUSHPROC)(void);
-GLAPI PFNGLFLUSHPROC glad_glFlush;
 #define glFlush glad_glFlush
 typedef void (APIENTRYP PFNGLBLENDFUNCPROC)(GLenum sfactor, GLenum dfactor);
-GLAPI PFNGLBLENDFUNCPROC glad_glBlendFunc;
 #define glBlendFunc glad_glBlendFunc
 typedef void (APIENTRYP PFNGLLOGICOPPROC)(GLenum opcode);
-GLAPI PFNGLLOGICOPPROC glad_glLogicOp;
 #define glLogicOp glad_glLogicOp
 typedef void (APIENTRYP PFNGLSTENCILFUNCPROC)(GLenum func, GLint ref, GLuint mask);
-GLAPI PFNGLSTENCILFUNCPROC glad_glStencilFunc;
 #define glStencilFunc glad_glStencilFunc
 typedef void (APIENTRYP PFNGLSTENCILOPPROC)(GLenum fail, GLenum zfail, GLenum zpass);
-GLAPI PFNGLSTENCILOPPROC glad_glStencilOp;
 #define glStencilOp glad_glStencilOp
 typedef void (APIENTRYP PFNGLDEPTHFUNCPROC)(GLenum func);
-GLAPI PFNGLDEPTHFUNCPROC glad_glDepthFunc;
 #define glDepthFunc glad_glDepthFunc
 typedef void (APIENTRYP PFNGLPIXELSTOREFPROC)(GLenum pname, GLfloat param);
-GLAPI PFNGLPIXELSTOREFPROC glad_glPixelStoref;
 #define glPixelStoref glad_glPixelStoref
 typedef void (APIENTRYP PFNGLPIXELSTOREIPROC)(GLenum pname, GLint param);
-GLAPI PFNGLPIXELSTOREIPROC glad_glPixelStorei;
 #define glPixelStorei glad_glPixelStorei
 typedef void (APIENTRYP PFNGLREADBUFFERPROC)(GLenum src);
-GLAPI PFNGLREADBUFFERPROC glad_glReadBuffer;
 #define glReadBuffer glad_glReadBuffer
 typedef void (APIENTRYP PFNGLREADPIXELSPROC)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
-GLAPI PFNGLREADPIXELSPROC glad_glReadPixels;
 #define glReadPixels glad_glReadPixels
 typedef void (APIENTRYP PFNGLGETBOOLEANVPROC)(GLenum pname, GLboolean *data);
-GLAPI PFNGLGETBOOLEANVPROC glad_glGetBooleanv;
 #define glGetBooleanv glad_glGetBooleanv
 typedef void (APIENTRYP PFNGLGETDOUBLEVPROC)(GLenum pname, GLdouble *data);
-GLAPI PFNGLGETDOUBLEVPROC glad_glGetDoublev;
 #define glGetDoublev glad_glGetDoublev
 typedef GLenum (APIENTRYP PFNGLGETERRORPROC)(void);
-GLAPI PFNGLGETERRORPROC glad_glGetError;
 #define glGetError glad_glGetError
 typedef void (APIENTRYP PFNGLGETFLOATVPROC)(GLenum pname, GLfloat *data);
-GLAPI PFNGLGETFLOATVPROC glad_glGetFloatv;
 #define glGetFloatv glad_glGetFloatv
 typedef void (APIENTRYP PFNGLGETINTEGERVPROC)(GLenum pname, GLint *data);
-GLAPI PFNGLGETINTEGERVPROC glad_glGetIntegerv;
 #define glGetIntegerv glad_glGetIntegerv
 typedef const GLubyte * (APIENTRYP PFNGLGETSTRINGPROC)(GLenum name);
-GLAPI PFNGLGETSTRINGPROC glad_glGetString;
 #define glGetString glad_glGetString
 typedef void (APIENTRYP PFNGLGETTEXIMAGEPROC)(GLenum target, GLint level, GLenum format, GLenum type, void *pixels);
-GLAPI PFNGLGETTEXIMAGEPROC glad_glGetTexImage;
 #define glGetTexImage glad_glGetTexImage
 typedef void (APIENTRYP PFNGLGETTEXPARAMETERFVPROC)(GLenum target, GLenum pname, GLfloat *params);
-GLAPI PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv;
 #define glGetTexParameterfv glad_glGetTexParameterfv
 typedef void (APIENTRYP PFNGLGETTEXPARAMETERIVPROC)(GLenum target, GLenum pname, GLint *params);
-GLAPI PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv;
 #define glGetTexParameteriv glad_glGetTexParameteriv
 typedef void (APIENTRYP PFNGLGETTEXLEVELPARAMETERFVPROC)(GLenum target, GLint level, GLenum pname, GLfloat *params);
-GLAPI PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv;
 #define glGetTexLevelParameterfv glad_glGetTexLevelParameterfv
 typedef void (APIENTRYP PFNGLGETTEXLEVELPARAMETERIVPROC)(GLenum target, GLint level, GLenum pname, GLint *params);
-GLAPI PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv;
 #define glGetTexLevelParameteriv glad_glGetTexLevelParameteriv
 typedef GLboolean (APIENTRYP PFNGLISENABLEDPROC)(GLenum cap);
-GLAPI PFNGLISENABLEDPROC glad_glIsEnabled;
 #define glIsEnabled glad_glIsEnabled
 typedef void (APIENTRYP PFNGLDEPTHRANGEPROC)(GLdouble n, GLdouble f);
-GLAPI PFNGLDEPTHRANGEPROC glad_glDepthRange;
 #define glDepthRange glad_glDepthRange
 typedef void (APIENTRYP PFNGLVIEWPORTPROC)(GLint x, GLint y, GLsizei width, GLsizei height);
-GLAPI PFNGLVIEWPORTPROC glad_glViewport;
 #define glViewport glad_glViewport
 #endif
 #ifndef GL_VERSION_1_1
 #define GL_VERSION_1_1 1
-GLAPI int GLAD_GL_VERSION_1_1;
 typedef void (APIENTRYP PFNGLDRAWARRAYSPROC)(GLenum mode, GLint first, GLsizei count);
-GLAPI PFNGLDRAWARRAYSPROC glad_glDrawArrays;
 #define glDrawArrays glad_glDrawArrays
 typedef void (APIENTRYP PFNGLDRAWELEMENTSPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices);
-GLAPI PFNGLDRAWELEMENTSPROC glad_glDrawElements;
 #define glDrawElements glad_glDrawElements
 typedef void (APIENTRYP PFNGLPOLYGONOFFSETPROC)(GLfloat factor, GLfloat units);
-GLAPI PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset;
 #define glPolygonOffset glad_glPolygonOffset
 typedef void (APIENTRYP PFNGLCOPYTEXIMAGE1DPROC)(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);
-GLAPI PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D;
 #define glCopyTexImage1D glad_glCopyTexImage1D
 typedef void (APIENTRYP PFNGLCOPYTEXIMAGE2DPROC)(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);
-GLAPI PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D;
 #define glCopyTexImage2D glad_glCopyTexImage2D
 typedef void (APIENTRYP PFNGLCOPYTEXSUBIMAGE1DPROC)(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
-GLAPI PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D;
 #define glCopyTexSubImage1D glad_glCopyTexSubImage1D
 typedef void (APIENTRYP PFNGLCOPYTEXSUBIMAGE2DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
-GLAPI PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D;
 #define glCopyTexSubImage2D glad_glCopyTexSubImage2D
 typedef void (APIENTRYP PFNGLTEXSUBIMAGE1DPROC)(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
-GLAPI PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D;
 #define glTexSubImage1D glad_glTexSubImage1D
 typedef void (APIENTRYP PFNGLTEXSUBIMAGE2DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
-GLAPI PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D;
 #define glTexSubImage2D glad_glTexSubImage2D
 typedef void (APIENTRYP PFNGLBINDTEXTUREPROC)(GLenum target, GLuint texture);
-GLAPI PFNGLBINDTEXTUREPROC glad_glBindTexture;
 #define glBindTexture glad_glBindTexture
 typedef void (APIENTRYP PFNGLDELETETEXTURESPROC)(GLsizei n, const GLuint *textures);
-GLAPI PFNGLDELETETEXTURESPROC glad_glDeleteTextures;
 #define glDeleteTextures glad_glDeleteTextures
 typedef void (APIENTRYP PFNGLGENTEXTURESPROC)(GLsizei n, GLuint *textures);
-GLAPI PFNGLGENTEXTURESPROC glad_glGenTextures;
 #define glGenTextures glad_glGenTextures
 typedef GLboolean (APIENTRYP PFNGLISTEXTUREPROC)(GLuint texture);
-GLAPI PFNGLISTEXTUREPROC glad_glIsTexture;
 #define glIsTexture glad_glIsTexture
 #endif
 #ifndef GL_VERSION_1_2
 #define GL_VERSION_1_2 1
-GLAPI int GLAD_GL_VERSION_1_2;
 typedef void (APIENTRYP PFNGLDRAWRANGEELEMENTSPROC)(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
-GLAPI PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements;
 #define glDrawRangeElements glad_glDrawRangeElements
 typedef void (APIENTRYP PFNGLTEXIMAGE3DPROC)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
-GLAPI PFNGLTEXIMAGE3DPROC glad_glTexImage3D;
 #define glTexImage3D glad_glTexImage3D
 typedef void (APIENTRYP PFNGLTEXSUBIMAGE3DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
-GLAPI PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D;
 #define glTexSubImage3D glad_glTexSubImage3D
 typedef void (APIENTRYP PFNGLCOPYTEXSUBIMAGE3DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
-GLAPI PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D;
 #define glCopyTexSubImage3D glad_glCopyTexSubImage3D
 #endif
 #ifndef GL_VERSION_1_3
 #define GL_VERSION_1_3 1
-GLAPI int GLAD_GL_VERSION_1_3;
 typedef void (APIENTRYP PFNGLACTIVETEXTUREPROC)(GLenum texture);
-GLAPI PFNGLACTIVETEXTUREPROC glad_glActiveTexture;
 #define glActiveTexture glad_glActiveTexture
 typedef void (APIENTRYP PFNGLSAMPLECOVERAGEPROC)(GLfloat value, GLboolean invert);
-GLAPI PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage;
 #define glSampleCoverage glad_glSampleCoverage
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXIMAGE3DPROC)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data);
-GLAPI PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D;
 #define glCompressedTexImage3D glad_glCompressedTexImage3D
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXIMAGE2DPROC)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data);
-GLAPI PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D;
 #define glCompressedTexImage2D glad_glCompressedTexImage2D
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXIMAGE1DPROC)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data);
-GLAPI PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D;
 #define glCompressedTexImage1D glad_glCompressedTexImage1D
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data);
-GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D;
 #define glCompressedTexSubImage3D glad_glCompressedTexSubImage3D
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
-GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D;
 #define glCompressedTexSubImage2D glad_glCompressedTexSubImage2D
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data);
-GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D;
 #define glCompressedTexSubImage1D glad_glCompressedTexSubImage1D
 typedef void (APIENTRYP PFNGLGETCOMPRESSEDTEXIMAGEPROC)(GLenum target, GLint level, void *img);
-GLAPI PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage;
 #define glGetCompressedTexImage glad_glGetCompressedTexImage
 #endif
 #ifndef GL_VERSION_1_4
 #define GL_VERSION_1_4 1
-GLAPI int GLAD_GL_VERSION_1_4;
 typedef void (APIENTRYP PFNGLBLENDFUNCSEPARATEPROC)(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
-GLAPI PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate;
 #define glBlendFuncSeparate glad_glBlendFuncSeparate
 typedef void (APIENTRYP PFNGLMULTIDRAWARRAYSPROC)(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount);
-GLAPI PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays;
 #define glMultiDrawArrays glad_glMultiDrawArrays
 typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSPROC)(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount);
-GLAPI PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements;
 #define glMultiDrawElements glad_glMultiDrawElements
 typedef void (APIENTRYP PFNGLPOINTPARAMETERFPROC)(GLenum pname, GLfloat param);
-GLAPI PFNGLPOINTPARAMETERFPROC glad_glPointParameterf;
 #define glPointParameterf glad_glPointParameterf
 typedef void (APIENTRYP PFNGLPOINTPARAMETERFVPROC)(GLenum pname, const GLfloat *params);
-GLAPI PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv;
 #define glPointParameterfv glad_glPointParameterfv
 typedef void (APIENTRYP PFNGLPOINTPARAMETERIPROC)(GLenum pname, GLint param);
-GLAPI PFNGLPOINTPARAMETERIPROC glad_glPointParameteri;
 #define glPointParameteri glad_glPointParameteri
 typedef void (APIENTRYP PFNGLPOINTPARAMETERIVPROC)(GLenum pname, const GLint *params);
-GLAPI PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv;
 #define glPointParameteriv glad_glPointParameteriv
 typedef void (APIENTRYP PFNGLBLENDCOLORPROC)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
-GLAPI PFNGLBLENDCOLORPROC glad_glBlendColor;
 #define glBlendColor glad_glBlendColor
 typedef void (APIENTRYP PFNGLBLENDEQUATIONPROC)(GLenum mode);
-GLAPI PFNGLBLENDEQUATIONPROC glad_glBlendEquation;
 #define glBlendEquation glad_glBlendEquation
 #endif
 #ifndef GL_VERSION_1_5
 #define GL_VERSION_1_5 1
-GLAPI int GLAD_GL_VERSION_1_5;
 typedef void (APIENTRYP PFNGLGENQUERIESPROC)(GLsizei n, GLuint *ids);
-GLAPI PFNGLGENQUERIESPROC glad_glGenQueries;
 #define glGenQueries glad_glGenQueries
 typedef void (APIENTRYP PFNGLDELETEQUERIESPROC)(GLsizei n, const GLuint *ids);
-GLAPI PFNGLDELETEQUERIESPROC glad_glDeleteQueries;
 #define glDeleteQueries glad_glDeleteQueries
 typedef GLboolean (APIENTRYP PFNGLISQUERYPROC)(GLuint id);
-GLAPI PFNGLISQUERYPROC glad_glIsQuery;
 #define glIsQuery glad_glIsQuery
 typedef void (APIENTRYP PFNGLBEGINQUERYPROC)(GLenum target, GLuint id);
-GLAPI PFNGLBEGINQUERYPROC glad_glBeginQuery;
 #define glBeginQuery glad_glBeginQuery
 typedef void (APIENTRYP PFNGLENDQUERYPROC)(GLenum target);
-GLAPI PFNGLENDQUERYPROC glad_glEndQuery;
 #define glEndQuery glad_glEndQuery
 typedef void (APIENTRYP PFNGLGETQUERYIVPROC)(GLenum target, GLenum pname, GLint *params);
-GLAPI PFNGLGETQUERYIVPROC glad_glGetQueryiv;
 #define glGetQueryiv glad_glGetQueryiv
 typedef void (APIENTRYP PFNGLGETQUERYOBJECTIVPROC)(GLuint id, GLenum pname, GLint *params);
-GLAPI PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv;
 #define glGetQueryObjectiv glad_glGetQueryObjectiv
 typedef void (APIENTRYP PFNGLGETQUERYOBJECTUIVPROC)(GLuint id, GLenum pname, GLuint *params);
-GLAPI PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv;
 #define glGetQueryObjectuiv glad_glGetQueryObjectuiv
 typedef void (APIENTRYP PFNGLBINDBUFFERPROC)(GLenum target, GLuint buffer);
-GLAPI PFNGLBINDBUFFERPROC glad_glBindBuffer;
 #define glBindBuffer glad_glBindBuffer
 typedef void (APIENTRYP PFNGLDELETEBUFFERSPROC)(GLsizei n, const GLuint *buffers);
-GLAPI PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers;
 #define glDeleteBuffers glad_glDeleteBuffers
 typedef void (APIENTRYP PFNGLGENBUFFERSPROC)(GLsizei n, GLuint *buffers);
-GLAPI PFNGLGENBUFFERSPROC glad_glGenBuffers;
 #define glGenBuffers glad_glGenBuffers
 typedef GLboolean (APIENTRYP PFNGLISBUFFERPROC)(GLuint buffer);
-GLAPI PFNGLISBUFFERPROC glad_glIsBuffer;
 #define glIsBuffer glad_glIsBuffer
 typedef void (APIENTRYP PFNGLBUFFERDATAPROC)(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
-GLAPI PFNGLBUFFERDATAPROC glad_glBufferData;
 #define glBufferData glad_glBufferData
 typedef void (APIENTRYP PFNGLBUFFERSUBDATAPROC)(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
-GLAPI PFNGLBUFFERSUBDATAPROC glad_glBufferSubData;
 #define glBufferSubData glad_glBufferSubData
 typedef void (APIENTRYP PFNGLGETBUFFERSUBDATAPROC)(GLenum target, GLintptr offset, GLsizeiptr size, void *data);
-GLAPI PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData;
 #define glGetBufferSubData glad_glGetBufferSubData
 typedef void * (APIENTRYP PFNGLMAPBUFFERPROC)(GLenum target, GLenum access);
-GLAPI PFNGLMAPBUFFERPROC glad_glMapBuffer;
 #define glMapBuffer glad_glMapBuffer
 typedef GLboolean (APIENTRYP PFNGLUNMAPBUFFERPROC)(GLenum target);
-GLAPI PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer;
 #define glUnmapBuffer glad_glUnmapBuffer
 typedef void (APIENTRYP PFNGLGETBUFFERPARAMETERIVPROC)(GLenum target, GLenum pname, GLint *params);
-GLAPI PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv;
 #define glGetBufferParameteriv glad_glGetBufferParameteriv
 typedef void (APIENTRYP PFNGLGETBUFFERPOINTERVPROC)(GLenum target, GLenum pname, void **params);
-GLAPI PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv;
 #define glGetBufferPointerv glad_glGetBufferPointerv
 #endif
 #ifndef GL_VERSION_2_0
 #define GL_VERSION_2_0 1
-GLAPI int GLAD_GL_VERSION_2_0;
 typedef void (APIENTRYP PFNGLBLENDEQUATIONSEPARATEPROC)(GLenum modeRGB, GLenum modeAlpha);
-GLAPI PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate;
 #define glBlendEquationSeparate glad_glBlendEquationSeparate
 typedef void (APIENTRYP PFNGLDRAWBUFFERSPROC)(GLsizei n, const GLenum *bufs);
-GLAPI PFNGLDRAWBUFFERSPROC glad_glDrawBuffers;
 #define glDrawBuffers glad_glDrawBuffers
 typedef void (APIENTRYP PFNGLSTENCILOPSEPARATEPROC)(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);
-GLAPI PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate;
 #define glStencilOpSeparate glad_glStencilOpSeparate
 typedef void (APIENTRYP PFNGLSTENCILFUNCSEPARATEPROC)(GLenum face, GLenum func, GLint ref, GLuint mask);
-GLAPI PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate;
 #define glStencilFuncSeparate glad_glStencilFuncSeparate
 typedef void (APIENTRYP PFNGLSTENCILMASKSEPARATEPROC)(GLenum face, GLuint mask);
-GLAPI PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate;
 #define glStencilMaskSeparate glad_glStencilMaskSeparate
 typedef void (APIENTRYP PFNGLATTACHSHADERPROC)(GLuint program, GLuint shader);
-GLAPI PFNGLATTACHSHADERPROC glad_glAttachShader;
 #define glAttachShader glad_glAttachShader
 typedef void (APIENTRYP PFNGLBINDATTRIBLOCATIONPROC)(GLuint program, GLuint index, const GLchar *name);
-GLAPI PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation;
 #define glBindAttribLocation glad_glBindAttribLocation
 typedef void (APIENTRYP PFNGLCOMPILESHADERPROC)(GLuint shader);
-GLAPI PFNGLCOMPILESHADERPROC glad_glCompileShader;
 #define glCompileShader glad_glCompileShader
 typedef GLuint (APIENTRYP PFNGLCREATEPROGRAMPROC)(void);
-GLAPI PFNGLCREATEPROGRAMPROC glad_glCreateProgram;
 #define glCreateProgram glad_glCreateProgram
 typedef GLuint (APIENTRYP PFNGLCREATESHADERPROC)(GLenum type);
-GLAPI PFNGLCREATESHADERPROC glad_glCreateShader;
 #define glCreateShader glad_glCreateShader
 typedef void (APIENTRYP PFNGLDELETEPROGRAMPROC)(GLuint program);
-GLAPI PFNGLDELETEPROGRAMPROC glad_glDeleteProgram;
 #define glDeleteProgram glad_glDeleteProgram
 typedef void (APIENTRYP PFNGLDELETESHADERPROC)(GLuint shader);
-GLAPI PFNGLDELETESHADERPROC glad_glDeleteShader;
 #define glDeleteShader glad_glDeleteShader
 typedef void (APIENTRYP PFNGLDETACHSHADERPROC)(GLuint program, GLuint shader);
-GLAPI PFNGLDETACHSHADERPROC glad_glDetachShader;
 #define glDetachShader glad_glDetachShader
 typedef void (APIENTRYP PFNGLDISABLEVERTEXATTRIBARRAYPROC)(GLuint index);
-GLAPI PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray;
 #define glDisableVertexAttribArray glad_glDisableVertexAttribArray
 typedef void (APIENTRYP PFNGLENABLEVERTEXATTRIBARRAYPROC)(GLuint index);
-GLAPI PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray;
 #define glEnableVertexAttribArray glad_glEnableVertexAttribArray
 typedef void (APIENTRYP PFNGLGETACTIVEATTRIBPROC)(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
-GLAPI PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib;
 #define glGetActiveAttrib glad_glGetActiveAttrib
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMPROC)(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
-GLAPI PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform;
 #define glGetActiveUniform glad_glGetActiveUniform
 typedef void (APIENTRYP PFNGLGETATTACHEDSHADERSPROC)(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders);
-GLAPI PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders;
 #define glGetAttachedShaders glad_glGetAttachedShaders
 typedef GLint (APIENTRYP PFNGLGETATTRIBLOCATIONPROC)(GLuint program, const GLchar *name);
-GLAPI PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation;
 #define glGetAttribLocation glad_glGetAttribLocation
 typedef void (APIENTRYP PFNGLGETPROGRAMIVPROC)(GLuint program, GLenum pname, GLint *params);
-GLAPI PFNGLGETPROGRAMIVPROC glad_glGetProgramiv;
 #define glGetProgramiv glad_glGetProgramiv
 typedef void (APIENTRYP PFNGLGETPROGRAMINFOLOGPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
-GLAPI PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog;
 #define glGetProgramInfoLog glad_glGetProgramInfoLog
 typedef void (APIENTRYP PFNGLGETSHADERIVPROC)(GLuint shader, GLenum pname, GLint *params);
-GLAPI PFNGLGETSHADERIVPROC glad_glGetShaderiv;
 #define glGetShaderiv glad_glGetShaderiv
 typedef void (APIENTRYP PFNGLGETSHADERINFOLOGPROC)(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
-GLAPI PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog;
 #define glGetShaderInfoLog glad_glGetShaderInfoLog
 typedef void (APIENTRYP PFNGLGETSHADERSOURCEPROC)(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source);
-GLAPI PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource;
 #define glGetShaderSource glad_glGetShaderSource
 typedef GLint (APIENTRYP PFNGLGETUNIFORMLOCATIONPROC)(GLuint program, const GLchar *name);
-GLAPI PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation;
 #define glGetUniformLocation glad_glGetUniformLocation
 typedef void (APIENTRYP PFNGLGETUNIFORMFVPROC)(GLuint program, GLint location, GLfloat *params);
-GLAPI PFNGLGETUNIFORMFVPROC glad_glGetUniformfv;
 #define glGetUniformfv glad_glGetUniformfv
 typedef void (APIENTRYP PFNGLGETUNIFORMIVPROC)(GLuint program, GLint location, GLint *params);
-GLAPI PFNGLGETUNIFORMIVPROC glad_glGetUniformiv;
 #define glGetUniformiv glad_glGetUniformiv
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBDVPROC)(GLuint index, GLenum pname, GLdouble *params);
-GLAPI PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv;
 #define glGetVertexAttribdv glad_glGetVertexAttribdv
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBFVPROC)(GLuint index, GLenum pname, GLfloat *params);
-GLAPI PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv;
 #define glGetVertexAttribfv glad_glGetVertexAttribfv
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBIVPROC)(GLuint index, GLenum pname, GLint *params);
-GLAPI PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv;
 #define glGetVertexAttribiv glad_glGetVertexAttribiv
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBPOINTERVPROC)(GLuint index, GLenum pname, void **pointer);
-GLAPI PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv;
 #define glGetVertexAttribPointerv glad_glGetVertexAttribPointerv
 typedef GLboolean (APIENTRYP PFNGLISPROGRAMPROC)(GLuint program);
-GLAPI PFNGLISPROGRAMPROC glad_glIsProgram;
 #define glIsProgram glad_glIsProgram
 typedef GLboolean (APIENTRYP PFNGLISSHADERPROC)(GLuint shader);
-GLAPI PFNGLISSHADERPROC glad_glIsShader;
 #define glIsShader glad_glIsShader
 typedef void (APIENTRYP PFNGLLINKPROGRAMPROC)(GLuint program);
-GLAPI PFNGLLINKPROGRAMPROC glad_glLinkProgram;
 #define glLinkProgram glad_glLinkProgram
 typedef void (APIENTRYP PFNGLSHADERSOURCEPROC)(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
-GLAPI PFNGLSHADERSOURCEPROC glad_glShaderSource;
 #define glShaderSource glad_glShaderSource
 typedef void (APIENTRYP PFNGLUSEPROGRAMPROC)(GLuint program);
-GLAPI PFNGLUSEPROGRAMPROC glad_glUseProgram;
 #define glUseProgram glad_glUseProgram
 typedef void (APIENTRYP PFNGLUNIFORM1FPROC)(GLint location, GLfloat v0);
-GLAPI PFNGLUNIFORM1FPROC glad_glUniform1f;
 #define glUniform1f glad_glUniform1f
 typedef void (APIENTRYP PFNGLUNIFORM2FPROC)(GLint location, GLfloat v0, GLfloat v1);
-GLAPI PFNGLUNIFORM2FPROC glad_glUniform2f;
 #define glUniform2f glad_glUniform2f
 typedef void (APIENTRYP PFNGLUNIFORM3FPROC)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
-GLAPI PFNGLUNIFORM3FPROC glad_glUniform3f;
 #define glUniform3f glad_glUniform3f
 typedef void (APIENTRYP PFNGLUNIFORM4FPROC)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
-GLAPI PFNGLUNIFORM4FPROC glad_glUniform4f;
 #define glUniform4f glad_glUniform4f
 typedef void (APIENTRYP PFNGLUNIFORM1IPROC)(GLint location, GLint v0);
-GLAPI PFNGLUNIFORM1IPROC glad_glUniform1i;
 #define glUniform1i glad_glUniform1i
 typedef void (APIENTRYP PFNGLUNIFORM2IPROC)(GLint location, GLint v0, GLint v1);
-GLAPI PFNGLUNIFORM2IPROC glad_glUniform2i;
 #define glUniform2i glad_glUniform2i
 typedef void (APIENTRYP PFNGLUNIFORM3IPROC)(GLint location, GLint v0, GLint v1, GLint v2);
-GLAPI PFNGLUNIFORM3IPROC glad_glUniform3i;
 #define glUniform3i glad_glUniform3i
 typedef void (APIENTRYP PFNGLUNIFORM4IPROC)(GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
-GLAPI PFNGLUNIFORM4IPROC glad_glUniform4i;
 #define glUniform4i glad_glUniform4i
 typedef void (APIENTRYP PFNGLUNIFORM1FVPROC)(GLint location, GLsizei count, const GLfloat *value);
-GLAPI PFNGLUNIFORM1FVPROC glad_glUniform1fv;
 #define glUniform1fv glad_glUniform1fv
 typedef void (APIENTRYP PFNGLUNIFORM2FVPROC)(GLint location, GLsizei count, const GLfloat *value);
-GLAPI PFNGLUNIFORM2FVPROC glad_glUniform2fv;
 #define glUniform2fv glad_glUniform2fv
 typedef void (APIENTRYP PFNGLUNIFORM3FVPROC)(GLint location, GLsizei count, const GLfloat *value);
-GLAPI PFNGLUNIFORM3FVPROC glad_glUniform3fv;
 #define glUniform3fv glad_glUniform3fv
 typedef void (APIENTRYP PFNGLUNIFORM4FVPROC)(GLint location, GLsizei count, const GLfloat *value);
-GLAPI PFNGLUNIFORM4FVPROC glad_glUniform4fv;
 #define glUniform4fv glad_glUniform4fv
 typedef void (APIENTRYP PFNGLUNIFORM1IVPROC)(GLint location, GLsizei count, const GLint *value);
-GLAPI PFNGLUNIFORM1IVPROC glad_glUniform1iv;
 #define glUniform1iv glad_glUniform1iv
 typedef void (APIENTRYP PFNGLUNIFORM2IVPROC)(GLint location, GLsizei count, const GLint *value);
-GLAPI PFNGLUNIFORM2IVPROC glad_glUniform2iv;
 #define glUniform2iv glad_glUniform2iv
 typedef void (APIENTRYP PFNGLUNIFORM3IVPROC)(GLint location, GLsizei count, const GLint *value);
-GLAPI PFNGLUNIFORM3IVPROC glad_glUniform3iv;
 #define glUniform3iv glad_glUniform3iv
 typedef void (APIENTRYP PFNGLUNIFORM4IVPROC)(GLint location, GLsizei count, const GLint *value);
-GLAPI PFNGLUNIFORM4IVPROC glad_glUniform4iv;
 #define glUniform4iv glad_glUniform4iv
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv;
 #define glUniformMatrix2fv glad_glUniformMatrix2fv
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv;
 #define glUniformMatrix3fv glad_glUniformMatrix3fv
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv;
 #define glUniformMatrix4fv glad_glUniformMatrix4fv
 typedef void (APIENTRYP PFNGLVALIDATEPROGRAMPROC)(GLuint program);
-GLAPI PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram;
 #define glValidateProgram glad_glValidateProgram
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1DPROC)(GLuint index, GLdouble x);
-GLAPI PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d;
 #define glVertexAttrib1d glad_glVertexAttrib1d
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1DVPROC)(GLuint index, const GLdouble *v);
-GLAPI PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv;
 #define glVertexAttrib1dv glad_glVertexAttrib1dv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1FPROC)(GLuint index, GLfloat x);
-GLAPI PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f;
 #define glVertexAttrib1f glad_glVertexAttrib1f
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1FVPROC)(GLuint index, const GLfloat *v);
-GLAPI PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv;
 #define glVertexAttrib1fv glad_glVertexAttrib1fv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1SPROC)(GLuint index, GLshort x);
-GLAPI PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s;
 #define glVertexAttrib1s glad_glVertexAttrib1s
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1SVPROC)(GLuint index, const GLshort *v);
-GLAPI PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv;
 #define glVertexAttrib1sv glad_glVertexAttrib1sv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2DPROC)(GLuint index, GLdouble x, GLdouble y);
-GLAPI PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d;
 #define glVertexAttrib2d glad_glVertexAttrib2d
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2DVPROC)(GLuint index, const GLdouble *v);
-GLAPI PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv;
 #define glVertexAttrib2dv glad_glVertexAttrib2dv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2FPROC)(GLuint index, GLfloat x, GLfloat y);
-GLAPI PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f;
 #define glVertexAttrib2f glad_glVertexAttrib2f
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2FVPROC)(GLuint index, const GLfloat *v);
-GLAPI PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv;
 #define glVertexAttrib2fv glad_glVertexAttrib2fv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2SPROC)(GLuint index, GLshort x, GLshort y);
-GLAPI PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s;
 #define glVertexAttrib2s glad_glVertexAttrib2s
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2SVPROC)(GLuint index, const GLshort *v);
-GLAPI PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv;
 #define glVertexAttrib2sv glad_glVertexAttrib2sv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3DPROC)(GLuint index, GLdouble x, GLdouble y, GLdouble z);
-GLAPI PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d;
 #define glVertexAttrib3d glad_glVertexAttrib3d
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3DVPROC)(GLuint index, const GLdouble *v);
-GLAPI PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv;
 #define glVertexAttrib3dv glad_glVertexAttrib3dv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3FPROC)(GLuint index, GLfloat x, GLfloat y, GLfloat z);
-GLAPI PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f;
 #define glVertexAttrib3f glad_glVertexAttrib3f
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3FVPROC)(GLuint index, const GLfloat *v);
-GLAPI PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv;
 #define glVertexAttrib3fv glad_glVertexAttrib3fv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3SPROC)(GLuint index, GLshort x, GLshort y, GLshort z);
-GLAPI PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s;
 #define glVertexAttrib3s glad_glVertexAttrib3s
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3SVPROC)(GLuint index, const GLshort *v);
-GLAPI PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv;
 #define glVertexAttrib3sv glad_glVertexAttrib3sv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NBVPROC)(GLuint index, const GLbyte *v);
-GLAPI PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv;
 #define glVertexAttrib4Nbv glad_glVertexAttrib4Nbv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NIVPROC)(GLuint index, const GLint *v);
-GLAPI PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv;
 #define glVertexAttrib4Niv glad_glVertexAttrib4Niv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NSVPROC)(GLuint index, const GLshort *v);
-GLAPI PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv;
 #define glVertexAttrib4Nsv glad_glVertexAttrib4Nsv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NUBPROC)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
-GLAPI PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub;
 #define glVertexAttrib4Nub glad_glVertexAttrib4Nub
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NUBVPROC)(GLuint index, const GLubyte *v);
-GLAPI PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv;
 #define glVertexAttrib4Nubv glad_glVertexAttrib4Nubv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NUIVPROC)(GLuint index, const GLuint *v);
-GLAPI PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv;
 #define glVertexAttrib4Nuiv glad_glVertexAttrib4Nuiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NUSVPROC)(GLuint index, const GLushort *v);
-GLAPI PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv;
 #define glVertexAttrib4Nusv glad_glVertexAttrib4Nusv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4BVPROC)(GLuint index, const GLbyte *v);
-GLAPI PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv;
 #define glVertexAttrib4bv glad_glVertexAttrib4bv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4DPROC)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
-GLAPI PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d;
 #define glVertexAttrib4d glad_glVertexAttrib4d
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4DVPROC)(GLuint index, const GLdouble *v);
-GLAPI PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv;
 #define glVertexAttrib4dv glad_glVertexAttrib4dv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4FPROC)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
-GLAPI PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f;
 #define glVertexAttrib4f glad_glVertexAttrib4f
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4FVPROC)(GLuint index, const GLfloat *v);
-GLAPI PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv;
 #define glVertexAttrib4fv glad_glVertexAttrib4fv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4IVPROC)(GLuint index, const GLint *v);
-GLAPI PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv;
 #define glVertexAttrib4iv glad_glVertexAttrib4iv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4SPROC)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
-GLAPI PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s;
 #define glVertexAttrib4s glad_glVertexAttrib4s
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4SVPROC)(GLuint index, const GLshort *v);
-GLAPI PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv;
 #define glVertexAttrib4sv glad_glVertexAttrib4sv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4UBVPROC)(GLuint index, const GLubyte *v);
-GLAPI PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv;
 #define glVertexAttrib4ubv glad_glVertexAttrib4ubv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4UIVPROC)(GLuint index, const GLuint *v);
-GLAPI PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv;
 #define glVertexAttrib4uiv glad_glVertexAttrib4uiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4USVPROC)(GLuint index, const GLushort *v);
-GLAPI PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv;
 #define glVertexAttrib4usv glad_glVertexAttrib4usv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBPOINTERPROC)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
-GLAPI PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer;
 #define glVertexAttribPointer glad_glVertexAttribPointer
 #endif
 #ifndef GL_VERSION_2_1
 #define GL_VERSION_2_1 1
-GLAPI int GLAD_GL_VERSION_2_1;
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2X3FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv;
 #define glUniformMatrix2x3fv glad_glUniformMatrix2x3fv
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3X2FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv;
 #define glUniformMatrix3x2fv glad_glUniformMatrix3x2fv
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2X4FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv;
 #define glUniformMatrix2x4fv glad_glUniformMatrix2x4fv
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4X2FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv;
 #define glUniformMatrix4x2fv glad_glUniformMatrix4x2fv
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3X4FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv;
 #define glUniformMatrix3x4fv glad_glUniformMatrix3x4fv
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4X3FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-GLAPI PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv;
 #define glUniformMatrix4x3fv glad_glUniformMatrix4x3fv
 #endif
 #ifndef GL_VERSION_3_0
 #define GL_VERSION_3_0 1
-GLAPI int GLAD_GL_VERSION_3_0;
 typedef void (APIENTRYP PFNGLCOLORMASKIPROC)(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a);
-GLAPI PFNGLCOLORMASKIPROC glad_glColorMaski;
 #define glColorMaski glad_glColorMaski
 typedef void (APIENTRYP PFNGLGETBOOLEANI_VPROC)(GLenum target, GLuint index, GLboolean *data);
-GLAPI PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v;
 #define glGetBooleani_v glad_glGetBooleani_v
 typedef void (APIENTRYP PFNGLGETINTEGERI_VPROC)(GLenum target, GLuint index, GLint *data);
-GLAPI PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v;
 #define glGetIntegeri_v glad_glGetIntegeri_v
 typedef void (APIENTRYP PFNGLENABLEIPROC)(GLenum target, GLuint index);
-GLAPI PFNGLENABLEIPROC glad_glEnablei;
 #define glEnablei glad_glEnablei
 typedef void (APIENTRYP PFNGLDISABLEIPROC)(GLenum target, GLuint index);
-GLAPI PFNGLDISABLEIPROC glad_glDisablei;
 #define glDisablei glad_glDisablei
 typedef GLboolean (APIENTRYP PFNGLISENABLEDIPROC)(GLenum target, GLuint index);
-GLAPI PFNGLISENABLEDIPROC glad_glIsEnabledi;
 #define glIsEnabledi glad_glIsEnabledi
 typedef void (APIENTRYP PFNGLBEGINTRANSFORMFEEDBACKPROC)(GLenum primitiveMode);
-GLAPI PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback;
 #define glBeginTransformFeedback glad_glBeginTransformFeedback
 typedef void (APIENTRYP PFNGLENDTRANSFORMFEEDBACKPROC)(void);
-GLAPI PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback;
 #define glEndTransformFeedback glad_glEndTransformFeedback
 typedef void (APIENTRYP PFNGLBINDBUFFERRANGEPROC)(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
-GLAPI PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange;
 #define glBindBufferRange glad_glBindBufferRange
 typedef void (APIENTRYP PFNGLBINDBUFFERBASEPROC)(GLenum target, GLuint index, GLuint buffer);
-GLAPI PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase;
 #define glBindBufferBase glad_glBindBufferBase
 typedef void (APIENTRYP PFNGLTRANSFORMFEEDBACKVARYINGSPROC)(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode);
-GLAPI PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings;
 #define glTransformFeedbackVaryings glad_glTransformFeedbackVaryings
 typedef void (APIENTRYP PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name);
-GLAPI PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying;
 #define glGetTransformFeedbackVarying glad_glGetTransformFeedbackVarying
 typedef void (APIENTRYP PFNGLCLAMPCOLORPROC)(GLenum target, GLenum clamp);
-GLAPI PFNGLCLAMPCOLORPROC glad_glClampColor;
 #define glClampColor glad_glClampColor
 typedef void (APIENTRYP PFNGLBEGINCONDITIONALRENDERPROC)(GLuint id, GLenum mode);
-GLAPI PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender;
 #define glBeginConditionalRender glad_glBeginConditionalRender
 typedef void (APIENTRYP PFNGLENDCONDITIONALRENDERPROC)(void);
-GLAPI PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender;
 #define glEndConditionalRender glad_glEndConditionalRender
 typedef void (APIENTRYP PFNGLVERTEXATTRIBIPOINTERPROC)(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
-GLAPI PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer;
 #define glVertexAttribIPointer glad_glVertexAttribIPointer
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBIIVPROC)(GLuint index, GLenum pname, GLint *params);
-GLAPI PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv;
 #define glGetVertexAttribIiv glad_glGetVertexAttribIiv
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBIUIVPROC)(GLuint index, GLenum pname, GLuint *params);
-GLAPI PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv;
 #define glGetVertexAttribIuiv glad_glGetVertexAttribIuiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI1IPROC)(GLuint index, GLint x);
-GLAPI PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i;
 #define glVertexAttribI1i glad_glVertexAttribI1i
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI2IPROC)(GLuint index, GLint x, GLint y);
-GLAPI PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i;
 #define glVertexAttribI2i glad_glVertexAttribI2i
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI3IPROC)(GLuint index, GLint x, GLint y, GLint z);
-GLAPI PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i;
 #define glVertexAttribI3i glad_glVertexAttribI3i
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4IPROC)(GLuint index, GLint x, GLint y, GLint z, GLint w);
-GLAPI PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i;
 #define glVertexAttribI4i glad_glVertexAttribI4i
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI1UIPROC)(GLuint index, GLuint x);
-GLAPI PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui;
 #define glVertexAttribI1ui glad_glVertexAttribI1ui
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI2UIPROC)(GLuint index, GLuint x, GLuint y);
-GLAPI PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui;
 #define glVertexAttribI2ui glad_glVertexAttribI2ui
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI3UIPROC)(GLuint index, GLuint x, GLuint y, GLuint z);
-GLAPI PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui;
 #define glVertexAttribI3ui glad_glVertexAttribI3ui
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4UIPROC)(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w);
-GLAPI PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui;
 #define glVertexAttribI4ui glad_glVertexAttribI4ui
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI1IVPROC)(GLuint index, const GLint *v);
-GLAPI PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv;
 #define glVertexAttribI1iv glad_glVertexAttribI1iv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI2IVPROC)(GLuint index, const GLint *v);
-GLAPI PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv;
 #define glVertexAttribI2iv glad_glVertexAttribI2iv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI3IVPROC)(GLuint index, const GLint *v);
-GLAPI PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv;
 #define glVertexAttribI3iv glad_glVertexAttribI3iv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4IVPROC)(GLuint index, const GLint *v);
-GLAPI PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv;
 #define glVertexAttribI4iv glad_glVertexAttribI4iv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI1UIVPROC)(GLuint index, const GLuint *v);
-GLAPI PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv;
 #define glVertexAttribI1uiv glad_glVertexAttribI1uiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI2UIVPROC)(GLuint index, const GLuint *v);
-GLAPI PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv;
 #define glVertexAttribI2uiv glad_glVertexAttribI2uiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI3UIVPROC)(GLuint index, const GLuint *v);
-GLAPI PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv;
 #define glVertexAttribI3uiv glad_glVertexAttribI3uiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4UIVPROC)(GLuint index, const GLuint *v);
-GLAPI PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv;
 #define glVertexAttribI4uiv glad_glVertexAttribI4uiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4BVPROC)(GLuint index, const GLbyte *v);
-GLAPI PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv;
 #define glVertexAttribI4bv glad_glVertexAttribI4bv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4SVPROC)(GLuint index, const GLshort *v);
-GLAPI PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv;
 #define glVertexAttribI4sv glad_glVertexAttribI4sv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4UBVPROC)(GLuint index, const GLubyte *v);
-GLAPI PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv;
 #define glVertexAttribI4ubv glad_glVertexAttribI4ubv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4USVPROC)(GLuint index, const GLushort *v);
-GLAPI PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv;
 #define glVertexAttribI4usv glad_glVertexAttribI4usv
 typedef void (APIENTRYP PFNGLGETUNIFORMUIVPROC)(GLuint program, GLint location, GLuint *params);
-GLAPI PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv;
 #define glGetUniformuiv glad_glGetUniformuiv
 typedef void (APIENTRYP PFNGLBINDFRAGDATALOCATIONPROC)(GLuint program, GLuint color, const GLchar *name);
-GLAPI PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation;
 #define glBindFragDataLocation glad_glBindFragDataLocation
 typedef GLint (APIENTRYP PFNGLGETFRAGDATALOCATIONPROC)(GLuint program, const GLchar *name);
-GLAPI PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation;
 #define glGetFragDataLocation glad_glGetFragDataLocation
 typedef void (APIENTRYP PFNGLUNIFORM1UIPROC)(GLint location, GLuint v0);
-GLAPI PFNGLUNIFORM1UIPROC glad_glUniform1ui;
 #define glUniform1ui glad_glUniform1ui
 typedef void (APIENTRYP PFNGLUNIFORM2UIPROC)(GLint location, GLuint v0, GLuint v1);
-GLAPI PFNGLUNIFORM2UIPROC glad_glUniform2ui;
 #define glUniform2ui glad_glUniform2ui
 typedef void (APIENTRYP PFNGLUNIFORM3UIPROC)(GLint location, GLuint v0, GLuint v1, GLuint v2);
-GLAPI PFNGLUNIFORM3UIPROC glad_glUniform3ui;
 #define glUniform3ui glad_glUniform3ui
 typedef void (APIENTRYP PFNGLUNIFORM4UIPROC)(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3);
-GLAPI PFNGLUNIFORM4UIPROC glad_glUniform4ui;
 #define glUniform4ui glad_glUniform4ui
 typedef void (APIENTRYP PFNGLUNIFORM1UIVPROC)(GLint location, GLsizei count, const GLuint *value);
-GLAPI PFNGLUNIFORM1UIVPROC glad_glUniform1uiv;
 #define glUniform1uiv glad_glUniform1uiv
 typedef void (APIENTRYP PFNGLUNIFORM2UIVPROC)(GLint location, GLsizei count, const GLuint *value);
-GLAPI PFNGLUNIFORM2UIVPROC glad_glUniform2uiv;
 #define glUniform2uiv glad_glUniform2uiv
 typedef void (APIENTRYP PFNGLUNIFORM3UIVPROC)(GLint location, GLsizei count, const GLuint *value);
-GLAPI PFNGLUNIFORM3UIVPROC glad_glUniform3uiv;
 #define glUniform3uiv glad_glUniform3uiv
 typedef void (APIENTRYP PFNGLUNIFORM4UIVPROC)(GLint location, GLsizei count, const GLuint *value);
-GLAPI PFNGLUNIFORM4UIVPROC glad_glUniform4uiv;
 #define glUniform4uiv glad_glUniform4uiv
 typedef void (APIENTRYP PFNGLTEXPARAMETERIIVPROC)(GLenum target, GLenum pname, const GLint *params);
-GLAPI PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv;
 #define glTexParameterIiv glad_glTexParameterIiv
 typedef void (APIENTRYP PFNGLTEXPARAMETERIUIVPROC)(GLenum target, GLenum pname, const GLuint *params);
-GLAPI PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv;
 #define glTexParameterIuiv glad_glTexParameterIuiv
 typedef void (APIENTRYP PFNGLGETTEXPARAMETERIIVPROC)(GLenum target, GLenum pname, GLint *params);
-GLAPI PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv;
 #define glGetTexParameterIiv glad_glGetTexParameterIiv
 typedef void (APIENTRYP PFNGLGETTEXPARAMETERIUIVPROC)(GLenum target, GLenum pname, GLuint *params);
-GLAPI PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv;
 #define glGetTexParameterIuiv glad_glGetTexParameterIuiv
 typedef void (APIENTRYP PFNGLCLEARBUFFERIVPROC)(GLenum buffer, GLint drawbuffer, const GLint *value);
-GLAPI PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv;
 #define glClearBufferiv glad_glClearBufferiv
 typedef void (APIENTRYP PFNGLCLEARBUFFERUIVPROC)(GLenum buffer, GLint drawbuffer, const GLuint *value);
-GLAPI PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv;
 #define glClearBufferuiv glad_glClearBufferuiv
 typedef void (APIENTRYP PFNGLCLEARBUFFERFVPROC)(GLenum buffer, GLint drawbuffer, const GLfloat *value);
-GLAPI PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv;
 #define glClearBufferfv glad_glClearBufferfv
 typedef void (APIENTRYP PFNGLCLEARBUFFERFIPROC)(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil);
-GLAPI PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi;
 #define glClearBufferfi glad_glClearBufferfi
 typedef const GLubyte * (APIENTRYP PFNGLGETSTRINGIPROC)(GLenum name, GLuint index);
-GLAPI PFNGLGETSTRINGIPROC glad_glGetStringi;
 #define glGetStringi glad_glGetStringi
 typedef GLboolean (APIENTRYP PFNGLISRENDERBUFFERPROC)(GLuint renderbuffer);
-GLAPI PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer;
 #define glIsRenderbuffer glad_glIsRenderbuffer
 typedef void (APIENTRYP PFNGLBINDRENDERBUFFERPROC)(GLenum target, GLuint renderbuffer);
-GLAPI PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer;
 #define glBindRenderbuffer glad_glBindRenderbuffer
 typedef void (APIENTRYP PFNGLDELETERENDERBUFFERSPROC)(GLsizei n, const GLuint *renderbuffers);
-GLAPI PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers;
 #define glDeleteRenderbuffers glad_glDeleteRenderbuffers
 typedef void (APIENTRYP PFNGLGENRENDERBUFFERSPROC)(GLsizei n, GLuint *renderbuffers);
-GLAPI PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers;
 #define glGenRenderbuffers glad_glGenRenderbuffers
 typedef void (APIENTRYP PFNGLRENDERBUFFERSTORAGEPROC)(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
-GLAPI PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage;
 #define glRenderbufferStorage glad_glRenderbufferStorage
 typedef void (APIENTRYP PFNGLGETRENDERBUFFERPARAMETERIVPROC)(GLenum target, GLenum pname, GLint *params);
-GLAPI PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv;
 #define glGetRenderbufferParameteriv glad_glGetRenderbufferParameteriv
 typedef GLboolean (APIENTRYP PFNGLISFRAMEBUFFERPROC)(GLuint framebuffer);
-GLAPI PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer;
 #define glIsFramebuffer glad_glIsFramebuffer
 typedef void (APIENTRYP PFNGLBINDFRAMEBUFFERPROC)(GLenum target, GLuint framebuffer);
-GLAPI PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer;
 #define glBindFramebuffer glad_glBindFramebuffer
 typedef void (APIENTRYP PFNGLDELETEFRAMEBUFFERSPROC)(GLsizei n, const GLuint *framebuffers);
-GLAPI PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers;
 #define glDeleteFramebuffers glad_glDeleteFramebuffers
 typedef void (APIENTRYP PFNGLGENFRAMEBUFFERSPROC)(GLsizei n, GLuint *framebuffers);
-GLAPI PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers;
 #define glGenFramebuffers glad_glGenFramebuffers
 typedef GLenum (APIENTRYP PFNGLCHECKFRAMEBUFFERSTATUSPROC)(GLenum target);
-GLAPI PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
 #define glCheckFramebufferStatus glad_glCheckFramebufferStatus
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE1DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
-GLAPI PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D;
 #define glFramebufferTexture1D glad_glFramebufferTexture1D
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE2DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
-GLAPI PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D;
 #define glFramebufferTexture2D glad_glFramebufferTexture2D
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE3DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset);
-GLAPI PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D;
 #define glFramebufferTexture3D glad_glFramebufferTexture3D
 typedef void (APIENTRYP PFNGLFRAMEBUFFERRENDERBUFFERPROC)(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
-GLAPI PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer;
 #define glFramebufferRenderbuffer glad_glFramebufferRenderbuffer
 typedef void (APIENTRYP PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)(GLenum target, GLenum attachment, GLenum pname, GLint *params);
-GLAPI PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv;
 #define glGetFramebufferAttachmentParameteriv glad_glGetFramebufferAttachmentParameteriv
 typedef void (APIENTRYP PFNGLGENERATEMIPMAPPROC)(GLenum target);
-GLAPI PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap;
 #define glGenerateMipmap glad_glGenerateMipmap
 typedef void (APIENTRYP PFNGLBLITFRAMEBUFFERPROC)(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
-GLAPI PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
 #define glBlitFramebuffer glad_glBlitFramebuffer
 typedef void (APIENTRYP PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);
-GLAPI PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample;
 #define glRenderbufferStorageMultisample glad_glRenderbufferStorageMultisample
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURELAYERPROC)(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
-GLAPI PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer;
 #define glFramebufferTextureLayer glad_glFramebufferTextureLayer
 typedef void * (APIENTRYP PFNGLMAPBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
-GLAPI PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange;
 #define glMapBufferRange glad_glMapBufferRange
 typedef void (APIENTRYP PFNGLFLUSHMAPPEDBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length);
-GLAPI PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange;
 #define glFlushMappedBufferRange glad_glFlushMappedBufferRange
 typedef void (APIENTRYP PFNGLBINDVERTEXARRAYPROC)(GLuint array);
-GLAPI PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray;
 #define glBindVertexArray glad_glBindVertexArray
 typedef void (APIENTRYP PFNGLDELETEVERTEXARRAYSPROC)(GLsizei n, const GLuint *arrays);
-GLAPI PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays;
 #define glDeleteVertexArrays glad_glDeleteVertexArrays
 typedef void (APIENTRYP PFNGLGENVERTEXARRAYSPROC)(GLsizei n, GLuint *arrays);
-GLAPI PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays;
 #define glGenVertexArrays glad_glGenVertexArrays
 typedef GLboolean (APIENTRYP PFNGLISVERTEXARRAYPROC)(GLuint array);
-GLAPI PFNGLISVERTEXARRAYPROC glad_glIsVertexArray;
 #define glIsVertexArray glad_glIsVertexArray
 #endif
 #ifndef GL_VERSION_3_1
 #define GL_VERSION_3_1 1
-GLAPI int GLAD_GL_VERSION_3_1;
 typedef void (APIENTRYP PFNGLDRAWARRAYSINSTANCEDPROC)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
-GLAPI PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced;
 #define glDrawArraysInstanced glad_glDrawArraysInstanced
 typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
-GLAPI PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
 #define glDrawElementsInstanced glad_glDrawElementsInstanced
 typedef void (APIENTRYP PFNGLTEXBUFFERPROC)(GLenum target, GLenum internalformat, GLuint buffer);
-GLAPI PFNGLTEXBUFFERPROC glad_glTexBuffer;
 #define glTexBuffer glad_glTexBuffer
 typedef void (APIENTRYP PFNGLPRIMITIVERESTARTINDEXPROC)(GLuint index);
-GLAPI PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex;
 #define glPrimitiveRestartIndex glad_glPrimitiveRestartIndex
 typedef void (APIENTRYP PFNGLCOPYBUFFERSUBDATAPROC)(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
-GLAPI PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData;
 #define glCopyBufferSubData glad_glCopyBufferSubData
 typedef void (APIENTRYP PFNGLGETUNIFORMINDICESPROC)(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices);
-GLAPI PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices;
 #define glGetUniformIndices glad_glGetUniformIndices
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMSIVPROC)(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params);
-GLAPI PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv;
 #define glGetActiveUniformsiv glad_glGetActiveUniformsiv
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMNAMEPROC)(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName);
-GLAPI PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName;
 #define glGetActiveUniformName glad_glGetActiveUniformName
 typedef GLuint (APIENTRYP PFNGLGETUNIFORMBLOCKINDEXPROC)(GLuint program, const GLchar *uniformBlockName);
-GLAPI PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex;
 #define glGetUniformBlockIndex glad_glGetUniformBlockIndex
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMBLOCKIVPROC)(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params);
-GLAPI PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv;
 #define glGetActiveUniformBlockiv glad_glGetActiveUniformBlockiv
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName);
-GLAPI PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName;
 #define glGetActiveUniformBlockName glad_glGetActiveUniformBlockName
 typedef void (APIENTRYP PFNGLUNIFORMBLOCKBINDINGPROC)(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
-GLAPI PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding;
 #define glUniformBlockBinding glad_glUniformBlockBinding
 #endif
 #ifndef GL_VERSION_3_2
 #define GL_VERSION_3_2 1
-GLAPI int GLAD_GL_VERSION_3_2;
 typedef void (APIENTRYP PFNGLDRAWELEMENTSBASEVERTEXPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
-GLAPI PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex;
 #define glDrawElementsBaseVertex glad_glDrawElementsBaseVertex
 typedef void (APIENTRYP PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex);
-GLAPI PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex;
 #define glDrawRangeElementsBaseVertex glad_glDrawRangeElementsBaseVertex
 typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex);
-GLAPI PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex;
 #define glDrawElementsInstancedBaseVertex glad_glDrawElementsInstancedBaseVertex
 typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex);
-GLAPI PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex;
 #define glMultiDrawElementsBaseVertex glad_glMultiDrawElementsBaseVertex
 typedef void (APIENTRYP PFNGLPROVOKINGVERTEXPROC)(GLenum mode);
-GLAPI PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex;
 #define glProvokingVertex glad_glProvokingVertex
 typedef GLsync (APIENTRYP PFNGLFENCESYNCPROC)(GLenum condition, GLbitfield flags);
-GLAPI PFNGLFENCESYNCPROC glad_glFenceSync;
 #define glFenceSync glad_glFenceSync
 typedef GLboolean (APIENTRYP PFNGLISSYNCPROC)(GLsync sync);
-GLAPI PFNGLISSYNCPROC glad_glIsSync;
 #define glIsSync glad_glIsSync
 typedef void (APIENTRYP PFNGLDELETESYNCPROC)(GLsync sync);
-GLAPI PFNGLDELETESYNCPROC glad_glDeleteSync;
 #define glDeleteSync glad_glDeleteSync
 typedef GLenum (APIENTRYP PFNGLCLIENTWAITSYNCPROC)(GLsync sync, GLbitfield flags, GLuint64 timeout);
-GLAPI PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync;
 #define glClientWaitSync glad_glClientWaitSync
 typedef void (APIENTRYP PFNGLWAITSYNCPROC)(GLsync sync, GLbitfield flags, GLuint64 timeout);
-GLAPI PFNGLWAITSYNCPROC glad_glWaitSync;
 #define glWaitSync glad_glWaitSync
 typedef void (APIENTRYP PFNGLGETINTEGER64VPROC)(GLenum pname, GLint64 *data);
-GLAPI PFNGLGETINTEGER64VPROC glad_glGetInteger64v;
 #define glGetInteger64v glad_glGetInteger64v
 typedef void (APIENTRYP PFNGLGETSYNCIVPROC)(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values);
-GLAPI PFNGLGETSYNCIVPROC glad_glGetSynciv;
 #define glGetSynciv glad_glGetSynciv
 typedef void (APIENTRYP PFNGLGETINTEGER64I_VPROC)(GLenum target, GLuint index, GLint64 *data);
-GLAPI PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v;
 #define glGetInteger64i_v glad_glGetInteger64i_v
 typedef void (APIENTRYP PFNGLGETBUFFERPARAMETERI64VPROC)(GLenum target, GLenum pname, GLint64 *params);
-GLAPI PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v;
 #define glGetBufferParameteri64v glad_glGetBufferParameteri64v
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTUREPROC)(GLenum target, GLenum attachment, GLuint texture, GLint level);
-GLAPI PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture;
 #define glFramebufferTexture glad_glFramebufferTexture
 typedef void (APIENTRYP PFNGLTEXIMAGE2DMULTISAMPLEPROC)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
-GLAPI PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample;
 #define glTexImage2DMultisample glad_glTexImage2DMultisample
 typedef void (APIENTRYP PFNGLTEXIMAGE3DMULTISAMPLEPROC)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
-GLAPI PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample;
 #define glTexImage3DMultisample glad_glTexImage3DMultisample
 typedef void (APIENTRYP PFNGLGETMULTISAMPLEFVPROC)(GLenum pname, GLuint index, GLfloat *val);
-GLAPI PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv;
 #define glGetMultisamplefv glad_glGetMultisamplefv
 typedef void (APIENTRYP PFNGLSAMPLEMASKIPROC)(GLuint maskNumber, GLbitfield mask);
-GLAPI PFNGLSAMPLEMASKIPROC glad_glSampleMaski;
 #define glSampleMaski glad_glSampleMaski
 #endif
 #ifndef GL_VERSION_3_3
 #define GL_VERSION_3_3 1
-GLAPI int GLAD_GL_VERSION_3_3;
 typedef void (APIENTRYP PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name);
-GLAPI PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed;
 #define glBindFragDataLocationIndexed glad_glBindFragDataLocationIndexed
 typedef GLint (APIENTRYP PFNGLGETFRAGDATAINDEXPROC)(GLuint program, const GLchar *name);
-GLAPI PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex;
 #define glGetFragDataIndex glad_glGetFragDataIndex
 typedef void (APIENTRYP PFNGLGENSAMPLERSPROC)(GLsizei count, GLuint *samplers);
-GLAPI PFNGLGENSAMPLERSPROC glad_glGenSamplers;
 #define glGenSamplers glad_glGenSamplers
 typedef void (APIENTRYP PFNGLDELETESAMPLERSPROC)(GLsizei count, const GLuint *samplers);
-GLAPI PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers;
 #define glDeleteSamplers glad_glDeleteSamplers
 typedef GLboolean (APIENTRYP PFNGLISSAMPLERPROC)(GLuint sampler);
-GLAPI PFNGLISSAMPLERPROC glad_glIsSampler;
 #define glIsSampler glad_glIsSampler
 typedef void (APIENTRYP PFNGLBINDSAMPLERPROC)(GLuint unit, GLuint sampler);
-GLAPI PFNGLBINDSAMPLERPROC glad_glBindSampler;
 #define glBindSampler glad_glBindSampler
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIPROC)(GLuint sampler, GLenum pname, GLint param);
-GLAPI PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri;
 #define glSamplerParameteri glad_glSamplerParameteri
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIVPROC)(GLuint sampler, GLenum pname, const GLint *param);
-GLAPI PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv;
 #define glSamplerParameteriv glad_glSamplerParameteriv
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERFPROC)(GLuint sampler, GLenum pname, GLfloat param);
-GLAPI PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf;
 #define glSamplerParameterf glad_glSamplerParameterf
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERFVPROC)(GLuint sampler, GLenum pname, const GLfloat *param);
-GLAPI PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv;
 #define glSamplerParameterfv glad_glSamplerParameterfv
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIIVPROC)(GLuint sampler, GLenum pname, const GLint *param);
-GLAPI PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv;
 #define glSamplerParameterIiv glad_glSamplerParameterIiv
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIUIVPROC)(GLuint sampler, GLenum pname, const GLuint *param);
-GLAPI PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv;
 #define glSamplerParameterIuiv glad_glSamplerParameterIuiv
 typedef void (APIENTRYP PFNGLGETSAMPLERPARAMETERIVPROC)(GLuint sampler, GLenum pname, GLint *params);
-GLAPI PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv;
 #define glGetSamplerParameteriv glad_glGetSamplerParameteriv
 typedef void (APIENTRYP PFNGLGETSAMPLERPARAMETERIIVPROC)(GLuint sampler, GLenum pname, GLint *params);
-GLAPI PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv;
 #define glGetSamplerParameterIiv glad_glGetSamplerParameterIiv
 typedef void (APIENTRYP PFNGLGETSAMPLERPARAMETERFVPROC)(GLuint sampler, GLenum pname, GLfloat *params);
-GLAPI PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv;
 #define glGetSamplerParameterfv glad_glGetSamplerParameterfv
 typedef void (APIENTRYP PFNGLGETSAMPLERPARAMETERIUIVPROC)(GLuint sampler, GLenum pname, GLuint *params);
-GLAPI PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv;
 #define glGetSamplerParameterIuiv glad_glGetSamplerParameterIuiv
 typedef void (APIENTRYP PFNGLQUERYCOUNTERPROC)(GLuint id, GLenum target);
-GLAPI PFNGLQUERYCOUNTERPROC glad_glQueryCounter;
 #define glQueryCounter glad_glQueryCounter
 typedef void (APIENTRYP PFNGLGETQUERYOBJECTI64VPROC)(GLuint id, GLenum pname, GLint64 *params);
-GLAPI PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v;
 #define glGetQueryObjecti64v glad_glGetQueryObjecti64v
 typedef void (APIENTRYP PFNGLGETQUERYOBJECTUI64VPROC)(GLuint id, GLenum pname, GLuint64 *params);
-GLAPI PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v;
 #define glGetQueryObjectui64v glad_glGetQueryObjectui64v
 typedef void (APIENTRYP PFNGLVERTEXATTRIBDIVISORPROC)(GLuint index, GLuint divisor);
-GLAPI PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor;
 #define glVertexAttribDivisor glad_glVertexAttribDivisor
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP1UIPROC)(GLuint index, GLenum type, GLboolean normalized, GLuint value);
-GLAPI PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui;
 #define glVertexAttribP1ui glad_glVertexAttribP1ui
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP1UIVPROC)(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
-GLAPI PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv;
 #define glVertexAttribP1uiv glad_glVertexAttribP1uiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP2UIPROC)(GLuint index, GLenum type, GLboolean normalized, GLuint value);
-GLAPI PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui;
 #define glVertexAttribP2ui glad_glVertexAttribP2ui
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP2UIVPROC)(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
-GLAPI PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv;
 #define glVertexAttribP2uiv glad_glVertexAttribP2uiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP3UIPROC)(GLuint index, GLenum type, GLboolean normalized, GLuint value);
-GLAPI PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui;
 #define glVertexAttribP3ui glad_glVertexAttribP3ui
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP3UIVPROC)(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
-GLAPI PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv;
 #define glVertexAttribP3uiv glad_glVertexAttribP3uiv
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP4UIPROC)(GLuint index, GLenum type, GLboolean normalized, GLuint value);
-GLAPI PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui;
 #define glVertexAttribP4ui glad_glVertexAttribP4ui
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP4UIVPROC)(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
-GLAPI PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv;
 #define glVertexAttribP4uiv glad_glVertexAttribP4uiv
 typedef void (APIENTRYP PFNGLVERTEXP2UIPROC)(GLenum type, GLuint value);
-GLAPI PFNGLVERTEXP2UIPROC glad_glVertexP2ui;
 #define glVertexP2ui glad_glVertexP2ui
 typedef void (APIENTRYP PFNGLVERTEXP2UIVPROC)(GLenum type, const GLuint *value);
-GLAPI PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv;
 #define glVertexP2uiv glad_glVertexP2uiv
 typedef void (APIENTRYP PFNGLVERTEXP3UIPROC)(GLenum type, GLuint value);
-GLAPI PFNGLVERTEXP3UIPROC glad_glVertexP3ui;
 #define glVertexP3ui glad_glVertexP3ui
 typedef void (APIENTRYP PFNGLVERTEXP3UIVPROC)(GLenum type, const GLuint *value);
-GLAPI PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv;
 #define glVertexP3uiv glad_glVertexP3uiv
 typedef void (APIENTRYP PFNGLVERTEXP4UIPROC)(GLenum type, GLuint value);
-GLAPI PFNGLVERTEXP4UIPROC glad_glVertexP4ui;
 #define glVertexP4ui glad_glVertexP4ui
 typedef void (APIENTRYP PFNGLVERTEXP4UIVPROC)(GLenum type, const GLuint *value);
-GLAPI PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv;
 #define glVertexP4uiv glad_glVertexP4uiv
 typedef void (APIENTRYP PFNGLTEXCOORDP1UIPROC)(GLenum type, GLuint coords);
-GLAPI PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui;
 #define glTexCoordP1ui glad_glTexCoordP1ui
 typedef void (APIENTRYP PFNGLTEXCOORDP1UIVPROC)(GLenum type, const GLuint *coords);
-GLAPI PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv;
 #define glTexCoordP1uiv glad_glTexCoordP1uiv
 typedef void (APIENTRYP PFNGLTEXCOORDP2UIPROC)(GLenum type, GLuint coords);
-GLAPI PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui;
 #define glTexCoordP2ui glad_glTexCoordP2ui
 typedef void (APIENTRYP PFNGLTEXCOORDP2UIVPROC)(GLenum type, const GLuint *coords);
-GLAPI PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv;
 #define glTexCoordP2uiv glad_glTexCoordP2uiv
 typedef void (APIENTRYP PFNGLTEXCOORDP3UIPROC)(GLenum type, GLuint coords);
-GLAPI PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui;
 #define glTexCoordP3ui glad_glTexCoordP3ui
 typedef void (APIENTRYP PFNGLTEXCOORDP3UIVPROC)(GLenum type, const GLuint *coords);
-GLAPI PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv;
 #define glTexCoordP3uiv glad_glTexCoordP3uiv
 typedef void (APIENTRYP PFNGLTEXCOORDP4UIPROC)(GLenum type, GLuint coords);
-GLAPI PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui;
 #define glTexCoordP4ui glad_glTexCoordP4ui
 typedef void (APIENTRYP PFNGLTEXCOORDP4UIVPROC)(GLenum type, const GLuint *coords);
-GLAPI PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv;
 #define glTexCoordP4uiv glad_glTexCoordP4uiv
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP1UIPROC)(GLenum texture, GLenum type, GLuint coords);
-GLAPI PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui;
 #define glMultiTexCoordP1ui glad_glMultiTexCoordP1ui
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP1UIVPROC)(GLenum texture, GLenum type, const GLuint *coords);
-GLAPI PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv;
 #define glMultiTexCoordP1uiv glad_glMultiTexCoordP1uiv
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP2UIPROC)(GLenum texture, GLenum type, GLuint coords);
-GLAPI PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui;
 #define glMultiTexCoordP2ui glad_glMultiTexCoordP2ui
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP2UIVPROC)(GLenum texture, GLenum type, const GLuint *coords);
-GLAPI PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv;
 #define glMultiTexCoordP2uiv glad_glMultiTexCoordP2uiv
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP3UIPROC)(GLenum texture, GLenum type, GLuint coords);
-GLAPI PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui;
 #define glMultiTexCoordP3ui glad_glMultiTexCoordP3ui
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP3UIVPROC)(GLenum texture, GLenum type, const GLuint *coords);
-GLAPI PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv;
 #define glMultiTexCoordP3uiv glad_glMultiTexCoordP3uiv
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP4UIPROC)(GLenum texture, GLenum type, GLuint coords);
-GLAPI PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui;
 #define glMultiTexCoordP4ui glad_glMultiTexCoordP4ui
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP4UIVPROC)(GLenum texture, GLenum type, const GLuint *coords);
-GLAPI PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv;
 #define glMultiTexCoordP4uiv glad_glMultiTexCoordP4uiv
 typedef void (APIENTRYP PFNGLNORMALP3UIPROC)(GLenum type, GLuint coords);
-GLAPI PFNGLNORMALP3UIPROC glad_glNormalP3ui;
 #define glNormalP3ui glad_glNormalP3ui
 typedef void (APIENTRYP PFNGLNORMALP3UIVPROC)(GLenum type, const GLuint *coords);
-GLAPI PFNGLNORMALP3UIVPROC glad_glNormalP3uiv;
 #define glNormalP3uiv glad_glNormalP3uiv
 typedef void (APIENTRYP PFNGLCOLORP3UIPROC)(GLenum type, GLuint color);
-GLAPI PFNGLCOLORP3UIPROC glad_glColorP3ui;
 #define glColorP3ui glad_glColorP3ui
 typedef void (APIENTRYP PFNGLCOLORP3UIVPROC)(GLenum type, const GLuint *color);
-GLAPI PFNGLCOLORP3UIVPROC glad_glColorP3uiv;
 #define glColorP3uiv glad_glColorP3uiv
 typedef void (APIENTRYP PFNGLCOLORP4UIPROC)(GLenum type, GLuint color);
-GLAPI PFNGLCOLORP4UIPROC glad_glColorP4ui;
 #define glColorP4ui glad_glColorP4ui
 typedef void (APIENTRYP PFNGLCOLORP4UIVPROC)(GLenum type, const GLuint *color);
-GLAPI PFNGLCOLORP4UIVPROC glad_glColorP4uiv;
 #define glColorP4uiv glad_glColorP4uiv
 typedef void (APIENTRYP PFNGLSECONDARYCOLORP3UIPROC)(GLenum type, GLuint color);
-GLAPI PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui;
 #define glSecondaryColorP3ui glad_glSecondaryColorP3ui
 typedef void (APIENTRYP PFNGLSECONDARYCOLORP3UIVPROC)(GLenum type, const GLuint *color);
-GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
 #define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv
 #endif
+#ifndef GL_ARB_get_program_binary
+#define GL_ARB_get_program_binary 1
+typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+#define glGetProgramBinary glad_glGetProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+#define glProgramBinary glad_glProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+#define glProgramParameteri glad_glProgramParameteri
+#endif
+#ifndef GL_KHR_parallel_shader_compile
+#define GL_KHR_parallel_shader_compile 1
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+#define glMaxShaderCompilerThreadsKHR glad_glMaxShaderCompilerThreadsKHR
+#endif
+#ifndef GL_ARB_base_instance
+#define GL_ARB_base_instance 1
+typedef void (APIENTRYP PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance);
+#define glDrawArraysInstancedBaseInstance glad_glDrawArraysInstancedBaseInstance
+typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance);
+#define glDrawElementsInstancedBaseInstance glad_glDrawElementsInstancedBaseInstance
+typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance);
+#define glDrawElementsInstancedBaseVertexBaseInstance glad_glDrawElementsInstancedBaseVertexBaseInstance
+#endif
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+#define glBufferStorage glad_glBufferStorage
+#endif
+#ifndef GL_ARB_direct_state_access
+#define GL_ARB_direct_state_access 1
+typedef void (APIENTRYP PFNGLCREATETRANSFORMFEEDBACKSPROC)(GLsizei n, GLuint *ids);
+#define glCreateTransformFeedbacks glad_glCreateTransformFeedbacks
+typedef void (APIENTRYP PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)(GLuint xfb, GLuint index, GLuint buffer);
+#define glTransformFeedbackBufferBase glad_glTransformFeedbackBufferBase
+typedef void (APIENTRYP PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+#define glTransformFeedbackBufferRange glad_glTransformFeedbackBufferRange
+typedef void (APIENTRYP PFNGLGETTRANSFORMFEEDBACKIVPROC)(GLuint xfb, GLenum pname, GLint *param);
+#define glGetTransformFeedbackiv glad_glGetTransformFeedbackiv
+typedef void (APIENTRYP PFNGLCREATEBUFFERSPROC)(GLsizei n, GLuint *buffers);
+#define glCreateBuffers glad_glCreateBuffers
+typedef void (APIENTRYP PFNGLNAMEDBUFFERSTORAGEPROC)(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags);
+#define glNamedBufferStorage glad_glNamedBufferStorage
+typedef void (APIENTRYP PFNGLNAMEDBUFFERDATAPROC)(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage);
+#define glNamedBufferData glad_glNamedBufferData
+typedef void (APIENTRYP PFNGLNAMEDBUFFERSUBDATAPROC)(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data);
+#define glNamedBufferSubData glad_glNamedBufferSubData
+typedef void (APIENTRYP PFNGLCOPYNAMEDBUFFERSUBDATAPROC)(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+#define glCopyNamedBufferSubData glad_glCopyNamedBufferSubData
+typedef void (APIENTRYP PFNGLCLEARNAMEDBUFFERDATAPROC)(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data);
+#define glClearNamedBufferData glad_glClearNamedBufferData
+typedef void (APIENTRYP PFNGLCLEARNAMEDBUFFERSUBDATAPROC)(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data);
+#define glClearNamedBufferSubData glad_glClearNamedBufferSubData
+typedef void * (APIENTRYP PFNGLMAPNAMEDBUFFERPROC)(GLuint buffer, GLenum access);
+#define glMapNamedBuffer glad_glMapNamedBuffer
+typedef void * (APIENTRYP PFNGLMAPNAMEDBUFFERRANGEPROC)(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+#define glMapNamedBufferRange glad_glMapNamedBufferRange
+typedef GLboolean (APIENTRYP PFNGLUNMAPNAMEDBUFFERPROC)(GLuint buffer);
+#define glUnmapNamedBuffer glad_glUnmapNamedBuffer
+typedef void (APIENTRYP PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)(GLuint buffer, GLintptr offset, GLsizeiptr length);
+#define glFlushMappedNamedBufferRange glad_glFlushMappedNamedBufferRange
+typedef void (APIENTRYP PFNGLGETNAMEDBUFFERPARAMETERIVPROC)(GLuint buffer, GLenum pname, GLint *params);
+#define glGetNamedBufferParameteriv glad_glGetNamedBufferParameteriv
+typedef void (APIENTRYP PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)(GLuint buffer, GLenum pname, GLint64 *params);
+#define glGetNamedBufferParameteri64v glad_glGetNamedBufferParameteri64v
+typedef void (APIENTRYP PFNGLGETNAMEDBUFFERPOINTERVPROC)(GLuint buffer, GLenum pname, void **params);
+#define glGetNamedBufferPointerv glad_glGetNamedBufferPointerv
+typedef void (APIENTRYP PFNGLGETNAMEDBUFFERSUBDATAPROC)(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data);
+#define glGetNamedBufferSubData glad_glGetNamedBufferSubData
+typedef void (APIENTRYP PFNGLCREATEFRAMEBUFFERSPROC)(GLsizei n, GLuint *framebuffers);
+#define glCreateFramebuffers glad_glCreateFramebuffers
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+#define glNamedFramebufferRenderbuffer glad_glNamedFramebufferRenderbuffer
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)(GLuint framebuffer, GLenum pname, GLint param);
+#define glNamedFramebufferParameteri glad_glNamedFramebufferParameteri
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level);
+#define glNamedFramebufferTexture glad_glNamedFramebufferTexture
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer);
+#define glNamedFramebufferTextureLayer glad_glNamedFramebufferTextureLayer
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)(GLuint framebuffer, GLenum buf);
+#define glNamedFramebufferDrawBuffer glad_glNamedFramebufferDrawBuffer
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)(GLuint framebuffer, GLsizei n, const GLenum *bufs);
+#define glNamedFramebufferDrawBuffers glad_glNamedFramebufferDrawBuffers
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)(GLuint framebuffer, GLenum src);
+#define glNamedFramebufferReadBuffer glad_glNamedFramebufferReadBuffer
+typedef void (APIENTRYP PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments);
+#define glInvalidateNamedFramebufferData glad_glInvalidateNamedFramebufferData
+typedef void (APIENTRYP PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height);
+#define glInvalidateNamedFramebufferSubData glad_glInvalidateNamedFramebufferSubData
+typedef void (APIENTRYP PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value);
+#define glClearNamedFramebufferiv glad_glClearNamedFramebufferiv
+typedef void (APIENTRYP PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value);
+#define glClearNamedFramebufferuiv glad_glClearNamedFramebufferuiv
+typedef void (APIENTRYP PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value);
+#define glClearNamedFramebufferfv glad_glClearNamedFramebufferfv
+typedef void (APIENTRYP PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil);
+#define glClearNamedFramebufferfi glad_glClearNamedFramebufferfi
+typedef void (APIENTRYP PFNGLBLITNAMEDFRAMEBUFFERPROC)(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+#define glBlitNamedFramebuffer glad_glBlitNamedFramebuffer
+typedef GLenum (APIENTRYP PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)(GLuint framebuffer, GLenum target);
+#define glCheckNamedFramebufferStatus glad_glCheckNamedFramebufferStatus
+typedef void (APIENTRYP PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)(GLuint framebuffer, GLenum pname, GLint *param);
+#define glGetNamedFramebufferParameteriv glad_glGetNamedFramebufferParameteriv
+typedef void (APIENTRYP PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params);
+#define glGetNamedFramebufferAttachmentParameteriv glad_glGetNamedFramebufferAttachmentParameteriv
+typedef void (APIENTRYP PFNGLCREATERENDERBUFFERSPROC)(GLsizei n, GLuint *renderbuffers);
+#define glCreateRenderbuffers glad_glCreateRenderbuffers
+typedef void (APIENTRYP PFNGLNAMEDRENDERBUFFERSTORAGEPROC)(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height);
+#define glNamedRenderbufferStorage glad_glNamedRenderbufferStorage
+typedef void (APIENTRYP PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);
+#define glNamedRenderbufferStorageMultisample glad_glNamedRenderbufferStorageMultisample
+typedef void (APIENTRYP PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)(GLuint renderbuffer, GLenum pname, GLint *params);
+#define glGetNamedRenderbufferParameteriv glad_glGetNamedRenderbufferParameteriv
+typedef void (APIENTRYP PFNGLCREATETEXTURESPROC)(GLenum target, GLsizei n, GLuint *textures);
+#define glCreateTextures glad_glCreateTextures
+typedef void (APIENTRYP PFNGLTEXTUREBUFFERPROC)(GLuint texture, GLenum internalformat, GLuint buffer);
+#define glTextureBuffer glad_glTextureBuffer
+typedef void (APIENTRYP PFNGLTEXTUREBUFFERRANGEPROC)(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size);
+#define glTextureBufferRange glad_glTextureBufferRange
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE1DPROC)(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width);
+#define glTextureStorage1D glad_glTextureStorage1D
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE2DPROC)(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+#define glTextureStorage2D glad_glTextureStorage2D
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE3DPROC)(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth);
+#define glTextureStorage3D glad_glTextureStorage3D
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
+#define glTextureStorage2DMultisample glad_glTextureStorage2DMultisample
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
+#define glTextureStorage3DMultisample glad_glTextureStorage3DMultisample
+typedef void (APIENTRYP PFNGLTEXTURESUBIMAGE1DPROC)(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
+#define glTextureSubImage1D glad_glTextureSubImage1D
+typedef void (APIENTRYP PFNGLTEXTURESUBIMAGE2DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+#define glTextureSubImage2D glad_glTextureSubImage2D
+typedef void (APIENTRYP PFNGLTEXTURESUBIMAGE3DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
+#define glTextureSubImage3D glad_glTextureSubImage3D
+typedef void (APIENTRYP PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data);
+#define glCompressedTextureSubImage1D glad_glCompressedTextureSubImage1D
+typedef void (APIENTRYP PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
+#define glCompressedTextureSubImage2D glad_glCompressedTextureSubImage2D
+typedef void (APIENTRYP PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data);
+#define glCompressedTextureSubImage3D glad_glCompressedTextureSubImage3D
+typedef void (APIENTRYP PFNGLCOPYTEXTURESUBIMAGE1DPROC)(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
+#define glCopyTextureSubImage1D glad_glCopyTextureSubImage1D
+typedef void (APIENTRYP PFNGLCOPYTEXTURESUBIMAGE2DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+#define glCopyTextureSubImage2D glad_glCopyTextureSubImage2D
+typedef void (APIENTRYP PFNGLCOPYTEXTURESUBIMAGE3DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+#define glCopyTextureSubImage3D glad_glCopyTextureSubImage3D
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERFPROC)(GLuint texture, GLenum pname, GLfloat param);
+#define glTextureParameterf glad_glTextureParameterf
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERFVPROC)(GLuint texture, GLenum pname, const GLfloat *param);
+#define glTextureParameterfv glad_glTextureParameterfv
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERIPROC)(GLuint texture, GLenum pname, GLint param);
+#define glTextureParameteri glad_glTextureParameteri
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERIIVPROC)(GLuint texture, GLenum pname, const GLint *params);
+#define glTextureParameterIiv glad_glTextureParameterIiv
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERIUIVPROC)(GLuint texture, GLenum pname, const GLuint *params);
+#define glTextureParameterIuiv glad_glTextureParameterIuiv
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERIVPROC)(GLuint texture, GLenum pname, const GLint *param);
+#define glTextureParameteriv glad_glTextureParameteriv
+typedef void (APIENTRYP PFNGLGENERATETEXTUREMIPMAPPROC)(GLuint texture);
+#define glGenerateTextureMipmap glad_glGenerateTextureMipmap
+typedef void (APIENTRYP PFNGLBINDTEXTUREUNITPROC)(GLuint unit, GLuint texture);
+#define glBindTextureUnit glad_glBindTextureUnit
+typedef void (APIENTRYP PFNGLGETTEXTUREIMAGEPROC)(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels);
+#define glGetTextureImage glad_glGetTextureImage
+typedef void (APIENTRYP PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)(GLuint texture, GLint level, GLsizei bufSize, void *pixels);
+#define glGetCompressedTextureImage glad_glGetCompressedTextureImage
+typedef void (APIENTRYP PFNGLGETTEXTURELEVELPARAMETERFVPROC)(GLuint texture, GLint level, GLenum pname, GLfloat *params);
+#define glGetTextureLevelParameterfv glad_glGetTextureLevelParameterfv
+typedef void (APIENTRYP PFNGLGETTEXTURELEVELPARAMETERIVPROC)(GLuint texture, GLint level, GLenum pname, GLint *params);
+#define glGetTextureLevelParameteriv glad_glGetTextureLevelParameteriv
+typedef void (APIENTRYP PFNGLGETTEXTUREPARAMETERFVPROC)(GLuint texture, GLenum pname, GLfloat *params);
+#define glGetTextureParameterfv glad_glGetTextureParameterfv
+typedef void (APIENTRYP PFNGLGETTEXTUREPARAMETERIIVPROC)(GLuint texture, GLenum pname, GLint *params);
+#define glGetTextureParameterIiv glad_glGetTextureParameterIiv
+typedef void (APIENTRYP PFNGLGETTEXTUREPARAMETERIUIVPROC)(GLuint texture, GLenum pname, GLuint *params);
+#define glGetTextureParameterIuiv glad_glGetTextureParameterIuiv
+typedef void (APIENTRYP PFNGLGETTEXTUREPARAMETERIVPROC)(GLuint texture, GLenum pname, GLint *params);
+#define glGetTextureParameteriv glad_glGetTextureParameteriv
+typedef void (APIENTRYP PFNGLCREATEVERTEXARRAYSPROC)(GLsizei n, GLuint *arrays);
+#define glCreateVertexArrays glad_glCreateVertexArrays
+typedef void (APIENTRYP PFNGLDISABLEVERTEXARRAYATTRIBPROC)(GLuint vaobj, GLuint index);
+#define glDisableVertexArrayAttrib glad_glDisableVertexArrayAttrib
+typedef void (APIENTRYP PFNGLENABLEVERTEXARRAYATTRIBPROC)(GLuint vaobj, GLuint index);
+#define glEnableVertexArrayAttrib glad_glEnableVertexArrayAttrib
+typedef void (APIENTRYP PFNGLVERTEXARRAYELEMENTBUFFERPROC)(GLuint vaobj, GLuint buffer);
+#define glVertexArrayElementBuffer glad_glVertexArrayElementBuffer
+typedef void (APIENTRYP PFNGLVERTEXARRAYVERTEXBUFFERPROC)(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+#define glVertexArrayVertexBuffer glad_glVertexArrayVertexBuffer
+typedef void (APIENTRYP PFNGLVERTEXARRAYVERTEXBUFFERSPROC)(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides);
+#define glVertexArrayVertexBuffers glad_glVertexArrayVertexBuffers
+typedef void (APIENTRYP PFNGLVERTEXARRAYATTRIBBINDINGPROC)(GLuint vaobj, GLuint attribindex, GLuint bindingindex);
+#define glVertexArrayAttribBinding glad_glVertexArrayAttribBinding
+typedef void (APIENTRYP PFNGLVERTEXARRAYATTRIBFORMATPROC)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
+#define glVertexArrayAttribFormat glad_glVertexArrayAttribFormat
+typedef void (APIENTRYP PFNGLVERTEXARRAYATTRIBIFORMATPROC)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+#define glVertexArrayAttribIFormat glad_glVertexArrayAttribIFormat
+typedef void (APIENTRYP PFNGLVERTEXARRAYATTRIBLFORMATPROC)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+#define glVertexArrayAttribLFormat glad_glVertexArrayAttribLFormat
+typedef void (APIENTRYP PFNGLVERTEXARRAYBINDINGDIVISORPROC)(GLuint vaobj, GLuint bindingindex, GLuint divisor);
+#define glVertexArrayBindingDivisor glad_glVertexArrayBindingDivisor
+typedef void (APIENTRYP PFNGLGETVERTEXARRAYIVPROC)(GLuint vaobj, GLenum pname, GLint *param);
+#define glGetVertexArrayiv glad_glGetVertexArrayiv
+typedef void (APIENTRYP PFNGLGETVERTEXARRAYINDEXEDIVPROC)(GLuint vaobj, GLuint index, GLenum pname, GLint *param);
+#define glGetVertexArrayIndexediv glad_glGetVertexArrayIndexediv
+typedef void (APIENTRYP PFNGLGETVERTEXARRAYINDEXED64IVPROC)(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param);
+#define glGetVertexArrayIndexed64iv glad_glGetVertexArrayIndexed64iv
+typedef void (APIENTRYP PFNGLCREATESAMPLERSPROC)(GLsizei n, GLuint *samplers);
+#define glCreateSamplers glad_glCreateSamplers
+typedef void (APIENTRYP PFNGLCREATEPROGRAMPIPELINESPROC)(GLsizei n, GLuint *pipelines);
+#define glCreateProgramPipelines glad_glCreateProgramPipelines
+typedef void (APIENTRYP PFNGLCREATEQUERIESPROC)(GLenum target, GLsizei n, GLuint *ids);
+#define glCreateQueries glad_glCreateQueries
+typedef void (APIENTRYP PFNGLGETQUERYBUFFEROBJECTI64VPROC)(GLuint id, GLuint buffer, GLenum pname, GLintptr offset);
+#define glGetQueryBufferObjecti64v glad_glGetQueryBufferObjecti64v
+typedef void (APIENTRYP PFNGLGETQUERYBUFFEROBJECTIVPROC)(GLuint id, GLuint buffer, GLenum pname, GLintptr offset);
+#define glGetQueryBufferObjectiv glad_glGetQueryBufferObjectiv
+typedef void (APIENTRYP PFNGLGETQUERYBUFFEROBJECTUI64VPROC)(GLuint id, GLuint buffer, GLenum pname, GLintptr offset);
+#define glGetQueryBufferObjectui64v glad_glGetQueryBufferObjectui64v
+typedef void (APIENTRYP PFNGLGETQUERYBUFFEROBJECTUIVPROC)(GLuint id, GLuint buffer, GLenum pname, GLintptr offset);
+#define glGetQueryBufferObjectuiv glad_glGetQueryBufferObjectuiv
+#endif
+#ifndef GL_ARB_draw_indirect
+#define GL_ARB_draw_indirect 1
+typedef void (APIENTRYP PFNGLDRAWARRAYSINDIRECTPROC)(GLenum mode, const void *indirect);
+#define glDrawArraysIndirect glad_glDrawArraysIndirect
+typedef void (APIENTRYP PFNGLDRAWELEMENTSINDIRECTPROC)(GLenum mode, GLenum type, const void *indirect);
+#define glDrawElementsIndirect glad_glDrawElementsIndirect
+#endif
+#ifndef GL_ARB_multi_draw_indirect
+#define GL_ARB_multi_draw_indirect 1
+typedef void (APIENTRYP PFNGLMULTIDRAWARRAYSINDIRECTPROC)(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride);
+#define glMultiDrawArraysIndirect glad_glMultiDrawArraysIndirect
+typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSINDIRECTPROC)(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride);
+#define glMultiDrawElementsIndirect glad_glMultiDrawElementsIndirect
+#endif
+
+/* Dispatch table: generated from the entry points and flags above */
+typedef struct GladGLContext {
+    struct gladGLversionStruct version;
+    int max_loaded_major;
+    int max_loaded_minor;
+    GladExtensionSet extensions;
+
+    /* Lazy loading */
+    GLADloadproc lazy_loader;
+    const unsigned char *lazy_hot;
+    volatile long lazy_resolved; /* Counted atomically by every thread that resolves a stub */
+
+    int VERSION_1_0;
+    int VERSION_1_1;
+    int VERSION_1_2;
+    int VERSION_1_3;
+    int VERSION_1_4;
+    int VERSION_1_5;
+    int VERSION_2_0;
+    int VERSION_2_1;
+    int VERSION_3_0;
+    int VERSION_3_1;
+    int VERSION_3_2;
+    int VERSION_3_3;
+    int ARB_get_program_binary;
+    int KHR_parallel_shader_compile;
+    int ARB_base_instance;
+    int ARB_buffer_storage;
+    int ARB_direct_state_access;
+    int ARB_draw_indirect;
+    int ARB_multi_draw_indirect;
+
+    PFNGLCULLFACEPROC CullFace;
+    PFNGLFRONTFACEPROC FrontFace;
+    PFNGLHINTPROC Hint;
+    PFNGLLINEWIDTHPROC LineWidth;
+    PFNGLPOINTSIZEPROC PointSize;
+    PFNGLPOLYGONMODEPROC PolygonMode;
+    PFNGLSCISSORPROC Scissor;
+    PFNGLTEXPARAMETERFPROC TexParameterf;
+    PFNGLTEXPARAMETERFVPROC TexParameterfv;
+    PFNGLTEXPARAMETERIPROC TexParameteri;
+    PFNGLTEXPARAMETERIVPROC TexParameteriv;
+    PFNGLTEXIMAGE1DPROC TexImage1D;
+    PFNGLTEXIMAGE2DPROC TexImage2D;
+    PFNGLDRAWBUFFERPROC DrawBuffer;
+    PFNGLCLEARPROC Clear;
+    PFNGLCLEARCOLORPROC ClearColor;
+    PFNGLCLEARSTENCILPROC ClearStencil;
+    PFNGLCLEARDEPTHPROC ClearDepth;
+    PFNGLSTENCILMASKPROC StencilMask;
+    PFNGLCOLORMASKPROC ColorMask;
+    PFNGLDEPTHMASKPROC DepthMask;
+    PFNGLDISABLEPROC Disable;
+    PFNGLENABLEPROC Enable;
+    PFNGLFINISHPROC Finish;
+    PFNGLFLUSHPROC Flush;
+    PFNGLBLENDFUNCPROC BlendFunc;
+    PFNGLLOGICOPPROC LogicOp;
+    PFNGLSTENCILFUNCPROC StencilFunc;
+    PFNGLSTENCILOPPROC StencilOp;
+    PFNGLDEPTHFUNCPROC DepthFunc;
+    PFNGLPIXELSTOREFPROC PixelStoref;
+    PFNGLPIXELSTOREIPROC PixelStorei;
+    PFNGLREADBUFFERPROC ReadBuffer;
+    PFNGLREADPIXELSPROC ReadPixels;
+    PFNGLGETBOOLEANVPROC GetBooleanv;
+    PFNGLGETDOUBLEVPROC GetDoublev;
+    PFNGLGETERRORPROC GetError;
+    PFNGLGETFLOATVPROC GetFloatv;
+    PFNGLGETINTEGERVPROC GetIntegerv;
+    PFNGLGETSTRINGPROC GetString;
+    PFNGLGETTEXIMAGEPROC GetTexImage;
+    PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+    PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+    PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+    PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+    PFNGLISENABLEDPROC IsEnabled;
+    PFNGLDEPTHRANGEPROC DepthRange;
+    PFNGLVIEWPORTPROC Viewport;
+    PFNGLDRAWARRAYSPROC DrawArrays;
+    PFNGLDRAWELEMENTSPROC DrawElements;
+    PFNGLPOLYGONOFFSETPROC PolygonOffset;
+    PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+    PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+    PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+    PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+    PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+    PFNGLBINDTEXTUREPROC BindTexture;
+    PFNGLDELETETEXTURESPROC DeleteTextures;
+    PFNGLGENTEXTURESPROC GenTextures;
+    PFNGLISTEXTUREPROC IsTexture;
+    PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+    PFNGLTEXIMAGE3DPROC TexImage3D;
+    PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+    PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+    PFNGLACTIVETEXTUREPROC ActiveTexture;
+    PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+    PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+    PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+    PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+    PFNGLPOINTPARAMETERFPROC PointParameterf;
+    PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+    PFNGLPOINTPARAMETERIPROC PointParameteri;
+    PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+    PFNGLBLENDCOLORPROC BlendColor;
+    PFNGLBLENDEQUATIONPROC BlendEquation;
+    PFNGLGENQUERIESPROC GenQueries;
+    PFNGLDELETEQUERIESPROC DeleteQueries;
+    PFNGLISQUERYPROC IsQuery;
+    PFNGLBEGINQUERYPROC BeginQuery;
+    PFNGLENDQUERYPROC EndQuery;
+    PFNGLGETQUERYIVPROC GetQueryiv;
+    PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLGENBUFFERSPROC GenBuffers;
+    PFNGLISBUFFERPROC IsBuffer;
+    PFNGLBUFFERDATAPROC BufferData;
+    PFNGLBUFFERSUBDATAPROC BufferSubData;
+    PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+    PFNGLMAPBUFFERPROC MapBuffer;
+    PFNGLUNMAPBUFFERPROC UnmapBuffer;
+    PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+    PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+    PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+    PFNGLDRAWBUFFERSPROC DrawBuffers;
+    PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+    PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+    PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+    PFNGLATTACHSHADERPROC AttachShader;
+    PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+    PFNGLCOMPILESHADERPROC CompileShader;
+    PFNGLCREATEPROGRAMPROC CreateProgram;
+    PFNGLCREATESHADERPROC CreateShader;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    PFNGLDELETESHADERPROC DeleteShader;
+    PFNGLDETACHSHADERPROC DetachShader;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+    PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+    PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+    PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+    PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+    PFNGLGETPROGRAMIVPROC GetProgramiv;
+    PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+    PFNGLGETSHADERIVPROC GetShaderiv;
+    PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+    PFNGLGETSHADERSOURCEPROC GetShaderSource;
+    PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+    PFNGLGETUNIFORMFVPROC GetUniformfv;
+    PFNGLGETUNIFORMIVPROC GetUniformiv;
+    PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+    PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+    PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+    PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+    PFNGLISPROGRAMPROC IsProgram;
+    PFNGLISSHADERPROC IsShader;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLSHADERSOURCEPROC ShaderSource;
+    PFNGLUSEPROGRAMPROC UseProgram;
+    PFNGLUNIFORM1FPROC Uniform1f;
+    PFNGLUNIFORM2FPROC Uniform2f;
+    PFNGLUNIFORM3FPROC Uniform3f;
+    PFNGLUNIFORM4FPROC Uniform4f;
+    PFNGLUNIFORM1IPROC Uniform1i;
+    PFNGLUNIFORM2IPROC Uniform2i;
+    PFNGLUNIFORM3IPROC Uniform3i;
+    PFNGLUNIFORM4IPROC Uniform4i;
+    PFNGLUNIFORM1FVPROC Uniform1fv;
+    PFNGLUNIFORM2FVPROC Uniform2fv;
+    PFNGLUNIFORM3FVPROC Uniform3fv;
+    PFNGLUNIFORM4FVPROC Uniform4fv;
+    PFNGLUNIFORM1IVPROC Uniform1iv;
+    PFNGLUNIFORM2IVPROC Uniform2iv;
+    PFNGLUNIFORM3IVPROC Uniform3iv;
+    PFNGLUNIFORM4IVPROC Uniform4iv;
+    PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+    PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+    PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+    PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+    PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+    PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+    PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+    PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+    PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+    PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+    PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+    PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+    PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+    PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+    PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+    PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+    PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+    PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+    PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+    PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+    PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+    PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+    PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+    PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+    PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+    PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+    PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+    PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+    PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+    PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+    PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+    PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+    PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+    PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+    PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+    PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+    PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+    PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+    PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+    PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+    PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+    PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+    PFNGLCOLORMASKIPROC ColorMaski;
+    PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+    PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+    PFNGLENABLEIPROC Enablei;
+    PFNGLDISABLEIPROC Disablei;
+    PFNGLISENABLEDIPROC IsEnabledi;
+    PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+    PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+    PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+    PFNGLBINDBUFFERBASEPROC BindBufferBase;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+    PFNGLCLAMPCOLORPROC ClampColor;
+    PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+    PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+    PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+    PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+    PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+    PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+    PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+    PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+    PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+    PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+    PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+    PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+    PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+    PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+    PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+    PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+    PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+    PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+    PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+    PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+    PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+    PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+    PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+    PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+    PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+    PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+    PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+    PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+    PFNGLUNIFORM1UIPROC Uniform1ui;
+    PFNGLUNIFORM2UIPROC Uniform2ui;
+    PFNGLUNIFORM3UIPROC Uniform3ui;
+    PFNGLUNIFORM4UIPROC Uniform4ui;
+    PFNGLUNIFORM1UIVPROC Uniform1uiv;
+    PFNGLUNIFORM2UIVPROC Uniform2uiv;
+    PFNGLUNIFORM3UIVPROC Uniform3uiv;
+    PFNGLUNIFORM4UIVPROC Uniform4uiv;
+    PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+    PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+    PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+    PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+    PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+    PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+    PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+    PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+    PFNGLGETSTRINGIPROC GetStringi;
+    PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+    PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+    PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+    PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+    PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+    PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+    PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+    PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+    PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+    PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+    PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+    PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+    PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+    PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+    PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+    PFNGLISVERTEXARRAYPROC IsVertexArray;
+    PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+    PFNGLTEXBUFFERPROC TexBuffer;
+    PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+    PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+    PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+    PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+    PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+    PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+    PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+    PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+    PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+    PFNGLFENCESYNCPROC FenceSync;
+    PFNGLISSYNCPROC IsSync;
+    PFNGLDELETESYNCPROC DeleteSync;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLWAITSYNCPROC WaitSync;
+    PFNGLGETINTEGER64VPROC GetInteger64v;
+    PFNGLGETSYNCIVPROC GetSynciv;
+    PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+    PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+    PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+    PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+    PFNGLSAMPLEMASKIPROC SampleMaski;
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+    PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+    PFNGLGENSAMPLERSPROC GenSamplers;
+    PFNGLDELETESAMPLERSPROC DeleteSamplers;
+    PFNGLISSAMPLERPROC IsSampler;
+    PFNGLBINDSAMPLERPROC BindSampler;
+    PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+    PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+    PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+    PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+    PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+    PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+    PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+    PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+    PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+    PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+    PFNGLQUERYCOUNTERPROC QueryCounter;
+    PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+    PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+    PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+    PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+    PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+    PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+    PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+    PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+    PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+    PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+    PFNGLVERTEXP2UIPROC VertexP2ui;
+    PFNGLVERTEXP2UIVPROC VertexP2uiv;
+    PFNGLVERTEXP3UIPROC VertexP3ui;
+    PFNGLVERTEXP3UIVPROC VertexP3uiv;
+    PFNGLVERTEXP4UIPROC VertexP4ui;
+    PFNGLVERTEXP4UIVPROC VertexP4uiv;
+    PFNGLTEXCOORDP1UIPROC TexCoordP1ui;
+    PFNGLTEXCOORDP1UIVPROC TexCoordP1uiv;
+    PFNGLTEXCOORDP2UIPROC TexCoordP2ui;
+    PFNGLTEXCOORDP2UIVPROC TexCoordP2uiv;
+    PFNGLTEXCOORDP3UIPROC TexCoordP3ui;
+    PFNGLTEXCOORDP3UIVPROC TexCoordP3uiv;
+    PFNGLTEXCOORDP4UIPROC TexCoordP4ui;
+    PFNGLTEXCOORDP4UIVPROC TexCoordP4uiv;
+    PFNGLMULTITEXCOORDP1UIPROC MultiTexCoordP1ui;
+    PFNGLMULTITEXCOORDP1UIVPROC MultiTexCoordP1uiv;
+    PFNGLMULTITEXCOORDP2UIPROC MultiTexCoordP2ui;
+    PFNGLMULTITEXCOORDP2UIVPROC MultiTexCoordP2uiv;
+    PFNGLMULTITEXCOORDP3UIPROC MultiTexCoordP3ui;
+    PFNGLMULTITEXCOORDP3UIVPROC MultiTexCoordP3uiv;
+    PFNGLMULTITEXCOORDP4UIPROC MultiTexCoordP4ui;
+    PFNGLMULTITEXCOORDP4UIVPROC MultiTexCoordP4uiv;
+    PFNGLNORMALP3UIPROC NormalP3ui;
+    PFNGLNORMALP3UIVPROC NormalP3uiv;
+    PFNGLCOLORP3UIPROC ColorP3ui;
+    PFNGLCOLORP3UIVPROC ColorP3uiv;
+    PFNGLCOLORP4UIPROC ColorP4ui;
+    PFNGLCOLORP4UIVPROC ColorP4uiv;
+    PFNGLSECONDARYCOLORP3UIPROC SecondaryColorP3ui;
+    PFNGLSECONDARYCOLORP3UIVPROC SecondaryColorP3uiv;
+    PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+    PFNGLPROGRAMBINARYPROC ProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+    PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreadsKHR;
+    PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC DrawArraysInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC DrawElementsInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC DrawElementsInstancedBaseVertexBaseInstance;
+    PFNGLBUFFERSTORAGEPROC BufferStorage;
+    PFNGLCREATETRANSFORMFEEDBACKSPROC CreateTransformFeedbacks;
+    PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC TransformFeedbackBufferBase;
+    PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC TransformFeedbackBufferRange;
+    PFNGLGETTRANSFORMFEEDBACKIVPROC GetTransformFeedbackiv;
+    PFNGLCREATEBUFFERSPROC CreateBuffers;
+    PFNGLNAMEDBUFFERSTORAGEPROC NamedBufferStorage;
+    PFNGLNAMEDBUFFERDATAPROC NamedBufferData;
+    PFNGLNAMEDBUFFERSUBDATAPROC NamedBufferSubData;
+    PFNGLCOPYNAMEDBUFFERSUBDATAPROC CopyNamedBufferSubData;
+    PFNGLCLEARNAMEDBUFFERDATAPROC ClearNamedBufferData;
+    PFNGLCLEARNAMEDBUFFERSUBDATAPROC ClearNamedBufferSubData;
+    PFNGLMAPNAMEDBUFFERPROC MapNamedBuffer;
+    PFNGLMAPNAMEDBUFFERRANGEPROC MapNamedBufferRange;
+    PFNGLUNMAPNAMEDBUFFERPROC UnmapNamedBuffer;
+    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC FlushMappedNamedBufferRange;
+    PFNGLGETNAMEDBUFFERPARAMETERIVPROC GetNamedBufferParameteriv;
+    PFNGLGETNAMEDBUFFERPARAMETERI64VPROC GetNamedBufferParameteri64v;
+    PFNGLGETNAMEDBUFFERPOINTERVPROC GetNamedBufferPointerv;
+    PFNGLGETNAMEDBUFFERSUBDATAPROC GetNamedBufferSubData;
+    PFNGLCREATEFRAMEBUFFERSPROC CreateFramebuffers;
+    PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC NamedFramebufferRenderbuffer;
+    PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC NamedFramebufferParameteri;
+    PFNGLNAMEDFRAMEBUFFERTEXTUREPROC NamedFramebufferTexture;
+    PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC NamedFramebufferTextureLayer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC NamedFramebufferDrawBuffer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC NamedFramebufferDrawBuffers;
+    PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC NamedFramebufferReadBuffer;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC InvalidateNamedFramebufferData;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC InvalidateNamedFramebufferSubData;
+    PFNGLCLEARNAMEDFRAMEBUFFERIVPROC ClearNamedFramebufferiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC ClearNamedFramebufferuiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFVPROC ClearNamedFramebufferfv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFIPROC ClearNamedFramebufferfi;
+    PFNGLBLITNAMEDFRAMEBUFFERPROC BlitNamedFramebuffer;
+    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC CheckNamedFramebufferStatus;
+    PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC GetNamedFramebufferParameteriv;
+    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetNamedFramebufferAttachmentParameteriv;
+    PFNGLCREATERENDERBUFFERSPROC CreateRenderbuffers;
+    PFNGLNAMEDRENDERBUFFERSTORAGEPROC NamedRenderbufferStorage;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC NamedRenderbufferStorageMultisample;
+    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC GetNamedRenderbufferParameteriv;
+    PFNGLCREATETEXTURESPROC CreateTextures;
+    PFNGLTEXTUREBUFFERPROC TextureBuffer;
+    PFNGLTEXTUREBUFFERRANGEPROC TextureBufferRange;
+    PFNGLTEXTURESTORAGE1DPROC TextureStorage1D;
+    PFNGLTEXTURESTORAGE2DPROC TextureStorage2D;
+    PFNGLTEXTURESTORAGE3DPROC TextureStorage3D;
+    PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC TextureStorage2DMultisample;
+    PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC TextureStorage3DMultisample;
+    PFNGLTEXTURESUBIMAGE1DPROC TextureSubImage1D;
+    PFNGLTEXTURESUBIMAGE2DPROC TextureSubImage2D;
+    PFNGLTEXTURESUBIMAGE3DPROC TextureSubImage3D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC CompressedTextureSubImage1D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC CompressedTextureSubImage2D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC CompressedTextureSubImage3D;
+    PFNGLCOPYTEXTURESUBIMAGE1DPROC CopyTextureSubImage1D;
+    PFNGLCOPYTEXTURESUBIMAGE2DPROC CopyTextureSubImage2D;
+    PFNGLCOPYTEXTURESUBIMAGE3DPROC CopyTextureSubImage3D;
+    PFNGLTEXTUREPARAMETERFPROC TextureParameterf;
+    PFNGLTEXTUREPARAMETERFVPROC TextureParameterfv;
+    PFNGLTEXTUREPARAMETERIPROC TextureParameteri;
+    PFNGLTEXTUREPARAMETERIIVPROC TextureParameterIiv;
+    PFNGLTEXTUREPARAMETERIUIVPROC TextureParameterIuiv;
+    PFNGLTEXTUREPARAMETERIVPROC TextureParameteriv;
+    PFNGLGENERATETEXTUREMIPMAPPROC GenerateTextureMipmap;
+    PFNGLBINDTEXTUREUNITPROC BindTextureUnit;
+    PFNGLGETTEXTUREIMAGEPROC GetTextureImage;
+    PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC GetCompressedTextureImage;
+    PFNGLGETTEXTURELEVELPARAMETERFVPROC GetTextureLevelParameterfv;
+    PFNGLGETTEXTURELEVELPARAMETERIVPROC GetTextureLevelParameteriv;
+    PFNGLGETTEXTUREPARAMETERFVPROC GetTextureParameterfv;
+    PFNGLGETTEXTUREPARAMETERIIVPROC GetTextureParameterIiv;
+    PFNGLGETTEXTUREPARAMETERIUIVPROC GetTextureParameterIuiv;
+    PFNGLGETTEXTUREPARAMETERIVPROC GetTextureParameteriv;
+    PFNGLCREATEVERTEXARRAYSPROC CreateVertexArrays;
+    PFNGLDISABLEVERTEXARRAYATTRIBPROC DisableVertexArrayAttrib;
+    PFNGLENABLEVERTEXARRAYATTRIBPROC EnableVertexArrayAttrib;
+    PFNGLVERTEXARRAYELEMENTBUFFERPROC VertexArrayElementBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERPROC VertexArrayVertexBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERSPROC VertexArrayVertexBuffers;
+    PFNGLVERTEXARRAYATTRIBBINDINGPROC VertexArrayAttribBinding;
+    PFNGLVERTEXARRAYATTRIBFORMATPROC VertexArrayAttribFormat;
+    PFNGLVERTEXARRAYATTRIBIFORMATPROC VertexArrayAttribIFormat;
+    PFNGLVERTEXARRAYATTRIBLFORMATPROC VertexArrayAttribLFormat;
+    PFNGLVERTEXARRAYBINDINGDIVISORPROC VertexArrayBindingDivisor;
+    PFNGLGETVERTEXARRAYIVPROC GetVertexArrayiv;
+    PFNGLGETVERTEXARRAYINDEXEDIVPROC GetVertexArrayIndexediv;
+    PFNGLGETVERTEXARRAYINDEXED64IVPROC GetVertexArrayIndexed64iv;
+    PFNGLCREATESAMPLERSPROC CreateSamplers;
+    PFNGLCREATEPROGRAMPIPELINESPROC CreateProgramPipelines;
+    PFNGLCREATEQUERIESPROC CreateQueries;
+    PFNGLGETQUERYBUFFEROBJECTI64VPROC GetQueryBufferObjecti64v;
+    PFNGLGETQUERYBUFFEROBJECTIVPROC GetQueryBufferObjectiv;
+    PFNGLGETQUERYBUFFEROBJECTUI64VPROC GetQueryBufferObjectui64v;
+    PFNGLGETQUERYBUFFEROBJECTUIVPROC GetQueryBufferObjectuiv;
+    PFNGLDRAWARRAYSINDIRECTPROC DrawArraysIndirect;
+    PFNGLDRAWELEMENTSINDIRECTPROC DrawElementsIndirect;
+    PFNGLMULTIDRAWARRAYSINDIRECTPROC MultiDrawArraysIndirect;
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC MultiDrawElementsIndirect;
+} GladGLContext;
+
+/* Without GLAD_MX there is a single process wide table. With GLAD_MX every
+   thread calls through its own current table, which starts out as the
+   default one; see gladMakeContextCurrentGL. */
+GLAPI GladGLContext glad_gl_default_context;
+
+#ifdef GLAD_MX
+#if defined(__cplusplus)
+#define GLAD_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define GLAD_THREAD_LOCAL _Thread_local
+#else
+#define GLAD_THREAD_LOCAL __thread
+#endif
+GLAPI GLAD_THREAD_LOCAL GladGLContext *glad_gl_current_context;
+#define GLAD_GL_CONTEXT (*glad_gl_current_context)
+
+/* Selects the table used by GL calls on the calling thread. NULL selects the default table. */
+GLAPI void gladMakeContextCurrentGL(GladGLContext *context);
+GLAPI GladGLContext *gladGetCurrentContextGL(void);
+/* Frees what a load allocated for the context */
+GLAPI void gladDestroyContextGL(GladGLContext *context);
+#else
+#define GLAD_GL_CONTEXT glad_gl_default_context
+#endif
 
+#define GLVersion (GLAD_GL_CONTEXT.version)
+#define GLAD_GL_VERSION_1_0 (GLAD_GL_CONTEXT.VERSION_1_0)
+#define GLAD_GL_VERSION_1_1 (GLAD_GL_CONTEXT.VERSION_1_1)
+#define GLAD_GL_VERSION_1_2 (GLAD_GL_CONTEXT.VERSION_1_2)
+#define GLAD_GL_VERSION_1_3 (GLAD_GL_CONTEXT.VERSION_1_3)
+#define GLAD_GL_VERSION_1_4 (GLAD_GL_CONTEXT.VERSION_1_4)
+#define GLAD_GL_VERSION_1_5 (GLAD_GL_CONTEXT.VERSION_1_5)
+#define GLAD_GL_VERSION_2_0 (GLAD_GL_CONTEXT.VERSION_2_0)
+#define GLAD_GL_VERSION_2_1 (GLAD_GL_CONTEXT.VERSION_2_1)
+#define GLAD_GL_VERSION_3_0 (GLAD_GL_CONTEXT.VERSION_3_0)
+#define GLAD_GL_VERSION_3_1 (GLAD_GL_CONTEXT.VERSION_3_1)
+#define GLAD_GL_VERSION_3_2 (GLAD_GL_CONTEXT.VERSION_3_2)
+#define GLAD_GL_VERSION_3_3 (GLAD_GL_CONTEXT.VERSION_3_3)
+#define GLAD_GL_ARB_get_program_binary (GLAD_GL_CONTEXT.ARB_get_program_binary)
+#define GLAD_GL_KHR_parallel_shader_compile (GLAD_GL_CONTEXT.KHR_parallel_shader_compile)
+#define GLAD_GL_ARB_base_instance (GLAD_GL_CONTEXT.ARB_base_instance)
+#define GLAD_GL_ARB_buffer_storage (GLAD_GL_CONTEXT.ARB_buffer_storage)
+#define GLAD_GL_ARB_direct_state_access (GLAD_GL_CONTEXT.ARB_direct_state_access)
+#define GLAD_GL_ARB_draw_indirect (GLAD_GL_CONTEXT.ARB_draw_indirect)
+#define GLAD_GL_ARB_multi_draw_indirect (GLAD_GL_CONTEXT.ARB_multi_draw_indirect)
+#define glad_glCullFace (GLAD_GL_CONTEXT.CullFace)
+#define glad_glFrontFace (GLAD_GL_CONTEXT.FrontFace)
+#define glad_glHint (GLAD_GL_CONTEXT.Hint)
+#define glad_glLineWidth (GLAD_GL_CONTEXT.LineWidth)
+#define glad_glPointSize (GLAD_GL_CONTEXT.PointSize)
+#define glad_glPolygonMode (GLAD_GL_CONTEXT.PolygonMode)
+#define glad_glScissor (GLAD_GL_CONTEXT.Scissor)
+#define glad_glTexParameterf (GLAD_GL_CONTEXT.TexParameterf)
+#define glad_glTexParameterfv (GLAD_GL_CONTEXT.TexParameterfv)
+#define glad_glTexParameteri (GLAD_GL_CONTEXT.TexParameteri)
+#define glad_glTexParameteriv (GLAD_GL_CONTEXT.TexParameteriv)
+#define glad_glTexImage1D (GLAD_GL_CONTEXT.TexImage1D)
+#define glad_glTexImage2D (GLAD_GL_CONTEXT.TexImage2D)
+#define glad_glDrawBuffer (GLAD_GL_CONTEXT.DrawBuffer)
+#define glad_glClear (GLAD_GL_CONTEXT.Clear)
+#define glad_glClearColor (GLAD_GL_CONTEXT.ClearColor)
+#define glad_glClearStencil (GLAD_GL_CONTEXT.ClearStencil)
+#define glad_glClearDepth (GLAD_GL_CONTEXT.ClearDepth)
+#define glad_glStencilMask (GLAD_GL_CONTEXT.StencilMask)
+#define glad_glColorMask (GLAD_GL_CONTEXT.ColorMask)
+#define glad_glDepthMask (GLAD_GL_CONTEXT.DepthMask)
+#define glad_glDisable (GLAD_GL_CONTEXT.Disable)
+#define glad_glEnable (GLAD_GL_CONTEXT.Enable)
+#define glad_glFinish (GLAD_GL_CONTEXT.Finish)
+#define glad_glFlush (GLAD_GL_CONTEXT.Flush)
+#define glad_glBlendFunc (GLAD_GL_CONTEXT.BlendFunc)
+#define glad_glLogicOp (GLAD_GL_CONTEXT.LogicOp)
+#define glad_glStencilFunc (GLAD_GL_CONTEXT.StencilFunc)
+#define glad_glStencilOp (GLAD_GL_CONTEXT.StencilOp)
+#define glad_glDepthFunc (GLAD_GL_CONTEXT.DepthFunc)
+#define glad_glPixelStoref (GLAD_GL_CONTEXT.PixelStoref)
+#define glad_glPixelStorei (GLAD_GL_CONTEXT.PixelStorei)
+#define glad_glReadBuffer (GLAD_GL_CONTEXT.ReadBuffer)
+#define glad_glReadPixels (GLAD_GL_CONTEXT.ReadPixels)
+#define glad_glGetBooleanv (GLAD_GL_CONTEXT.GetBooleanv)
+#define glad_glGetDoublev (GLAD_GL_CONTEXT.GetDoublev)
+#define glad_glGetError (GLAD_GL_CONTEXT.GetError)
+#define glad_glGetFloatv (GLAD_GL_CONTEXT.GetFloatv)
+#define glad_glGetIntegerv (GLAD_GL_CONTEXT.GetIntegerv)
+#define glad_glGetString (GLAD_GL_CONTEXT.GetString)
+#define glad_glGetTexImage (GLAD_GL_CONTEXT.GetTexImage)
+#define glad_glGetTexParameterfv (GLAD_GL_CONTEXT.GetTexParameterfv)
+#define glad_glGetTexParameteriv (GLAD_GL_CONTEXT.GetTexParameteriv)
+#define glad_glGetTexLevelParameterfv (GLAD_GL_CONTEXT.GetTexLevelParameterfv)
+#define glad_glGetTexLevelParameteriv (GLAD_GL_CONTEXT.GetTexLevelParameteriv)
+#define glad_glIsEnabled (GLAD_GL_CONTEXT.IsEnabled)
+#define glad_glDepthRange (GLAD_GL_CONTEXT.DepthRange)
+#define glad_glViewport (GLAD_GL_CONTEXT.Viewport)
+#define glad_glDrawArrays (GLAD_GL_CONTEXT.DrawArrays)
+#define glad_glDrawElements (GLAD_GL_CONTEXT.DrawElements)
+#define glad_glPolygonOffset (GLAD_GL_CONTEXT.PolygonOffset)
+#define glad_glCopyTexImage1D (GLAD_GL_CONTEXT.CopyTexImage1D)
+#define glad_glCopyTexImage2D (GLAD_GL_CONTEXT.CopyTexImage2D)
+#define glad_glCopyTexSubImage1D (GLAD_GL_CONTEXT.CopyTexSubImage1D)
+#define glad_glCopyTexSubImage2D (GLAD_GL_CONTEXT.CopyTexSubImage2D)
+#define glad_glTexSubImage1D (GLAD_GL_CONTEXT.TexSubImage1D)
+#define glad_glTexSubImage2D (GLAD_GL_CONTEXT.TexSubImage2D)
+#define glad_glBindTexture (GLAD_GL_CONTEXT.BindTexture)
+#define glad_glDeleteTextures (GLAD_GL_CONTEXT.DeleteTextures)
+#define glad_glGenTextures (GLAD_GL_CONTEXT.GenTextures)
+#define glad_glIsTexture (GLAD_GL_CONTEXT.IsTexture)
+#define glad_glDrawRangeElements (GLAD_GL_CONTEXT.DrawRangeElements)
+#define glad_glTexImage3D (GLAD_GL_CONTEXT.TexImage3D)
+#define glad_glTexSubImage3D (GLAD_GL_CONTEXT.TexSubImage3D)
+#define glad_glCopyTexSubImage3D (GLAD_GL_CONTEXT.CopyTexSubImage3D)
+#define glad_glActiveTexture (GLAD_GL_CONTEXT.ActiveTexture)
+#define glad_glSampleCoverage (GLAD_GL_CONTEXT.SampleCoverage)
+#define glad_glCompressedTexImage3D (GLAD_GL_CONTEXT.CompressedTexImage3D)
+#define glad_glCompressedTexImage2D (GLAD_GL_CONTEXT.CompressedTexImage2D)
+#define glad_glCompressedTexImage1D (GLAD_GL_CONTEXT.CompressedTexImage1D)
+#define glad_glCompressedTexSubImage3D (GLAD_GL_CONTEXT.CompressedTexSubImage3D)
+#define glad_glCompressedTexSubImage2D (GLAD_GL_CONTEXT.CompressedTexSubImage2D)
+#define glad_glCompressedTexSubImage1D (GLAD_GL_CONTEXT.CompressedTexSubImage1D)
+#define glad_glGetCompressedTexImage (GLAD_GL_CONTEXT.GetCompressedTexImage)
+#define glad_glBlendFuncSeparate (GLAD_GL_CONTEXT.BlendFuncSeparate)
+#define glad_glMultiDrawArrays (GLAD_GL_CONTEXT.MultiDrawArrays)
+#define glad_glMultiDrawElements (GLAD_GL_CONTEXT.MultiDrawElements)
+#define glad_glPointParameterf (GLAD_GL_CONTEXT.PointParameterf)
+#define glad_glPointParameterfv (GLAD_GL_CONTEXT.PointParameterfv)
+#define glad_glPointParameteri (GLAD_GL_CONTEXT.PointParameteri)
+#define glad_glPointParameteriv (GLAD_GL_CONTEXT.PointParameteriv)
+#define glad_glBlendColor (GLAD_GL_CONTEXT.BlendColor)
+#define glad_glBlendEquation (GLAD_GL_CONTEXT.BlendEquation)
+#define glad_glGenQueries (GLAD_GL_CONTEXT.GenQueries)
+#define glad_glDeleteQueries (GLAD_GL_CONTEXT.DeleteQueries)
+#define glad_glIsQuery (GLAD_GL_CONTEXT.IsQuery)
+#define glad_glBeginQuery (GLAD_GL_CONTEXT.BeginQuery)
+#define glad_glEndQuery (GLAD_GL_CONTEXT.EndQuery)
+#define glad_glGetQueryiv (GLAD_GL_CONTEXT.GetQueryiv)
+#define glad_glGetQueryObjectiv (GLAD_GL_CONTEXT.GetQueryObjectiv)
+#define glad_glGetQueryObjectuiv (GLAD_GL_CONTEXT.GetQueryObjectuiv)
+#define glad_glBindBuffer (GLAD_GL_CONTEXT.BindBuffer)
+#define glad_glDeleteBuffers (GLAD_GL_CONTEXT.DeleteBuffers)
+#define glad_glGenBuffers (GLAD_GL_CONTEXT.GenBuffers)
+#define glad_glIsBuffer (GLAD_GL_CONTEXT.IsBuffer)
+#define glad_glBufferData (GLAD_GL_CONTEXT.BufferData)
+#define glad_glBufferSubData (GLAD_GL_CONTEXT.BufferSubData)
+#define glad_glGetBufferSubData (GLAD_GL_CONTEXT.GetBufferSubData)
+#define glad_glMapBuffer (GLAD_GL_CONTEXT.MapBuffer)
+#define glad_glUnmapBuffer (GLAD_GL_CONTEXT.UnmapBuffer)
+#define glad_glGetBufferParameteriv (GLAD_GL_CONTEXT.GetBufferParameteriv)
+#define glad_glGetBufferPointerv (GLAD_GL_CONTEXT.GetBufferPointerv)
+#define glad_glBlendEquationSeparate (GLAD_GL_CONTEXT.BlendEquationSeparate)
+#define glad_glDrawBuffers (GLAD_GL_CONTEXT.DrawBuffers)
+#define glad_glStencilOpSeparate (GLAD_GL_CONTEXT.StencilOpSeparate)
+#define glad_glStencilFuncSeparate (GLAD_GL_CONTEXT.StencilFuncSeparate)
+#define glad_glStencilMaskSeparate (GLAD_GL_CONTEXT.StencilMaskSeparate)
+#define glad_glAttachShader (GLAD_GL_CONTEXT.AttachShader)
+#define glad_glBindAttribLocation (GLAD_GL_CONTEXT.BindAttribLocation)
+#define glad_glCompileShader (GLAD_GL_CONTEXT.CompileShader)
+#define glad_glCreateProgram (GLAD_GL_CONTEXT.CreateProgram)
+#define glad_glCreateShader (GLAD_GL_CONTEXT.CreateShader)
+#define glad_glDeleteProgram (GLAD_GL_CONTEXT.DeleteProgram)
+#define glad_glDeleteShader (GLAD_GL_CONTEXT.DeleteShader)
+#define glad_glDetachShader (GLAD_GL_CONTEXT.DetachShader)
+#define glad_glDisableVertexAttribArray (GLAD_GL_CONTEXT.DisableVertexAttribArray)
+#define glad_glEnableVertexAttribArray (GLAD_GL_CONTEXT.EnableVertexAttribArray)
+#define glad_glGetActiveAttrib (GLAD_GL_CONTEXT.GetActiveAttrib)
+#define glad_glGetActiveUniform (GLAD_GL_CONTEXT.GetActiveUniform)
+#define glad_glGetAttachedShaders (GLAD_GL_CONTEXT.GetAttachedShaders)
+#define glad_glGetAttribLocation (GLAD_GL_CONTEXT.GetAttribLocation)
+#define glad_glGetProgramiv (GLAD_GL_CONTEXT.GetProgramiv)
+#define glad_glGetProgramInfoLog (GLAD_GL_CONTEXT.GetProgramInfoLog)
+#define glad_glGetShaderiv (GLAD_GL_CONTEXT.GetShaderiv)
+#define glad_glGetShaderInfoLog (GLAD_GL_CONTEXT.GetShaderInfoLog)
+#define glad_glGetShaderSource (GLAD_GL_CONTEXT.GetShaderSource)
+#define glad_glGetUniformLocation (GLAD_GL_CONTEXT.GetUniformLocation)
+#define glad_glGetUniformfv (GLAD_GL_CONTEXT.GetUniformfv)
+#define glad_glGetUniformiv (GLAD_GL_CONTEXT.GetUniformiv)
+#define glad_glGetVertexAttribdv (GLAD_GL_CONTEXT.GetVertexAttribdv)
+#define glad_glGetVertexAttribfv (GLAD_GL_CONTEXT.GetVertexAttribfv)
+#define glad_glGetVertexAttribiv (GLAD_GL_CONTEXT.GetVertexAttribiv)
+#define glad_glGetVertexAttribPointerv (GLAD_GL_CONTEXT.GetVertexAttribPointerv)
+#define glad_glIsProgram (GLAD_GL_CONTEXT.IsProgram)
+#define glad_glIsShader (GLAD_GL_CONTEXT.IsShader)
+#define glad_glLinkProgram (GLAD_GL_CONTEXT.LinkProgram)
+#define glad_glShaderSource (GLAD_GL_CONTEXT.ShaderSource)
+#define glad_glUseProgram (GLAD_GL_CONTEXT.UseProgram)
+#define glad_glUniform1f (GLAD_GL_CONTEXT.Uniform1f)
+#define glad_glUniform2f (GLAD_GL_CONTEXT.Uniform2f)
+#define glad_glUniform3f (GLAD_GL_CONTEXT.Uniform3f)
+#define glad_glUniform4f (GLAD_GL_CONTEXT.Uniform4f)
+#define glad_glUniform1i (GLAD_GL_CONTEXT.Uniform1i)
+#define glad_glUniform2i (GLAD_GL_CONTEXT.Uniform2i)
+#define glad_glUniform3i (GLAD_GL_CONTEXT.Uniform3i)
+#define glad_glUniform4i (GLAD_GL_CONTEXT.Uniform4i)
+#define glad_glUniform1fv (GLAD_GL_CONTEXT.Uniform1fv)
+#define glad_glUniform2fv (GLAD_GL_CONTEXT.Uniform2fv)
+#define glad_glUniform3fv (GLAD_GL_CONTEXT.Uniform3fv)
+#define glad_glUniform4fv (GLAD_GL_CONTEXT.Uniform4fv)
+#define glad_glUniform1iv (GLAD_GL_CONTEXT.Uniform1iv)
+#define glad_glUniform2iv (GLAD_GL_CONTEXT.Uniform2iv)
+#define glad_glUniform3iv (GLAD_GL_CONTEXT.Uniform3iv)
+#define glad_glUniform4iv (GLAD_GL_CONTEXT.Uniform4iv)
+#define glad_glUniformMatrix2fv (GLAD_GL_CONTEXT.UniformMatrix2fv)
+#define glad_glUniformMatrix3fv (GLAD_GL_CONTEXT.UniformMatrix3fv)
+#define glad_glUniformMatrix4fv (GLAD_GL_CONTEXT.UniformMatrix4fv)
+#define glad_glValidateProgram (GLAD_GL_CONTEXT.ValidateProgram)
+#define glad_glVertexAttrib1d (GLAD_GL_CONTEXT.VertexAttrib1d)
+#define glad_glVertexAttrib1dv (GLAD_GL_CONTEXT.VertexAttrib1dv)
+#define glad_glVertexAttrib1f (GLAD_GL_CONTEXT.VertexAttrib1f)
+#define glad_glVertexAttrib1fv (GLAD_GL_CONTEXT.VertexAttrib1fv)
+#define glad_glVertexAttrib1s (GLAD_GL_CONTEXT.VertexAttrib1s)
+#define glad_glVertexAttrib1sv (GLAD_GL_CONTEXT.VertexAttrib1sv)
+#define glad_glVertexAttrib2d (GLAD_GL_CONTEXT.VertexAttrib2d)
+#define glad_glVertexAttrib2dv (GLAD_GL_CONTEXT.VertexAttrib2dv)
+#define glad_glVertexAttrib2f (GLAD_GL_CONTEXT.VertexAttrib2f)
+#define glad_glVertexAttrib2fv (GLAD_GL_CONTEXT.VertexAttrib2fv)
+#define glad_glVertexAttrib2s (GLAD_GL_CONTEXT.VertexAttrib2s)
+#define glad_glVertexAttrib2sv (GLAD_GL_CONTEXT.VertexAttrib2sv)
+#define glad_glVertexAttrib3d (GLAD_GL_CONTEXT.VertexAttrib3d)
+#define glad_glVertexAttrib3dv (GLAD_GL_CONTEXT.VertexAttrib3dv)
+#define glad_glVertexAttrib3f (GLAD_GL_CONTEXT.VertexAttrib3f)
+#define glad_glVertexAttrib3fv (GLAD_GL_CONTEXT.VertexAttrib3fv)
+#define glad_glVertexAttrib3s (GLAD_GL_CONTEXT.VertexAttrib3s)
+#define glad_glVertexAttrib3sv (GLAD_GL_CONTEXT.VertexAttrib3sv)
+#define glad_glVertexAttrib4Nbv (GLAD_GL_CONTEXT.VertexAttrib4Nbv)
+#define glad_glVertexAttrib4Niv (GLAD_GL_CONTEXT.VertexAttrib4Niv)
+#define glad_glVertexAttrib4Nsv (GLAD_GL_CONTEXT.VertexAttrib4Nsv)
+#define glad_glVertexAttrib4Nub (GLAD_GL_CONTEXT.VertexAttrib4Nub)
+#define glad_glVertexAttrib4Nubv (GLAD_GL_CONTEXT.VertexAttrib4Nubv)
+#define glad_glVertexAttrib4Nuiv (GLAD_GL_CONTEXT.VertexAttrib4Nuiv)
+#define glad_glVertexAttrib4Nusv (GLAD_GL_CONTEXT.VertexAttrib4Nusv)
+#define glad_glVertexAttrib4bv (GLAD_GL_CONTEXT.VertexAttrib4bv)
+#define glad_glVertexAttrib4d (GLAD_GL_CONTEXT.VertexAttrib4d)
+#define glad_glVertexAttrib4dv (GLAD_GL_CONTEXT.VertexAttrib4dv)
+#define glad_glVertexAttrib4f (GLAD_GL_CONTEXT.VertexAttrib4f)
+#define glad_glVertexAttrib4fv (GLAD_GL_CONTEXT.VertexAttrib4fv)
+#define glad_glVertexAttrib4iv (GLAD_GL_CONTEXT.VertexAttrib4iv)
+#define glad_glVertexAttrib4s (GLAD_GL_CONTEXT.VertexAttrib4s)
+#define glad_glVertexAttrib4sv (GLAD_GL_CONTEXT.VertexAttrib4sv)
+#define glad_glVertexAttrib4ubv (GLAD_GL_CONTEXT.VertexAttrib4ubv)
+#define glad_glVertexAttrib4uiv (GLAD_GL_CONTEXT.VertexAttrib4uiv)
+#define glad_glVertexAttrib4usv (GLAD_GL_CONTEXT.VertexAttrib4usv)
+#define glad_glVertexAttribPointer (GLAD_GL_CONTEXT.VertexAttribPointer)
+#define glad_glUniformMatrix2x3fv (GLAD_GL_CONTEXT.UniformMatrix2x3fv)
+#define glad_glUniformMatrix3x2fv (GLAD_GL_CONTEXT.UniformMatrix3x2fv)
+#define glad_glUniformMatrix2x4fv (GLAD_GL_CONTEXT.UniformMatrix2x4fv)
+#define glad_glUniformMatrix4x2fv (GLAD_GL_CONTEXT.UniformMatrix4x2fv)
+#define glad_glUniformMatrix3x4fv (GLAD_GL_CONTEXT.UniformMatrix3x4fv)
+#define glad_glUniformMatrix4x3fv (GLAD_GL_CONTEXT.UniformMatrix4x3fv)
+#define glad_glColorMaski (GLAD_GL_CONTEXT.ColorMaski)
+#define glad_glGetBooleani_v (GLAD_GL_CONTEXT.GetBooleani_v)
+#define glad_glGetIntegeri_v (GLAD_GL_CONTEXT.GetIntegeri_v)
+#define glad_glEnablei (GLAD_GL_CONTEXT.Enablei)
+#define glad_glDisablei (GLAD_GL_CONTEXT.Disablei)
+#define glad_glIsEnabledi (GLAD_GL_CONTEXT.IsEnabledi)
+#define glad_glBeginTransformFeedback (GLAD_GL_CONTEXT.BeginTransformFeedback)
+#define glad_glEndTransformFeedback (GLAD_GL_CONTEXT.EndTransformFeedback)
+#define glad_glBindBufferRange (GLAD_GL_CONTEXT.BindBufferRange)
+#define glad_glBindBufferBase (GLAD_GL_CONTEXT.BindBufferBase)
+#define glad_glTransformFeedbackVaryings (GLAD_GL_CONTEXT.TransformFeedbackVaryings)
+#define glad_glGetTransformFeedbackVarying (GLAD_GL_CONTEXT.GetTransformFeedbackVarying)
+#define glad_glClampColor (GLAD_GL_CONTEXT.ClampColor)
+#define glad_glBeginConditionalRender (GLAD_GL_CONTEXT.BeginConditionalRender)
+#define glad_glEndConditionalRender (GLAD_GL_CONTEXT.EndConditionalRender)
+#define glad_glVertexAttribIPointer (GLAD_GL_CONTEXT.VertexAttribIPointer)
+#define glad_glGetVertexAttribIiv (GLAD_GL_CONTEXT.GetVertexAttribIiv)
+#define glad_glGetVertexAttribIuiv (GLAD_GL_CONTEXT.GetVertexAttribIuiv)
+#define glad_glVertexAttribI1i (GLAD_GL_CONTEXT.VertexAttribI1i)
+#define glad_glVertexAttribI2i (GLAD_GL_CONTEXT.VertexAttribI2i)
+#define glad_glVertexAttribI3i (GLAD_GL_CONTEXT.VertexAttribI3i)
+#define glad_glVertexAttribI4i (GLAD_GL_CONTEXT.VertexAttribI4i)
+#define glad_glVertexAttribI1ui (GLAD_GL_CONTEXT.VertexAttribI1ui)
+#define glad_glVertexAttribI2ui (GLAD_GL_CONTEXT.VertexAttribI2ui)
+#define glad_glVertexAttribI3ui (GLAD_GL_CONTEXT.VertexAttribI3ui)
+#define glad_glVertexAttribI4ui (GLAD_GL_CONTEXT.VertexAttribI4ui)
+#define glad_glVertexAttribI1iv (GLAD_GL_CONTEXT.VertexAttribI1iv)
+#define glad_glVertexAttribI2iv (GLAD_GL_CONTEXT.VertexAttribI2iv)
+#define glad_glVertexAttribI3iv (GLAD_GL_CONTEXT.VertexAttribI3iv)
+#define glad_glVertexAttribI4iv (GLAD_GL_CONTEXT.VertexAttribI4iv)
+#define glad_glVertexAttribI1uiv (GLAD_GL_CONTEXT.VertexAttribI1uiv)
+#define glad_glVertexAttribI2uiv (GLAD_GL_CONTEXT.VertexAttribI2uiv)
+#define glad_glVertexAttribI3uiv (GLAD_GL_CONTEXT.VertexAttribI3uiv)
+#define glad_glVertexAttribI4uiv (GLAD_GL_CONTEXT.VertexAttribI4uiv)
+#define glad_glVertexAttribI4bv (GLAD_GL_CONTEXT.VertexAttribI4bv)
+#define glad_glVertexAttribI4sv (GLAD_GL_CONTEXT.VertexAttribI4sv)
+#define glad_glVertexAttribI4ubv (GLAD_GL_CONTEXT.VertexAttribI4ubv)
+#define glad_glVertexAttribI4usv (GLAD_GL_CONTEXT.VertexAttribI4usv)
+#define glad_glGetUniformuiv (GLAD_GL_CONTEXT.GetUniformuiv)
+#define glad_glBindFragDataLocation (GLAD_GL_CONTEXT.BindFragDataLocation)
+#define glad_glGetFragDataLocation (GLAD_GL_CONTEXT.GetFragDataLocation)
+#define glad_glUniform1ui (GLAD_GL_CONTEXT.Uniform1ui)
+#define glad_glUniform2ui (GLAD_GL_CONTEXT.Uniform2ui)
+#define glad_glUniform3ui (GLAD_GL_CONTEXT.Uniform3ui)
+#define glad_glUniform4ui (GLAD_GL_CONTEXT.Uniform4ui)
+#define glad_glUniform1uiv (GLAD_GL_CONTEXT.Uniform1uiv)
+#define glad_glUniform2uiv (GLAD_GL_CONTEXT.Uniform2uiv)
+#define glad_glUniform3uiv (GLAD_GL_CONTEXT.Uniform3uiv)
+#define glad_glUniform4uiv (GLAD_GL_CONTEXT.Uniform4uiv)
+#define glad_glTexParameterIiv (GLAD_GL_CONTEXT.TexParameterIiv)
+#define glad_glTexParameterIuiv (GLAD_GL_CONTEXT.TexParameterIuiv)
+#define glad_glGetTexParameterIiv (GLAD_GL_CONTEXT.GetTexParameterIiv)
+#define glad_glGetTexParameterIuiv (GLAD_GL_CONTEXT.GetTexParameterIuiv)
+#define glad_glClearBufferiv (GLAD_GL_CONTEXT.ClearBufferiv)
+#define glad_glClearBufferuiv (GLAD_GL_CONTEXT.ClearBufferuiv)
+#define glad_glClearBufferfv (GLAD_GL_CONTEXT.ClearBufferfv)
+#define glad_glClearBufferfi (GLAD_GL_CONTEXT.ClearBufferfi)
+#define glad_glGetStringi (GLAD_GL_CONTEXT.GetStringi)
+#define glad_glIsRenderbuffer (GLAD_GL_CONTEXT.IsRenderbuffer)
+#define glad_glBindRenderbuffer (GLAD_GL_CONTEXT.BindRenderbuffer)
+#define glad_glDeleteRenderbuffers (GLAD_GL_CONTEXT.DeleteRenderbuffers)
+#define glad_glGenRenderbuffers (GLAD_GL_CONTEXT.GenRenderbuffers)
+#define glad_glRenderbufferStorage (GLAD_GL_CONTEXT.RenderbufferStorage)
+#define glad_glGetRenderbufferParameteriv (GLAD_GL_CONTEXT.GetRenderbufferParameteriv)
+#define glad_glIsFramebuffer (GLAD_GL_CONTEXT.IsFramebuffer)
+#define glad_glBindFramebuffer (GLAD_GL_CONTEXT.BindFramebuffer)
+#define glad_glDeleteFramebuffers (GLAD_GL_CONTEXT.DeleteFramebuffers)
+#define glad_glGenFramebuffers (GLAD_GL_CONTEXT.GenFramebuffers)
+#define glad_glCheckFramebufferStatus (GLAD_GL_CONTEXT.CheckFramebufferStatus)
+#define glad_glFramebufferTexture1D (GLAD_GL_CONTEXT.FramebufferTexture1D)
+#define glad_glFramebufferTexture2D (GLAD_GL_CONTEXT.FramebufferTexture2D)
+#define glad_glFramebufferTexture3D (GLAD_GL_CONTEXT.FramebufferTexture3D)
+#define glad_glFramebufferRenderbuffer (GLAD_GL_CONTEXT.FramebufferRenderbuffer)
+#define glad_glGetFramebufferAttachmentParameteriv (GLAD_GL_CONTEXT.GetFramebufferAttachmentParameteriv)
+#define glad_glGenerateMipmap (GLAD_GL_CONTEXT.GenerateMipmap)
+#define glad_glBlitFramebuffer (GLAD_GL_CONTEXT.BlitFramebuffer)
+#define glad_glRenderbufferStorageMultisample (GLAD_GL_CONTEXT.RenderbufferStorageMultisample)
+#define glad_glFramebufferTextureLayer (GLAD_GL_CONTEXT.FramebufferTextureLayer)
+#define glad_glMapBufferRange (GLAD_GL_CONTEXT.MapBufferRange)
+#define glad_glFlushMappedBufferRange (GLAD_GL_CONTEXT.FlushMappedBufferRange)
+#define glad_glBindVertexArray (GLAD_GL_CONTEXT.BindVertexArray)
+#define glad_glDeleteVertexArrays (GLAD_GL_CONTEXT.DeleteVertexArrays)
+#define glad_glGenVertexArrays (GLAD_GL_CONTEXT.GenVertexArrays)
+#define glad_glIsVertexArray (GLAD_GL_CONTEXT.IsVertexArray)
+#define glad_glDrawArraysInstanced (GLAD_GL_CONTEXT.DrawArraysInstanced)
+#define glad_glDrawElementsInstanced (GLAD_GL_CONTEXT.DrawElementsInstanced)
+#define glad_glTexBuffer (GLAD_GL_CONTEXT.TexBuffer)
+#define glad_glPrimitiveRestartIndex (GLAD_GL_CONTEXT.PrimitiveRestartIndex)
+#define glad_glCopyBufferSubData (GLAD_GL_CONTEXT.CopyBufferSubData)
+#define glad_glGetUniformIndices (GLAD_GL_CONTEXT.GetUniformIndices)
+#define glad_glGetActiveUniformsiv (GLAD_GL_CONTEXT.GetActiveUniformsiv)
+#define glad_glGetActiveUniformName (GLAD_GL_CONTEXT.GetActiveUniformName)
+#define glad_glGetUniformBlockIndex (GLAD_GL_CONTEXT.GetUniformBlockIndex)
+#define glad_glGetActiveUniformBlockiv (GLAD_GL_CONTEXT.GetActiveUniformBlockiv)
+#define glad_glGetActiveUniformBlockName (GLAD_GL_CONTEXT.GetActiveUniformBlockName)
+#define glad_glUniformBlockBinding (GLAD_GL_CONTEXT.UniformBlockBinding)
+#define glad_glDrawElementsBaseVertex (GLAD_GL_CONTEXT.DrawElementsBaseVertex)
+#define glad_glDrawRangeElementsBaseVertex (GLAD_GL_CONTEXT.DrawRangeElementsBaseVertex)
+#define glad_glDrawElementsInstancedBaseVertex (GLAD_GL_CONTEXT.DrawElementsInstancedBaseVertex)
+#define glad_glMultiDrawElementsBaseVertex (GLAD_GL_CONTEXT.MultiDrawElementsBaseVertex)
+#define glad_glProvokingVertex (GLAD_GL_CONTEXT.ProvokingVertex)
+#define glad_glFenceSync (GLAD_GL_CONTEXT.FenceSync)
+#define glad_glIsSync (GLAD_GL_CONTEXT.IsSync)
+#define glad_glDeleteSync (GLAD_GL_CONTEXT.DeleteSync)
+#define glad_glClientWaitSync (GLAD_GL_CONTEXT.ClientWaitSync)
+#define glad_glWaitSync (GLAD_GL_CONTEXT.WaitSync)
+#define glad_glGetInteger64v (GLAD_GL_CONTEXT.GetInteger64v)
+#define glad_glGetSynciv (GLAD_GL_CONTEXT.GetSynciv)
+#define glad_glGetInteger64i_v (GLAD_GL_CONTEXT.GetInteger64i_v)
+#define glad_glGetBufferParameteri64v (GLAD_GL_CONTEXT.GetBufferParameteri64v)
+#define glad_glFramebufferTexture (GLAD_GL_CONTEXT.FramebufferTexture)
+#define glad_glTexImage2DMultisample (GLAD_GL_CONTEXT.TexImage2DMultisample)
+#define glad_glTexImage3DMultisample (GLAD_GL_CONTEXT.TexImage3DMultisample)
+#define glad_glGetMultisamplefv (GLAD_GL_CONTEXT.GetMultisamplefv)
+#define glad_glSampleMaski (GLAD_GL_CONTEXT.SampleMaski)
+#define glad_glBindFragDataLocationIndexed (GLAD_GL_CONTEXT.BindFragDataLocationIndexed)
+#define glad_glGetFragDataIndex (GLAD_GL_CONTEXT.GetFragDataIndex)
+#define glad_glGenSamplers (GLAD_GL_CONTEXT.GenSamplers)
+#define glad_glDeleteSamplers (GLAD_GL_CONTEXT.DeleteSamplers)
+#define glad_glIsSampler (GLAD_GL_CONTEXT.IsSampler)
+#define glad_glBindSampler (GLAD_GL_CONTEXT.BindSampler)
+#define glad_glSamplerParameteri (GLAD_GL_CONTEXT.SamplerParameteri)
+#define glad_glSamplerParameteriv (GLAD_GL_CONTEXT.SamplerParameteriv)
+#define glad_glSamplerParameterf (GLAD_GL_CONTEXT.SamplerParameterf)
+#define glad_glSamplerParameterfv (GLAD_GL_CONTEXT.SamplerParameterfv)
+#define glad_glSamplerParameterIiv (GLAD_GL_CONTEXT.SamplerParameterIiv)
+#define glad_glSamplerParameterIuiv (GLAD_GL_CONTEXT.SamplerParameterIuiv)
+#define glad_glGetSamplerParameteriv (GLAD_GL_CONTEXT.GetSamplerParameteriv)
+#define glad_glGetSamplerParameterIiv (GLAD_GL_CONTEXT.GetSamplerParameterIiv)
+#define glad_glGetSamplerParameterfv (GLAD_GL_CONTEXT.GetSamplerParameterfv)
+#define glad_glGetSamplerParameterIuiv (GLAD_GL_CONTEXT.GetSamplerParameterIuiv)
+#define glad_glQueryCounter (GLAD_GL_CONTEXT.QueryCounter)
+#define glad_glGetQueryObjecti64v (GLAD_GL_CONTEXT.GetQueryObjecti64v)
+#define glad_glGetQueryObjectui64v (GLAD_GL_CONTEXT.GetQueryObjectui64v)
+#define glad_glVertexAttribDivisor (GLAD_GL_CONTEXT.VertexAttribDivisor)
+#define glad_glVertexAttribP1ui (GLAD_GL_CONTEXT.VertexAttribP1ui)
+#define glad_glVertexAttribP1uiv (GLAD_GL_CONTEXT.VertexAttribP1uiv)
+#define glad_glVertexAttribP2ui (GLAD_GL_CONTEXT.VertexAttribP2ui)
+#define glad_glVertexAttribP2uiv (GLAD_GL_CONTEXT.VertexAttribP2uiv)
+#define glad_glVertexAttribP3ui (GLAD_GL_CONTEXT.VertexAttribP3ui)
+#define glad_glVertexAttribP3uiv (GLAD_GL_CONTEXT.VertexAttribP3uiv)
+#define glad_glVertexAttribP4ui (GLAD_GL_CONTEXT.VertexAttribP4ui)
+#define glad_glVertexAttribP4uiv (GLAD_GL_CONTEXT.VertexAttribP4uiv)
+#define glad_glVertexP2ui (GLAD_GL_CONTEXT.VertexP2ui)
+#define glad_glVertexP2uiv (GLAD_GL_CONTEXT.VertexP2uiv)
+#define glad_glVertexP3ui (GLAD_GL_CONTEXT.VertexP3ui)
+#define glad_glVertexP3uiv (GLAD_GL_CONTEXT.VertexP3uiv)
+#define glad_glVertexP4ui (GLAD_GL_CONTEXT.VertexP4ui)
+#define glad_glVertexP4uiv (GLAD_GL_CONTEXT.VertexP4uiv)
+#define glad_glTexCoordP1ui (GLAD_GL_CONTEXT.TexCoordP1ui)
+#define glad_glTexCoordP1uiv (GLAD_GL_CONTEXT.TexCoordP1uiv)
+#define glad_glTexCoordP2ui (GLAD_GL_CONTEXT.TexCoordP2ui)
+#define glad_glTexCoordP2uiv (GLAD_GL_CONTEXT.TexCoordP2uiv)
+#define glad_glTexCoordP3ui (GLAD_GL_CONTEXT.TexCoordP3ui)
+#define glad_glTexCoordP3uiv (GLAD_GL_CONTEXT.TexCoordP3uiv)
+#define glad_glTexCoordP4ui (GLAD_GL_CONTEXT.TexCoordP4ui)
+#define glad_glTexCoordP4uiv (GLAD_GL_CONTEXT.TexCoordP4uiv)
+#define glad_glMultiTexCoordP1ui (GLAD_GL_CONTEXT.MultiTexCoordP1ui)
+#define glad_glMultiTexCoordP1uiv (GLAD_GL_CONTEXT.MultiTexCoordP1uiv)
+#define glad_glMultiTexCoordP2ui (GLAD_GL_CONTEXT.MultiTexCoordP2ui)
+#define glad_glMultiTexCoordP2uiv (GLAD_GL_CONTEXT.MultiTexCoordP2uiv)
+#define glad_glMultiTexCoordP3ui (GLAD_GL_CONTEXT.MultiTexCoordP3ui)
+#define glad_glMultiTexCoordP3uiv (GLAD_GL_CONTEXT.MultiTexCoordP3uiv)
+#define glad_glMultiTexCoordP4ui (GLAD_GL_CONTEXT.MultiTexCoordP4ui)
+#define glad_glMultiTexCoordP4uiv (GLAD_GL_CONTEXT.MultiTexCoordP4uiv)
+#define glad_glNormalP3ui (GLAD_GL_CONTEXT.NormalP3ui)
+#define glad_glNormalP3uiv (GLAD_GL_CONTEXT.NormalP3uiv)
+#define glad_glColorP3ui (GLAD_GL_CONTEXT.ColorP3ui)
+#define glad_glColorP3uiv (GLAD_GL_CONTEXT.ColorP3uiv)
+#define glad_glColorP4ui (GLAD_GL_CONTEXT.ColorP4ui)
+#define glad_glColorP4uiv (GLAD_GL_CONTEXT.ColorP4uiv)
+#define glad_glSecondaryColorP3ui (GLAD_GL_CONTEXT.SecondaryColorP3ui)
+#define glad_glSecondaryColorP3uiv (GLAD_GL_CONTEXT.SecondaryColorP3uiv)
+#define glad_glGetProgramBinary (GLAD_GL_CONTEXT.GetProgramBinary)
+#define glad_glProgramBinary (GLAD_GL_CONTEXT.ProgramBinary)
+#define glad_glProgramParameteri (GLAD_GL_CONTEXT.ProgramParameteri)
+#define glad_glMaxShaderCompilerThreadsKHR (GLAD_GL_CONTEXT.MaxShaderCompilerThreadsKHR)
+#define glad_glDrawArraysInstancedBaseInstance (GLAD_GL_CONTEXT.DrawArraysInstancedBaseInstance)
+#define glad_glDrawElementsInstancedBaseInstance (GLAD_GL_CONTEXT.DrawElementsInstancedBaseInstance)
+#define glad_glDrawElementsInstancedBaseVertexBaseInstance (GLAD_GL_CONTEXT.DrawElementsInstancedBaseVertexBaseInstance)
+#define glad_glBufferStorage (GLAD_GL_CONTEXT.BufferStorage)
+#define glad_glCreateTransformFeedbacks (GLAD_GL_CONTEXT.CreateTransformFeedbacks)
+#define glad_glTransformFeedbackBufferBase (GLAD_GL_CONTEXT.TransformFeedbackBufferBase)
+#define glad_glTransformFeedbackBufferRange (GLAD_GL_CONTEXT.TransformFeedbackBufferRange)
+#define glad_glGetTransformFeedbackiv (GLAD_GL_CONTEXT.GetTransformFeedbackiv)
+#define glad_glCreateBuffers (GLAD_GL_CONTEXT.CreateBuffers)
+#define glad_glNamedBufferStorage (GLAD_GL_CONTEXT.NamedBufferStorage)
+#define glad_glNamedBufferData (GLAD_GL_CONTEXT.NamedBufferData)
+#define glad_glNamedBufferSubData (GLAD_GL_CONTEXT.NamedBufferSubData)
+#define glad_glCopyNamedBufferSubData (GLAD_GL_CONTEXT.CopyNamedBufferSubData)
+#define glad_glClearNamedBufferData (GLAD_GL_CONTEXT.ClearNamedBufferData)
+#define glad_glClearNamedBufferSubData (GLAD_GL_CONTEXT.ClearNamedBufferSubData)
+#define glad_glMapNamedBuffer (GLAD_GL_CONTEXT.MapNamedBuffer)
+#define glad_glMapNamedBufferRange (GLAD_GL_CONTEXT.MapNamedBufferRange)
+#define glad_glUnmapNamedBuffer (GLAD_GL_CONTEXT.UnmapNamedBuffer)
+#define glad_glFlushMappedNamedBufferRange (GLAD_GL_CONTEXT.FlushMappedNamedBufferRange)
+#define glad_glGetNamedBufferParameteriv (GLAD_GL_CONTEXT.GetNamedBufferParameteriv)
+#define glad_glGetNamedBufferParameteri64v (GLAD_GL_CONTEXT.GetNamedBufferParameteri64v)
+#define glad_glGetNamedBufferPointerv (GLAD_GL_CONTEXT.GetNamedBufferPointerv)
+#define glad_glGetNamedBufferSubData (GLAD_GL_CONTEXT.GetNamedBufferSubData)
+#define glad_glCreateFramebuffers (GLAD_GL_CONTEXT.CreateFramebuffers)
+#define glad_glNamedFramebufferRenderbuffer (GLAD_GL_CONTEXT.NamedFramebufferRenderbuffer)
+#define glad_glNamedFramebufferParameteri (GLAD_GL_CONTEXT.NamedFramebufferParameteri)
+#define glad_glNamedFramebufferTexture (GLAD_GL_CONTEXT.NamedFramebufferTexture)
+#define glad_glNamedFramebufferTextureLayer (GLAD_GL_CONTEXT.NamedFramebufferTextureLayer)
+#define glad_glNamedFramebufferDrawBuffer (GLAD_GL_CONTEXT.NamedFramebufferDrawBuffer)
+#define glad_glNamedFramebufferDrawBuffers (GLAD_GL_CONTEXT.NamedFramebufferDrawBuffers)
+#define glad_glNamedFramebufferReadBuffer (GLAD_GL_CONTEXT.NamedFramebufferReadBuffer)
+#define glad_glInvalidateNamedFramebufferData (GLAD_GL_CONTEXT.InvalidateNamedFramebufferData)
+#define glad_glInvalidateNamedFramebufferSubData (GLAD_GL_CONTEXT.InvalidateNamedFramebufferSubData)
+#define glad_glClearNamedFramebufferiv (GLAD_GL_CONTEXT.ClearNamedFramebufferiv)
+#define glad_glClearNamedFramebufferuiv (GLAD_GL_CONTEXT.ClearNamedFramebufferuiv)
+#define glad_glClearNamedFramebufferfv (GLAD_GL_CONTEXT.ClearNamedFramebufferfv)
+#define glad_glClearNamedFramebufferfi (GLAD_GL_CONTEXT.ClearNamedFramebufferfi)
+#define glad_glBlitNamedFramebuffer (GLAD_GL_CONTEXT.BlitNamedFramebuffer)
+#define glad_glCheckNamedFramebufferStatus (GLAD_GL_CONTEXT.CheckNamedFramebufferStatus)
+#define glad_glGetNamedFramebufferParameteriv (GLAD_GL_CONTEXT.GetNamedFramebufferParameteriv)
+#define glad_glGetNamedFramebufferAttachmentParameteriv (GLAD_GL_CONTEXT.GetNamedFramebufferAttachmentParameteriv)
+#define glad_glCreateRenderbuffers (GLAD_GL_CONTEXT.CreateRenderbuffers)
+#define glad_glNamedRenderbufferStorage (GLAD_GL_CONTEXT.NamedRenderbufferStorage)
+#define glad_glNamedRenderbufferStorageMultisample (GLAD_GL_CONTEXT.NamedRenderbufferStorageMultisample)
+#define glad_glGetNamedRenderbufferParameteriv (GLAD_GL_CONTEXT.GetNamedRenderbufferParameteriv)
+#define glad_glCreateTextures (GLAD_GL_CONTEXT.CreateTextures)
+#define glad_glTextureBuffer (GLAD_GL_CONTEXT.TextureBuffer)
+#define glad_glTextureBufferRange (GLAD_GL_CONTEXT.TextureBufferRange)
+#define glad_glTextureStorage1D (GLAD_GL_CONTEXT.TextureStorage1D)
+#define glad_glTextureStorage2D (GLAD_GL_CONTEXT.TextureStorage2D)
+#define glad_glTextureStorage3D (GLAD_GL_CONTEXT.TextureStorage3D)
+#define glad_glTextureStorage2DMultisample (GLAD_GL_CONTEXT.TextureStorage2DMultisample)
+#define glad_glTextureStorage3DMultisample (GLAD_GL_CONTEXT.TextureStorage3DMultisample)
+#define glad_glTextureSubImage1D (GLAD_GL_CONTEXT.TextureSubImage1D)
+#define glad_glTextureSubImage2D (GLAD_GL_CONTEXT.TextureSubImage2D)
+#define glad_glTextureSubImage3D (GLAD_GL_CONTEXT.TextureSubImage3D)
+#define glad_glCompressedTextureSubImage1D (GLAD_GL_CONTEXT.CompressedTextureSubImage1D)
+#define glad_glCompressedTextureSubImage2D (GLAD_GL_CONTEXT.CompressedTextureSubImage2D)
+#define glad_glCompressedTextureSubImage3D (GLAD_GL_CONTEXT.CompressedTextureSubImage3D)
+#define glad_glCopyTextureSubImage1D (GLAD_GL_CONTEXT.CopyTextureSubImage1D)
+#define glad_glCopyTextureSubImage2D (GLAD_GL_CONTEXT.CopyTextureSubImage2D)
+#define glad_glCopyTextureSubImage3D (GLAD_GL_CONTEXT.CopyTextureSubImage3D)
+#define glad_glTextureParameterf (GLAD_GL_CONTEXT.TextureParameterf)
+#define glad_glTextureParameterfv (GLAD_GL_CONTEXT.TextureParameterfv)
+#define glad_glTextureParameteri (GLAD_GL_CONTEXT.TextureParameteri)
+#define glad_glTextureParameterIiv (GLAD_GL_CONTEXT.TextureParameterIiv)
+#define glad_glTextureParameterIuiv (GLAD_GL_CONTEXT.TextureParameterIuiv)
+#define glad_glTextureParameteriv (GLAD_GL_CONTEXT.TextureParameteriv)
+#define glad_glGenerateTextureMipmap (GLAD_GL_CONTEXT.GenerateTextureMipmap)
+#define glad_glBindTextureUnit (GLAD_GL_CONTEXT.BindTextureUnit)
+#define glad_glGetTextureImage (GLAD_GL_CONTEXT.GetTextureImage)
+#define glad_glGetCompressedTextureImage (GLAD_GL_CONTEXT.GetCompressedTextureImage)
+#define glad_glGetTextureLevelParameterfv (GLAD_GL_CONTEXT.GetTextureLevelParameterfv)
+#define glad_glGetTextureLevelParameteriv (GLAD_GL_CONTEXT.GetTextureLevelParameteriv)
+#define glad_glGetTextureParameterfv (GLAD_GL_CONTEXT.GetTextureParameterfv)
+#define glad_glGetTextureParameterIiv (GLAD_GL_CONTEXT.GetTextureParameterIiv)
+#define glad_glGetTextureParameterIuiv (GLAD_GL_CONTEXT.GetTextureParameterIuiv)
+#define glad_glGetTextureParameteriv (GLAD_GL_CONTEXT.GetTextureParameteriv)
+#define glad_glCreateVertexArrays (GLAD_GL_CONTEXT.CreateVertexArrays)
+#define glad_glDisableVertexArrayAttrib (GLAD_GL_CONTEXT.DisableVertexArrayAttrib)
+#define glad_glEnableVertexArrayAttrib (GLAD_GL_CONTEXT.EnableVertexArrayAttrib)
+#define glad_glVertexArrayElementBuffer (GLAD_GL_CONTEXT.VertexArrayElementBuffer)
+#define glad_glVertexArrayVertexBuffer (GLAD_GL_CONTEXT.VertexArrayVertexBuffer)
+#define glad_glVertexArrayVertexBuffers (GLAD_GL_CONTEXT.VertexArrayVertexBuffers)
+#define glad_glVertexArrayAttribBinding (GLAD_GL_CONTEXT.VertexArrayAttribBinding)
+#define glad_glVertexArrayAttribFormat (GLAD_GL_CONTEXT.VertexArrayAttribFormat)
+#define glad_glVertexArrayAttribIFormat (GLAD_GL_CONTEXT.VertexArrayAttribIFormat)
+#define glad_glVertexArrayAttribLFormat (GLAD_GL_CONTEXT.VertexArrayAttribLFormat)
+#define glad_glVertexArrayBindingDivisor (GLAD_GL_CONTEXT.VertexArrayBindingDivisor)
+#define glad_glGetVertexArrayiv (GLAD_GL_CONTEXT.GetVertexArrayiv)
+#define glad_glGetVertexArrayIndexediv (GLAD_GL_CONTEXT.GetVertexArrayIndexediv)
+#define glad_glGetVertexArrayIndexed64iv (GLAD_GL_CONTEXT.GetVertexArrayIndexed64iv)
+#define glad_glCreateSamplers (GLAD_GL_CONTEXT.CreateSamplers)
+#define glad_glCreateProgramPipelines (GLAD_GL_CONTEXT.CreateProgramPipelines)
+#define glad_glCreateQueries (GLAD_GL_CONTEXT.CreateQueries)
+#define glad_glGetQueryBufferObjecti64v (GLAD_GL_CONTEXT.GetQueryBufferObjecti64v)
+#define glad_glGetQueryBufferObjectiv (GLAD_GL_CONTEXT.GetQueryBufferObjectiv)
+#define glad_glGetQueryBufferObjectui64v (GLAD_GL_CONTEXT.GetQueryBufferObjectui64v)
+#define glad_glGetQueryBufferObjectuiv (GLAD_GL_CONTEXT.GetQueryBufferObjectuiv)
+#define glad_glDrawArraysIndirect (GLAD_GL_CONTEXT.DrawArraysIndirect)
+#define glad_glDrawElementsIndirect (GLAD_GL_CONTEXT.DrawElementsIndirect)
+#define glad_glMultiDrawArraysIndirect (GLAD_GL_CONTEXT.MultiDrawArraysIndirect)
+#define glad_glMultiDrawElementsIndirect (GLAD_GL_CONTEXT.MultiDrawElementsIndirect)
+/* End of dispatch table */
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,52 @@
+/*
+
+    Extension set shared by the glad GL and WGL loaders.
+
+    The names are copied into a single allocation together with an open
+    addressing hash table, so building a set costs one malloc and a lookup
+    is a hash plus (usually) one string compare. The loaders keep the set
+    after loading, so extensions can be queried at any time afterwards.
+
+*/
+
+#ifndef __glad_exts_h_
+#define __glad_exts_h_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    unsigned int hash;
+    unsigned int offset; /* Into names, plus one; zero marks an empty slot */
+} GladExtensionSlot;
+
+typedef struct {
+    void *block;               /* Slots followed by the names */
+    GladExtensionSlot *slots;
+    char *names;
+    unsigned int slot_count;   /* Power of two */
+    unsigned int count;
+    size_t names_used;
+    int allocations;           /* Made by the last build */
+} GladExtensionSet;
+
+typedef const char* (* GLADextensionproc)(unsigned int index, void *user);
+
+/* Builds from a space separated list, as returned by glGetString(GL_EXTENSIONS) or wglGetExtensionsString */
+int glad_exts_build_from_string(GladExtensionSet *set, const char *extensions);
+
+/* Builds from `count` names returned one at a time, as by glGetStringi */
+int glad_exts_build_from_list(GladExtensionSet *set, unsigned int count, GLADextensionproc get, void *user);
+
+int glad_exts_has(const GladExtensionSet *set, const char *name);
+
+void glad_exts_free(GladExtensionSet *set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
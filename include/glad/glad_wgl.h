@@ -89,6 +89,9 @@ GLAPI void gladUnloadWGL(void);
 
 GLAPI int gladLoadWGLLoader(GLADloadproc, HDC hdc);
 
+/* Extensions found by the last load. Kept until the next load. */
+GLAPI int gladHasWGLExtension(const char *ext);
+
 struct _GPU_DEVICE {
     DWORD  cb;
     CHAR   DeviceName[32];
@@ -0,0 +1,16 @@
+#!/bin/sh
+# Builds the X11/GLX version of the window on Linux, and the stand-in window
+# manager for testing its resize sync. Needs Xlib with the SYNC extension
+# (libXext) and a GL 3.3 core driver (Mesa's llvmpipe works without a GPU,
+# e.g. under Xvfb). Run from the root of the repo. Add defines such as
+# -DNO_VSYNC to CFLAGS.
+
+mkdir -p build
+
+cmd="cc -O2 $CFLAGS -DGLAD_MX -Iinclude -Isrc linux/x11_main.c linux/handshake.c linux/scene.c src/glad.c src/glad_exts.c -o build/smooth_sizing_x11 -lGL -lX11 -lXext -lpthread -ldl -lm"
+echo $cmd
+$cmd
+
+cmd="cc -O2 linux/sync_wm.c linux/handshake.c -o build/sync_wm -lX11 -lXext -lpthread -lm"
+echo $cmd
+$cmd
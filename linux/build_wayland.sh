@@ -0,0 +1,16 @@
+#!/bin/sh
+# Builds the Wayland/EGL version of the window on Linux. Needs the Wayland
+# client and EGL libraries, wayland-scanner and wayland-protocols (for
+# xdg-shell), and a GL 3.3 core driver (Mesa's llvmpipe works without a GPU,
+# e.g. under weston's headless backend). Run from the root of the repo. Add
+# defines such as -DNO_VSYNC to CFLAGS.
+
+mkdir -p build
+
+protocols=$(pkg-config --variable=pkgdatadir wayland-protocols)
+wayland-scanner client-header "$protocols/stable/xdg-shell/xdg-shell.xml" build/xdg-shell-client-protocol.h
+wayland-scanner private-code "$protocols/stable/xdg-shell/xdg-shell.xml" build/xdg-shell-protocol.c
+
+cmd="cc -O2 $CFLAGS -DGLAD_MX -Iinclude -Isrc -Ibuild linux/wayland_main.c linux/handshake.c linux/scene.c build/xdg-shell-protocol.c src/glad.c src/glad_exts.c -o build/smooth_sizing_wayland -lwayland-client -lwayland-egl -lEGL -lpthread -ldl -lm"
+echo $cmd
+$cmd
@@ -0,0 +1,211 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "handshake.h"
+
+static const float pi = 3.14159265358979f;
+
+void window_data_init(WindowData *window, int width, int height) {
+    memset(window, 0, sizeof(*window));
+    get_time_now(); // Starts the clock before there is a second thread to race for it
+    pthread_mutex_init(&window->mutex, NULL);
+
+    // Timed waits measure against the monotonic clock, like get_time_now
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&window->wake_render, &attr);
+    pthread_cond_init(&window->frame_done, &attr);
+    pthread_condattr_destroy(&attr);
+
+    window->width = width;
+    window->height = height;
+    window->wake_fd = -1;
+}
+
+void window_data_destroy(WindowData *window) {
+    pthread_cond_destroy(&window->frame_done);
+    pthread_cond_destroy(&window->wake_render);
+    pthread_mutex_destroy(&window->mutex);
+}
+
+// --------------------------------------------------
+// ----- Event thread
+// --------------------------------------------------
+// Called with the lock held, after setting flags
+static void wake_render_thread(WindowData *window) {
+    pthread_cond_signal(&window->wake_render);
+    if (window->wake_fd >= 0) {
+        uint64_t one = 1;
+        ssize_t written = write(window->wake_fd, &one, sizeof(one));
+        (void)written; // Only fails when the counter is already far from zero
+    }
+}
+
+void window_set_size(WindowData *window, int width, int height) {
+    pthread_mutex_lock(&window->mutex);
+    window->width = width;
+    window->height = height;
+    pthread_mutex_unlock(&window->mutex);
+}
+
+void window_post_flags(WindowData *window, uint32_t flags) {
+    pthread_mutex_lock(&window->mutex);
+    window->flags |= flags;
+    wake_render_thread(window);
+    pthread_mutex_unlock(&window->mutex);
+}
+
+double window_paint(WindowData *window) {
+    pthread_mutex_lock(&window->mutex);
+
+    bool resized = (window->width != window->new_width) | (window->height != window->new_height);
+    if (resized) {
+        window->new_width = window->width;
+        window->new_height = window->height;
+        window->flags |= EVENT_SIZECHANGED;
+    }
+    window->flags |= EVENT_PAINT;
+    uint64_t paint = ++window->paints_posted;
+
+    double start = get_time_now();
+    wake_render_thread(window);
+    while (window->paints_done < paint && !window->render_stopped) {
+        pthread_cond_wait(&window->frame_done, &window->mutex);
+    }
+    double waited = get_time_now() - start;
+    if (window->paints_done < paint) waited = -1.0; // Stopped before drawing it
+
+    if (resized && waited >= 0.0) {
+        window->resize_count++;
+        window->resize_seconds += waited;
+        if (waited > window->resize_max_seconds) window->resize_max_seconds = waited;
+    }
+    pthread_mutex_unlock(&window->mutex);
+    return waited;
+}
+
+// --------------------------------------------------
+// ----- Render thread
+// --------------------------------------------------
+uint32_t take_window_flags(WindowData *window, bool wait, int timeout_ms, float *sleep_time) {
+    pthread_mutex_lock(&window->mutex);
+
+    *sleep_time = 0;
+    if (wait && !window->flags) {
+        double before_sleep_time = get_time_now();
+        if (timeout_ms < 0) {
+            pthread_cond_wait(&window->wake_render, &window->mutex);
+        } else {
+            struct timespec deadline;
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_sec += timeout_ms / 1000;
+            deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+            if (deadline.tv_nsec >= 1000000000) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000;
+            }
+            pthread_cond_timedwait(&window->wake_render, &window->mutex, &deadline);
+        }
+        *sleep_time = (float)(get_time_now() - before_sleep_time);
+    }
+
+    uint32_t flags = window->flags; // Cache this frame's flags
+    window->flags = 0;              // Reset next frame's flags
+    window->paints_taken = window->paints_posted;
+
+    pthread_mutex_unlock(&window->mutex);
+    return flags;
+}
+
+void window_get_size(WindowData *window, int *width, int *height) {
+    pthread_mutex_lock(&window->mutex);
+    *width = window->width;
+    *height = window->height;
+    pthread_mutex_unlock(&window->mutex);
+}
+
+void window_frame_done(WindowData *window) {
+    pthread_mutex_lock(&window->mutex);
+    if (window->paints_done != window->paints_taken) {
+        window->paints_done = window->paints_taken;
+        pthread_cond_broadcast(&window->frame_done);
+    }
+    pthread_mutex_unlock(&window->mutex);
+}
+
+void window_render_stopped(WindowData *window) {
+    pthread_mutex_lock(&window->mutex);
+    window->render_stopped = true;
+    pthread_cond_broadcast(&window->frame_done);
+    pthread_mutex_unlock(&window->mutex);
+}
+
+// --------------------------------------------------
+// ----- Shared
+// --------------------------------------------------
+double get_time_now(void) {
+    static double start = -1.0;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    double now = (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+    if (start < 0.0) start = now;
+    return now - start;
+}
+
+void report_resize_latency(WindowData *window) {
+    pthread_mutex_lock(&window->mutex);
+    uint64_t count = window->resize_count;
+    double seconds = window->resize_seconds;
+    double max_seconds = window->resize_max_seconds;
+    pthread_mutex_unlock(&window->mutex);
+
+    if (!count) return;
+    printf("Resizes: %llu (avg wait %.2f ms, max %.2f ms)\n", (unsigned long long)count,
+           1000.0 * seconds / (double)count, 1000.0 * max_seconds);
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+void report_samples(const char *label, double *samples, int count) {
+    if (!count) return;
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += samples[i];
+    qsort(samples, count, sizeof(double), compare_doubles);
+    printf("  %-18s min %8.3f  median %8.3f  p95 %8.3f  max %8.3f  mean %8.3f ms\n", label, samples[0],
+           samples[count / 2], samples[(int)((count - 1) * 0.95)], samples[count - 1], sum / count);
+}
+
+void drag_size(int step, int *width, int *height) {
+    int phase = step % 160;
+    int offset = phase < 80 ? phase * 8 : (160 - phase) * 8;
+    *width = 640 + offset;
+    *height = 480 + offset * 3 / 4;
+}
+
+float quad_modifier(float time) {
+    return 0.25f * sinf(4.0f * (time + pi / 8.0f)) + 0.75f;
+}
+
+float background_color(float time) {
+    return 1 - (0.5f * sinf(2.0f * time + pi / 2.0f) + 0.5f);
+}
+
+void advance_animation(float *time, float *start_time, float sleep_time, bool animating) {
+    float end_time = (float)get_time_now();
+    if (animating) {
+        *time += end_time - *start_time - sleep_time;
+        if (*time > 2 * pi) {
+            *time -= (2 * pi);
+        }
+    }
+    *start_time = end_time;
+}
@@ -0,0 +1,88 @@
+#ifndef HANDSHAKE_H
+#define HANDSHAKE_H
+
+// The render thread handshake of src/main.c on pthreads, for the Linux
+// backends. The event thread plays WindowProc: it records size changes as
+// they arrive and, on a paint, blocks until the render thread has finished a
+// frame that took the paint into account. The render thread takes the flags,
+// draws at the latest size, and marks the paint done once the frame is on
+// screen.
+//
+// Waiting goes through pthread condition variables, which glibc builds on
+// futexes, so a blocked thread sleeps in the kernel until it is woken.
+// Paints are numbered, so the event thread only returns for a frame that was
+// started after its paint was posted, not for one already in flight.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+enum {
+    EVENT_TERMINATE       = 1 << 0,
+    EVENT_SIZECHANGED     = 1 << 1,
+    EVENT_TOGGLEANIMATION = 1 << 2,
+    EVENT_PAINT           = 1 << 3,
+};
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t wake_render; // Flags were set
+    pthread_cond_t frame_done;  // A paint was finished, or the render thread stopped
+    int width;                  // Latest size the window system reported
+    int height;
+    int new_width;              // Size as of the last paint
+    int new_height;
+    uint32_t flags;
+    int wake_fd; // An eventfd also signalled when flags are posted, for a render thread in poll(); -1 if none
+
+    uint64_t paints_posted;
+    uint64_t paints_taken; // By the frame the render thread is drawing
+    uint64_t paints_done;
+    bool render_stopped;
+
+    // How long paints at a new size waited for their frame
+    uint64_t resize_count;
+    double resize_seconds;
+    double resize_max_seconds;
+} WindowData;
+
+void window_data_init(WindowData *window, int width, int height);
+void window_data_destroy(WindowData *window);
+
+// ----- Event thread
+void window_set_size(WindowData *window, int width, int height);
+void window_post_flags(WindowData *window, uint32_t flags);
+
+// Blocks until the render thread has finished a frame for this paint, and
+// returns how long that took. Returns at once with a negative time when the
+// render thread has stopped.
+double window_paint(WindowData *window);
+
+// ----- Render thread
+// Takes the flags set for this frame and clears them. Unless told not to
+// wait, sleeps until there are some or until timeout_ms (negative waits
+// forever), and reports how long it slept.
+uint32_t take_window_flags(WindowData *window, bool wait, int timeout_ms, float *sleep_time);
+void window_get_size(WindowData *window, int *width, int *height);
+
+// Releases the paints taken with the last flags; call once the frame is presented
+void window_frame_done(WindowData *window);
+void window_render_stopped(WindowData *window);
+
+// ----- Shared
+double get_time_now(void);
+void report_resize_latency(WindowData *window);
+
+// Prints samples in ms as min/median/p95/max/mean. Sorts them in place.
+void report_samples(const char *label, double *samples, int count);
+
+// The scripted drag every resize benchmark follows, so their numbers compare:
+// grows the window from 640x480 to 1280x960 and back every 160 steps
+void drag_size(int step, int *width, int *height);
+
+// The scene's animation, as in src/main.c
+float quad_modifier(float time);
+float background_color(float time);
+void advance_animation(float *time, float *start_time, float sleep_time, bool animating);
+
+#endif
@@ -0,0 +1,126 @@
+#include <stdio.h>
+
+#include "scene.h"
+
+static const char *vertex_shader_source =
+    "#version 330 core\n"
+
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+
+    "out vec3 color;\n"
+
+    "uniform float modifier;\n"
+
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.x * modifier, aPos.y * modifier, aPos.z, 1.0);\n"
+    "    color = aColor;\n"
+    "}\0";
+
+static const char *fragment_shader_source =
+    "#version 330 core\n"
+
+    "in vec3 color;\n"
+    "out vec4 fragColor;\n"
+
+    "void main()\n"
+    "{\n"
+    "    fragColor = vec4(color, 1.0f);\n"
+    "}\n\0";
+
+static const float vertices[] = {         // (x, y, z, r, g, b)
+     0.5f,  0.5f, 0.0f, 1.0f, 0.0f, 0.0f, // top right
+     0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // bottom right
+    -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 1.0f, // bottom left
+    -0.5f,  0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // top left
+};
+
+static const GLuint indices[] = {
+    0, 1, 2, // first triangle
+    0, 2, 3, // second triangle
+};
+
+static GLuint compile_shader(GLenum type, const char *source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        char info_log[512];
+        glGetShaderInfoLog(shader, sizeof(info_log), NULL, info_log);
+        fprintf(stderr, "Shader compilation failed: %s\n", info_log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+bool scene_init(Scene *scene) {
+    GLuint vertex_shader = compile_shader(GL_VERTEX_SHADER, vertex_shader_source);
+    GLuint fragment_shader = compile_shader(GL_FRAGMENT_SHADER, fragment_shader_source);
+    if (!vertex_shader || !fragment_shader) return false;
+
+    scene->program = glCreateProgram();
+    glAttachShader(scene->program, vertex_shader);
+    glAttachShader(scene->program, fragment_shader);
+    glLinkProgram(scene->program);
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+
+    GLint success;
+    glGetProgramiv(scene->program, GL_LINK_STATUS, &success);
+    if (!success) {
+        char info_log[512];
+        glGetProgramInfoLog(scene->program, sizeof(info_log), NULL, info_log);
+        fprintf(stderr, "Program linking failed: %s\n", info_log);
+        return false;
+    }
+    scene->modifier_location = glGetUniformLocation(scene->program, "modifier");
+
+    glGenVertexArrays(1, &scene->vao);
+    glGenBuffers(1, &scene->vbo);
+    glGenBuffers(1, &scene->ebo);
+
+    glBindVertexArray(scene->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, scene->vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, scene->ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+    return true;
+}
+
+void scene_destroy(Scene *scene) {
+    glDeleteBuffers(1, &scene->ebo);
+    glDeleteBuffers(1, &scene->vbo);
+    glDeleteVertexArrays(1, &scene->vao);
+    glDeleteProgram(scene->program);
+}
+
+void scene_draw(const Scene *scene, int width, int height, float background, float modifier) {
+    glViewport(0, 0, width, height);
+    glClearColor(background, background, background, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(scene->program);
+    glUniform1f(scene->modifier_location, modifier);
+    glBindVertexArray(scene->vao);
+    glDrawElements(GL_TRIANGLES, sizeof(indices) / sizeof(indices[0]), GL_UNSIGNED_INT, 0);
+    glBindVertexArray(0);
+}
+
+void scene_finish(void) {
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (fence) {
+        glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        glDeleteSync(fence);
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+// The quad and background of src/main.c, drawn straight to the default
+// framebuffer, for the Linux backends. Needs a current GL 3.3 core context
+// with glad loaded.
+
+#include <stdbool.h>
+
+#include "glad/glad.h"
+
+typedef struct {
+    GLuint program;
+    GLint modifier_location;
+    GLuint vao;
+    GLuint vbo;
+    GLuint ebo;
+} Scene;
+
+bool scene_init(Scene *scene);
+void scene_destroy(Scene *scene);
+
+void scene_draw(const Scene *scene, int width, int height, float background, float modifier);
+
+// Blocks until the GPU has finished everything submitted so far, so a frame
+// counts as done when it is on screen rather than queued
+void scene_finish(void);
+
+#endif
@@ -0,0 +1,318 @@
+// A stand-in window manager for testing _NET_WM_SYNC_REQUEST, for servers
+// without one such as Xvfb. It manages the first window that is mapped, and
+// configures it the way a window manager resizing a window interactively
+// does: a numbered sync request, then the configure, then nothing more until
+// the window has set its XSync counter to that number. It reports how long
+// each counter update took, from the window manager's side.
+//
+// Usage: sync_wm [--resizes N] [--csv]
+//
+// Resize requests the window makes itself go through the same steps. With
+// --resizes N, it drags the window along the same path as the window's
+// --resize-bench once the window is mapped, then closes it and exits.
+// Without, it runs until the window is destroyed.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <poll.h>
+#include <time.h>
+
+#include <X11/Xatom.h>
+#include <X11/Xlib.h>
+#include <X11/Xproto.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/sync.h>
+
+#include "handshake.h"
+
+#define SYNC_TIMEOUT_MS 1000
+
+typedef struct {
+    Display *display;
+    int sync_event_base;
+    Atom wm_protocols;
+    Atom wm_delete_window;
+    Atom net_wm_sync_request;
+    Atom net_wm_sync_request_counter;
+
+    Window client;            // None until one is mapped
+    XSyncCounter counter;     // None when the client doesn't take part
+    XSyncAlarm alarm;
+    int64_t sync_value;       // Last value requested
+    int64_t counter_value;    // Last value the alarm reported
+    bool client_gone;
+    bool other_wm;
+
+    double *latency_ms;
+    int latency_count;
+    int latency_capacity;
+    int timeouts;
+} SyncWM;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static SyncWM *error_wm; // Where the error handler reports to
+
+static int handle_x_error(Display *display, XErrorEvent *error) {
+    (void)display;
+    // Selecting substructure redirect on the root fails when it is taken
+    if (error->error_code == BadAccess && error->request_code == X_ChangeWindowAttributes) {
+        error_wm->other_wm = true;
+    } else if (error->resourceid == error_wm->client) {
+        error_wm->client_gone = true;
+    }
+    return 0;
+}
+
+static int64_t value_to_int64(XSyncValue value) {
+    return (int64_t)XSyncValueHigh32(value) << 32 | XSyncValueLow32(value);
+}
+
+static XSyncValue int64_to_value(int64_t number) {
+    XSyncValue value;
+    XSyncIntsToValue(&value, (unsigned int)(number & 0xFFFFFFFF), (int)(number >> 32));
+    return value;
+}
+
+// Reads the client's counter, if it offers the sync protocol
+static void find_sync_counter(SyncWM *wm) {
+    wm->counter = None;
+
+    Atom *protocols = NULL;
+    int protocol_count = 0;
+    bool offered = false;
+    if (XGetWMProtocols(wm->display, wm->client, &protocols, &protocol_count)) {
+        for (int i = 0; i < protocol_count; i++) offered |= protocols[i] == wm->net_wm_sync_request;
+        XFree(protocols);
+    }
+    if (!offered) return;
+
+    Atom type;
+    int format;
+    unsigned long count, remaining;
+    unsigned char *data = NULL;
+    if (XGetWindowProperty(wm->display, wm->client, wm->net_wm_sync_request_counter, 0, 1, False, XA_CARDINAL,
+                           &type, &format, &count, &remaining, &data) == Success && data) {
+        if (type == XA_CARDINAL && format == 32 && count == 1) wm->counter = (XSyncCounter)*(unsigned long*)data;
+        XFree(data);
+    }
+    if (wm->counter == None) return;
+
+    // Notifies us whenever the counter reaches the value last requested
+    XSyncValue current;
+    wm->counter_value = XSyncQueryCounter(wm->display, wm->counter, &current) ? value_to_int64(current) : 0;
+    wm->sync_value = wm->counter_value;
+
+    XSyncAlarmAttributes attributes;
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.trigger.counter = wm->counter;
+    attributes.trigger.value_type = XSyncAbsolute;
+    attributes.trigger.wait_value = int64_to_value(wm->sync_value + 1);
+    attributes.trigger.test_type = XSyncPositiveComparison;
+    XSyncIntToValue(&attributes.delta, 0);
+    attributes.events = True;
+    wm->alarm = XSyncCreateAlarm(wm->display,
+                                 XSyncCACounter | XSyncCAValueType | XSyncCAValue | XSyncCATestType |
+                                 XSyncCADelta | XSyncCAEvents,
+                                 &attributes);
+}
+
+static void handle_event(SyncWM *wm, XEvent *event);
+
+// Handles events until there are none left, waiting up to timeout_ms
+// (negative waits forever) for the first
+static void pump_events(SyncWM *wm, int timeout_ms) {
+    if (!XPending(wm->display)) {
+        struct pollfd fd = { ConnectionNumber(wm->display), POLLIN, 0 };
+        if (poll(&fd, 1, timeout_ms) <= 0) return;
+    }
+    while (XPending(wm->display)) {
+        XEvent event;
+        XNextEvent(wm->display, &event);
+        handle_event(wm, &event);
+    }
+}
+
+// Configures the client the way an interactive resize does, and waits for
+// the client to say it has drawn the result
+static void configure_synced(SyncWM *wm, unsigned int mask, XWindowChanges *changes) {
+    if (wm->counter == None) {
+        XConfigureWindow(wm->display, wm->client, mask, changes);
+        XFlush(wm->display);
+        return;
+    }
+
+    int64_t value = ++wm->sync_value;
+    XEvent request;
+    memset(&request, 0, sizeof(request));
+    request.xclient.type = ClientMessage;
+    request.xclient.window = wm->client;
+    request.xclient.message_type = wm->wm_protocols;
+    request.xclient.format = 32;
+    request.xclient.data.l[0] = (long)wm->net_wm_sync_request;
+    request.xclient.data.l[1] = CurrentTime;
+    request.xclient.data.l[2] = (long)(value & 0xFFFFFFFF);
+    request.xclient.data.l[3] = (long)(value >> 32);
+    XSendEvent(wm->display, wm->client, False, NoEventMask, &request);
+
+    XSyncAlarmAttributes attributes;
+    attributes.trigger.wait_value = int64_to_value(value);
+    XSyncChangeAlarm(wm->display, wm->alarm, XSyncCAValue, &attributes);
+
+    double start = now_seconds();
+    XConfigureWindow(wm->display, wm->client, mask, changes);
+    XFlush(wm->display);
+
+    double deadline = start + SYNC_TIMEOUT_MS / 1000.0;
+    while (wm->counter_value < value && !wm->client_gone) {
+        int remaining_ms = (int)(1000.0 * (deadline - now_seconds()));
+        if (remaining_ms <= 0) {
+            wm->timeouts++;
+            return;
+        }
+        pump_events(wm, remaining_ms);
+    }
+    if (wm->client_gone) return;
+
+    if (wm->latency_count == wm->latency_capacity) {
+        wm->latency_capacity = wm->latency_capacity ? 2 * wm->latency_capacity : 256;
+        wm->latency_ms = (double*)realloc(wm->latency_ms, wm->latency_capacity * sizeof(double));
+    }
+    wm->latency_ms[wm->latency_count++] = 1000.0 * (now_seconds() - start);
+}
+
+static void handle_event(SyncWM *wm, XEvent *event) {
+    if (event->type == wm->sync_event_base + XSyncAlarmNotify) {
+        XSyncAlarmNotifyEvent *notify = (XSyncAlarmNotifyEvent*)event;
+        int64_t value = value_to_int64(notify->counter_value);
+        if (value > wm->counter_value) wm->counter_value = value;
+        return;
+    }
+
+    switch (event->type) {
+    case MapRequest: {
+        if (wm->client == None) {
+            wm->client = event->xmaprequest.window;
+            XSelectInput(wm->display, wm->client, StructureNotifyMask);
+            find_sync_counter(wm);
+            printf("Managing window 0x%lx, %s\n", (unsigned long)wm->client,
+                   wm->counter != None ? "with a sync counter" : "without the sync protocol");
+        }
+        XMapWindow(wm->display, event->xmaprequest.window);
+        break;
+    }
+
+    case ConfigureRequest: {
+        XConfigureRequestEvent *request = &event->xconfigurerequest;
+        XWindowChanges changes;
+        changes.x = request->x;
+        changes.y = request->y;
+        changes.width = request->width;
+        changes.height = request->height;
+        changes.border_width = request->border_width;
+        changes.sibling = request->above;
+        changes.stack_mode = request->detail;
+        if (request->window == wm->client && (request->value_mask & (CWWidth | CWHeight))) {
+            configure_synced(wm, (unsigned int)request->value_mask, &changes);
+        } else {
+            XConfigureWindow(wm->display, request->window, (unsigned int)request->value_mask, &changes);
+        }
+        break;
+    }
+
+    case DestroyNotify: {
+        if (event->xdestroywindow.window == wm->client) wm->client_gone = true;
+        break;
+    }
+    }
+}
+
+static void close_client(SyncWM *wm) {
+    XEvent event;
+    memset(&event, 0, sizeof(event));
+    event.xclient.type = ClientMessage;
+    event.xclient.window = wm->client;
+    event.xclient.message_type = wm->wm_protocols;
+    event.xclient.format = 32;
+    event.xclient.data.l[0] = (long)wm->wm_delete_window;
+    event.xclient.data.l[1] = CurrentTime;
+    XSendEvent(wm->display, wm->client, False, NoEventMask, &event);
+    XFlush(wm->display);
+}
+
+int main(int argc, char **argv) {
+    int resize_count = 0;
+    bool csv = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--resizes") == 0 && i + 1 < argc) {
+            resize_count = atoi(argv[++i]);
+            if (resize_count < 1) resize_count = 1;
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else {
+            fprintf(stderr, "Usage: %s [--resizes N] [--csv]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    SyncWM wm;
+    memset(&wm, 0, sizeof(wm));
+    wm.display = XOpenDisplay(NULL);
+    if (!wm.display) {
+        fprintf(stderr, "Could not open the X display\n");
+        return 1;
+    }
+    int sync_error_base, sync_major, sync_minor;
+    if (!XSyncQueryExtension(wm.display, &wm.sync_event_base, &sync_error_base) ||
+        !XSyncInitialize(wm.display, &sync_major, &sync_minor)) {
+        fprintf(stderr, "The X server has no SYNC extension\n");
+        return 1;
+    }
+    wm.wm_protocols = XInternAtom(wm.display, "WM_PROTOCOLS", False);
+    wm.wm_delete_window = XInternAtom(wm.display, "WM_DELETE_WINDOW", False);
+    wm.net_wm_sync_request = XInternAtom(wm.display, "_NET_WM_SYNC_REQUEST", False);
+    wm.net_wm_sync_request_counter = XInternAtom(wm.display, "_NET_WM_SYNC_REQUEST_COUNTER", False);
+
+    error_wm = &wm;
+    XSetErrorHandler(handle_x_error);
+    XSelectInput(wm.display, DefaultRootWindow(wm.display), SubstructureRedirectMask | SubstructureNotifyMask);
+    XSync(wm.display, False);
+    if (wm.other_wm) {
+        fprintf(stderr, "Another window manager is running\n");
+        return 1;
+    }
+    printf("Waiting for a window\n");
+    fflush(stdout);
+
+    while (wm.client == None) pump_events(&wm, -1);
+
+    if (resize_count) {
+        for (int i = 0; i < resize_count && !wm.client_gone; i++) {
+            XWindowChanges changes;
+            drag_size(i, &changes.width, &changes.height);
+            int sample = wm.latency_count;
+            configure_synced(&wm, CWWidth | CWHeight, &changes);
+            if (csv && wm.latency_count > sample) {
+                printf("sync,%d,%d,%d,%.4f\n", i, changes.width, changes.height, wm.latency_ms[sample]);
+            }
+        }
+        if (!wm.client_gone) close_client(&wm);
+    }
+    while (!wm.client_gone) pump_events(&wm, -1);
+
+    printf("Synced configures: %d, %d not answered within %d ms\n", wm.latency_count, wm.timeouts,
+           SYNC_TIMEOUT_MS);
+    report_samples("request to counter", wm.latency_ms, wm.latency_count);
+
+    free(wm.latency_ms);
+    XCloseDisplay(wm.display);
+    return wm.timeouts ? 1 : 0;
+}
@@ -0,0 +1,595 @@
+// The window of src/main.c on Wayland, with EGL: an event thread that owns
+// the toplevel and a render thread that owns the GL context, kept in step by
+// the same handshake as on Windows and X11 (see handshake.h).
+//
+// Usage: smooth_sizing_wayland [--resize-bench N] [--csv]
+//
+// xdg_toplevel.configure plays WM_SIZE and xdg_surface.configure plays
+// WM_PAINT: the event thread posts a paint and waits while the render thread
+// resizes the EGL window, draws, acks the configure and commits, so the
+// commit that acks a configure is always the first one at its size. The
+// compositor never sees a buffer of the wrong size.
+//
+// Frames are paced by wl_surface.frame callbacks instead of the swap
+// interval: while animating, the render thread waits for the callback of the
+// previous frame (up to a second, since a hidden surface may never get one)
+// before drawing the next. A paint posted during that wait ends it through an
+// eventfd, so paints don't wait for callbacks. The time from each commit to
+// its callback is recorded; it is how long the compositor took to use the
+// frame.
+//
+// --resize-bench N resizes the window N times along a scripted drag, which a
+// floating toplevel may do on its own, and reports the time from each new
+// size to its commit. Space toggles the animation and Escape closes the
+// window. Statistics go to stdout once a second.
+
+#include <linux/input-event-codes.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "glad/glad.h"
+
+// Before EGL, so EGL's native types are Wayland's
+#include <wayland-client.h>
+#include <wayland-egl.h>
+
+#include <EGL/egl.h>
+
+#include "xdg-shell-client-protocol.h"
+
+#include "handshake.h"
+#include "scene.h"
+
+#define FRAME_CALLBACK_TIMEOUT_MS 1000
+
+static const int window_width = 800;
+static const int window_height = 600;
+
+typedef struct {
+    struct wl_display *display;
+    struct wl_registry *registry;
+    struct wl_compositor *compositor;
+    struct xdg_wm_base *wm_base;
+    struct wl_seat *seat;
+    struct wl_keyboard *keyboard;
+    struct wl_surface *surface;
+    struct xdg_surface *xdg_surface;
+    struct xdg_toplevel *toplevel;
+
+    WindowData data;
+    int toplevel_width;       // From the last xdg_toplevel.configure; 0 lets us choose
+    int toplevel_height;
+    int configured_width;     // Size the window has, as seen by the event thread
+    int configured_height;
+    bool configured;          // The first configure arrived and was painted
+    uint32_t configure_serial; // For the render thread to ack; see handle_surface_configure
+    double configure_time;
+    bool quit;
+
+    // Render thread only
+    struct wl_event_queue *frame_queue;
+    struct wl_callback *frame_callback; // The one being waited for, if any
+    double frame_commit_time;
+    double *frame_ms;
+    double frame_ms_sum;
+    int frame_count;
+    int frame_capacity;
+    int frame_timeouts;
+
+    // How long a configure took to be acked with a frame at its size
+    uint64_t ack_count;
+    double ack_seconds;
+    double ack_max_seconds;
+} WaylandApp;
+
+// --------------------------------------------------
+// ----- Render thread
+// --------------------------------------------------
+static void *load_proc(const char *name) {
+    return (void*)eglGetProcAddress(name);
+}
+
+static void handle_frame_done(void *user, struct wl_callback *callback, uint32_t time) {
+    (void)time;
+    WaylandApp *app = (WaylandApp*)user;
+    wl_callback_destroy(callback);
+    if (callback != app->frame_callback) return; // Given up on, or overtaken by a paint
+    app->frame_callback = NULL;
+
+    if (app->frame_count == app->frame_capacity) {
+        app->frame_capacity = app->frame_capacity ? 2 * app->frame_capacity : 1024;
+        app->frame_ms = (double*)realloc(app->frame_ms, app->frame_capacity * sizeof(double));
+    }
+    double latency_ms = 1000.0 * (get_time_now() - app->frame_commit_time);
+    app->frame_ms[app->frame_count++] = latency_ms;
+    app->frame_ms_sum += latency_ms;
+}
+
+static const struct wl_callback_listener frame_listener = { handle_frame_done };
+
+// Dispatches the render thread's queue until the last frame's callback has
+// arrived or the timeout passes, reading from the display alongside the
+// event thread. Flags posted meanwhile, such as a paint, end the wait early;
+// returns them, taken.
+static uint32_t wait_for_frame_callback(WaylandApp *app, int timeout_ms) {
+    uint32_t flags = 0;
+    double deadline = get_time_now() + timeout_ms / 1000.0;
+    while (app->frame_callback && !flags) {
+        while (wl_display_prepare_read_queue(app->display, app->frame_queue) != 0) {
+            wl_display_dispatch_queue_pending(app->display, app->frame_queue);
+        }
+        if (!app->frame_callback) {
+            wl_display_cancel_read(app->display);
+            break;
+        }
+        wl_display_flush(app->display);
+
+        int remaining_ms = (int)(1000.0 * (deadline - get_time_now()));
+        struct pollfd fds[2] = {
+            { wl_display_get_fd(app->display), POLLIN, 0 },
+            { app->data.wake_fd, POLLIN, 0 },
+        };
+        if (remaining_ms <= 0 || poll(fds, 2, remaining_ms) <= 0) {
+            wl_display_cancel_read(app->display);
+            app->frame_timeouts++;
+            app->frame_callback = NULL; // Destroyed without counting if it turns up
+            break;
+        }
+        if (fds[0].revents) {
+            wl_display_read_events(app->display);
+            wl_display_dispatch_queue_pending(app->display, app->frame_queue);
+        } else {
+            wl_display_cancel_read(app->display);
+        }
+
+        // The count may be left from flags taken before the wait, so only
+        // flags still pending end it
+        if (fds[1].revents & POLLIN) {
+            uint64_t count;
+            if (read(app->data.wake_fd, &count, sizeof(count)) < 0) count = 0;
+            float unused;
+            flags = take_window_flags(&app->data, false, 0, &unused);
+        }
+    }
+    return flags;
+}
+
+static bool create_context(EGLDisplay *egl_display, EGLContext *context, EGLSurface *egl_surface,
+                           struct wl_egl_window *egl_window, struct wl_display *display) {
+    *egl_display = eglGetDisplay((EGLNativeDisplayType)display);
+    if (!eglInitialize(*egl_display, NULL, NULL) || !eglBindAPI(EGL_OPENGL_API)) return false;
+
+    EGLint config_attribs[] = {
+        EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_NONE,
+    };
+    EGLConfig config;
+    EGLint config_count = 0;
+    if (!eglChooseConfig(*egl_display, config_attribs, &config, 1, &config_count) || !config_count) return false;
+
+    EGLint context_attribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE,
+    };
+    *context = eglCreateContext(*egl_display, config, EGL_NO_CONTEXT, context_attribs);
+    if (*context == EGL_NO_CONTEXT) return false;
+
+    *egl_surface = eglCreateWindowSurface(*egl_display, config, (EGLNativeWindowType)egl_window, NULL);
+    if (*egl_surface == EGL_NO_SURFACE) return false;
+
+    // Frame callbacks pace the animation; swaps never block on them
+    return eglMakeCurrent(*egl_display, *egl_surface, *egl_surface, *context) && eglSwapInterval(*egl_display, 0) &&
+           gladLoadGLLoader(load_proc);
+}
+
+static void report_frame_stats(const WaylandApp *app, uint64_t frames_rendered, double cpu_seconds) {
+    printf("Frames rendered: %llu (avg CPU %.2f ms, avg commit to frame callback %.2f ms, %d callbacks missed)\n",
+           (unsigned long long)frames_rendered,
+           frames_rendered ? 1000.0 * cpu_seconds / (double)frames_rendered : 0.0,
+           app->frame_count ? app->frame_ms_sum / app->frame_count : 0.0, app->frame_timeouts);
+}
+
+static void report_ack_latency(const WaylandApp *app) {
+    if (!app->ack_count) return;
+    printf("Configures: %llu (avg %.2f ms to the ack, max %.2f ms)\n", (unsigned long long)app->ack_count,
+           1000.0 * app->ack_seconds / (double)app->ack_count, 1000.0 * app->ack_max_seconds);
+}
+
+static void *render_thread_func(void *arg) {
+    WaylandApp *app = (WaylandApp*)arg;
+    WindowData *window = &app->data;
+
+    // Frame callbacks arrive on a queue only this thread dispatches
+    app->frame_queue = wl_display_create_queue(app->display);
+    struct wl_surface *frame_surface = (struct wl_surface*)wl_proxy_create_wrapper(app->surface);
+    wl_proxy_set_queue((struct wl_proxy*)frame_surface, app->frame_queue);
+
+    int egl_width = window_width;
+    int egl_height = window_height;
+    struct wl_egl_window *egl_window = wl_egl_window_create(app->surface, egl_width, egl_height);
+    EGLDisplay egl_display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+    EGLSurface egl_surface = EGL_NO_SURFACE;
+    Scene scene;
+    if (!egl_window || !create_context(&egl_display, &context, &egl_surface, egl_window, app->display) ||
+        !scene_init(&scene)) {
+        fprintf(stderr, "Could not create a GL 3.3 core context\n");
+        if (egl_display != EGL_NO_DISPLAY) eglTerminate(egl_display);
+        if (egl_window) wl_egl_window_destroy(egl_window);
+        wl_proxy_wrapper_destroy(frame_surface);
+        wl_event_queue_destroy(app->frame_queue);
+        window_render_stopped(window);
+        return NULL;
+    }
+    printf("GL renderer: %s\n", (const char*)glGetString(GL_RENDERER));
+
+    float time = 0.0f;
+    float start_time = time;
+    bool animating = false;
+    float modifier = 1.0f;
+
+    uint64_t frames_rendered = 0;
+    double cpu_seconds = 0.0;
+    double last_report_time = 0.0;
+
+    // While the event thread hasn't signaled to stop
+    while (true) {
+        float sleep_time = 0;
+        uint32_t flags = take_window_flags(window, !animating, -1, &sleep_time);
+
+        if (flags & EVENT_TERMINATE) break;
+
+        // The compositor is ready for another frame; a paint can't wait for
+        // that, so posting one ends the wait and the frame takes it
+#ifndef NO_VSYNC
+        if (!(flags & EVENT_PAINT) && app->frame_callback) {
+            float before_wait_time = (float)get_time_now();
+            flags |= wait_for_frame_callback(app, FRAME_CALLBACK_TIMEOUT_MS);
+            sleep_time += (float)get_time_now() - before_wait_time;
+            if (flags & EVENT_TERMINATE) break;
+        }
+#endif
+
+        int width, height;
+        window_get_size(window, &width, &height);
+        if (width != egl_width || height != egl_height) {
+            wl_egl_window_resize(egl_window, width, height, 0, 0);
+            egl_width = width;
+            egl_height = height;
+        }
+
+        if (flags & EVENT_TOGGLEANIMATION) animating = !animating;
+
+        if (animating) {
+            modifier = quad_modifier(time);
+        }
+
+        double frame_start = get_time_now();
+        scene_draw(&scene, width, height, background_color(time), modifier);
+        cpu_seconds += get_time_now() - frame_start;
+
+        // Set by the event thread before it posted the paint, and left alone
+        // while it waits for this frame
+        uint32_t serial = (flags & EVENT_PAINT) ? app->configure_serial : 0;
+        if (serial) xdg_surface_ack_configure(app->xdg_surface, serial);
+
+        wl_display_dispatch_queue_pending(app->display, app->frame_queue);
+        app->frame_callback = wl_surface_frame(frame_surface);
+        wl_callback_add_listener(app->frame_callback, &frame_listener, app);
+
+        eglSwapBuffers(egl_display, egl_surface); // Commits the surface, with the ack and the callback
+        app->frame_commit_time = get_time_now();
+        scene_finish();
+        frames_rendered++;
+
+        if (serial) {
+            double waited = get_time_now() - app->configure_time;
+            app->ack_count++;
+            app->ack_seconds += waited;
+            if (waited > app->ack_max_seconds) app->ack_max_seconds = waited;
+        }
+
+        window_frame_done(window);
+
+        advance_animation(&time, &start_time, sleep_time, animating);
+
+        double now = get_time_now();
+        if (now - last_report_time >= 1.0) {
+            report_frame_stats(app, frames_rendered, cpu_seconds);
+            report_ack_latency(app);
+            report_resize_latency(window);
+            fflush(stdout);
+            last_report_time = now;
+        }
+    }
+
+    report_frame_stats(app, frames_rendered, cpu_seconds);
+    report_ack_latency(app);
+    report_resize_latency(window);
+
+    scene_destroy(&scene);
+    eglMakeCurrent(egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroySurface(egl_display, egl_surface);
+    eglDestroyContext(egl_display, context);
+    eglTerminate(egl_display);
+    wl_egl_window_destroy(egl_window);
+    if (app->frame_callback) wl_callback_destroy(app->frame_callback);
+    app->frame_callback = NULL;
+    wl_proxy_wrapper_destroy(frame_surface);
+    wl_event_queue_destroy(app->frame_queue);
+
+    printf("RenderThread exiting\n");
+    window_render_stopped(window);
+    return NULL;
+}
+
+// --------------------------------------------------
+// ----- Event thread
+// --------------------------------------------------
+static void handle_wm_base_ping(void *user, struct xdg_wm_base *wm_base, uint32_t serial) {
+    (void)user;
+    xdg_wm_base_pong(wm_base, serial);
+}
+
+static const struct xdg_wm_base_listener wm_base_listener = { handle_wm_base_ping };
+
+static void handle_toplevel_configure(void *user, struct xdg_toplevel *toplevel, int32_t width, int32_t height,
+                                      struct wl_array *states) {
+    (void)toplevel;
+    (void)states;
+    WaylandApp *app = (WaylandApp*)user;
+    app->toplevel_width = width;
+    app->toplevel_height = height;
+}
+
+static void handle_toplevel_close(void *user, struct xdg_toplevel *toplevel) {
+    (void)toplevel;
+    ((WaylandApp*)user)->quit = true;
+}
+
+// Only the events of version 1, which is what we bind
+static const struct xdg_toplevel_listener toplevel_listener = { handle_toplevel_configure, handle_toplevel_close };
+
+// Ends a configure sequence: the size to use is settled, and the frame that
+// acks it must have that size
+static void handle_surface_configure(void *user, struct xdg_surface *xdg_surface, uint32_t serial) {
+    (void)xdg_surface;
+    WaylandApp *app = (WaylandApp*)user;
+    if (app->toplevel_width > 0 && app->toplevel_height > 0) {
+        app->configured_width = app->toplevel_width;
+        app->configured_height = app->toplevel_height;
+    }
+    window_set_size(&app->data, app->configured_width, app->configured_height);
+
+    // The paint hands the serial to the render thread through the handshake's lock
+    app->configure_serial = serial;
+    app->configure_time = get_time_now();
+    if (window_paint(&app->data) < 0.0) app->quit = true; // Nothing will ever draw the window
+    app->configure_serial = 0;
+    app->configured = true;
+}
+
+static const struct xdg_surface_listener surface_listener = { handle_surface_configure };
+
+static void handle_keyboard_keymap(void *user, struct wl_keyboard *keyboard, uint32_t format, int32_t fd,
+                                   uint32_t size) {
+    (void)user;
+    (void)keyboard;
+    (void)format;
+    (void)size;
+    close(fd); // Keys are matched by evdev code, so the keymap isn't needed
+}
+
+static void handle_keyboard_enter(void *user, struct wl_keyboard *keyboard, uint32_t serial,
+                                  struct wl_surface *surface, struct wl_array *keys) {
+    (void)user;
+    (void)keyboard;
+    (void)serial;
+    (void)surface;
+    (void)keys;
+}
+
+static void handle_keyboard_leave(void *user, struct wl_keyboard *keyboard, uint32_t serial,
+                                  struct wl_surface *surface) {
+    (void)user;
+    (void)keyboard;
+    (void)serial;
+    (void)surface;
+}
+
+// Wayland leaves key repeat to the client, so every press is a real one
+static void handle_keyboard_key(void *user, struct wl_keyboard *keyboard, uint32_t serial, uint32_t time,
+                                uint32_t key, uint32_t state) {
+    (void)keyboard;
+    (void)serial;
+    (void)time;
+    WaylandApp *app = (WaylandApp*)user;
+    if (state != WL_KEYBOARD_KEY_STATE_PRESSED) return;
+    if (key == KEY_ESC) {
+        app->quit = true;
+    } else if (key == KEY_SPACE) {
+        window_post_flags(&app->data, EVENT_TOGGLEANIMATION);
+    }
+}
+
+static void handle_keyboard_modifiers(void *user, struct wl_keyboard *keyboard, uint32_t serial, uint32_t depressed,
+                                      uint32_t latched, uint32_t locked, uint32_t group) {
+    (void)user;
+    (void)keyboard;
+    (void)serial;
+    (void)depressed;
+    (void)latched;
+    (void)locked;
+    (void)group;
+}
+
+static const struct wl_keyboard_listener keyboard_listener = {
+    handle_keyboard_keymap,
+    handle_keyboard_enter,
+    handle_keyboard_leave,
+    handle_keyboard_key,
+    handle_keyboard_modifiers,
+};
+
+static void handle_seat_capabilities(void *user, struct wl_seat *seat, uint32_t capabilities) {
+    WaylandApp *app = (WaylandApp*)user;
+    if ((capabilities & WL_SEAT_CAPABILITY_KEYBOARD) && !app->keyboard) {
+        app->keyboard = wl_seat_get_keyboard(seat);
+        wl_keyboard_add_listener(app->keyboard, &keyboard_listener, app);
+    }
+}
+
+// Only the events of version 1, which is what we bind
+static const struct wl_seat_listener seat_listener = { handle_seat_capabilities };
+
+static void handle_registry_global(void *user, struct wl_registry *registry, uint32_t name, const char *interface,
+                                   uint32_t version) {
+    (void)version;
+    WaylandApp *app = (WaylandApp*)user;
+    if (strcmp(interface, wl_compositor_interface.name) == 0) {
+        app->compositor = (struct wl_compositor*)wl_registry_bind(registry, name, &wl_compositor_interface, 1);
+    } else if (strcmp(interface, xdg_wm_base_interface.name) == 0) {
+        app->wm_base = (struct xdg_wm_base*)wl_registry_bind(registry, name, &xdg_wm_base_interface, 1);
+        xdg_wm_base_add_listener(app->wm_base, &wm_base_listener, app);
+    } else if (strcmp(interface, wl_seat_interface.name) == 0 && !app->seat) {
+        app->seat = (struct wl_seat*)wl_registry_bind(registry, name, &wl_seat_interface, 1);
+        wl_seat_add_listener(app->seat, &seat_listener, app);
+    }
+}
+
+static void handle_registry_global_remove(void *user, struct wl_registry *registry, uint32_t name) {
+    (void)user;
+    (void)registry;
+    (void)name;
+}
+
+static const struct wl_registry_listener registry_listener = {
+    handle_registry_global,
+    handle_registry_global_remove,
+};
+
+static void run_resize_benchmark(WaylandApp *app, int resize_count, bool csv) {
+    while (!app->quit && !app->configured && wl_display_dispatch(app->display) != -1) {}
+
+    // Maximized, fullscreen and tiled windows take the size they are given
+    if (app->toplevel_width > 0 && app->toplevel_height > 0) {
+        printf("The compositor sets the window's size (%dx%d), so it can't be resized\n", app->toplevel_width,
+               app->toplevel_height);
+        return;
+    }
+
+    double *latency_ms = (double*)malloc(resize_count * sizeof(double));
+    int resized = 0;
+    for (int i = 0; i < resize_count && !app->quit; i++) {
+        drag_size(i, &app->configured_width, &app->configured_height);
+
+        double start = get_time_now();
+        window_set_size(&app->data, app->configured_width, app->configured_height);
+        window_paint(&app->data);
+        latency_ms[resized] = 1000.0 * (get_time_now() - start);
+        if (csv) {
+            printf("resize,%d,%d,%d,%.4f\n", i, app->configured_width, app->configured_height, latency_ms[resized]);
+        }
+        resized++;
+
+        // Answers pings and takes any configure the compositor sent meanwhile
+        if (wl_display_roundtrip(app->display) == -1) break;
+    }
+
+    printf("Resize benchmark: %d resizes\n", resized);
+    report_samples("size to commit", latency_ms, resized);
+    free(latency_ms);
+}
+
+int main(int argc, char **argv) {
+    int resize_count = 0;
+    bool csv = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--resize-bench") == 0 && i + 1 < argc) {
+            resize_count = atoi(argv[++i]);
+            if (resize_count < 1) resize_count = 1;
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else {
+            fprintf(stderr, "Usage: %s [--resize-bench N] [--csv]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    WaylandApp *app = (WaylandApp*)calloc(1, sizeof(WaylandApp));
+    app->display = wl_display_connect(NULL);
+    if (!app->display) {
+        fprintf(stderr, "Could not connect to the Wayland display\n");
+        return 1;
+    }
+    app->registry = wl_display_get_registry(app->display);
+    wl_registry_add_listener(app->registry, &registry_listener, app);
+    wl_display_roundtrip(app->display);
+    if (!app->compositor || !app->wm_base) {
+        fprintf(stderr, "The compositor has no xdg_wm_base\n");
+        return 1;
+    }
+
+    app->configured_width = window_width;
+    app->configured_height = window_height;
+    app->surface = wl_compositor_create_surface(app->compositor);
+    app->xdg_surface = xdg_wm_base_get_xdg_surface(app->wm_base, app->surface);
+    xdg_surface_add_listener(app->xdg_surface, &surface_listener, app);
+    app->toplevel = xdg_surface_get_toplevel(app->xdg_surface);
+    xdg_toplevel_add_listener(app->toplevel, &toplevel_listener, app);
+    xdg_toplevel_set_title(app->toplevel, "SPC to pause/resume | ESC to exit");
+
+    window_data_init(&app->data, window_width, window_height);
+    app->data.wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    pthread_t render_thread;
+    if (pthread_create(&render_thread, NULL, render_thread_func, app) != 0) {
+        fprintf(stderr, "Could not start render thread\n");
+        return 1;
+    }
+
+    // A commit without a buffer asks for the first configure
+    wl_surface_commit(app->surface);
+
+    if (resize_count) {
+        run_resize_benchmark(app, resize_count, csv);
+    } else {
+        while (!app->quit && wl_display_dispatch(app->display) != -1) {}
+    }
+
+    // Stop and wait on render thread before exiting
+    window_post_flags(&app->data, EVENT_TERMINATE);
+    pthread_join(render_thread, NULL);
+
+    if (app->frame_count) {
+        printf("Frame callbacks: %d, %d missed\n", app->frame_count, app->frame_timeouts);
+        report_samples("commit to callback", app->frame_ms, app->frame_count);
+    }
+
+    if (app->keyboard) wl_keyboard_destroy(app->keyboard);
+    if (app->seat) wl_seat_destroy(app->seat);
+    xdg_toplevel_destroy(app->toplevel);
+    xdg_surface_destroy(app->xdg_surface);
+    wl_surface_destroy(app->surface);
+    xdg_wm_base_destroy(app->wm_base);
+    wl_compositor_destroy(app->compositor);
+    wl_registry_destroy(app->registry);
+    wl_display_disconnect(app->display);
+    if (app->data.wake_fd >= 0) close(app->data.wake_fd);
+    window_data_destroy(&app->data);
+    free(app->frame_ms);
+    free(app);
+    return 0;
+}
@@ -0,0 +1,498 @@
+// The window of src/main.c on X11 and GLX: an event thread that owns the
+// window and a render thread that owns the GL context, kept in step by the
+// same handshake (see handshake.h).
+//
+// Usage: smooth_sizing_x11 [--resize-bench N] [--csv]
+//
+// ConfigureNotify plays WM_SIZE and Expose plays WM_PAINT: the window has
+// ForgetGravity, so the server throws its contents away on every resize and
+// exposes all of it, the way CS_HREDRAW | CS_VREDRAW repaints a Win32 window.
+// The event thread doesn't return to the event queue until the render thread
+// has drawn and presented a frame at the new size.
+//
+// A window manager or compositor doesn't wait for that on its own: it shows
+// the window stretched or with garbage while a frame is missing. Windows that
+// take part in _NET_WM_SYNC_REQUEST get a numbered request before each
+// configure, and the window manager holds off until the window sets its XSync
+// counter to that number. The counter is set once the paint at the new size
+// has finished, or right away when the configure didn't change the size.
+//
+// --resize-bench N resizes the window N times along a scripted drag and
+// reports, for each resize, the time from the request to the end of the
+// paint at that size. Space toggles the animation and Escape closes the
+// window, as on Windows. Statistics go to stdout once a second.
+
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad/glad.h"
+
+#include <GL/glx.h>
+#include <X11/XKBlib.h>
+#include <X11/Xatom.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/sync.h>
+#include <X11/keysym.h>
+
+#include "handshake.h"
+#include "scene.h"
+
+#define BENCH_TIMEOUT_MS 1000
+
+static const int window_width = 800;
+static const int window_height = 600;
+
+typedef struct {
+    Display *display;        // Event thread's connection
+    Display *render_display; // Render thread's connection, so neither waits on the other's lock
+    Window window;
+    Atom wm_protocols;
+    Atom wm_delete_window;
+    Atom net_wm_sync_request;
+    int fbconfig_id;
+
+    XSyncCounter sync_counter; // None when the server has no XSync
+    bool sync_pending;         // A request waits for the frame at its size
+    int64_t sync_value;
+    double sync_request_time;
+    uint64_t sync_count;       // Requests answered, and how long they took
+    double sync_seconds;
+    double sync_max_seconds;
+
+    WindowData data;
+    int configured_width;  // Latest ConfigureNotify, as seen by the event thread
+    int configured_height;
+    int painted_width;     // Size of the last paint that finished
+    int painted_height;
+    bool space_down;
+    bool quit;
+} X11App;
+
+// --------------------------------------------------
+// ----- Render thread
+// --------------------------------------------------
+static void *load_proc(const char *name) {
+    return (void*)glXGetProcAddressARB((const GLubyte*)name);
+}
+
+static bool has_glx_extension(Display *display, const char *name) {
+    const char *extensions = glXQueryExtensionsString(display, DefaultScreen(display));
+    size_t length = strlen(name);
+    for (const char *found = extensions; found && (found = strstr(found, name)); found += length) {
+        if ((found == extensions || found[-1] == ' ') && (found[length] == ' ' || found[length] == '\0')) return true;
+    }
+    return false;
+}
+
+static GLXContext create_context(Display *display, int fbconfig_id) {
+    int config_attribs[] = { GLX_FBCONFIG_ID, fbconfig_id, None };
+    int config_count = 0;
+    GLXFBConfig *configs = glXChooseFBConfig(display, DefaultScreen(display), config_attribs, &config_count);
+    if (!configs || !config_count) return NULL;
+
+    PFNGLXCREATECONTEXTATTRIBSARBPROC glXCreateContextAttribsARB =
+        (PFNGLXCREATECONTEXTATTRIBSARBPROC)load_proc("glXCreateContextAttribsARB");
+    int context_attribs[] = {
+        GLX_CONTEXT_MAJOR_VERSION_ARB, 3,
+        GLX_CONTEXT_MINOR_VERSION_ARB, 3,
+        GLX_CONTEXT_PROFILE_MASK_ARB, GLX_CONTEXT_CORE_PROFILE_BIT_ARB,
+        None,
+    };
+    GLXContext context = NULL;
+    if (glXCreateContextAttribsARB && has_glx_extension(display, "GLX_ARB_create_context_profile")) {
+        context = glXCreateContextAttribsARB(display, configs[0], NULL, True, context_attribs);
+    }
+    XFree(configs);
+    return context;
+}
+
+static void set_swap_interval(Display *display, GLXDrawable drawable) {
+#ifdef NO_VSYNC
+    int interval = 0;
+#elif defined(ADAPTIVE_VSYNC)
+    // A late frame tears instead of waiting for the next vblank
+    int interval = has_glx_extension(display, "GLX_EXT_swap_control_tear") ? -1 : 1;
+#else
+    int interval = 1;
+#endif
+    if (has_glx_extension(display, "GLX_EXT_swap_control")) {
+        PFNGLXSWAPINTERVALEXTPROC swap_interval = (PFNGLXSWAPINTERVALEXTPROC)load_proc("glXSwapIntervalEXT");
+        if (swap_interval) swap_interval(display, drawable, interval);
+    } else if (has_glx_extension(display, "GLX_MESA_swap_control")) {
+        PFNGLXSWAPINTERVALMESAPROC swap_interval = (PFNGLXSWAPINTERVALMESAPROC)load_proc("glXSwapIntervalMESA");
+        if (swap_interval) swap_interval(interval < 0 ? 1 : (unsigned)interval);
+    }
+}
+
+// Asks the event thread to close the window, as the window manager would
+static void request_close(X11App *app) {
+    XEvent event;
+    memset(&event, 0, sizeof(event));
+    event.xclient.type = ClientMessage;
+    event.xclient.window = app->window;
+    event.xclient.message_type = app->wm_protocols;
+    event.xclient.format = 32;
+    event.xclient.data.l[0] = (long)app->wm_delete_window;
+    XSendEvent(app->render_display, app->window, False, NoEventMask, &event);
+    XFlush(app->render_display);
+}
+
+static void report_frame_stats(uint64_t frames_rendered, double cpu_seconds) {
+    printf("Frames rendered: %llu (avg CPU %.2f ms)\n", (unsigned long long)frames_rendered,
+           frames_rendered ? 1000.0 * cpu_seconds / (double)frames_rendered : 0.0);
+}
+
+static void *render_thread_func(void *arg) {
+    X11App *app = (X11App*)arg;
+    WindowData *window = &app->data;
+    Display *display = app->render_display;
+
+    GLXContext context = create_context(display, app->fbconfig_id);
+    Scene scene;
+    if (!context || !glXMakeContextCurrent(display, app->window, app->window, context) ||
+        !gladLoadGLLoader(load_proc) || !scene_init(&scene)) {
+        fprintf(stderr, "Could not create a GL 3.3 core context\n");
+        if (context) glXDestroyContext(display, context);
+        window_render_stopped(window);
+        request_close(app);
+        return NULL;
+    }
+    set_swap_interval(display, app->window);
+    printf("GL renderer: %s\n", (const char*)glGetString(GL_RENDERER));
+
+    float time = 0.0f;
+    float start_time = time;
+    bool animating = false;
+    float modifier = 1.0f;
+
+    uint64_t frames_rendered = 0;
+    double cpu_seconds = 0.0;
+    double last_report_time = 0.0;
+
+    // While the event thread hasn't signaled to stop
+    while (true) {
+        float sleep_time = 0;
+        uint32_t flags = take_window_flags(window, !animating, -1, &sleep_time);
+
+        if (flags & EVENT_TERMINATE) break;
+
+        int width, height;
+        window_get_size(window, &width, &height);
+
+        if (flags & EVENT_TOGGLEANIMATION) animating = !animating;
+
+        if (animating) {
+            modifier = quad_modifier(time);
+        }
+
+        double frame_start = get_time_now();
+        scene_draw(&scene, width, height, background_color(time), modifier);
+        cpu_seconds += get_time_now() - frame_start;
+
+        glXSwapBuffers(display, app->window);
+        scene_finish();
+        frames_rendered++;
+
+        window_frame_done(window);
+
+        advance_animation(&time, &start_time, sleep_time, animating);
+
+        double now = get_time_now();
+        if (now - last_report_time >= 1.0) {
+            report_frame_stats(frames_rendered, cpu_seconds);
+            report_resize_latency(window);
+            fflush(stdout);
+            last_report_time = now;
+        }
+    }
+
+    report_frame_stats(frames_rendered, cpu_seconds);
+    report_resize_latency(window);
+
+    scene_destroy(&scene);
+    glXMakeContextCurrent(display, None, None, NULL);
+    glXDestroyContext(display, context);
+
+    printf("RenderThread exiting\n");
+    window_render_stopped(window);
+    return NULL;
+}
+
+// --------------------------------------------------
+// ----- Event thread
+// --------------------------------------------------
+// Tells the window manager the frame for its last sync request is on screen
+static void answer_sync_request(X11App *app) {
+    if (!app->sync_pending) return;
+    app->sync_pending = false;
+
+    XSyncValue value;
+    XSyncIntsToValue(&value, (unsigned int)(app->sync_value & 0xFFFFFFFF), (int)(app->sync_value >> 32));
+    XSyncSetCounter(app->display, app->sync_counter, value);
+    XFlush(app->display);
+
+    double waited = get_time_now() - app->sync_request_time;
+    app->sync_count++;
+    app->sync_seconds += waited;
+    if (waited > app->sync_max_seconds) app->sync_max_seconds = waited;
+}
+
+static void report_sync_latency(const X11App *app) {
+    if (!app->sync_count) return;
+    printf("Sync requests: %llu (avg %.2f ms to the counter update, max %.2f ms)\n",
+           (unsigned long long)app->sync_count, 1000.0 * app->sync_seconds / (double)app->sync_count,
+           1000.0 * app->sync_max_seconds);
+}
+
+static void handle_event(X11App *app, XEvent *event) {
+    switch (event->type) {
+    case ConfigureNotify: {
+        app->configured_width = event->xconfigure.width;
+        app->configured_height = event->xconfigure.height;
+        window_set_size(&app->data, app->configured_width, app->configured_height);
+
+        // A move or restack exposes nothing, so the frame on screen already fits
+        if (app->configured_width == app->painted_width && app->configured_height == app->painted_height) {
+            answer_sync_request(app);
+        }
+        break;
+    }
+
+    case Expose: {
+        // The last of a batch of exposed rectangles; the frame covers them all
+        if (event->xexpose.count != 0) break;
+        window_paint(&app->data);
+        app->painted_width = app->configured_width;
+        app->painted_height = app->configured_height;
+        answer_sync_request(app);
+        break;
+    }
+
+    case KeyPress: {
+        KeySym key = XLookupKeysym(&event->xkey, 0);
+        if (key == XK_Escape) {
+            app->quit = true;
+        } else if (key == XK_space && !app->space_down) {
+            app->space_down = true;
+            window_post_flags(&app->data, EVENT_TOGGLEANIMATION);
+        }
+        break;
+    }
+
+    case KeyRelease: {
+        if (XLookupKeysym(&event->xkey, 0) == XK_space) app->space_down = false;
+        break;
+    }
+
+    case ClientMessage: {
+        if (event->xclient.message_type != app->wm_protocols) break;
+        Atom protocol = (Atom)event->xclient.data.l[0];
+        if (protocol == app->wm_delete_window) {
+            app->quit = true;
+        } else if (protocol == app->net_wm_sync_request && app->sync_counter != None) {
+            // The value to set once the configure that follows has been drawn
+            app->sync_value = (int64_t)(unsigned long)event->xclient.data.l[2] & 0xFFFFFFFF;
+            app->sync_value |= (int64_t)event->xclient.data.l[3] << 32;
+            app->sync_pending = true;
+            app->sync_request_time = get_time_now();
+        }
+        break;
+    }
+    }
+}
+
+// Handles events until there are none left, waiting up to timeout_ms (negative
+// waits forever) for the first. Returns false on timeout.
+static bool pump_events(X11App *app, int timeout_ms) {
+    if (!XPending(app->display)) {
+        struct pollfd fd = { ConnectionNumber(app->display), POLLIN, 0 };
+        if (poll(&fd, 1, timeout_ms) <= 0 || !XPending(app->display)) return false;
+    }
+    while (XPending(app->display)) {
+        XEvent event;
+        XNextEvent(app->display, &event);
+        handle_event(app, &event);
+    }
+    return true;
+}
+
+// Waits until a paint at the given size has finished, or the timeout
+static bool wait_for_paint(X11App *app, int width, int height) {
+    double deadline = get_time_now() + BENCH_TIMEOUT_MS / 1000.0;
+    while (!app->quit && (app->painted_width != width || app->painted_height != height)) {
+        int remaining_ms = (int)(1000.0 * (deadline - get_time_now()));
+        if (remaining_ms <= 0) return false;
+        pump_events(app, remaining_ms);
+    }
+    return !app->quit;
+}
+
+static void run_resize_benchmark(X11App *app, int resize_count, bool csv) {
+    // The first paint, at whatever size the window was mapped with
+    while (!app->quit && !app->painted_width) pump_events(app, -1);
+
+    double *latency_ms = (double*)malloc(resize_count * sizeof(double));
+    int resized = 0;
+    int missed = 0;
+    for (int i = 0; i < resize_count && !app->quit; i++) {
+        int width, height;
+        drag_size(i, &width, &height);
+        if (width == app->painted_width && height == app->painted_height) width += 8;
+
+        double start = get_time_now();
+        XResizeWindow(app->display, app->window, width, height);
+        XFlush(app->display);
+        if (!wait_for_paint(app, width, height)) {
+            missed++;
+            continue;
+        }
+        latency_ms[resized] = 1000.0 * (get_time_now() - start);
+        if (csv) printf("resize,%d,%d,%d,%.4f\n", i, width, height, latency_ms[resized]);
+        resized++;
+    }
+
+    printf("Resize benchmark: %d resizes, %d not painted within %d ms\n", resized, missed, BENCH_TIMEOUT_MS);
+    report_samples("request to paint", latency_ms, resized);
+    free(latency_ms);
+}
+
+static bool create_window(X11App *app) {
+    int screen = DefaultScreen(app->display);
+    int glx_major = 0, glx_minor = 0;
+    if (!glXQueryVersion(app->display, &glx_major, &glx_minor) || glx_major * 10 + glx_minor < 13) {
+        fprintf(stderr, "GLX 1.3 is required\n");
+        return false;
+    }
+
+    int config_attribs[] = {
+        GLX_X_RENDERABLE, True,
+        GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT,
+        GLX_RENDER_TYPE, GLX_RGBA_BIT,
+        GLX_X_VISUAL_TYPE, GLX_TRUE_COLOR,
+        GLX_RED_SIZE, 8,
+        GLX_GREEN_SIZE, 8,
+        GLX_BLUE_SIZE, 8,
+        GLX_DOUBLEBUFFER, True,
+        None,
+    };
+    int config_count = 0;
+    GLXFBConfig *configs = glXChooseFBConfig(app->display, screen, config_attribs, &config_count);
+    if (!configs || !config_count) {
+        fprintf(stderr, "No double buffered RGB8 GLX config\n");
+        return false;
+    }
+    glXGetFBConfigAttrib(app->display, configs[0], GLX_FBCONFIG_ID, &app->fbconfig_id);
+    XVisualInfo *visual = glXGetVisualFromFBConfig(app->display, configs[0]);
+    XFree(configs);
+    if (!visual) return false;
+
+    Window root = RootWindow(app->display, screen);
+    XSetWindowAttributes attributes;
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.colormap = XCreateColormap(app->display, root, visual->visual, AllocNone);
+    attributes.background_pixmap = None; // We replace the window's entire contents every frame ourselves
+    attributes.bit_gravity = ForgetGravity; // Every resize exposes the whole window
+    attributes.event_mask = StructureNotifyMask | ExposureMask | KeyPressMask | KeyReleaseMask;
+    app->window = XCreateWindow(app->display, root, 0, 0, window_width, window_height, 0, visual->depth,
+                                InputOutput, visual->visual,
+                                CWColormap | CWBackPixmap | CWBitGravity | CWEventMask, &attributes);
+    XFree(visual);
+
+    XStoreName(app->display, app->window, "SPC to pause/resume | ESC to exit");
+    app->wm_protocols = XInternAtom(app->display, "WM_PROTOCOLS", False);
+    app->wm_delete_window = XInternAtom(app->display, "WM_DELETE_WINDOW", False);
+    app->net_wm_sync_request = XInternAtom(app->display, "_NET_WM_SYNC_REQUEST", False);
+
+    // Offer the sync protocol when the server can hold the counter
+    Atom protocols[2] = { app->wm_delete_window, app->net_wm_sync_request };
+    int event_base, error_base, sync_major, sync_minor;
+    app->sync_counter = None;
+    if (XSyncQueryExtension(app->display, &event_base, &error_base) &&
+        XSyncInitialize(app->display, &sync_major, &sync_minor)) {
+        XSyncValue zero;
+        XSyncIntToValue(&zero, 0);
+        app->sync_counter = XSyncCreateCounter(app->display, zero);
+
+        Atom counter_property = XInternAtom(app->display, "_NET_WM_SYNC_REQUEST_COUNTER", False);
+        unsigned long counter = app->sync_counter;
+        XChangeProperty(app->display, app->window, counter_property, XA_CARDINAL, 32, PropModeReplace,
+                        (unsigned char*)&counter, 1);
+    }
+    XSetWMProtocols(app->display, app->window, protocols, app->sync_counter != None ? 2 : 1);
+
+    // Held keys repeat as presses alone, so a press while down is a repeat
+    XkbSetDetectableAutoRepeat(app->display, True, NULL);
+
+    // The render thread draws into the window through its own connection
+    XSync(app->display, False);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    int resize_count = 0;
+    bool csv = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--resize-bench") == 0 && i + 1 < argc) {
+            resize_count = atoi(argv[++i]);
+            if (resize_count < 1) resize_count = 1;
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else {
+            fprintf(stderr, "Usage: %s [--resize-bench N] [--csv]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    X11App *app = (X11App*)calloc(1, sizeof(X11App));
+    app->display = XOpenDisplay(NULL);
+    app->render_display = app->display ? XOpenDisplay(NULL) : NULL;
+    if (!app->render_display) {
+        fprintf(stderr, "Could not open the X display\n");
+        return 1;
+    }
+    if (!create_window(app)) return 1;
+
+    window_data_init(&app->data, window_width, window_height);
+    pthread_t render_thread;
+    if (pthread_create(&render_thread, NULL, render_thread_func, app) != 0) {
+        fprintf(stderr, "Could not start render thread\n");
+        return 1;
+    }
+
+    XMapWindow(app->display, app->window);
+    XFlush(app->display);
+
+    if (resize_count) {
+        run_resize_benchmark(app, resize_count, csv);
+    } else {
+        double last_report_time = 0.0;
+        while (!app->quit) {
+            pump_events(app, 1000);
+            double now = get_time_now();
+            if (now - last_report_time >= 1.0) {
+                report_sync_latency(app);
+                fflush(stdout);
+                last_report_time = now;
+            }
+        }
+    }
+    report_sync_latency(app);
+
+    // Stop and wait on render thread before exiting
+    window_post_flags(&app->data, EVENT_TERMINATE);
+    pthread_join(render_thread, NULL);
+
+    if (app->sync_counter != None) XSyncDestroyCounter(app->display, app->sync_counter);
+    XDestroyWindow(app->display, app->window);
+    XCloseDisplay(app->render_display);
+    XCloseDisplay(app->display);
+    window_data_destroy(&app->data);
+    free(app);
+    return 0;
+}
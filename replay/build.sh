@@ -0,0 +1,9 @@
+#!/bin/sh
+# Builds the headless trace replayer on Linux. Needs EGL and a GL 3.3 core
+# driver (Mesa's llvmpipe works without a GPU). Run from the root of the repo.
+
+mkdir -p build
+
+cmd="cc -O2 -DGLAD_MX -Iinclude -Isrc -Ilinux replay/gl_replay.c linux/handshake.c src/glad.c src/glad_exts.c -o build/gl_replay -lEGL -lpthread -ldl -lm"
+echo $cmd
+$cmd
@@ -0,0 +1,507 @@
+// Replays a trace written with --capture (see src/gl_trace.h) on a headless
+// EGL context, as fast as the driver allows, and reports the CPU time spent
+// submitting each frame and the GPU time it took.
+//
+// Usage: gl_replay <trace> [--csv]
+//
+// The default framebuffer of the captured window is replaced by a texture
+// backed framebuffer as large as the largest frame. Frames end at the
+// captured presents. CPU time leaves out time spent waiting on fences, which
+// is reported on its own; GPU time runs from one frame boundary to the next.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <EGL/egl.h>
+
+#include "glad/glad.h"
+#include "gl_trace.h"
+#include "handshake.h"
+
+// ----- Name maps
+// --------------------------------------------------
+
+// Captured name -> replayed name, for one namespace
+typedef struct {
+    GLuint *names;
+    uint32_t capacity;
+} NameMap;
+
+static void name_map_set(NameMap *map, GLuint captured, GLuint name) {
+    if (captured >= map->capacity) {
+        uint32_t capacity = map->capacity ? map->capacity : 64;
+        while (capacity <= captured) capacity *= 2;
+        map->names = (GLuint*)realloc(map->names, capacity * sizeof(GLuint));
+        memset(map->names + map->capacity, 0, (capacity - map->capacity) * sizeof(GLuint));
+        map->capacity = capacity;
+    }
+    map->names[captured] = name;
+}
+
+static GLuint name_map_get(const NameMap *map, GLuint captured) {
+    return captured < map->capacity ? map->names[captured] : 0;
+}
+
+// Uniform locations and block indices are per program
+typedef struct {
+    GLuint program; // Captured name
+    GLint captured;
+    GLint replayed;
+} ProgramSlot;
+
+typedef struct {
+    ProgramSlot *slots;
+    int count;
+    int capacity;
+} ProgramSlotMap;
+
+static void slot_map_set(ProgramSlotMap *map, GLuint program, GLint captured, GLint replayed) {
+    for (int i = 0; i < map->count; i++) {
+        if (map->slots[i].program == program && map->slots[i].captured == captured) {
+            map->slots[i].replayed = replayed;
+            return;
+        }
+    }
+    if (map->count == map->capacity) {
+        map->capacity = map->capacity ? map->capacity * 2 : 64;
+        map->slots = (ProgramSlot*)realloc(map->slots, map->capacity * sizeof(ProgramSlot));
+    }
+    ProgramSlot slot = { program, captured, replayed };
+    map->slots[map->count++] = slot;
+}
+
+// Unknown slots are assumed to be the same on both drivers
+static GLint slot_map_get(const ProgramSlotMap *map, GLuint program, GLint captured) {
+    for (int i = 0; i < map->count; i++) {
+        if (map->slots[i].program == program && map->slots[i].captured == captured) return map->slots[i].replayed;
+    }
+    return captured;
+}
+
+#define MAX_SYNCS 256
+#define MAX_MAPPINGS 8
+
+typedef struct {
+    NameMap buffers;
+    NameMap textures;
+    NameMap vertex_arrays;
+    NameMap framebuffers;
+    NameMap programs; // Shaders too: they share one namespace
+    ProgramSlotMap locations;
+    ProgramSlotMap blocks;
+    GLuint current_program; // Captured name
+
+    uint64_t captured_syncs[MAX_SYNCS];
+    GLsync syncs[MAX_SYNCS];
+
+    GLenum mapped_targets[MAX_MAPPINGS];
+    void *mapped[MAX_MAPPINGS];
+
+    GLuint backbuffer; // Stands in for framebuffer 0
+    double wait_seconds;
+    uint64_t calls;
+    uint64_t unknown;
+} Replayer;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t word64(const uint32_t *words, int index) {
+    return (uint64_t)words[index] | ((uint64_t)words[index + 1] << 32);
+}
+
+static float word_float(uint32_t word) {
+    float value;
+    memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+static GLuint framebuffer_name(const Replayer *replayer, GLuint captured) {
+    return captured ? name_map_get(&replayer->framebuffers, captured) : replayer->backbuffer;
+}
+
+static int find_sync(const Replayer *replayer, uint64_t captured) {
+    for (int i = 0; i < MAX_SYNCS; i++) {
+        if (replayer->syncs[i] && replayer->captured_syncs[i] == captured) return i;
+    }
+    return -1;
+}
+
+// Names arrive without a terminator
+static const char *terminated(const uint8_t *data, uint32_t size) {
+    static char name[256];
+    uint32_t length = size < sizeof(name) - 1 ? size : (uint32_t)sizeof(name) - 1;
+    memcpy(name, data, length);
+    name[length] = 0;
+    return name;
+}
+
+// ----- Replay
+// --------------------------------------------------
+
+typedef void (APIENTRYP PFNGENPROC)(GLsizei n, GLuint *names);
+typedef void (APIENTRYP PFNDELETEPROC)(GLsizei n, const GLuint *names);
+
+static void replay_gen(NameMap *map, PFNGENPROC gen, const uint8_t *data, uint32_t size) {
+    for (uint32_t i = 0; i < size / 4; i++) {
+        GLuint captured, name;
+        memcpy(&captured, data + i * 4, 4);
+        gen(1, &name);
+        name_map_set(map, captured, name);
+    }
+}
+
+static void replay_delete(NameMap *map, PFNDELETEPROC del, const uint8_t *data, uint32_t size) {
+    for (uint32_t i = 0; i < size / 4; i++) {
+        GLuint captured;
+        memcpy(&captured, data + i * 4, 4);
+        GLuint name = name_map_get(map, captured);
+        if (name) del(1, &name);
+        name_map_set(map, captured, 0);
+    }
+}
+
+static void replay_uniform(Replayer *replayer, const uint32_t *w, const uint8_t *data) {
+    GLint location = slot_map_get(&replayer->locations, replayer->current_program, (GLint)w[1]);
+    if (location < 0) return;
+    GLsizei count = (GLsizei)w[2];
+    const GLfloat *floats = (const GLfloat*)data;
+    switch (w[0]) {
+    case GL_TRACE_UNIFORM_FLOAT: glUniform1fv(location, count, floats); break;
+    case GL_TRACE_UNIFORM_VEC2: glUniform2fv(location, count, floats); break;
+    case GL_TRACE_UNIFORM_VEC3: glUniform3fv(location, count, floats); break;
+    case GL_TRACE_UNIFORM_VEC4: glUniform4fv(location, count, floats); break;
+    case GL_TRACE_UNIFORM_INT: glUniform1iv(location, count, (const GLint*)data); break;
+    case GL_TRACE_UNIFORM_MAT4: glUniformMatrix4fv(location, count, GL_FALSE, floats); break;
+    }
+}
+
+static void replay_record(Replayer *replayer, const GLTraceRecord *record, const uint32_t *w, const uint8_t *data) {
+    replayer->calls++;
+    switch (record->opcode) {
+    case GL_TRACE_GEN_BUFFERS: replay_gen(&replayer->buffers, glGenBuffers, data, record->data_size); break;
+    case GL_TRACE_GEN_TEXTURES: replay_gen(&replayer->textures, glGenTextures, data, record->data_size); break;
+    case GL_TRACE_GEN_VERTEX_ARRAYS: replay_gen(&replayer->vertex_arrays, glGenVertexArrays, data, record->data_size); break;
+    case GL_TRACE_GEN_FRAMEBUFFERS: replay_gen(&replayer->framebuffers, glGenFramebuffers, data, record->data_size); break;
+    case GL_TRACE_DELETE_BUFFERS: replay_delete(&replayer->buffers, glDeleteBuffers, data, record->data_size); break;
+    case GL_TRACE_DELETE_TEXTURES: replay_delete(&replayer->textures, glDeleteTextures, data, record->data_size); break;
+    case GL_TRACE_DELETE_VERTEX_ARRAYS:
+        replay_delete(&replayer->vertex_arrays, glDeleteVertexArrays, data, record->data_size);
+        break;
+    case GL_TRACE_DELETE_FRAMEBUFFERS:
+        replay_delete(&replayer->framebuffers, glDeleteFramebuffers, data, record->data_size);
+        break;
+
+    case GL_TRACE_CREATE_SHADER: name_map_set(&replayer->programs, w[1], glCreateShader(w[0])); break;
+    case GL_TRACE_SHADER_SOURCE: {
+        const GLchar *source = (const GLchar*)data;
+        GLint length = (GLint)record->data_size;
+        glShaderSource(name_map_get(&replayer->programs, w[0]), 1, &source, &length);
+    } break;
+    case GL_TRACE_COMPILE_SHADER: glCompileShader(name_map_get(&replayer->programs, w[0])); break;
+    case GL_TRACE_DELETE_SHADER: glDeleteShader(name_map_get(&replayer->programs, w[0])); break;
+    case GL_TRACE_CREATE_PROGRAM: name_map_set(&replayer->programs, w[0], glCreateProgram()); break;
+    case GL_TRACE_ATTACH_SHADER:
+        glAttachShader(name_map_get(&replayer->programs, w[0]), name_map_get(&replayer->programs, w[1]));
+        break;
+    case GL_TRACE_PROGRAM_PARAMETERI:
+        glProgramParameteri(name_map_get(&replayer->programs, w[0]), w[1], (GLint)w[2]);
+        break;
+    case GL_TRACE_LINK_PROGRAM: glLinkProgram(name_map_get(&replayer->programs, w[0])); break;
+    case GL_TRACE_DELETE_PROGRAM: glDeleteProgram(name_map_get(&replayer->programs, w[0])); break;
+    case GL_TRACE_USE_PROGRAM:
+        replayer->current_program = w[0];
+        glUseProgram(name_map_get(&replayer->programs, w[0]));
+        break;
+    case GL_TRACE_GET_UNIFORM_LOCATION: {
+        GLint location = glGetUniformLocation(name_map_get(&replayer->programs, w[0]),
+                                              terminated(data, record->data_size));
+        slot_map_set(&replayer->locations, w[0], (GLint)w[1], location);
+    } break;
+    case GL_TRACE_GET_UNIFORM_BLOCK_INDEX:
+    case GL_TRACE_GET_ACTIVE_UNIFORM_BLOCK_NAME: {
+        GLuint index = glGetUniformBlockIndex(name_map_get(&replayer->programs, w[0]),
+                                              terminated(data, record->data_size));
+        slot_map_set(&replayer->blocks, w[0], (GLint)w[1], (GLint)index);
+    } break;
+    case GL_TRACE_UNIFORM_BLOCK_BINDING:
+        glUniformBlockBinding(name_map_get(&replayer->programs, w[0]),
+                              (GLuint)slot_map_get(&replayer->blocks, w[0], (GLint)w[1]), w[2]);
+        break;
+    case GL_TRACE_UNIFORM: replay_uniform(replayer, w, data); break;
+
+    case GL_TRACE_BIND_BUFFER: glBindBuffer(w[0], name_map_get(&replayer->buffers, w[1])); break;
+    case GL_TRACE_BIND_BUFFER_RANGE:
+        glBindBufferRange(w[0], w[1], name_map_get(&replayer->buffers, w[2]), (GLintptr)word64(w, 3),
+                          (GLsizeiptr)word64(w, 5));
+        break;
+    case GL_TRACE_BUFFER_DATA: glBufferData(w[0], (GLsizeiptr)word64(w, 1), w[4] ? data : NULL, w[3]); break;
+    case GL_TRACE_BUFFER_SUB_DATA: glBufferSubData(w[0], (GLintptr)word64(w, 1), record->data_size, data); break;
+    case GL_TRACE_MAP_BUFFER_RANGE:
+        for (int i = 0; i < MAX_MAPPINGS; i++) {
+            if (replayer->mapped[i]) continue;
+            replayer->mapped_targets[i] = w[0];
+            replayer->mapped[i] = glMapBufferRange(w[0], (GLintptr)word64(w, 1), (GLsizeiptr)word64(w, 3),
+                                                   w[5] & ~(GLbitfield)GL_MAP_FLUSH_EXPLICIT_BIT);
+            break;
+        }
+        break;
+    case GL_TRACE_UNMAP_BUFFER:
+        for (int i = 0; i < MAX_MAPPINGS; i++) {
+            if (!replayer->mapped[i] || replayer->mapped_targets[i] != w[0]) continue;
+            memcpy(replayer->mapped[i], data, record->data_size);
+            replayer->mapped[i] = NULL;
+            glUnmapBuffer(w[0]);
+            break;
+        }
+        break;
+
+    case GL_TRACE_BIND_VERTEX_ARRAY: glBindVertexArray(name_map_get(&replayer->vertex_arrays, w[0])); break;
+    case GL_TRACE_VERTEX_ATTRIB_POINTER:
+        glVertexAttribPointer(w[0], (GLint)w[1], w[2], (GLboolean)w[3], (GLsizei)w[4],
+                              (const void*)(uintptr_t)word64(w, 5));
+        break;
+    case GL_TRACE_ENABLE_VERTEX_ATTRIB_ARRAY: glEnableVertexAttribArray(w[0]); break;
+    case GL_TRACE_VERTEX_ATTRIB_DIVISOR: glVertexAttribDivisor(w[0], w[1]); break;
+
+    case GL_TRACE_ACTIVE_TEXTURE: glActiveTexture(w[0]); break;
+    case GL_TRACE_BIND_TEXTURE: glBindTexture(w[0], name_map_get(&replayer->textures, w[1])); break;
+    case GL_TRACE_TEX_PARAMETERI: glTexParameteri(w[0], w[1], (GLint)w[2]); break;
+    case GL_TRACE_TEX_IMAGE_2D:
+        glTexImage2D(w[0], (GLint)w[1], (GLint)w[2], (GLsizei)w[3], (GLsizei)w[4], (GLint)w[5], w[6], w[7],
+                     w[10] ? (const void*)data : (const void*)(uintptr_t)word64(w, 8));
+        break;
+    case GL_TRACE_TEX_SUB_IMAGE_2D:
+        glTexSubImage2D(w[0], (GLint)w[1], (GLint)w[2], (GLint)w[3], (GLsizei)w[4], (GLsizei)w[5], w[6], w[7],
+                        w[10] ? (const void*)data : (const void*)(uintptr_t)word64(w, 8));
+        break;
+
+    case GL_TRACE_BIND_FRAMEBUFFER: glBindFramebuffer(w[0], framebuffer_name(replayer, w[1])); break;
+    case GL_TRACE_FRAMEBUFFER_TEXTURE_2D:
+        glFramebufferTexture2D(w[0], w[1], w[2], name_map_get(&replayer->textures, w[3]), (GLint)w[4]);
+        break;
+    case GL_TRACE_DRAW_BUFFERS: glDrawBuffers((GLsizei)(record->data_size / 4), (const GLenum*)data); break;
+    case GL_TRACE_BLIT_FRAMEBUFFER:
+        glBlitFramebuffer((GLint)w[0], (GLint)w[1], (GLint)w[2], (GLint)w[3], (GLint)w[4], (GLint)w[5],
+                          (GLint)w[6], (GLint)w[7], w[8], w[9]);
+        break;
+
+    case GL_TRACE_ENABLE: glEnable(w[0]); break;
+    case GL_TRACE_DISABLE: glDisable(w[0]); break;
+    case GL_TRACE_BLEND_FUNC: glBlendFunc(w[0], w[1]); break;
+    case GL_TRACE_DEPTH_FUNC: glDepthFunc(w[0]); break;
+    case GL_TRACE_DEPTH_MASK: glDepthMask((GLboolean)w[0]); break;
+    case GL_TRACE_VIEWPORT: glViewport((GLint)w[0], (GLint)w[1], (GLsizei)w[2], (GLsizei)w[3]); break;
+    case GL_TRACE_SCISSOR: glScissor((GLint)w[0], (GLint)w[1], (GLsizei)w[2], (GLsizei)w[3]); break;
+    case GL_TRACE_CLEAR_COLOR:
+        glClearColor(word_float(w[0]), word_float(w[1]), word_float(w[2]), word_float(w[3]));
+        break;
+    case GL_TRACE_CLEAR: glClear(w[0]); break;
+    case GL_TRACE_CLEAR_BUFFERFV: glClearBufferfv(w[0], (GLint)w[1], (const GLfloat*)data); break;
+
+    case GL_TRACE_DRAW_ARRAYS: glDrawArrays(w[0], (GLint)w[1], (GLsizei)w[2]); break;
+    case GL_TRACE_DRAW_ELEMENTS: {
+        const void *indices = (const void*)(uintptr_t)word64(w, 3);
+        GLsizei instances = (GLsizei)w[5];
+        GLint base_vertex = (GLint)w[6];
+        if (instances == 1 && !base_vertex) glDrawElements(w[0], (GLsizei)w[1], w[2], indices);
+        else if (instances == 1) glDrawElementsBaseVertex(w[0], (GLsizei)w[1], w[2], indices, base_vertex);
+        else glDrawElementsInstancedBaseVertex(w[0], (GLsizei)w[1], w[2], indices, instances, base_vertex);
+    } break;
+
+    case GL_TRACE_FENCE_SYNC:
+        for (int i = 0; i < MAX_SYNCS; i++) {
+            if (replayer->syncs[i]) continue;
+            replayer->syncs[i] = glFenceSync(w[0], w[1]);
+            replayer->captured_syncs[i] = word64(w, 2);
+            break;
+        }
+        break;
+    case GL_TRACE_CLIENT_WAIT_SYNC: {
+        int i = find_sync(replayer, word64(w, 0));
+        if (i < 0) break;
+        double start = now_seconds();
+        glClientWaitSync(replayer->syncs[i], w[2], word64(w, 3));
+        replayer->wait_seconds += now_seconds() - start;
+    } break;
+    case GL_TRACE_DELETE_SYNC: {
+        int i = find_sync(replayer, word64(w, 0));
+        if (i < 0) break;
+        glDeleteSync(replayer->syncs[i]);
+        replayer->syncs[i] = NULL;
+    } break;
+    case GL_TRACE_FLUSH: glFlush(); break;
+
+    default:
+        replayer->calls--;
+        replayer->unknown++;
+        break;
+    }
+}
+
+// ----- Main
+// --------------------------------------------------
+
+static void *load_proc(const char *name) {
+    return (void*)eglGetProcAddress(name);
+}
+
+static bool create_context(void) {
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (!eglInitialize(display, NULL, NULL) || !eglBindAPI(EGL_OPENGL_API)) return false;
+
+    EGLint config_attribs[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config;
+    EGLint config_count = 0;
+    if (!eglChooseConfig(display, config_attribs, &config, 1, &config_count) || !config_count) return false;
+
+    EGLint context_attribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE,
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, context_attribs);
+    if (context == EGL_NO_CONTEXT) return false;
+
+    // Frames go to an offscreen framebuffer, so no surface is needed
+    return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context) && gladLoadGLLoader(load_proc);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <trace> [--csv]\n", argv[0]);
+        return 1;
+    }
+    bool csv = argc > 2 && strcmp(argv[2], "--csv") == 0;
+
+    FILE *file = fopen(argv[1], "rb");
+    if (!file) {
+        fprintf(stderr, "Could not open %s\n", argv[1]);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    long file_size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *trace = (uint8_t*)malloc(file_size > 0 ? (size_t)file_size : 1);
+    size_t size = trace ? fread(trace, 1, (size_t)file_size, file) : 0;
+    fclose(file);
+
+    const GLTraceHeader *header = (const GLTraceHeader*)trace;
+    if (size < sizeof(GLTraceHeader) || header->magic != GL_TRACE_MAGIC || header->version != GL_TRACE_VERSION) {
+        fprintf(stderr, "%s is not a version %d trace\n", argv[1], GL_TRACE_VERSION);
+        return 1;
+    }
+
+    // The frames, and the largest extent the backbuffer has to cover
+    int frame_count = 0;
+    int max_width = 1;
+    int max_height = 1;
+    size_t cursor = sizeof(GLTraceHeader);
+    while (cursor + sizeof(GLTraceRecord) <= size) {
+        const GLTraceRecord *record = (const GLTraceRecord*)(trace + cursor);
+        const uint32_t *words = (const uint32_t*)(record + 1);
+        if (record->opcode == GL_TRACE_FRAME) {
+            frame_count++;
+            if ((int)words[1] > max_width) max_width = (int)words[1];
+            if ((int)words[2] > max_height) max_height = (int)words[2];
+        }
+        cursor += sizeof(GLTraceRecord) + record->word_count * 4 + ((record->data_size + 3) & ~3u);
+    }
+
+    if (!create_context()) {
+        fprintf(stderr, "Could not create a GL 3.3 core context\n");
+        return 1;
+    }
+    printf("Replaying %d frames (%.1f MB) on %s\n", frame_count, (double)size / (1024.0 * 1024.0),
+           (const char*)glGetString(GL_RENDERER));
+
+    Replayer replayer;
+    memset(&replayer, 0, sizeof(replayer));
+    GLuint backbuffer_texture;
+    glGenTextures(1, &backbuffer_texture);
+    glBindTexture(GL_TEXTURE_2D, backbuffer_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, max_width, max_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glGenFramebuffers(1, &replayer.backbuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, replayer.backbuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, backbuffer_texture, 0);
+
+    GLuint *queries = (GLuint*)malloc((frame_count + 2) * sizeof(GLuint));
+    double *cpu_ms = (double*)malloc((frame_count + 1) * sizeof(double));
+    double *wait_ms = (double*)malloc((frame_count + 1) * sizeof(double));
+    double *captured_ms = (double*)malloc((frame_count + 1) * sizeof(double));
+    uint64_t *calls = (uint64_t*)malloc((frame_count + 1) * sizeof(uint64_t));
+    glGenQueries(frame_count + 2, queries);
+
+    // GPU time per frame is the gap between timestamps written at the frame
+    // boundaries, which also works where a frame creates the first programs
+    int frame = 0;
+    double replay_start = now_seconds();
+    double frame_start = replay_start;
+    glQueryCounter(queries[0], GL_TIMESTAMP);
+
+    cursor = sizeof(GLTraceHeader);
+    while (cursor + sizeof(GLTraceRecord) <= size) {
+        const GLTraceRecord *record = (const GLTraceRecord*)(trace + cursor);
+        const uint32_t *words = (const uint32_t*)(record + 1);
+        const uint8_t *data = (const uint8_t*)(words + record->word_count);
+        cursor += sizeof(GLTraceRecord) + record->word_count * 4 + ((record->data_size + 3) & ~3u);
+        if (cursor > size) break;
+
+        if (record->opcode != GL_TRACE_FRAME) {
+            replay_record(&replayer, record, words, data);
+            continue;
+        }
+
+        // The present: flushed like a swap would
+        glQueryCounter(queries[frame + 1], GL_TIMESTAMP);
+        glFlush();
+        double end = now_seconds();
+        cpu_ms[frame] = (end - frame_start - replayer.wait_seconds) * 1000.0;
+        wait_ms[frame] = replayer.wait_seconds * 1000.0;
+        captured_ms[frame] = (double)words[3] / 1000.0;
+        calls[frame] = replayer.calls;
+
+        frame++;
+        replayer.wait_seconds = 0.0;
+        replayer.calls = 0;
+        frame_start = end;
+    }
+    glFinish();
+    double replay_seconds = now_seconds() - replay_start;
+
+    double *gpu_ms = (double*)malloc((frame_count + 1) * sizeof(double));
+    uint64_t total_calls = 0;
+    if (csv) printf("frame,calls,cpu_ms,wait_ms,gpu_ms,captured_frame_ms\n");
+    GLuint64 frame_end_ns = 0;
+    glGetQueryObjectui64v(queries[0], GL_QUERY_RESULT, &frame_end_ns);
+    for (int i = 0; i < frame; i++) {
+        GLuint64 frame_start_ns = frame_end_ns;
+        glGetQueryObjectui64v(queries[i + 1], GL_QUERY_RESULT, &frame_end_ns);
+        gpu_ms[i] = (double)(frame_end_ns - frame_start_ns) / 1e6;
+        total_calls += calls[i];
+        if (csv) {
+            printf("%d,%llu,%.3f,%.3f,%.3f,%.3f\n", i, (unsigned long long)calls[i], cpu_ms[i], wait_ms[i],
+                   gpu_ms[i], captured_ms[i]);
+        }
+    }
+
+    printf("%d frames in %.3f s (%.1f frames/s), %.0f calls per frame, GL error 0x%x",
+           frame, replay_seconds, frame ? frame / replay_seconds : 0.0,
+           frame ? (double)total_calls / frame : 0.0, glGetError());
+    if (replayer.unknown) printf(", %llu unknown records skipped", (unsigned long long)replayer.unknown);
+    printf("\n");
+    report_samples("CPU submit", cpu_ms, frame);
+    report_samples("Fence waits", wait_ms, frame);
+    report_samples("GPU", gpu_ms, frame);
+    report_samples("Captured frame", captured_ms, frame);
+    return 0;
+}
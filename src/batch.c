@@ -0,0 +1,235 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "batch.h"
+#include "gl_state.h"
+
+// 64K instances (2.25 MB) per draw keeps a million instances to 16 draws
+#define BATCH_CHUNK_INSTANCES (64 * 1024)
+#define BATCH_INITIAL_CAPACITY 1024
+// Four chunks per region (9 MB) to start with; batch_flush grows the regions
+// to a whole frame of instances. A whole number of instances, so every offset
+// in the stream is also an instance index for the indirect commands.
+#define BATCH_STREAM_REGION_SIZE ((GLsizeiptr)(4 * BATCH_CHUNK_INSTANCES * sizeof(BatchInstance)))
+#define BATCH_MAX_COMMANDS 16
+#define BATCH_INDIRECT_REGION_SIZE ((GLsizeiptr)(64 * BATCH_MAX_COMMANDS * sizeof(DrawElementsIndirectCommand)))
+
+uint32_t pack_rgba8(float r, float g, float b, float a) {
+    uint32_t ri = (uint32_t)(r * 255.0f + 0.5f);
+    uint32_t gi = (uint32_t)(g * 255.0f + 0.5f);
+    uint32_t bi = (uint32_t)(b * 255.0f + 0.5f);
+    uint32_t ai = (uint32_t)(a * 255.0f + 0.5f);
+    return ri | (gi << 8) | (bi << 16) | (ai << 24);
+}
+
+static const VertexAttrib instance_attribs[] = {
+    { BATCH_ATTRIB_TRANSFORM,   4, VERTEX_FLOAT32 },
+    { BATCH_ATTRIB_TRANSLATION, 2, VERTEX_FLOAT32 },
+    { BATCH_ATTRIB_COLOR,       4, VERTEX_UNORM8 },
+    { BATCH_ATTRIB_UV,          4, VERTEX_UNORM16 },
+};
+
+static void set_instance_attribs(BatchRenderer *batch, GLuint buffer, GLintptr base) {
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, buffer);
+    vertex_layout_apply(&batch->instance_layout, base);
+}
+
+// Binding 0 is the unit quad, binding 1 the whole instance stream. Nothing
+// changes per chunk, since base instances select the data.
+static void init_vao_dsa(BatchRenderer *batch) {
+    GLuint vao = batch->vao;
+    glVertexArrayVertexBuffer(vao, 0, batch->quad->vbo, 0, batch->quad->layout->stride);
+    glVertexArrayElementBuffer(vao, batch->quad->ebo);
+    vertex_layout_apply_binding(batch->quad->layout, vao, 0);
+
+    glVertexArrayVertexBuffer(vao, 1, batch->instance_stream.buffer, 0, batch->instance_layout.stride);
+    glVertexArrayBindingDivisor(vao, 1, 1);
+    vertex_layout_apply_binding(&batch->instance_layout, vao, 1);
+}
+
+// Called when the batch program arrives, before any batch state is cached, so this uses GL directly
+bool batch_init(BatchRenderer *batch, const Mesh *quad, GLuint program, GLTier tier) {
+    memset(batch, 0, sizeof(*batch));
+
+    // The CPU-side arrays come first, so running out of memory leaves no GL objects to clean up
+    batch->capacity = BATCH_INITIAL_CAPACITY;
+    batch->instances = (BatchInstance*)malloc(batch->capacity * sizeof(BatchInstance));
+    if (tier == GL_TIER_45) {
+        batch->commands = (DrawElementsIndirectCommand*)malloc(BATCH_MAX_COMMANDS * sizeof(DrawElementsIndirectCommand));
+    }
+    if (!batch->instances || (tier == GL_TIER_45 && !batch->commands)) {
+        free(batch->instances);
+        free(batch->commands);
+        memset(batch, 0, sizeof(*batch));
+        return false;
+    }
+
+    batch->program = program;
+    batch->tier = tier;
+    batch->quad = quad;
+    vertex_layout_init(&batch->instance_layout, instance_attribs,
+                       (int)(sizeof(instance_attribs) / sizeof(instance_attribs[0])));
+    batch->chunk_instances = BATCH_CHUNK_INSTANCES;
+
+    if (tier == GL_TIER_45) {
+        glCreateVertexArrays(1, &batch->vao);
+        stream_buffer_init(&batch->instance_stream, GL_ARRAY_BUFFER, BATCH_STREAM_REGION_SIZE, true);
+        stream_buffer_init(&batch->indirect_stream, GL_DRAW_INDIRECT_BUFFER, BATCH_INDIRECT_REGION_SIZE, true);
+        init_vao_dsa(batch);
+        return true;
+    }
+
+    glGenVertexArrays(1, &batch->vao);
+    glGenBuffers(1, &batch->naive_vbo);
+    stream_buffer_init(&batch->instance_stream, GL_ARRAY_BUFFER, BATCH_STREAM_REGION_SIZE, false);
+
+    glBindVertexArray(batch->vao);
+
+    // Shared unit quad, only its position is read
+    glBindBuffer(GL_ARRAY_BUFFER, quad->vbo);
+    vertex_layout_apply(quad->layout, 0);
+    vertex_layout_enable(quad->layout, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quad->ebo);
+
+    // Instance attribute pointers are set per chunk, since each chunk lands at a different offset
+    vertex_layout_enable(&batch->instance_layout, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void batch_destroy(BatchRenderer *batch) {
+    stream_buffer_destroy(&batch->instance_stream);
+    if (batch->tier == GL_TIER_45) stream_buffer_destroy(&batch->indirect_stream);
+    if (batch->naive_vbo) glDeleteBuffers(1, &batch->naive_vbo);
+    glDeleteVertexArrays(1, &batch->vao);
+    free(batch->commands);
+    free(batch->instances);
+    memset(batch, 0, sizeof(*batch));
+}
+
+BatchInstance *batch_push(BatchRenderer *batch) {
+    if (batch->count == batch->capacity) {
+        size_t new_capacity = batch->capacity * 2;
+        BatchInstance *grown = (BatchInstance*)realloc(batch->instances, new_capacity * sizeof(BatchInstance));
+        if (!grown) return NULL;
+        batch->instances = grown;
+        batch->capacity = new_capacity;
+    }
+    return &batch->instances[batch->count++];
+}
+
+void batch_push_rect(BatchRenderer *batch, float x, float y, float width, float height, float rotation, uint32_t color) {
+    BatchInstance *instance = batch_push(batch);
+    if (!instance) return;
+
+    float c = cosf(rotation);
+    float s = sinf(rotation);
+    instance->transform[0] = c * width;
+    instance->transform[1] = s * width;
+    instance->transform[2] = -s * height;
+    instance->transform[3] = c * height;
+    instance->translation[0] = x;
+    instance->translation[1] = y;
+    instance->color = color;
+    instance->uv[0] = 0;
+    instance->uv[1] = 0;
+    instance->uv[2] = 0xFFFF;
+    instance->uv[3] = 0xFFFF;
+}
+
+// Draws the pending commands. Must happen before the instance stream moves to
+// its next region, since that fences the region these commands read from.
+static void draw_commands(BatchRenderer *batch) {
+    if (!batch->command_count) return;
+
+    GLsizeiptr size = (GLsizeiptr)(batch->command_count * sizeof(DrawElementsIndirectCommand));
+    GLintptr offset;
+    if (stream_buffer_write(&batch->indirect_stream, batch->commands, size, sizeof(GLuint), &offset)) {
+        gl_state_bind_buffer(GL_DRAW_INDIRECT_BUFFER, batch->indirect_stream.buffer);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, batch->quad->index_type, (void*)offset, (GLsizei)batch->command_count, 0);
+        batch->draw_calls++;
+    }
+    batch->command_count = 0;
+}
+
+static void flush_indirect(BatchRenderer *batch) {
+    for (size_t first = 0; first < batch->count; first += batch->chunk_instances) {
+        size_t count = batch->count - first;
+        if (count > batch->chunk_instances) count = batch->chunk_instances;
+        GLsizeiptr size = (GLsizeiptr)(count * sizeof(BatchInstance));
+
+        if (!stream_buffer_fits(&batch->instance_stream, size, sizeof(BatchInstance)) ||
+            batch->command_count == BATCH_MAX_COMMANDS) {
+            draw_commands(batch);
+        }
+
+        GLintptr offset;
+        if (!stream_buffer_write(&batch->instance_stream, &batch->instances[first], size,
+                                 sizeof(BatchInstance), &offset)) {
+            break;
+        }
+
+        DrawElementsIndirectCommand *command = &batch->commands[batch->command_count++];
+        command->count = (GLuint)batch->quad->index_count;
+        command->instance_count = (GLuint)count;
+        command->first_index = 0;
+        command->base_vertex = 0;
+        command->base_instance = (GLuint)(offset / (GLintptr)sizeof(BatchInstance));
+        batch->bytes_uploaded += (uint64_t)size;
+    }
+
+    draw_commands(batch);
+    stream_buffer_end_frame(&batch->instance_stream);
+    stream_buffer_end_frame(&batch->indirect_stream);
+}
+
+void batch_flush(BatchRenderer *batch) {
+    batch->draw_calls = 0;
+    batch->bytes_uploaded = 0;
+    if (!batch->count) return;
+
+    // One frame per region, so the ring only ever waits on earlier frames
+    if (!batch->naive_upload &&
+        stream_buffer_reserve(&batch->instance_stream, (GLsizeiptr)(batch->count * sizeof(BatchInstance))) &&
+        batch->tier == GL_TIER_45) {
+        glVertexArrayVertexBuffer(batch->vao, 1, batch->instance_stream.buffer, 0, batch->instance_layout.stride);
+    }
+
+    gl_state_bind_vertex_array(batch->vao);
+    gl_state_use_program(batch->program);
+
+    if (batch->tier == GL_TIER_45) {
+        flush_indirect(batch);
+        batch->count = 0;
+        return;
+    }
+
+    for (size_t first = 0; first < batch->count; first += batch->chunk_instances) {
+        size_t count = batch->count - first;
+        if (count > batch->chunk_instances) count = batch->chunk_instances;
+        GLsizeiptr size = (GLsizeiptr)(count * sizeof(BatchInstance));
+
+        if (batch->naive_upload) {
+            gl_state_bind_buffer(GL_ARRAY_BUFFER, batch->naive_vbo);
+            glBufferData(GL_ARRAY_BUFFER, size, &batch->instances[first], GL_STREAM_DRAW);
+            set_instance_attribs(batch, batch->naive_vbo, 0);
+        } else {
+            GLintptr offset;
+            if (!stream_buffer_write(&batch->instance_stream, &batch->instances[first], size,
+                                     sizeof(BatchInstance), &offset)) {
+                break;
+            }
+            set_instance_attribs(batch, batch->instance_stream.buffer, offset);
+        }
+
+        glDrawElementsInstanced(GL_TRIANGLES, batch->quad->index_count, batch->quad->index_type, 0, (GLsizei)count);
+        batch->draw_calls++;
+        batch->bytes_uploaded += (uint64_t)size;
+    }
+
+    if (!batch->naive_upload) stream_buffer_end_frame(&batch->instance_stream);
+    batch->count = 0;
+}
@@ -0,0 +1,88 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+// Instanced quad renderer. Every rectangle, glyph or marker is one instance of
+// the shared unit quad; instance data is streamed each frame and drawn with a
+// handful of glDrawElementsInstanced calls.
+//
+// On GL_TIER_45 the instance stream is persistently mapped and bound to the
+// VAO once; every chunk becomes an indirect command whose base instance points
+// at its data, and each run of chunks is drawn with one glMultiDrawElementsIndirect.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gl_caps.h"
+#include "glad/glad.h"
+#include "stream_buffer.h"
+#include "vertex_format.h"
+
+// Vertex attribute locations used by the instance stream. 0 and 1 belong to the
+// unit quad's position and colour.
+enum BatchAttribLocation {
+    BATCH_ATTRIB_TRANSFORM   = 2,
+    BATCH_ATTRIB_TRANSLATION = 3,
+    BATCH_ATTRIB_COLOR       = 4,
+    BATCH_ATTRIB_UV          = 5,
+};
+
+// Described to GL by the instance layout built in batch_init
+typedef struct {
+    float transform[4];   // Column-major 2x2 applied to the unit quad, in pixels
+    float translation[2]; // Quad centre in pixels from the top-left of the window
+    uint32_t color;       // RGBA8, R in the lowest byte
+    uint16_t uv[4];       // unorm16 (u0, v0, u1, v1)
+} BatchInstance;
+
+// Layout fixed by GL for glMultiDrawElementsIndirect
+typedef struct {
+    GLuint count;
+    GLuint instance_count;
+    GLuint first_index;
+    GLint base_vertex;
+    GLuint base_instance;
+} DrawElementsIndirectCommand;
+
+typedef struct {
+    GLuint vao;
+    GLuint program;
+    GLTier tier;
+    const Mesh *quad;
+    VertexLayout instance_layout;
+
+    StreamBuffer instance_stream;
+    StreamBuffer indirect_stream; // GL_TIER_45 only
+    GLuint naive_vbo;    // Only used when naive_upload is set
+    bool naive_upload;   // Re-specify a buffer with glBufferData per chunk, for comparison (GL_TIER_33)
+
+    BatchInstance *instances;
+    size_t count;
+    size_t capacity;
+
+    size_t chunk_instances; // Instances uploaded per draw, or per indirect command
+    DrawElementsIndirectCommand *commands; // Pending commands for the current run
+    size_t command_count;
+
+    uint64_t draw_calls;    // Per flush, for statistics
+    uint64_t bytes_uploaded;
+} BatchRenderer;
+
+// Instances are drawn as copies of `quad`, which must outlive the batch. tier
+// must not be above gl_caps.tier. Returns false, with nothing to destroy, when
+// out of memory.
+bool batch_init(BatchRenderer *batch, const Mesh *quad, GLuint program, GLTier tier);
+void batch_destroy(BatchRenderer *batch);
+
+// Returns a slot for one instance, growing the CPU-side array as needed
+BatchInstance *batch_push(BatchRenderer *batch);
+void batch_push_rect(BatchRenderer *batch, float x, float y, float width, float height, float rotation, uint32_t color);
+
+// Uploads and draws everything pushed since the last flush. The program's
+// FrameConstants block must already be bound. Each flush fences one region of
+// the instance stream, so flush once per frame.
+void batch_flush(BatchRenderer *batch);
+
+uint32_t pack_rgba8(float r, float g, float b, float a);
+
+#endif
@@ -0,0 +1,289 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "command_list.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+
+enum CommandType {
+    COMMAND_BIND_VERTEX_ARRAY,
+    COMMAND_USE_PROGRAM,
+    COMMAND_BIND_BUFFER,
+    COMMAND_BIND_BUFFER_RANGE,
+    COMMAND_BIND_TEXTURE,
+    COMMAND_UNIFORM,
+    COMMAND_BUFFER_WRITE,
+    COMMAND_DRAW_ARRAYS,
+    COMMAND_DRAW_ELEMENTS,
+};
+
+typedef struct {
+    uint32_t type;
+    uint32_t size; // Of the whole command, header and inline data included
+} CommandHeader;
+
+typedef struct {
+    CommandHeader header;
+    GLenum target;
+    GLuint index; // Also the texture unit
+    GLuint name;
+} BindCommand;
+
+typedef struct {
+    CommandHeader header;
+    GLenum target;
+    GLuint index;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+} BindRangeCommand;
+
+typedef struct {
+    CommandHeader header;
+    int type;
+    GLint location;
+    GLsizei count;
+    // The values follow
+} UniformCommand;
+
+typedef struct {
+    CommandHeader header;
+    GLenum target;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+    // The data follows
+} BufferWriteCommand;
+
+typedef struct {
+    CommandHeader header;
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+} DrawArraysCommand;
+
+typedef struct {
+    CommandHeader header;
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    GLsizei instance_count;
+    GLint base_vertex;
+    size_t offset;
+} DrawElementsCommand;
+
+#define COMMAND_ALIGNMENT 8
+
+static size_t align_command(size_t size) {
+    return (size + COMMAND_ALIGNMENT - 1) & ~(size_t)(COMMAND_ALIGNMENT - 1);
+}
+
+// Space for a command of `size` bytes plus `extra` inline bytes, or NULL once full
+static void *push_command(CommandList *list, uint32_t type, size_t size, size_t extra) {
+    if (list->overflowed) return NULL;
+
+    size_t total = align_command(size + extra);
+    if (total > UINT32_MAX || total > list->capacity - list->size) {
+        list->overflowed = true;
+        return NULL;
+    }
+
+    CommandHeader *header = (CommandHeader*)(list->data + list->size);
+    header->type = type;
+    header->size = (uint32_t)total;
+    list->size += total;
+    list->commands++;
+    return header;
+}
+
+static void push_bind(CommandList *list, uint32_t type, GLenum target, GLuint index, GLuint name) {
+    BindCommand *command = (BindCommand*)push_command(list, type, sizeof(BindCommand), 0);
+    if (!command) return;
+    command->target = target;
+    command->index = index;
+    command->name = name;
+}
+
+static GLsizei uniform_components(int type) {
+    switch (type) {
+    case COMMAND_UNIFORM_FLOAT: return 1;
+    case COMMAND_UNIFORM_VEC2: return 2;
+    case COMMAND_UNIFORM_VEC3: return 3;
+    case COMMAND_UNIFORM_VEC4: return 4;
+    case COMMAND_UNIFORM_INT: return 1;
+    case COMMAND_UNIFORM_MAT4: return 16;
+    }
+    return 0;
+}
+
+bool command_list_init(CommandList *list, size_t capacity) {
+    memset(list, 0, sizeof(*list));
+    list->data = (uint8_t*)malloc(capacity);
+    if (!list->data) return false;
+    list->capacity = capacity;
+    return true;
+}
+
+void command_list_destroy(CommandList *list) {
+    free(list->data);
+    memset(list, 0, sizeof(*list));
+}
+
+void command_list_reset(CommandList *list) {
+    list->size = 0;
+    list->overflowed = false;
+    list->commands = 0;
+    list->draws = 0;
+}
+
+void command_list_bind_vertex_array(CommandList *list, GLuint vao) {
+    push_bind(list, COMMAND_BIND_VERTEX_ARRAY, 0, 0, vao);
+}
+
+void command_list_use_program(CommandList *list, GLuint program) {
+    push_bind(list, COMMAND_USE_PROGRAM, 0, 0, program);
+}
+
+void command_list_bind_buffer(CommandList *list, GLenum target, GLuint buffer) {
+    push_bind(list, COMMAND_BIND_BUFFER, target, 0, buffer);
+}
+
+void command_list_bind_buffer_range(CommandList *list, GLenum target, GLuint index, GLuint buffer,
+                                    GLintptr offset, GLsizeiptr size) {
+    BindRangeCommand *command = (BindRangeCommand*)push_command(list, COMMAND_BIND_BUFFER_RANGE,
+                                                                sizeof(BindRangeCommand), 0);
+    if (!command) return;
+    command->target = target;
+    command->index = index;
+    command->buffer = buffer;
+    command->offset = offset;
+    command->size = size;
+}
+
+void command_list_bind_texture(CommandList *list, GLuint unit, GLenum target, GLuint texture) {
+    push_bind(list, COMMAND_BIND_TEXTURE, target, unit, texture);
+}
+
+void command_list_uniform(CommandList *list, int type, GLint location, GLsizei count, const void *values) {
+    // Both floats and ints are 4 bytes
+    size_t data_size = (size_t)count * (size_t)uniform_components(type) * 4;
+    UniformCommand *command = (UniformCommand*)push_command(list, COMMAND_UNIFORM, sizeof(UniformCommand), data_size);
+    if (!command) return;
+    command->type = type;
+    command->location = location;
+    command->count = count;
+    memcpy(command + 1, values, data_size);
+}
+
+void command_list_buffer_write(CommandList *list, GLenum target, GLuint buffer, GLintptr offset,
+                               const void *data, GLsizeiptr size) {
+    BufferWriteCommand *command = (BufferWriteCommand*)push_command(list, COMMAND_BUFFER_WRITE,
+                                                                    sizeof(BufferWriteCommand), (size_t)size);
+    if (!command) return;
+    command->target = target;
+    command->buffer = buffer;
+    command->offset = offset;
+    command->size = size;
+    memcpy(command + 1, data, (size_t)size);
+}
+
+void command_list_draw_arrays(CommandList *list, GLenum mode, GLint first, GLsizei count) {
+    DrawArraysCommand *command = (DrawArraysCommand*)push_command(list, COMMAND_DRAW_ARRAYS,
+                                                                  sizeof(DrawArraysCommand), 0);
+    if (!command) return;
+    command->mode = mode;
+    command->first = first;
+    command->count = count;
+    list->draws++;
+}
+
+void command_list_draw_elements(CommandList *list, GLenum mode, GLsizei count, GLenum type, size_t offset,
+                                GLsizei instance_count, GLint base_vertex) {
+    DrawElementsCommand *command = (DrawElementsCommand*)push_command(list, COMMAND_DRAW_ELEMENTS,
+                                                                      sizeof(DrawElementsCommand), 0);
+    if (!command) return;
+    command->mode = mode;
+    command->count = count;
+    command->type = type;
+    command->instance_count = instance_count;
+    command->base_vertex = base_vertex;
+    command->offset = offset;
+    list->draws++;
+}
+
+static void replay_uniform(const UniformCommand *command) {
+    const GLfloat *floats = (const GLfloat*)(command + 1);
+    switch (command->type) {
+    case COMMAND_UNIFORM_FLOAT: glUniform1fv(command->location, command->count, floats); break;
+    case COMMAND_UNIFORM_VEC2: glUniform2fv(command->location, command->count, floats); break;
+    case COMMAND_UNIFORM_VEC3: glUniform3fv(command->location, command->count, floats); break;
+    case COMMAND_UNIFORM_VEC4: glUniform4fv(command->location, command->count, floats); break;
+    case COMMAND_UNIFORM_INT: glUniform1iv(command->location, command->count, (const GLint*)(command + 1)); break;
+    case COMMAND_UNIFORM_MAT4: glUniformMatrix4fv(command->location, command->count, GL_FALSE, floats); break;
+    }
+}
+
+static void replay_draw_elements(const DrawElementsCommand *command) {
+    const void *indices = (const void*)command->offset;
+    if (command->base_vertex) {
+        if (command->instance_count == 1) {
+            glDrawElementsBaseVertex(command->mode, command->count, command->type, indices, command->base_vertex);
+        } else {
+            glDrawElementsInstancedBaseVertex(command->mode, command->count, command->type, indices,
+                                              command->instance_count, command->base_vertex);
+        }
+    } else if (command->instance_count == 1) {
+        glDrawElements(command->mode, command->count, command->type, indices);
+    } else {
+        glDrawElementsInstanced(command->mode, command->count, command->type, indices, command->instance_count);
+    }
+}
+
+void command_list_replay(const CommandList *list) {
+    size_t cursor = 0;
+    while (cursor < list->size) {
+        const CommandHeader *header = (const CommandHeader*)(list->data + cursor);
+        cursor += header->size;
+
+        switch (header->type) {
+        case COMMAND_BIND_VERTEX_ARRAY:
+            gl_state_bind_vertex_array(((const BindCommand*)header)->name);
+            break;
+        case COMMAND_USE_PROGRAM:
+            gl_state_use_program(((const BindCommand*)header)->name);
+            break;
+        case COMMAND_BIND_BUFFER: {
+            const BindCommand *command = (const BindCommand*)header;
+            gl_state_bind_buffer(command->target, command->name);
+        } break;
+        case COMMAND_BIND_BUFFER_RANGE: {
+            const BindRangeCommand *command = (const BindRangeCommand*)header;
+            gl_state_bind_buffer_range(command->target, command->index, command->buffer,
+                                       command->offset, command->size);
+        } break;
+        case COMMAND_BIND_TEXTURE: {
+            const BindCommand *command = (const BindCommand*)header;
+            gl_state_bind_texture(command->index, command->target, command->name);
+        } break;
+        case COMMAND_UNIFORM:
+            replay_uniform((const UniformCommand*)header);
+            break;
+        case COMMAND_BUFFER_WRITE: {
+            const BufferWriteCommand *command = (const BufferWriteCommand*)header;
+            if (gl_caps.direct_state_access) {
+                glNamedBufferSubData(command->buffer, command->offset, command->size, command + 1);
+            } else {
+                gl_state_bind_buffer(command->target, command->buffer);
+                glBufferSubData(command->target, command->offset, command->size, command + 1);
+            }
+        } break;
+        case COMMAND_DRAW_ARRAYS: {
+            const DrawArraysCommand *command = (const DrawArraysCommand*)header;
+            glDrawArrays(command->mode, command->first, command->count);
+        } break;
+        case COMMAND_DRAW_ELEMENTS:
+            replay_draw_elements((const DrawElementsCommand*)header);
+            break;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef COMMAND_LIST_H
+#define COMMAND_LIST_H
+
+// A deferred list of GL commands. Recording makes no GL calls, so any thread
+// can build a list while the render thread is busy; the render thread then
+// replays it in order, issuing the calls recording them stood for (binds go
+// through the gl_state cache, as they would have when called directly).
+//
+// Commands are packed back to back into one buffer allocated at init: a
+// header, the arguments, then any inline data (uniform values, buffer
+// contents), padded to 8 bytes. Recording never allocates; a command that
+// doesn't fit sets `overflowed` and is dropped along with everything after
+// it, and replaying an overflowed list replays the commands that did fit.
+//
+// A list belongs to one thread at a time. Handing it between threads is up to
+// the caller, under whatever lock hands over the rest of the frame.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+enum CommandUniformType {
+    COMMAND_UNIFORM_FLOAT,
+    COMMAND_UNIFORM_VEC2,
+    COMMAND_UNIFORM_VEC3,
+    COMMAND_UNIFORM_VEC4,
+    COMMAND_UNIFORM_INT,
+    COMMAND_UNIFORM_MAT4,
+};
+
+typedef struct {
+    uint8_t *data;
+    size_t capacity;
+    size_t size;
+    bool overflowed;
+
+    // Since the last reset
+    uint32_t commands;
+    uint32_t draws;
+} CommandList;
+
+bool command_list_init(CommandList *list, size_t capacity);
+void command_list_destroy(CommandList *list);
+
+// Empties the list for recording again; the buffer is kept
+void command_list_reset(CommandList *list);
+
+void command_list_bind_vertex_array(CommandList *list, GLuint vao);
+void command_list_use_program(CommandList *list, GLuint program);
+void command_list_bind_buffer(CommandList *list, GLenum target, GLuint buffer);
+void command_list_bind_buffer_range(CommandList *list, GLenum target, GLuint index, GLuint buffer,
+                                    GLintptr offset, GLsizeiptr size);
+void command_list_bind_texture(CommandList *list, GLuint unit, GLenum target, GLuint texture);
+
+// Sets `count` elements of a uniform (an array when count > 1) of the program
+// in use at replay; the values are copied into the list
+void command_list_uniform(CommandList *list, int type, GLint location, GLsizei count, const void *values);
+
+// glBufferSubData, or glNamedBufferSubData with direct state access; the data
+// is copied into the list
+void command_list_buffer_write(CommandList *list, GLenum target, GLuint buffer, GLintptr offset,
+                               const void *data, GLsizeiptr size);
+
+void command_list_draw_arrays(CommandList *list, GLenum mode, GLint first, GLsizei count);
+// `offset` is in bytes into the bound element buffer. Replays as the plainest
+// draw call the instance count and base vertex allow.
+void command_list_draw_elements(CommandList *list, GLenum mode, GLsizei count, GLenum type, size_t offset,
+                                GLsizei instance_count, GLint base_vertex);
+
+// Render thread only, with the context current
+void command_list_replay(const CommandList *list);
+
+#endif
@@ -0,0 +1,104 @@
+#include "damage.h"
+
+static int64_t rect_area(DamageRect rect) {
+    return (int64_t)rect.width * rect.height;
+}
+
+// Touching rectangles count too, so neighbouring strips become one draw
+static bool rects_touch(DamageRect a, DamageRect b) {
+    return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+           a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+static DamageRect rect_union(DamageRect a, DamageRect b) {
+    int x0 = a.x < b.x ? a.x : b.x;
+    int y0 = a.y < b.y ? a.y : b.y;
+    int x1 = a.x + a.width > b.x + b.width ? a.x + a.width : b.x + b.width;
+    int y1 = a.y + a.height > b.y + b.height ? a.y + a.height : b.y + b.height;
+    DamageRect rect = { x0, y0, x1 - x0, y1 - y0 };
+    return rect;
+}
+
+static void remove_rect(DamageRegion *region, int index) {
+    region->rects[index] = region->rects[--region->count];
+}
+
+static void insert_rect(DamageRegion *region, DamageRect rect) {
+    // Swallow everything the new rectangle touches; the union may touch more
+    for (int i = 0; i < region->count;) {
+        if (rects_touch(region->rects[i], rect)) {
+            rect = rect_union(region->rects[i], rect);
+            remove_rect(region, i);
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (region->count == DAMAGE_MAX_RECTS) {
+        // Merge the cheapest pair, counting the new rectangle as a candidate
+        int best_a = 0;
+        int best_b = 0;
+        int64_t best_waste = INT64_MAX;
+        for (int a = 0; a <= region->count; a++) {
+            DamageRect ra = a < region->count ? region->rects[a] : rect;
+            for (int b = a + 1; b <= region->count; b++) {
+                DamageRect rb = b < region->count ? region->rects[b] : rect;
+                int64_t waste = rect_area(rect_union(ra, rb)) - rect_area(ra) - rect_area(rb);
+                if (waste < best_waste) {
+                    best_waste = waste;
+                    best_a = a;
+                    best_b = b;
+                }
+            }
+        }
+
+        // b > a, so removing b first leaves a's index valid
+        DamageRect ra = region->rects[best_a];
+        DamageRect rb = best_b < region->count ? region->rects[best_b] : rect;
+        if (best_b < region->count) {
+            remove_rect(region, best_b);
+            remove_rect(region, best_a);
+            region->rects[region->count++] = rect;
+        } else {
+            remove_rect(region, best_a);
+        }
+        insert_rect(region, rect_union(ra, rb));
+        return;
+    }
+
+    region->rects[region->count++] = rect;
+    region->full = region->count == 1 && rect.x == 0 && rect.y == 0 &&
+                   rect.width == region->width && rect.height == region->height;
+}
+
+void damage_reset(DamageRegion *region, int width, int height) {
+    region->width = width;
+    region->height = height;
+    region->full = false;
+    region->count = 0;
+}
+
+void damage_add(DamageRegion *region, int x, int y, int width, int height) {
+    if (region->full) return;
+
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + width > region->width ? region->width : x + width;
+    int y1 = y + height > region->height ? region->height : y + height;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    DamageRect rect = { x0, y0, x1 - x0, y1 - y0 };
+    insert_rect(region, rect);
+}
+
+void damage_add_full(DamageRegion *region) {
+    damage_reset(region, region->width, region->height);
+    damage_add(region, 0, 0, region->width, region->height);
+}
+
+int64_t damage_area(const DamageRegion *region) {
+    int64_t area = 0;
+    for (int i = 0; i < region->count; i++) area += rect_area(region->rects[i]);
+    return area;
+}
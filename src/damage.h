@@ -0,0 +1,39 @@
+#ifndef DAMAGE_H
+#define DAMAGE_H
+
+// The parts of a render target that changed since it was last drawn, as a
+// short list of rectangles in GL window coordinates (origin bottom left).
+// Rectangles never overlap, so the region's area is the pixels to shade.
+// Overlapping and touching rectangles are merged as they are added; past
+// DAMAGE_MAX_RECTS the pair whose union wastes the fewest pixels is merged,
+// trading a little overdraw for a bounded number of scissored draws.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DAMAGE_MAX_RECTS 8
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} DamageRect;
+
+typedef struct {
+    int width; // Bounds everything added is clipped to
+    int height;
+    bool full; // One rectangle covering the bounds
+    DamageRect rects[DAMAGE_MAX_RECTS];
+    int count;
+} DamageRegion;
+
+// Empties the region and sets its bounds
+void damage_reset(DamageRegion *region, int width, int height);
+
+void damage_add(DamageRegion *region, int x, int y, int width, int height);
+void damage_add_full(DamageRegion *region);
+
+int64_t damage_area(const DamageRegion *region);
+
+#endif
@@ -0,0 +1,451 @@
+#include <stdio.h>
+#include <string.h>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "frame_graph.h"
+#include "gl_state.h"
+
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static uint64_t fnv1a_str(uint64_t hash, const char *str) {
+    return fnv1a(hash, str, strlen(str) + 1);
+}
+
+static int scaled_size(int extent, float scale) {
+    int size = (int)((float)extent * scale + 0.5f);
+    return size > 0 ? size : 1;
+}
+
+static uint64_t texel_size(FrameGraphFormat format) {
+    return format == FRAME_GRAPH_RGBA16F ? 8 : 4;
+}
+
+static void log_error(const char *message, const char *name) {
+    char buf[256];
+    sprintf_s(buf, sizeof(buf), "Frame graph: %s '%s'\n", message, name);
+    OutputDebugStringA(buf);
+}
+
+// --------------------------------------------------
+// ----- Declaration
+// --------------------------------------------------
+void frame_graph_begin(FrameGraph *graph, int width, int height) {
+    graph->pass_count = 0;
+    graph->resource_count = 0;
+    graph->width = width;
+    graph->height = height;
+    graph->overflowed = false;
+    graph->cursor = 0;
+}
+
+static int add_resource(FrameGraph *graph, const char *name) {
+    if (graph->resource_count == FRAME_GRAPH_MAX_RESOURCES) {
+        graph->overflowed = true;
+        return -1;
+    }
+    FrameGraphResource *resource = &graph->resources[graph->resource_count];
+    memset(resource, 0, sizeof(*resource));
+    resource->name = name;
+    return graph->resource_count++;
+}
+
+int frame_graph_create_texture(FrameGraph *graph, const char *name, FrameGraphFormat format, float scale) {
+    int handle = add_resource(graph, name);
+    if (handle < 0) return -1;
+    graph->resources[handle].format = format;
+    graph->resources[handle].scale = scale;
+    return handle;
+}
+
+int frame_graph_import(FrameGraph *graph, const char *name, GLuint texture, GLuint framebuffer, int width, int height) {
+    int handle = add_resource(graph, name);
+    if (handle < 0) return -1;
+    FrameGraphResource *resource = &graph->resources[handle];
+    resource->imported = true;
+    resource->texture = texture;
+    resource->framebuffer = framebuffer;
+    resource->width = width;
+    resource->height = height;
+    return handle;
+}
+
+int frame_graph_add_pass(FrameGraph *graph, const char *name, int tag) {
+    if (graph->pass_count == FRAME_GRAPH_MAX_PASSES) {
+        graph->overflowed = true;
+        return -1;
+    }
+    FrameGraphPass *pass = &graph->passes[graph->pass_count];
+    memset(pass, 0, sizeof(*pass));
+    pass->name = name;
+    pass->tag = tag;
+    return graph->pass_count++;
+}
+
+void frame_graph_read(FrameGraph *graph, int pass, int resource) {
+    if (pass < 0 || resource < 0) return;
+    FrameGraphPass *declared = &graph->passes[pass];
+    if (declared->read_count == FRAME_GRAPH_MAX_READS) {
+        graph->overflowed = true;
+        return;
+    }
+    declared->reads[declared->read_count++] = resource;
+}
+
+void frame_graph_write(FrameGraph *graph, int pass, int resource) {
+    if (pass < 0 || resource < 0) return;
+    FrameGraphPass *declared = &graph->passes[pass];
+    if (declared->write_count == FRAME_GRAPH_MAX_WRITES) {
+        graph->overflowed = true;
+        return;
+    }
+    declared->writes[declared->write_count++] = resource;
+}
+
+void frame_graph_keep(FrameGraph *graph, int pass) {
+    if (pass >= 0) graph->passes[pass].keep = true;
+}
+
+// --------------------------------------------------
+// ----- Compilation
+// --------------------------------------------------
+// Covers everything but imported handles and sizes, which may change freely
+static uint64_t declaration_hash(const FrameGraph *graph) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (int i = 0; i < graph->resource_count; i++) {
+        const FrameGraphResource *resource = &graph->resources[i];
+        hash = fnv1a_str(hash, resource->name);
+        hash = fnv1a(hash, &resource->imported, sizeof(resource->imported));
+        if (!resource->imported) {
+            hash = fnv1a(hash, &resource->format, sizeof(resource->format));
+            hash = fnv1a(hash, &resource->scale, sizeof(resource->scale));
+        }
+    }
+    for (int i = 0; i < graph->pass_count; i++) {
+        const FrameGraphPass *pass = &graph->passes[i];
+        hash = fnv1a_str(hash, pass->name);
+        hash = fnv1a(hash, &pass->tag, sizeof(pass->tag));
+        hash = fnv1a(hash, &pass->keep, sizeof(pass->keep));
+        hash = fnv1a(hash, &pass->read_count, sizeof(pass->read_count));
+        hash = fnv1a(hash, pass->reads, (size_t)pass->read_count * sizeof(int));
+        hash = fnv1a(hash, &pass->write_count, sizeof(pass->write_count));
+        hash = fnv1a(hash, pass->writes, (size_t)pass->write_count * sizeof(int));
+    }
+    return hash;
+}
+
+static bool pass_writes(const FrameGraphPass *pass, int resource) {
+    for (int i = 0; i < pass->write_count; i++) {
+        if (pass->writes[i] == resource) return true;
+    }
+    return false;
+}
+
+static bool pass_touches(const FrameGraphPass *pass, int resource) {
+    for (int i = 0; i < pass->read_count; i++) {
+        if (pass->reads[i] == resource) return true;
+    }
+    return pass_writes(pass, resource);
+}
+
+static void release_plan(FrameGraph *graph) {
+    for (int i = 0; i < FRAME_GRAPH_MAX_PASSES; i++) {
+        if (graph->plans[i].framebuffer) glDeleteFramebuffers(1, &graph->plans[i].framebuffer);
+    }
+    for (int i = 0; i < graph->texture_count; i++) glDeleteTextures(1, &graph->textures[i].texture);
+    memset(graph->plans, 0, sizeof(graph->plans));
+    graph->texture_count = 0;
+    graph->order_count = 0;
+    graph->compiled = false;
+    gl_state_invalidate(); // Deleted objects may still be bound
+}
+
+void frame_graph_destroy(FrameGraph *graph) {
+    release_plan(graph);
+    memset(graph, 0, sizeof(*graph));
+}
+
+static void specify_texture(FrameGraph *graph, FrameGraphTexture *texture) {
+    texture->width = scaled_size(graph->width, texture->scale);
+    texture->height = scaled_size(graph->height, texture->scale);
+
+    bool half = texture->format == FRAME_GRAPH_RGBA16F;
+    gl_state_bind_texture(0, GL_TEXTURE_2D, texture->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, half ? GL_RGBA16F : GL_RGBA8, texture->width, texture->height, 0, GL_RGBA,
+                 half ? GL_HALF_FLOAT : GL_UNSIGNED_BYTE, NULL);
+}
+
+static void count_bytes(FrameGraph *graph) {
+    graph->transient_bytes = 0;
+    graph->unaliased_bytes = 0;
+    for (int i = 0; i < graph->texture_count; i++) {
+        const FrameGraphTexture *texture = &graph->textures[i];
+        graph->transient_bytes += (uint64_t)texture->width * (uint64_t)texture->height * texel_size(texture->format);
+    }
+    for (int i = 0; i < graph->resource_count; i++) {
+        if (graph->physical[i] < 0) continue;
+        const FrameGraphTexture *texture = &graph->textures[graph->physical[i]];
+        graph->unaliased_bytes += (uint64_t)texture->width * (uint64_t)texture->height * texel_size(texture->format);
+    }
+}
+
+// Same plan, new extent: the textures are respecified in place and stay attached
+static void resize_textures(FrameGraph *graph) {
+    for (int i = 0; i < graph->texture_count; i++) specify_texture(graph, &graph->textures[i]);
+    graph->compiled_width = graph->width;
+    graph->compiled_height = graph->height;
+    graph->resizes++;
+    count_bytes(graph);
+}
+
+// Bit j of deps[i] is set when pass i must run after pass j. Readers depend on
+// every writer of what they read, except that a pass which both reads and
+// writes a texture sees only the writers declared before it; writers of one
+// texture keep their declared order.
+static void build_dependencies(const FrameGraph *graph, uint32_t *deps) {
+    for (int i = 0; i < graph->pass_count; i++) {
+        const FrameGraphPass *pass = &graph->passes[i];
+        deps[i] = 0;
+        for (int j = 0; j < graph->pass_count; j++) {
+            if (j == i) continue;
+            const FrameGraphPass *other = &graph->passes[j];
+            for (int r = 0; r < pass->read_count; r++) {
+                int resource = pass->reads[r];
+                if (pass_writes(other, resource) && (j < i || !pass_writes(pass, resource))) deps[i] |= 1u << j;
+            }
+            for (int w = 0; w < pass->write_count; w++) {
+                if (j < i && pass_writes(other, pass->writes[w])) deps[i] |= 1u << j;
+            }
+        }
+    }
+}
+
+// Passes that write an imported texture or are kept, and everything they depend on
+static void mark_live(FrameGraph *graph, const uint32_t *deps) {
+    uint32_t live = 0;
+    for (int i = 0; i < graph->pass_count; i++) {
+        const FrameGraphPass *pass = &graph->passes[i];
+        bool root = pass->keep;
+        for (int w = 0; w < pass->write_count; w++) root = root || graph->resources[pass->writes[w]].imported;
+        if (root) live |= 1u << i;
+    }
+
+    uint32_t previous;
+    do {
+        previous = live;
+        for (int i = 0; i < graph->pass_count; i++) {
+            if (live & (1u << i)) live |= deps[i];
+        }
+    } while (live != previous);
+
+    graph->culled_passes = 0;
+    for (int i = 0; i < graph->pass_count; i++) {
+        graph->plans[i].live = (live & (1u << i)) != 0;
+        if (!graph->plans[i].live) graph->culled_passes++;
+    }
+}
+
+// Topological order, taking the earliest declared pass that is ready each time
+static bool order_passes(FrameGraph *graph, const uint32_t *deps) {
+    uint32_t done = 0;
+    uint32_t pending = 0;
+    for (int i = 0; i < graph->pass_count; i++) {
+        if (graph->plans[i].live) pending |= 1u << i;
+    }
+
+    graph->order_count = 0;
+    while (pending) {
+        int next = -1;
+        for (int i = 0; i < graph->pass_count && next < 0; i++) {
+            if ((pending & (1u << i)) && (deps[i] & ~done) == 0) next = i;
+        }
+        if (next < 0) return false;
+
+        graph->order[graph->order_count++] = next;
+        done |= 1u << next;
+        pending &= ~(1u << next);
+    }
+    return true;
+}
+
+// Walks the order once; a transient takes the first compatible texture whose
+// last user ran before the transient's first one
+static void assign_textures(FrameGraph *graph) {
+    int first[FRAME_GRAPH_MAX_RESOURCES];
+    int last[FRAME_GRAPH_MAX_RESOURCES];
+    for (int r = 0; r < graph->resource_count; r++) {
+        first[r] = -1;
+        last[r] = -1;
+        graph->physical[r] = -1;
+        if (graph->resources[r].imported) continue;
+
+        for (int position = 0; position < graph->order_count; position++) {
+            if (!pass_touches(&graph->passes[graph->order[position]], r)) continue;
+            if (first[r] < 0) first[r] = position;
+            last[r] = position;
+        }
+    }
+
+    for (int position = 0; position < graph->order_count; position++) {
+        for (int r = 0; r < graph->resource_count; r++) {
+            if (first[r] != position) continue;
+            const FrameGraphResource *resource = &graph->resources[r];
+
+            int chosen = -1;
+            for (int t = 0; t < graph->texture_count && chosen < 0; t++) {
+                const FrameGraphTexture *texture = &graph->textures[t];
+                if (texture->format == resource->format && texture->scale == resource->scale &&
+                    texture->free_after < position) {
+                    chosen = t;
+                }
+            }
+            if (chosen < 0) {
+                chosen = graph->texture_count++;
+                FrameGraphTexture *texture = &graph->textures[chosen];
+                memset(texture, 0, sizeof(*texture));
+                texture->format = resource->format;
+                texture->scale = resource->scale;
+                glGenTextures(1, &texture->texture);
+                specify_texture(graph, texture);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            }
+            graph->textures[chosen].free_after = last[r];
+            graph->physical[r] = chosen;
+        }
+    }
+
+    // Clear each transient at its first write, which is where its lifetime starts
+    for (int position = 0; position < graph->order_count; position++) {
+        int index = graph->order[position];
+        const FrameGraphPass *pass = &graph->passes[index];
+        for (int w = 0; w < pass->write_count; w++) {
+            if (first[pass->writes[w]] == position) graph->plans[index].clear |= 1u << w;
+        }
+    }
+}
+
+static bool create_framebuffers(FrameGraph *graph) {
+    for (int position = 0; position < graph->order_count; position++) {
+        int index = graph->order[position];
+        const FrameGraphPass *pass = &graph->passes[index];
+        if (!pass->write_count) continue;
+
+        bool imported = graph->resources[pass->writes[0]].imported;
+        for (int w = 1; w < pass->write_count; w++) {
+            if (graph->resources[pass->writes[w]].imported != imported || imported) {
+                log_error("a pass may write one imported texture, or only transients:", pass->name);
+                return false;
+            }
+        }
+        if (imported) continue;
+
+        GLenum draw_buffers[FRAME_GRAPH_MAX_WRITES];
+        GLuint *framebuffer = &graph->plans[index].framebuffer;
+        glGenFramebuffers(1, framebuffer);
+        gl_state_bind_framebuffer(GL_FRAMEBUFFER, *framebuffer);
+        for (int w = 0; w < pass->write_count; w++) {
+            const FrameGraphTexture *texture = &graph->textures[graph->physical[pass->writes[w]]];
+            draw_buffers[w] = GL_COLOR_ATTACHMENT0 + w;
+            glFramebufferTexture2D(GL_FRAMEBUFFER, draw_buffers[w], GL_TEXTURE_2D, texture->texture, 0);
+        }
+        glDrawBuffers(pass->write_count, draw_buffers);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            log_error("incomplete framebuffer for pass", pass->name);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool frame_graph_compile(FrameGraph *graph) {
+    if (graph->overflowed) {
+        if (graph->compiled) release_plan(graph);
+        OutputDebugStringA("Frame graph: too many passes, resources, reads or writes\n");
+        return false;
+    }
+
+    uint64_t hash = declaration_hash(graph);
+    if (graph->compiled && hash == graph->compiled_hash) {
+        if (graph->width != graph->compiled_width || graph->height != graph->compiled_height) resize_textures(graph);
+        return false;
+    }
+
+    release_plan(graph);
+    graph->compiled_hash = hash;
+    graph->compiled_width = graph->width;
+    graph->compiled_height = graph->height;
+
+    uint32_t deps[FRAME_GRAPH_MAX_PASSES];
+    build_dependencies(graph, deps);
+    mark_live(graph, deps);
+    if (!order_passes(graph, deps)) {
+        OutputDebugStringA("Frame graph: passes depend on each other in a cycle\n");
+        release_plan(graph);
+        return false;
+    }
+    assign_textures(graph);
+    if (!create_framebuffers(graph)) {
+        release_plan(graph);
+        return false;
+    }
+
+    count_bytes(graph);
+    graph->compiled = true;
+    graph->compiles++;
+
+    char buf[256];
+    sprintf_s(buf, sizeof(buf),
+              "Frame graph: %d passes (%d culled), %d transient textures for %.1f MB (%.1f MB without aliasing)\n",
+              graph->order_count, graph->culled_passes, graph->texture_count,
+              (double)graph->transient_bytes / (1024.0 * 1024.0), (double)graph->unaliased_bytes / (1024.0 * 1024.0));
+    OutputDebugStringA(buf);
+    return true;
+}
+
+// --------------------------------------------------
+// ----- Execution
+// --------------------------------------------------
+const FrameGraphPass *frame_graph_next(FrameGraph *graph) {
+    if (!graph->compiled || graph->cursor >= graph->order_count) return NULL;
+
+    int index = graph->order[graph->cursor++];
+    const FrameGraphPass *pass = &graph->passes[index];
+    const FrameGraphPassPlan *plan = &graph->plans[index];
+    if (!pass->write_count) return pass;
+
+    const FrameGraphResource *target = &graph->resources[pass->writes[0]];
+    if (target->imported) {
+        gl_state_bind_framebuffer(GL_FRAMEBUFFER, target->framebuffer);
+        gl_state_viewport(0, 0, target->width, target->height);
+        return pass;
+    }
+
+    const FrameGraphTexture *texture = &graph->textures[graph->physical[pass->writes[0]]];
+    gl_state_bind_framebuffer(GL_FRAMEBUFFER, plan->framebuffer);
+    gl_state_viewport(0, 0, texture->width, texture->height);
+
+    static const float transparent[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int w = 0; w < pass->write_count; w++) {
+        if (plan->clear & (1u << w)) glClearBufferfv(GL_COLOR, w, transparent);
+    }
+    return pass;
+}
+
+GLuint frame_graph_texture(const FrameGraph *graph, int resource) {
+    if (resource < 0 || resource >= graph->resource_count) return 0;
+    if (graph->resources[resource].imported) return graph->resources[resource].texture;
+    int physical = graph->compiled ? graph->physical[resource] : -1;
+    return physical >= 0 ? graph->textures[physical].texture : 0;
+}
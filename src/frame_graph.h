@@ -0,0 +1,129 @@
+#ifndef FRAME_GRAPH_H
+#define FRAME_GRAPH_H
+
+// A declarative frame graph. Every frame the passes are declared again, each
+// with the textures it reads and writes; compiling culls passes whose results
+// never reach an imported texture, orders the rest so every reader runs after
+// the writers of what it reads, and backs the transient textures with as few
+// GL textures as their lifetimes allow. Transients of the same format and scale
+// share a texture whenever one is dead before the other is first written.
+//
+// Compiling is cheap when nothing changed: the declaration is hashed, and the
+// plan is only rebuilt when the hash changes. A new extent alone keeps the
+// plan and just respecifies the textures behind it.
+//
+// Transients are cleared by the graph before their first writer runs, since
+// an aliased texture holds whatever its previous user left in it.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+#define FRAME_GRAPH_MAX_PASSES 32
+#define FRAME_GRAPH_MAX_RESOURCES 32
+#define FRAME_GRAPH_MAX_READS 8
+#define FRAME_GRAPH_MAX_WRITES 4
+
+typedef enum {
+    FRAME_GRAPH_RGBA8,
+    FRAME_GRAPH_RGBA16F,
+} FrameGraphFormat;
+
+typedef struct {
+    const char *name;
+    bool imported;
+    FrameGraphFormat format;
+    float scale; // Of the graph's extent
+
+    // Imported textures only; these may change every frame without a recompile
+    GLuint texture;
+    GLuint framebuffer;
+    int width;
+    int height;
+} FrameGraphResource;
+
+typedef struct {
+    const char *name;
+    int tag;   // Chosen by the caller, to tell passes apart when executing
+    bool keep; // Never culled, for passes with effects outside the graph
+    int reads[FRAME_GRAPH_MAX_READS];
+    int read_count;
+    int writes[FRAME_GRAPH_MAX_WRITES];
+    int write_count;
+} FrameGraphPass;
+
+// The plan for one declared pass, valid while the declaration hash holds
+typedef struct {
+    bool live;
+    GLuint framebuffer; // Owned by the graph, unless the pass writes an imported texture
+    GLbitfield clear;   // Attachments written for the first time this frame, as a bit per write
+} FrameGraphPassPlan;
+
+// Transients are compatible when format and scale match, whatever the extent
+typedef struct {
+    FrameGraphFormat format;
+    float scale;
+    int width;
+    int height;
+    GLuint texture;
+    int free_after; // Last position in the order that uses it, while compiling
+} FrameGraphTexture;
+
+typedef struct {
+    // Declared since frame_graph_begin
+    FrameGraphPass passes[FRAME_GRAPH_MAX_PASSES];
+    int pass_count;
+    FrameGraphResource resources[FRAME_GRAPH_MAX_RESOURCES];
+    int resource_count;
+    int width;
+    int height;
+    bool overflowed;
+
+    // Compiled
+    bool compiled;
+    uint64_t compiled_hash;
+    int compiled_width;
+    int compiled_height;
+    FrameGraphPassPlan plans[FRAME_GRAPH_MAX_PASSES];
+    int order[FRAME_GRAPH_MAX_PASSES]; // Live passes, in execution order
+    int order_count;
+    int physical[FRAME_GRAPH_MAX_RESOURCES]; // Index into textures, -1 when unused or imported
+    FrameGraphTexture textures[FRAME_GRAPH_MAX_RESOURCES];
+    int texture_count;
+    int cursor;
+
+    // Statistics
+    uint64_t compiles;
+    uint64_t resizes;
+    int culled_passes;
+    uint64_t transient_bytes; // Behind the transients now
+    uint64_t unaliased_bytes; // What they would take with a texture each
+} FrameGraph;
+
+void frame_graph_destroy(FrameGraph *graph);
+
+// Starts a new declaration; transient sizes are relative to width x height
+void frame_graph_begin(FrameGraph *graph, int width, int height);
+
+// Resources return a handle, or -1 when the graph is full
+int frame_graph_create_texture(FrameGraph *graph, const char *name, FrameGraphFormat format, float scale);
+int frame_graph_import(FrameGraph *graph, const char *name, GLuint texture, GLuint framebuffer, int width, int height);
+
+int frame_graph_add_pass(FrameGraph *graph, const char *name, int tag);
+void frame_graph_read(FrameGraph *graph, int pass, int resource);
+void frame_graph_write(FrameGraph *graph, int pass, int resource);
+void frame_graph_keep(FrameGraph *graph, int pass);
+
+// Returns true when the plan had to be rebuilt. On a cycle, or a pass mixing
+// imported and transient writes, logs it and returns false with no plan.
+bool frame_graph_compile(FrameGraph *graph);
+
+// The next pass to run, with its framebuffer bound, its viewport set and its
+// new transients cleared; NULL after the last one
+const FrameGraphPass *frame_graph_next(FrameGraph *graph);
+
+// The GL texture behind a resource, for the passes that read it
+GLuint frame_graph_texture(const FrameGraph *graph, int resource);
+
+#endif
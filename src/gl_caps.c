@@ -0,0 +1,44 @@
+#include <stdio.h>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "gl_caps.h"
+
+GLCaps gl_caps;
+
+void gl_caps_detect(GLTier max_tier) {
+    gl_caps.buffer_storage = GLAD_GL_ARB_buffer_storage != 0;
+    gl_caps.direct_state_access = GLAD_GL_ARB_direct_state_access != 0;
+    // Without base instance every indirect command would read instances from offset 0
+    gl_caps.multi_draw_indirect = GLAD_GL_ARB_multi_draw_indirect && GLAD_GL_ARB_draw_indirect &&
+                                  GLAD_GL_ARB_base_instance;
+
+    gl_caps.tier = GL_TIER_33;
+    if (gl_caps.buffer_storage && gl_caps.direct_state_access && gl_caps.multi_draw_indirect) {
+        gl_caps.tier = GL_TIER_45;
+    }
+    if (gl_caps.tier > max_tier) gl_caps.tier = max_tier;
+
+    // Below 4.5 the renderer takes the 3.3 path everywhere, including the
+    // places that only check for one of the features
+    if (gl_caps.tier < GL_TIER_45) {
+        gl_caps.buffer_storage = false;
+        gl_caps.direct_state_access = false;
+        gl_caps.multi_draw_indirect = false;
+    }
+
+    char buf[160];
+    sprintf_s(buf, sizeof(buf), "GL tier: %s (buffer storage %d, DSA %d, multi-draw-indirect %d)\n",
+              gl_tier_name(gl_caps.tier), gl_caps.buffer_storage, gl_caps.direct_state_access,
+              gl_caps.multi_draw_indirect);
+    OutputDebugStringA(buf);
+}
+
+const char *gl_tier_name(GLTier tier) {
+    switch (tier) {
+    case GL_TIER_33: return "3.3";
+    case GL_TIER_45: return "4.5";
+    default: return "?";
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef GL_CAPS_H
+#define GL_CAPS_H
+
+// Capability tiers. The renderer is written against GL 3.3 core and only
+// switches to a faster path for uploads, draws and state setup when every
+// feature that path relies on is present. Detected once after the loader has
+// run; the 3.3 tier always works.
+
+#include <stdbool.h>
+
+#include "glad/glad.h"
+
+typedef enum {
+    GL_TIER_33, // glMapBufferRange streaming, per-draw attribute pointers, bind-to-edit
+    GL_TIER_45, // Persistent mapped buffers, multi-draw-indirect, direct state access
+    GL_TIER_COUNT,
+} GLTier;
+
+typedef struct {
+    GLTier tier;
+
+    bool buffer_storage;      // Immutable storage, persistent + coherent maps
+    bool direct_state_access; // glCreate*, glNamedBuffer*, glVertexArray*
+    bool multi_draw_indirect; // glMultiDrawElementsIndirect with a base instance per command
+} GLCaps;
+
+extern GLCaps gl_caps;
+
+// Picks the highest tier the current context supports, but never above
+// max_tier. The feature flags are only set on GL_TIER_45.
+void gl_caps_detect(GLTier max_tier);
+
+const char *gl_tier_name(GLTier tier);
+
+#endif
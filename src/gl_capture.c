@@ -0,0 +1,789 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "gl_capture.h"
+#include "gl_trace.h"
+
+#define GL_CAPTURE_MAX_TABLES 4
+#define GL_CAPTURE_MAX_MAPPINGS 8
+#define GL_CAPTURE_BUFFER_SIZE (4 * 1024 * 1024)
+
+typedef struct {
+    GLenum target;
+    void *ptr;
+    GLsizeiptr length;
+} CaptureMapping;
+
+typedef struct {
+    GladGLContext *table;
+    GladGLContext real; // What the wrappers call through
+
+    // State the wrappers need to know how much data a call reads; only
+    // touched by the thread the table belongs to
+    GLuint unpack_buffer;
+    CaptureMapping mappings[GL_CAPTURE_MAX_MAPPINGS];
+} CaptureTable;
+
+static struct {
+    bool active;
+    HANDLE file;
+    CRITICAL_SECTION crit_sect;
+    uint8_t buffer[GL_CAPTURE_BUFFER_SIZE];
+    size_t buffered;
+
+    // Registered by their own threads, which are the only ones looking them up
+    CaptureTable tables[GL_CAPTURE_MAX_TABLES];
+    int table_count;
+
+    uint32_t frames;
+    uint64_t records;
+    uint64_t bytes;
+    LARGE_INTEGER last_frame_count;
+} capture;
+
+// ----- Writing records
+// --------------------------------------------------
+
+static void flush_buffer(void) {
+    DWORD written = 0;
+    if (capture.buffered) WriteFile(capture.file, capture.buffer, (DWORD)capture.buffered, &written, NULL);
+    capture.bytes += capture.buffered;
+    capture.buffered = 0;
+}
+
+static void append(const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t*)data;
+    while (size) {
+        if (capture.buffered == GL_CAPTURE_BUFFER_SIZE) flush_buffer();
+        size_t chunk = GL_CAPTURE_BUFFER_SIZE - capture.buffered;
+        if (chunk > size) chunk = size;
+        memcpy(capture.buffer + capture.buffered, bytes, chunk);
+        capture.buffered += chunk;
+        bytes += chunk;
+        size -= chunk;
+    }
+}
+
+// A record is written between begin and end, under the lock, so records from
+// different threads never interleave. Returns false when not capturing.
+static bool record_begin(uint32_t opcode, const uint32_t *words, int word_count, size_t data_size) {
+    EnterCriticalSection(&capture.crit_sect);
+    if (!capture.active) {
+        LeaveCriticalSection(&capture.crit_sect);
+        return false;
+    }
+
+    GLTraceRecord record;
+    record.opcode = (uint16_t)opcode;
+    record.word_count = (uint16_t)word_count;
+    record.data_size = (uint32_t)data_size;
+    append(&record, sizeof(record));
+    append(words, word_count * sizeof(uint32_t));
+    capture.records++;
+    return true;
+}
+
+static void record_end(size_t data_size) {
+    static const uint8_t padding[4] = {};
+    append(padding, (4 - data_size % 4) % 4);
+    LeaveCriticalSection(&capture.crit_sect);
+}
+
+static void record(uint32_t opcode, const uint32_t *words, int word_count, const void *data, size_t data_size) {
+    if (!record_begin(opcode, words, word_count, data_size)) return;
+    append(data, data_size);
+    record_end(data_size);
+}
+
+#define WORDS(...) const uint32_t words[] = { __VA_ARGS__ }
+#define RECORD(opcode) record(opcode, words, sizeof(words) / sizeof(words[0]), NULL, 0)
+#define RECORD_DATA(opcode, data, size) record(opcode, words, sizeof(words) / sizeof(words[0]), data, size)
+#define LO(value) (uint32_t)(uint64_t)(value)
+#define HI(value) (uint32_t)((uint64_t)(value) >> 32)
+
+static uint32_t float_bits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// The calling thread's table; every caller has attached it
+static CaptureTable *current_table(void) {
+#ifdef GLAD_MX
+    GladGLContext *current = gladGetCurrentContextGL();
+    for (int i = 0; i < capture.table_count; i++) {
+        if (capture.tables[i].table == current) return &capture.tables[i];
+    }
+#endif
+    return &capture.tables[0];
+}
+
+#define REAL (current_table()->real)
+
+// Bytes glTex(Sub)Image2D reads from client memory, at the default unpack
+// alignment of 4, which this renderer never changes
+static size_t image_size(GLsizei width, GLsizei height, GLenum format, GLenum type) {
+    size_t components = 4;
+    switch (format) {
+    case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: components = 1; break;
+    case GL_RG: case GL_RG_INTEGER: components = 2; break;
+    case GL_RGB: case GL_BGR: components = 3; break;
+    }
+
+    size_t pixel_size = components;
+    switch (type) {
+    case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: pixel_size = components * 2; break;
+    case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: pixel_size = components * 4; break;
+    case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+    case GL_UNSIGNED_INT_2_10_10_10_REV: pixel_size = 4; break;
+    }
+
+    if (width <= 0 || height <= 0) return 0;
+    size_t row_size = ((size_t)width * pixel_size + 3) & ~(size_t)3;
+    return row_size * (size_t)(height - 1) + (size_t)width * pixel_size;
+}
+
+// ----- Wrappers
+// --------------------------------------------------
+
+static void record_names(uint32_t opcode, GLsizei n, const GLuint *names) {
+    record(opcode, NULL, 0, names, (size_t)n * sizeof(GLuint));
+}
+
+static void APIENTRY capture_glGenBuffers(GLsizei n, GLuint *buffers) {
+    REAL.GenBuffers(n, buffers);
+    record_names(GL_TRACE_GEN_BUFFERS, n, buffers);
+}
+
+static void APIENTRY capture_glGenTextures(GLsizei n, GLuint *textures) {
+    REAL.GenTextures(n, textures);
+    record_names(GL_TRACE_GEN_TEXTURES, n, textures);
+}
+
+static void APIENTRY capture_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    REAL.GenVertexArrays(n, arrays);
+    record_names(GL_TRACE_GEN_VERTEX_ARRAYS, n, arrays);
+}
+
+static void APIENTRY capture_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    REAL.GenFramebuffers(n, framebuffers);
+    record_names(GL_TRACE_GEN_FRAMEBUFFERS, n, framebuffers);
+}
+
+static void APIENTRY capture_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    REAL.DeleteBuffers(n, buffers);
+    record_names(GL_TRACE_DELETE_BUFFERS, n, buffers);
+}
+
+static void APIENTRY capture_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    REAL.DeleteTextures(n, textures);
+    record_names(GL_TRACE_DELETE_TEXTURES, n, textures);
+}
+
+static void APIENTRY capture_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    REAL.DeleteVertexArrays(n, arrays);
+    record_names(GL_TRACE_DELETE_VERTEX_ARRAYS, n, arrays);
+}
+
+static void APIENTRY capture_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    REAL.DeleteFramebuffers(n, framebuffers);
+    record_names(GL_TRACE_DELETE_FRAMEBUFFERS, n, framebuffers);
+}
+
+static GLuint APIENTRY capture_glCreateShader(GLenum type) {
+    GLuint shader = REAL.CreateShader(type);
+    WORDS(type, shader);
+    RECORD(GL_TRACE_CREATE_SHADER);
+    return shader;
+}
+
+static void APIENTRY capture_glShaderSource(GLuint shader, GLsizei count, const GLchar *const *strings,
+                                            const GLint *lengths) {
+    REAL.ShaderSource(shader, count, strings, lengths);
+
+    size_t size = 0;
+    for (GLsizei i = 0; i < count; i++) {
+        size += lengths && lengths[i] >= 0 ? (size_t)lengths[i] : strlen(strings[i]);
+    }
+    WORDS(shader);
+    if (!record_begin(GL_TRACE_SHADER_SOURCE, words, 1, size)) return;
+    for (GLsizei i = 0; i < count; i++) {
+        append(strings[i], lengths && lengths[i] >= 0 ? (size_t)lengths[i] : strlen(strings[i]));
+    }
+    record_end(size);
+}
+
+static void APIENTRY capture_glCompileShader(GLuint shader) {
+    REAL.CompileShader(shader);
+    WORDS(shader);
+    RECORD(GL_TRACE_COMPILE_SHADER);
+}
+
+static void APIENTRY capture_glDeleteShader(GLuint shader) {
+    REAL.DeleteShader(shader);
+    WORDS(shader);
+    RECORD(GL_TRACE_DELETE_SHADER);
+}
+
+static GLuint APIENTRY capture_glCreateProgram(void) {
+    GLuint program = REAL.CreateProgram();
+    WORDS(program);
+    RECORD(GL_TRACE_CREATE_PROGRAM);
+    return program;
+}
+
+static void APIENTRY capture_glAttachShader(GLuint program, GLuint shader) {
+    REAL.AttachShader(program, shader);
+    WORDS(program, shader);
+    RECORD(GL_TRACE_ATTACH_SHADER);
+}
+
+static void APIENTRY capture_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    REAL.ProgramParameteri(program, pname, value);
+    WORDS(program, pname, (uint32_t)value);
+    RECORD(GL_TRACE_PROGRAM_PARAMETERI);
+}
+
+static void APIENTRY capture_glLinkProgram(GLuint program) {
+    REAL.LinkProgram(program);
+    WORDS(program);
+    RECORD(GL_TRACE_LINK_PROGRAM);
+}
+
+static void APIENTRY capture_glDeleteProgram(GLuint program) {
+    REAL.DeleteProgram(program);
+    WORDS(program);
+    RECORD(GL_TRACE_DELETE_PROGRAM);
+}
+
+static void APIENTRY capture_glUseProgram(GLuint program) {
+    REAL.UseProgram(program);
+    WORDS(program);
+    RECORD(GL_TRACE_USE_PROGRAM);
+}
+
+static GLint APIENTRY capture_glGetUniformLocation(GLuint program, const GLchar *name) {
+    GLint location = REAL.GetUniformLocation(program, name);
+    WORDS(program, (uint32_t)location);
+    RECORD_DATA(GL_TRACE_GET_UNIFORM_LOCATION, name, strlen(name));
+    return location;
+}
+
+static GLuint APIENTRY capture_glGetUniformBlockIndex(GLuint program, const GLchar *name) {
+    GLuint index = REAL.GetUniformBlockIndex(program, name);
+    WORDS(program, index);
+    RECORD_DATA(GL_TRACE_GET_UNIFORM_BLOCK_INDEX, name, strlen(name));
+    return index;
+}
+
+static void APIENTRY capture_glGetActiveUniformBlockName(GLuint program, GLuint index, GLsizei buffer_size,
+                                                         GLsizei *length, GLchar *name) {
+    REAL.GetActiveUniformBlockName(program, index, buffer_size, length, name);
+    if (buffer_size <= 0) return;
+    WORDS(program, index);
+    RECORD_DATA(GL_TRACE_GET_ACTIVE_UNIFORM_BLOCK_NAME, name, strlen(name));
+}
+
+static void APIENTRY capture_glUniformBlockBinding(GLuint program, GLuint index, GLuint binding) {
+    REAL.UniformBlockBinding(program, index, binding);
+    WORDS(program, index, binding);
+    RECORD(GL_TRACE_UNIFORM_BLOCK_BINDING);
+}
+
+static void record_uniform(uint32_t type, GLint location, GLsizei count, const void *values, size_t value_size) {
+    WORDS(type, (uint32_t)location, (uint32_t)count);
+    RECORD_DATA(GL_TRACE_UNIFORM, values, (size_t)count * value_size);
+}
+
+static void APIENTRY capture_glUniform1i(GLint location, GLint v0) {
+    REAL.Uniform1i(location, v0);
+    record_uniform(GL_TRACE_UNIFORM_INT, location, 1, &v0, sizeof(GLint));
+}
+
+static void APIENTRY capture_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    REAL.Uniform1iv(location, count, value);
+    record_uniform(GL_TRACE_UNIFORM_INT, location, count, value, sizeof(GLint));
+}
+
+static void APIENTRY capture_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    REAL.Uniform1fv(location, count, value);
+    record_uniform(GL_TRACE_UNIFORM_FLOAT, location, count, value, sizeof(GLfloat));
+}
+
+static void APIENTRY capture_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    REAL.Uniform2f(location, v0, v1);
+    GLfloat value[2] = { v0, v1 };
+    record_uniform(GL_TRACE_UNIFORM_VEC2, location, 1, value, sizeof(value));
+}
+
+static void APIENTRY capture_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    REAL.Uniform2fv(location, count, value);
+    record_uniform(GL_TRACE_UNIFORM_VEC2, location, count, value, 2 * sizeof(GLfloat));
+}
+
+static void APIENTRY capture_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    REAL.Uniform3fv(location, count, value);
+    record_uniform(GL_TRACE_UNIFORM_VEC3, location, count, value, 3 * sizeof(GLfloat));
+}
+
+static void APIENTRY capture_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    REAL.Uniform4f(location, v0, v1, v2, v3);
+    GLfloat value[4] = { v0, v1, v2, v3 };
+    record_uniform(GL_TRACE_UNIFORM_VEC4, location, 1, value, sizeof(value));
+}
+
+static void APIENTRY capture_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    REAL.Uniform4fv(location, count, value);
+    record_uniform(GL_TRACE_UNIFORM_VEC4, location, count, value, 4 * sizeof(GLfloat));
+}
+
+// Matrices are recorded column major, as the replayer sets them
+static void APIENTRY capture_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose,
+                                                const GLfloat *value) {
+    REAL.UniformMatrix4fv(location, count, transpose, value);
+    if (!transpose) {
+        record_uniform(GL_TRACE_UNIFORM_MAT4, location, count, value, 16 * sizeof(GLfloat));
+        return;
+    }
+    for (GLsizei i = 0; i < count; i++) {
+        GLfloat matrix[16];
+        for (int j = 0; j < 16; j++) matrix[j] = value[i * 16 + (j % 4) * 4 + j / 4];
+        record_uniform(GL_TRACE_UNIFORM_MAT4, location + i, 1, matrix, sizeof(matrix));
+    }
+}
+
+static void APIENTRY capture_glBindBuffer(GLenum target, GLuint buffer) {
+    REAL.BindBuffer(target, buffer);
+    if (target == GL_PIXEL_UNPACK_BUFFER) current_table()->unpack_buffer = buffer;
+    WORDS(target, buffer);
+    RECORD(GL_TRACE_BIND_BUFFER);
+}
+
+static void APIENTRY capture_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset,
+                                               GLsizeiptr size) {
+    REAL.BindBufferRange(target, index, buffer, offset, size);
+    WORDS(target, index, buffer, LO(offset), HI(offset), LO(size), HI(size));
+    RECORD(GL_TRACE_BIND_BUFFER_RANGE);
+}
+
+static void APIENTRY capture_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    REAL.BufferData(target, size, data, usage);
+    WORDS(target, LO(size), HI(size), usage, data != NULL);
+    RECORD_DATA(GL_TRACE_BUFFER_DATA, data, data ? (size_t)size : 0);
+}
+
+static void APIENTRY capture_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    REAL.BufferSubData(target, offset, size, data);
+    WORDS(target, LO(offset), HI(offset));
+    RECORD_DATA(GL_TRACE_BUFFER_SUB_DATA, data, (size_t)size);
+}
+
+static void *APIENTRY capture_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length,
+                                               GLbitfield access) {
+    void *ptr = REAL.MapBufferRange(target, offset, length, access);
+    if (!ptr) return ptr;
+
+    CaptureTable *table = current_table();
+    for (int i = 0; i < GL_CAPTURE_MAX_MAPPINGS; i++) {
+        if (!table->mappings[i].ptr) {
+            table->mappings[i].target = target;
+            table->mappings[i].ptr = ptr;
+            table->mappings[i].length = length;
+            break;
+        }
+    }
+    WORDS(target, LO(offset), HI(offset), LO(length), HI(length), access);
+    RECORD(GL_TRACE_MAP_BUFFER_RANGE);
+    return ptr;
+}
+
+// What was written through the mapping is recorded before it goes away
+static GLboolean APIENTRY capture_glUnmapBuffer(GLenum target) {
+    CaptureTable *table = current_table();
+    const void *ptr = NULL;
+    size_t length = 0;
+    for (int i = 0; i < GL_CAPTURE_MAX_MAPPINGS; i++) {
+        if (table->mappings[i].ptr && table->mappings[i].target == target) {
+            ptr = table->mappings[i].ptr;
+            length = (size_t)table->mappings[i].length;
+            table->mappings[i].ptr = NULL;
+            break;
+        }
+    }
+    WORDS(target);
+    RECORD_DATA(GL_TRACE_UNMAP_BUFFER, ptr, length);
+    return table->real.UnmapBuffer(target);
+}
+
+static void APIENTRY capture_glBindVertexArray(GLuint array) {
+    REAL.BindVertexArray(array);
+    WORDS(array);
+    RECORD(GL_TRACE_BIND_VERTEX_ARRAY);
+}
+
+static void APIENTRY capture_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                                                   GLsizei stride, const void *pointer) {
+    REAL.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+    WORDS(index, (uint32_t)size, type, normalized, (uint32_t)stride, LO((uintptr_t)pointer), HI((uintptr_t)pointer));
+    RECORD(GL_TRACE_VERTEX_ATTRIB_POINTER);
+}
+
+static void APIENTRY capture_glEnableVertexAttribArray(GLuint index) {
+    REAL.EnableVertexAttribArray(index);
+    WORDS(index);
+    RECORD(GL_TRACE_ENABLE_VERTEX_ATTRIB_ARRAY);
+}
+
+static void APIENTRY capture_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    REAL.VertexAttribDivisor(index, divisor);
+    WORDS(index, divisor);
+    RECORD(GL_TRACE_VERTEX_ATTRIB_DIVISOR);
+}
+
+static void APIENTRY capture_glActiveTexture(GLenum texture) {
+    REAL.ActiveTexture(texture);
+    WORDS(texture);
+    RECORD(GL_TRACE_ACTIVE_TEXTURE);
+}
+
+static void APIENTRY capture_glBindTexture(GLenum target, GLuint texture) {
+    REAL.BindTexture(target, texture);
+    WORDS(target, texture);
+    RECORD(GL_TRACE_BIND_TEXTURE);
+}
+
+static void APIENTRY capture_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    REAL.TexParameteri(target, pname, param);
+    WORDS(target, pname, (uint32_t)param);
+    RECORD(GL_TRACE_TEX_PARAMETERI);
+}
+
+// With a pixel unpack buffer bound the pointer is an offset into it, and
+// the buffer's contents were recorded when they were written
+static void APIENTRY capture_glTexImage2D(GLenum target, GLint level, GLint internal_format, GLsizei width,
+                                          GLsizei height, GLint border, GLenum format, GLenum type,
+                                          const void *pixels) {
+    REAL.TexImage2D(target, level, internal_format, width, height, border, format, type, pixels);
+    bool has_data = pixels && !current_table()->unpack_buffer;
+    WORDS(target, (uint32_t)level, (uint32_t)internal_format, (uint32_t)width, (uint32_t)height,
+          (uint32_t)border, format, type, LO((uintptr_t)pixels), HI((uintptr_t)pixels), has_data);
+    RECORD_DATA(GL_TRACE_TEX_IMAGE_2D, pixels, has_data ? image_size(width, height, format, type) : 0);
+}
+
+static void APIENTRY capture_glTexSubImage2D(GLenum target, GLint level, GLint x, GLint y, GLsizei width,
+                                             GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    REAL.TexSubImage2D(target, level, x, y, width, height, format, type, pixels);
+    bool has_data = pixels && !current_table()->unpack_buffer;
+    WORDS(target, (uint32_t)level, (uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height,
+          format, type, LO((uintptr_t)pixels), HI((uintptr_t)pixels), has_data);
+    RECORD_DATA(GL_TRACE_TEX_SUB_IMAGE_2D, pixels, has_data ? image_size(width, height, format, type) : 0);
+}
+
+static void APIENTRY capture_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    REAL.BindFramebuffer(target, framebuffer);
+    WORDS(target, framebuffer);
+    RECORD(GL_TRACE_BIND_FRAMEBUFFER);
+}
+
+static void APIENTRY capture_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget,
+                                                    GLuint texture, GLint level) {
+    REAL.FramebufferTexture2D(target, attachment, textarget, texture, level);
+    WORDS(target, attachment, textarget, texture, (uint32_t)level);
+    RECORD(GL_TRACE_FRAMEBUFFER_TEXTURE_2D);
+}
+
+static void APIENTRY capture_glDrawBuffers(GLsizei n, const GLenum *buffers) {
+    REAL.DrawBuffers(n, buffers);
+    record(GL_TRACE_DRAW_BUFFERS, NULL, 0, buffers, (size_t)n * sizeof(GLenum));
+}
+
+static void APIENTRY capture_glBlitFramebuffer(GLint src_x0, GLint src_y0, GLint src_x1, GLint src_y1,
+                                               GLint dst_x0, GLint dst_y0, GLint dst_x1, GLint dst_y1,
+                                               GLbitfield mask, GLenum filter) {
+    REAL.BlitFramebuffer(src_x0, src_y0, src_x1, src_y1, dst_x0, dst_y0, dst_x1, dst_y1, mask, filter);
+    WORDS((uint32_t)src_x0, (uint32_t)src_y0, (uint32_t)src_x1, (uint32_t)src_y1,
+          (uint32_t)dst_x0, (uint32_t)dst_y0, (uint32_t)dst_x1, (uint32_t)dst_y1, mask, filter);
+    RECORD(GL_TRACE_BLIT_FRAMEBUFFER);
+}
+
+static void APIENTRY capture_glEnable(GLenum cap) {
+    REAL.Enable(cap);
+    WORDS(cap);
+    RECORD(GL_TRACE_ENABLE);
+}
+
+static void APIENTRY capture_glDisable(GLenum cap) {
+    REAL.Disable(cap);
+    WORDS(cap);
+    RECORD(GL_TRACE_DISABLE);
+}
+
+static void APIENTRY capture_glBlendFunc(GLenum src_factor, GLenum dst_factor) {
+    REAL.BlendFunc(src_factor, dst_factor);
+    WORDS(src_factor, dst_factor);
+    RECORD(GL_TRACE_BLEND_FUNC);
+}
+
+static void APIENTRY capture_glDepthFunc(GLenum func) {
+    REAL.DepthFunc(func);
+    WORDS(func);
+    RECORD(GL_TRACE_DEPTH_FUNC);
+}
+
+static void APIENTRY capture_glDepthMask(GLboolean flag) {
+    REAL.DepthMask(flag);
+    WORDS(flag);
+    RECORD(GL_TRACE_DEPTH_MASK);
+}
+
+static void APIENTRY capture_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    REAL.Viewport(x, y, width, height);
+    WORDS((uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height);
+    RECORD(GL_TRACE_VIEWPORT);
+}
+
+static void APIENTRY capture_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    REAL.Scissor(x, y, width, height);
+    WORDS((uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height);
+    RECORD(GL_TRACE_SCISSOR);
+}
+
+static void APIENTRY capture_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    REAL.ClearColor(red, green, blue, alpha);
+    WORDS(float_bits(red), float_bits(green), float_bits(blue), float_bits(alpha));
+    RECORD(GL_TRACE_CLEAR_COLOR);
+}
+
+static void APIENTRY capture_glClear(GLbitfield mask) {
+    REAL.Clear(mask);
+    WORDS(mask);
+    RECORD(GL_TRACE_CLEAR);
+}
+
+static void APIENTRY capture_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    REAL.ClearBufferfv(buffer, drawbuffer, value);
+    WORDS(buffer, (uint32_t)drawbuffer);
+    RECORD_DATA(GL_TRACE_CLEAR_BUFFERFV, value, (buffer == GL_COLOR ? 4 : 1) * sizeof(GLfloat));
+}
+
+static void APIENTRY capture_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    REAL.DrawArrays(mode, first, count);
+    WORDS(mode, (uint32_t)first, (uint32_t)count);
+    RECORD(GL_TRACE_DRAW_ARRAYS);
+}
+
+static void record_draw_elements(GLenum mode, GLsizei count, GLenum type, const void *indices,
+                                 GLsizei instances, GLint base_vertex) {
+    WORDS(mode, (uint32_t)count, type, LO((uintptr_t)indices), HI((uintptr_t)indices),
+          (uint32_t)instances, (uint32_t)base_vertex);
+    RECORD(GL_TRACE_DRAW_ELEMENTS);
+}
+
+static void APIENTRY capture_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    REAL.DrawElements(mode, count, type, indices);
+    record_draw_elements(mode, count, type, indices, 1, 0);
+}
+
+static void APIENTRY capture_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type,
+                                                      const void *indices, GLint base_vertex) {
+    REAL.DrawElementsBaseVertex(mode, count, type, indices, base_vertex);
+    record_draw_elements(mode, count, type, indices, 1, base_vertex);
+}
+
+static void APIENTRY capture_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
+                                                     const void *indices, GLsizei instances) {
+    REAL.DrawElementsInstanced(mode, count, type, indices, instances);
+    record_draw_elements(mode, count, type, indices, instances, 0);
+}
+
+static void APIENTRY capture_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type,
+                                                               const void *indices, GLsizei instances,
+                                                               GLint base_vertex) {
+    REAL.DrawElementsInstancedBaseVertex(mode, count, type, indices, instances, base_vertex);
+    record_draw_elements(mode, count, type, indices, instances, base_vertex);
+}
+
+static GLsync APIENTRY capture_glFenceSync(GLenum condition, GLbitfield flags) {
+    GLsync sync = REAL.FenceSync(condition, flags);
+    WORDS(condition, flags, LO((uintptr_t)sync), HI((uintptr_t)sync));
+    RECORD(GL_TRACE_FENCE_SYNC);
+    return sync;
+}
+
+static GLenum APIENTRY capture_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GLenum result = REAL.ClientWaitSync(sync, flags, timeout);
+    WORDS(LO((uintptr_t)sync), HI((uintptr_t)sync), flags, LO(timeout), HI(timeout));
+    RECORD(GL_TRACE_CLIENT_WAIT_SYNC);
+    return result;
+}
+
+static void APIENTRY capture_glDeleteSync(GLsync sync) {
+    REAL.DeleteSync(sync);
+    WORDS(LO((uintptr_t)sync), HI((uintptr_t)sync));
+    RECORD(GL_TRACE_DELETE_SYNC);
+}
+
+static void APIENTRY capture_glFlush(void) {
+    REAL.Flush();
+    record(GL_TRACE_FLUSH, NULL, 0, NULL, 0);
+}
+
+// ----- Dispatch tables
+// --------------------------------------------------
+
+typedef struct {
+    const char *name;
+    size_t offset;
+    void *wrapper;
+} CaptureEntry;
+
+#define CAPTURE_ENTRY(name) { "gl" #name, offsetof(GladGLContext, name), (void*)capture_gl##name }
+
+static const CaptureEntry capture_entries[] = {
+    CAPTURE_ENTRY(ActiveTexture),
+    CAPTURE_ENTRY(AttachShader),
+    CAPTURE_ENTRY(BindBuffer),
+    CAPTURE_ENTRY(BindBufferRange),
+    CAPTURE_ENTRY(BindFramebuffer),
+    CAPTURE_ENTRY(BindTexture),
+    CAPTURE_ENTRY(BindVertexArray),
+    CAPTURE_ENTRY(BlendFunc),
+    CAPTURE_ENTRY(BlitFramebuffer),
+    CAPTURE_ENTRY(BufferData),
+    CAPTURE_ENTRY(BufferSubData),
+    CAPTURE_ENTRY(Clear),
+    CAPTURE_ENTRY(ClearBufferfv),
+    CAPTURE_ENTRY(ClearColor),
+    CAPTURE_ENTRY(ClientWaitSync),
+    CAPTURE_ENTRY(CompileShader),
+    CAPTURE_ENTRY(CreateProgram),
+    CAPTURE_ENTRY(CreateShader),
+    CAPTURE_ENTRY(DeleteBuffers),
+    CAPTURE_ENTRY(DeleteFramebuffers),
+    CAPTURE_ENTRY(DeleteProgram),
+    CAPTURE_ENTRY(DeleteShader),
+    CAPTURE_ENTRY(DeleteSync),
+    CAPTURE_ENTRY(DeleteTextures),
+    CAPTURE_ENTRY(DeleteVertexArrays),
+    CAPTURE_ENTRY(DepthFunc),
+    CAPTURE_ENTRY(DepthMask),
+    CAPTURE_ENTRY(Disable),
+    CAPTURE_ENTRY(DrawArrays),
+    CAPTURE_ENTRY(DrawBuffers),
+    CAPTURE_ENTRY(DrawElements),
+    CAPTURE_ENTRY(DrawElementsBaseVertex),
+    CAPTURE_ENTRY(DrawElementsInstanced),
+    CAPTURE_ENTRY(DrawElementsInstancedBaseVertex),
+    CAPTURE_ENTRY(Enable),
+    CAPTURE_ENTRY(EnableVertexAttribArray),
+    CAPTURE_ENTRY(FenceSync),
+    CAPTURE_ENTRY(Flush),
+    CAPTURE_ENTRY(FramebufferTexture2D),
+    CAPTURE_ENTRY(GenBuffers),
+    CAPTURE_ENTRY(GenFramebuffers),
+    CAPTURE_ENTRY(GenTextures),
+    CAPTURE_ENTRY(GenVertexArrays),
+    CAPTURE_ENTRY(GetActiveUniformBlockName),
+    CAPTURE_ENTRY(GetUniformBlockIndex),
+    CAPTURE_ENTRY(GetUniformLocation),
+    CAPTURE_ENTRY(LinkProgram),
+    CAPTURE_ENTRY(MapBufferRange),
+    CAPTURE_ENTRY(ProgramParameteri),
+    CAPTURE_ENTRY(Scissor),
+    CAPTURE_ENTRY(ShaderSource),
+    CAPTURE_ENTRY(TexImage2D),
+    CAPTURE_ENTRY(TexParameteri),
+    CAPTURE_ENTRY(TexSubImage2D),
+    CAPTURE_ENTRY(Uniform1fv),
+    CAPTURE_ENTRY(Uniform1i),
+    CAPTURE_ENTRY(Uniform1iv),
+    CAPTURE_ENTRY(Uniform2f),
+    CAPTURE_ENTRY(Uniform2fv),
+    CAPTURE_ENTRY(Uniform3fv),
+    CAPTURE_ENTRY(Uniform4f),
+    CAPTURE_ENTRY(Uniform4fv),
+    CAPTURE_ENTRY(UniformBlockBinding),
+    CAPTURE_ENTRY(UniformMatrix4fv),
+    CAPTURE_ENTRY(UnmapBuffer),
+    CAPTURE_ENTRY(UseProgram),
+    CAPTURE_ENTRY(VertexAttribDivisor),
+    CAPTURE_ENTRY(VertexAttribPointer),
+    CAPTURE_ENTRY(Viewport),
+};
+#define CAPTURE_ENTRY_COUNT (int)(sizeof(capture_entries) / sizeof(capture_entries[0]))
+
+bool gl_capture_start(const char *path) {
+    capture.file = CreateFileA(path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (capture.file == INVALID_HANDLE_VALUE) return false;
+
+    InitializeCriticalSection(&capture.crit_sect);
+    GLTraceHeader header = { GL_TRACE_MAGIC, GL_TRACE_VERSION };
+    append(&header, sizeof(header));
+    QueryPerformanceCounter(&capture.last_frame_count);
+    capture.active = true;
+    return true;
+}
+
+bool gl_capture_active(void) {
+    return capture.active;
+}
+
+void gl_capture_attach(GladGLContext *table) {
+    if (!capture.active) return;
+
+    EnterCriticalSection(&capture.crit_sect);
+    if (capture.table_count == GL_CAPTURE_MAX_TABLES) {
+        LeaveCriticalSection(&capture.crit_sect);
+        OutputDebugStringA("GL capture: too many dispatch tables, calls on this one are not recorded\n");
+        return;
+    }
+    CaptureTable *entry = &capture.tables[capture.table_count];
+    entry->table = table;
+    entry->real = *table;
+
+    for (int i = 0; i < CAPTURE_ENTRY_COUNT; i++) {
+        // A lazy stub would resolve into the table it is called from, over
+        // the wrapper, so the real entries are resolved up front
+        void **real = (void**)((uint8_t*)&entry->real + capture_entries[i].offset);
+        if (table->lazy_loader) {
+            void *proc = table->lazy_loader(capture_entries[i].name);
+            if (proc) *real = proc;
+        }
+        if (*real) *(void**)((uint8_t*)table + capture_entries[i].offset) = capture_entries[i].wrapper;
+    }
+    capture.table_count++;
+    LeaveCriticalSection(&capture.crit_sect);
+}
+
+void gl_capture_frame(int width, int height) {
+    if (!capture.active) return;
+
+    LARGE_INTEGER now, frequency;
+    QueryPerformanceCounter(&now);
+    QueryPerformanceFrequency(&frequency);
+    uint32_t frame_us = (uint32_t)((now.QuadPart - capture.last_frame_count.QuadPart) * 1000000 / frequency.QuadPart);
+    capture.last_frame_count = now;
+
+    WORDS(capture.frames++, (uint32_t)width, (uint32_t)height, frame_us);
+    RECORD(GL_TRACE_FRAME);
+}
+
+void gl_capture_stop(void) {
+    if (!capture.active) return;
+
+    EnterCriticalSection(&capture.crit_sect);
+    capture.active = false;
+    flush_buffer();
+    CloseHandle(capture.file);
+    capture.file = INVALID_HANDLE_VALUE;
+    LeaveCriticalSection(&capture.crit_sect);
+
+    char buf[160];
+    sprintf_s(buf, sizeof(buf), "GL capture: %u frames, %llu calls, %.1f MB\n", capture.frames,
+              (unsigned long long)capture.records, (double)capture.bytes / (1024.0 * 1024.0));
+    OutputDebugStringA(buf);
+}
@@ -0,0 +1,40 @@
+#ifndef GL_CAPTURE_H
+#define GL_CAPTURE_H
+
+// Captures the GL calls the renderer makes, with the buffer, texture and
+// shader data they carry, into a trace file (see gl_trace.h) that the
+// replayer can run again headless on another machine.
+//
+// Capturing works on the dispatch tables: gl_capture_attach swaps the traced
+// entries of a table for wrappers that record the call and then make it.
+// Every thread whose calls matter attaches its own table once it is loaded,
+// with its context current. Calls outside the traced set pass through
+// unrecorded, so they must not change what a frame draws: queries, getters
+// and compiler hints are left out on purpose.
+//
+// Writes through persistent mappings never pass through a GL call, and
+// program binaries don't load on another driver, so the caller must stay off
+// both while capturing: the 3.3 paths, without the program cache.
+//
+// There is one capture per process; its functions may be called from any
+// thread.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+bool gl_capture_start(const char *path);
+bool gl_capture_active(void);
+
+// Does nothing unless a capture is running
+void gl_capture_attach(GladGLContext *table);
+
+// Marks the end of a frame, after it was presented at width x height
+void gl_capture_frame(int width, int height);
+
+// Writes out what is buffered and closes the file. The tables stay attached
+// but record nothing more.
+void gl_capture_stop(void);
+
+#endif
@@ -0,0 +1,240 @@
+#include <string.h>
+
+#include "gl_state.h"
+
+// Never returned by glGen*, so a shadowed binding with this value always mismatches
+#define UNKNOWN_NAME 0xFFFFFFFFu
+
+enum BufferTarget {
+    BUFFER_ARRAY,
+    BUFFER_ELEMENT_ARRAY, // Part of VAO state, forgotten whenever the VAO changes
+    BUFFER_UNIFORM,
+    BUFFER_PIXEL_UNPACK,
+    BUFFER_PIXEL_PACK,
+    BUFFER_COPY_READ,
+    BUFFER_COPY_WRITE,
+    BUFFER_DRAW_INDIRECT,
+    BUFFER_TARGET_COUNT,
+};
+
+enum TextureTarget {
+    TEXTURE_2D,
+    TEXTURE_2D_ARRAY,
+    TEXTURE_TARGET_COUNT,
+};
+
+enum Capability {
+    CAP_BLEND,
+    CAP_DEPTH_TEST,
+    CAP_SCISSOR_TEST,
+    CAP_CULL_FACE,
+    CAP_COUNT,
+};
+
+typedef struct {
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+} IndexedBinding;
+
+typedef struct {
+    GLuint vao;
+    GLuint program;
+    GLuint buffers[BUFFER_TARGET_COUNT];
+    IndexedBinding uniform_bindings[GL_STATE_MAX_BUFFER_INDICES];
+    GLenum active_texture_unit;
+    GLuint textures[GL_STATE_MAX_TEXTURE_UNITS][TEXTURE_TARGET_COUNT];
+    GLuint read_framebuffer;
+    GLuint draw_framebuffer;
+
+    int8_t enabled[CAP_COUNT]; // -1 when unknown
+    GLenum blend_src;
+    GLenum blend_dst;
+    GLenum depth_func;
+    int8_t depth_mask;
+    GLint viewport[4];
+    GLint scissor[4];
+    float clear_color[4];
+} GLStateShadow;
+
+GLStateCounters gl_state_counters;
+static GLStateShadow shadow;
+
+static int buffer_target_index(GLenum target) {
+    switch (target) {
+    case GL_ARRAY_BUFFER:         return BUFFER_ARRAY;
+    case GL_ELEMENT_ARRAY_BUFFER: return BUFFER_ELEMENT_ARRAY;
+    case GL_UNIFORM_BUFFER:       return BUFFER_UNIFORM;
+    case GL_PIXEL_UNPACK_BUFFER:  return BUFFER_PIXEL_UNPACK;
+    case GL_PIXEL_PACK_BUFFER:    return BUFFER_PIXEL_PACK;
+    case GL_COPY_READ_BUFFER:     return BUFFER_COPY_READ;
+    case GL_COPY_WRITE_BUFFER:    return BUFFER_COPY_WRITE;
+    case GL_DRAW_INDIRECT_BUFFER: return BUFFER_DRAW_INDIRECT;
+    default:                      return -1;
+    }
+}
+
+static int texture_target_index(GLenum target) {
+    switch (target) {
+    case GL_TEXTURE_2D:       return TEXTURE_2D;
+    case GL_TEXTURE_2D_ARRAY: return TEXTURE_2D_ARRAY;
+    default:                  return -1;
+    }
+}
+
+static int capability_index(GLenum cap) {
+    switch (cap) {
+    case GL_BLEND:        return CAP_BLEND;
+    case GL_DEPTH_TEST:   return CAP_DEPTH_TEST;
+    case GL_SCISSOR_TEST: return CAP_SCISSOR_TEST;
+    case GL_CULL_FACE:    return CAP_CULL_FACE;
+    default:              return -1;
+    }
+}
+
+static bool elide(bool unchanged) {
+    if (unchanged) gl_state_counters.elided++;
+    else           gl_state_counters.issued++;
+    return unchanged;
+}
+
+void gl_state_invalidate(void) {
+    // Every name becomes UNKNOWN_NAME, every flag -1, every rect -1 and every
+    // clear colour NaN, none of which can match a real value
+    memset(&shadow, 0xFF, sizeof(shadow));
+}
+
+void gl_state_reset_counters(void) {
+    memset(&gl_state_counters, 0, sizeof(gl_state_counters));
+}
+
+void gl_state_bind_vertex_array(GLuint vao) {
+    if (elide(shadow.vao == vao)) return;
+    glBindVertexArray(vao);
+    shadow.vao = vao;
+    shadow.buffers[BUFFER_ELEMENT_ARRAY] = UNKNOWN_NAME;
+}
+
+void gl_state_use_program(GLuint program) {
+    if (elide(shadow.program == program)) return;
+    glUseProgram(program);
+    shadow.program = program;
+}
+
+void gl_state_bind_buffer(GLenum target, GLuint buffer) {
+    int index = buffer_target_index(target);
+    if (index >= 0 && elide(shadow.buffers[index] == buffer)) return;
+    if (index < 0) gl_state_counters.issued++;
+
+    glBindBuffer(target, buffer);
+    if (index >= 0) shadow.buffers[index] = buffer;
+}
+
+void gl_state_bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (target != GL_UNIFORM_BUFFER || index >= GL_STATE_MAX_BUFFER_INDICES) {
+        gl_state_counters.issued++;
+        glBindBufferRange(target, index, buffer, offset, size);
+        int generic = buffer_target_index(target);
+        if (generic >= 0) shadow.buffers[generic] = buffer;
+        return;
+    }
+
+    IndexedBinding *binding = &shadow.uniform_bindings[index];
+    bool unchanged = binding->buffer == buffer && binding->offset == offset && binding->size == size;
+    if (elide(unchanged)) return;
+
+    glBindBufferRange(target, index, buffer, offset, size);
+    binding->buffer = buffer;
+    binding->offset = offset;
+    binding->size = size;
+    shadow.buffers[BUFFER_UNIFORM] = buffer; // Indexed binds also set the generic binding
+}
+
+void gl_state_bind_texture(GLuint unit, GLenum target, GLuint texture) {
+    int index = texture_target_index(target);
+    if (unit < GL_STATE_MAX_TEXTURE_UNITS && index >= 0 && elide(shadow.textures[unit][index] == texture)) return;
+    if (unit >= GL_STATE_MAX_TEXTURE_UNITS || index < 0) gl_state_counters.issued++;
+
+    GLenum unit_enum = GL_TEXTURE0 + unit;
+    if (shadow.active_texture_unit != unit_enum) {
+        glActiveTexture(unit_enum);
+        shadow.active_texture_unit = unit_enum;
+        gl_state_counters.issued++;
+    }
+
+    glBindTexture(target, texture);
+    if (unit < GL_STATE_MAX_TEXTURE_UNITS && index >= 0) shadow.textures[unit][index] = texture;
+}
+
+void gl_state_bind_framebuffer(GLenum target, GLuint framebuffer) {
+    bool read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+    bool draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+    bool unchanged = (!read || shadow.read_framebuffer == framebuffer) &&
+                     (!draw || shadow.draw_framebuffer == framebuffer);
+    if (elide(unchanged)) return;
+
+    glBindFramebuffer(target, framebuffer);
+    if (read) shadow.read_framebuffer = framebuffer;
+    if (draw) shadow.draw_framebuffer = framebuffer;
+}
+
+void gl_state_set_enabled(GLenum cap, bool enabled) {
+    int index = capability_index(cap);
+    if (index >= 0 && elide(shadow.enabled[index] == (int8_t)enabled)) return;
+    if (index < 0) gl_state_counters.issued++;
+
+    if (enabled) glEnable(cap);
+    else         glDisable(cap);
+    if (index >= 0) shadow.enabled[index] = (int8_t)enabled;
+}
+
+void gl_state_blend_func(GLenum src_factor, GLenum dst_factor) {
+    if (elide(shadow.blend_src == src_factor && shadow.blend_dst == dst_factor)) return;
+    glBlendFunc(src_factor, dst_factor);
+    shadow.blend_src = src_factor;
+    shadow.blend_dst = dst_factor;
+}
+
+void gl_state_depth_func(GLenum func) {
+    if (elide(shadow.depth_func == func)) return;
+    glDepthFunc(func);
+    shadow.depth_func = func;
+}
+
+void gl_state_depth_mask(bool write) {
+    if (elide(shadow.depth_mask == (int8_t)write)) return;
+    glDepthMask(write ? GL_TRUE : GL_FALSE);
+    shadow.depth_mask = (int8_t)write;
+}
+
+static bool rect_equal(const GLint *rect, GLint x, GLint y, GLsizei width, GLsizei height) {
+    return rect[0] == x && rect[1] == y && rect[2] == width && rect[3] == height;
+}
+
+void gl_state_viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (elide(rect_equal(shadow.viewport, x, y, width, height))) return;
+    glViewport(x, y, width, height);
+    shadow.viewport[0] = x;
+    shadow.viewport[1] = y;
+    shadow.viewport[2] = width;
+    shadow.viewport[3] = height;
+}
+
+void gl_state_scissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (elide(rect_equal(shadow.scissor, x, y, width, height))) return;
+    glScissor(x, y, width, height);
+    shadow.scissor[0] = x;
+    shadow.scissor[1] = y;
+    shadow.scissor[2] = width;
+    shadow.scissor[3] = height;
+}
+
+void gl_state_clear_color(float r, float g, float b, float a) {
+    const float *c = shadow.clear_color;
+    if (elide(c[0] == r && c[1] == g && c[2] == b && c[3] == a)) return;
+    glClearColor(r, g, b, a);
+    shadow.clear_color[0] = r;
+    shadow.clear_color[1] = g;
+    shadow.clear_color[2] = b;
+    shadow.clear_color[3] = a;
+}
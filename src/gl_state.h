@@ -0,0 +1,45 @@
+#ifndef GL_STATE_H
+#define GL_STATE_H
+
+// Thin state-tracking layer over the glad function pointers. It shadows the
+// state that is rebound every frame and skips calls that would not change it.
+//
+// The shadow describes the context current on the calling thread. Any code
+// that changes this state with direct GL calls (or makes a different context
+// current) must call gl_state_invalidate() before using the cache again.
+// Deleting a bound object also changes bindings behind the cache's back.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+#define GL_STATE_MAX_TEXTURE_UNITS 16
+#define GL_STATE_MAX_BUFFER_INDICES 8
+
+typedef struct {
+    uint64_t issued; // Calls that reached the driver
+    uint64_t elided; // Calls skipped because the state already matched
+} GLStateCounters;
+
+extern GLStateCounters gl_state_counters;
+
+void gl_state_invalidate(void);
+void gl_state_reset_counters(void);
+
+void gl_state_bind_vertex_array(GLuint vao);
+void gl_state_use_program(GLuint program);
+void gl_state_bind_buffer(GLenum target, GLuint buffer);
+void gl_state_bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+void gl_state_bind_texture(GLuint unit, GLenum target, GLuint texture);
+void gl_state_bind_framebuffer(GLenum target, GLuint framebuffer);
+
+void gl_state_set_enabled(GLenum cap, bool enabled);
+void gl_state_blend_func(GLenum src_factor, GLenum dst_factor);
+void gl_state_depth_func(GLenum func);
+void gl_state_depth_mask(bool write);
+void gl_state_viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_state_scissor(GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_state_clear_color(float r, float g, float b, float a);
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+// The trace format written by gl_capture and read by the replayer.
+//
+// A file is a GLTraceHeader followed by records. A record is a GLTraceRecord,
+// `word_count` 32-bit argument words, then `data_size` bytes of inline data
+// (buffer and texture contents, shader sources, uniform values, names)
+// padded to a multiple of 4. Arguments are in the order of the GL call's
+// parameters; 64-bit values take two words, low word first, and floats are
+// stored as their bits. Everything is little endian.
+//
+// Object names, sync objects, uniform locations and block indices are the
+// values the capturing driver returned; the replayer maps them to its own.
+// Records the replayer doesn't know can be skipped by their sizes.
+
+#include <stdint.h>
+
+#define GL_TRACE_MAGIC 0x52544C47 // "GLTR"
+#define GL_TRACE_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+} GLTraceHeader;
+
+typedef struct {
+    uint16_t opcode;
+    uint16_t word_count;
+    uint32_t data_size;
+} GLTraceRecord;
+
+enum GLTraceOpcode {
+    // Not a GL call: the frame was presented. Args: frame, width, height, CPU microseconds since the last frame.
+    GL_TRACE_FRAME,
+
+    GL_TRACE_GEN_BUFFERS,       // Data: the names
+    GL_TRACE_GEN_TEXTURES,
+    GL_TRACE_GEN_VERTEX_ARRAYS,
+    GL_TRACE_GEN_FRAMEBUFFERS,
+    GL_TRACE_DELETE_BUFFERS,
+    GL_TRACE_DELETE_TEXTURES,
+    GL_TRACE_DELETE_VERTEX_ARRAYS,
+    GL_TRACE_DELETE_FRAMEBUFFERS,
+
+    GL_TRACE_CREATE_SHADER,     // Args: type, returned name
+    GL_TRACE_SHADER_SOURCE,     // Args: shader. Data: the strings joined
+    GL_TRACE_COMPILE_SHADER,
+    GL_TRACE_DELETE_SHADER,
+    GL_TRACE_CREATE_PROGRAM,    // Args: returned name
+    GL_TRACE_ATTACH_SHADER,
+    GL_TRACE_PROGRAM_PARAMETERI,
+    GL_TRACE_LINK_PROGRAM,
+    GL_TRACE_DELETE_PROGRAM,
+    GL_TRACE_USE_PROGRAM,
+    GL_TRACE_GET_UNIFORM_LOCATION,        // Args: program, returned location. Data: the name
+    GL_TRACE_GET_UNIFORM_BLOCK_INDEX,     // Args: program, returned index. Data: the name
+    GL_TRACE_GET_ACTIVE_UNIFORM_BLOCK_NAME, // Args: program, index. Data: the name
+    GL_TRACE_UNIFORM_BLOCK_BINDING,
+    GL_TRACE_UNIFORM,           // Args: GLTraceUniformType, location, count. Data: the values
+
+    GL_TRACE_BIND_BUFFER,
+    GL_TRACE_BIND_BUFFER_RANGE,
+    GL_TRACE_BUFFER_DATA,       // Args: target, size (64), usage, has data. Data: the contents
+    GL_TRACE_BUFFER_SUB_DATA,   // Args: target, offset (64). Data: the contents
+    GL_TRACE_MAP_BUFFER_RANGE,  // Args: target, offset (64), length (64), access
+    GL_TRACE_UNMAP_BUFFER,      // Args: target. Data: the mapped range as written
+
+    GL_TRACE_BIND_VERTEX_ARRAY,
+    GL_TRACE_VERTEX_ATTRIB_POINTER, // Pointer as a 64-bit offset
+    GL_TRACE_ENABLE_VERTEX_ATTRIB_ARRAY,
+    GL_TRACE_VERTEX_ATTRIB_DIVISOR,
+
+    GL_TRACE_ACTIVE_TEXTURE,
+    GL_TRACE_BIND_TEXTURE,
+    GL_TRACE_TEX_PARAMETERI,
+    GL_TRACE_TEX_IMAGE_2D,      // Last args: pixels as a 64-bit offset, has data. Data: the pixels
+    GL_TRACE_TEX_SUB_IMAGE_2D,
+
+    GL_TRACE_BIND_FRAMEBUFFER,
+    GL_TRACE_FRAMEBUFFER_TEXTURE_2D,
+    GL_TRACE_DRAW_BUFFERS,      // Data: the buffers
+    GL_TRACE_BLIT_FRAMEBUFFER,
+
+    GL_TRACE_ENABLE,
+    GL_TRACE_DISABLE,
+    GL_TRACE_BLEND_FUNC,
+    GL_TRACE_DEPTH_FUNC,
+    GL_TRACE_DEPTH_MASK,
+    GL_TRACE_VIEWPORT,
+    GL_TRACE_SCISSOR,
+    GL_TRACE_CLEAR_COLOR,
+    GL_TRACE_CLEAR,
+    GL_TRACE_CLEAR_BUFFERFV,    // Data: the value, 4 floats for colour and 1 otherwise
+
+    GL_TRACE_DRAW_ARRAYS,
+    GL_TRACE_DRAW_ELEMENTS,     // Args: mode, count, type, offset (64), instances, base vertex
+
+    GL_TRACE_FENCE_SYNC,        // Args: condition, flags, returned sync (64)
+    GL_TRACE_CLIENT_WAIT_SYNC,  // Args: sync (64), flags, timeout (64)
+    GL_TRACE_DELETE_SYNC,
+    GL_TRACE_FLUSH,
+
+    GL_TRACE_OPCODE_COUNT,
+};
+
+enum GLTraceUniformType {
+    GL_TRACE_UNIFORM_FLOAT,
+    GL_TRACE_UNIFORM_VEC2,
+    GL_TRACE_UNIFORM_VEC3,
+    GL_TRACE_UNIFORM_VEC4,
+    GL_TRACE_UNIFORM_INT,
+    GL_TRACE_UNIFORM_MAT4,
+};
+
+#endif
@@ -7,16 +7,22 @@
     APIs: gl=3.3
     Profile: core
     Extensions:
-        
+        GL_ARB_get_program_binary,
+        GL_KHR_parallel_shader_compile,
+        GL_ARB_base_instance,
+        GL_ARB_buffer_storage,
+        GL_ARB_direct_state_access,
+        GL_ARB_draw_indirect,
+        GL_ARB_multi_draw_indirect
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile,GL_ARB_base_instance,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_draw_indirect,GL_ARB_multi_draw_indirect"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_get_program_binary&extensions=GL_KHR_parallel_shader_compile&extensions=GL_ARB_base_instance&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_direct_state_access&extensions=GL_ARB_draw_indirect&extensions=GL_ARB_multi_draw_indirect
 */
 
 #include <stdio.h>
@@ -56,6 +62,7 @@ static PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
 static
 int open_gl(void) {
 #ifndef IS_UWP
+    if(libGL != NULL) return gladGetProcAddressPtr != NULL;
     libGL = LoadLibraryW(L"opengl32.dll");
     if(libGL != NULL) {
         void (* tmp)(void);
@@ -98,6 +105,14 @@ int open_gl(void) {
 #endif
 
     unsigned int index = 0;
+    if(libGL != NULL) {
+#if defined(__APPLE__) || defined(__HAIKU__)
+        return 1;
+#else
+        return gladGetProcAddressPtr != NULL;
+#endif
+    }
+
     for(index = 0; index < (sizeof(NAMES) / sizeof(NAMES[0])); index++) {
         libGL = dlopen(NAMES[index], RTLD_NOW | RTLD_GLOBAL);
 
@@ -114,533 +129,2581 @@ int open_gl(void) {
 
     return 0;
 }
-
-static
-void close_gl(void) {
-    if(libGL != NULL) {
-        dlclose(libGL);
-        libGL = NULL;
-    }
+
+static
+void close_gl(void) {
+    if(libGL != NULL) {
+        dlclose(libGL);
+        libGL = NULL;
+    }
+}
+#endif
+
+static
+void* get_proc(const char *namez) {
+    void* result = NULL;
+    if(libGL == NULL) return NULL;
+
+#if !defined(__APPLE__) && !defined(__HAIKU__)
+    if(gladGetProcAddressPtr != NULL) {
+        result = gladGetProcAddressPtr(namez);
+    }
+#endif
+    if(result == NULL) {
+#if defined(_WIN32) || defined(__CYGWIN__)
+        result = (void*)GetProcAddress((HMODULE) libGL, namez);
+#else
+        result = dlsym(libGL, namez);
+#endif
+    }
+
+    return result;
+}
+
+/* The library is opened by the first load and stays open until gladUnloadGL,
+   so loading another context or resolving a lazy stub doesn't reopen it */
+int gladLoadGL(void) {
+    int status = 0;
+
+    if(open_gl()) {
+        status = gladLoadGLLoader(&get_proc);
+    }
+
+    return status;
+}
+
+void gladUnloadGL(void) {
+    close_gl();
+}
+
+
+#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
+#define _GLAD_IS_SOME_NEW_VERSION 1
+#endif
+
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+static const char* get_ext_i(unsigned int index, void *user) {
+    (void)user;
+    return (const char*)glGetStringi(GL_EXTENSIONS, index);
+}
+#endif
+
+static int get_exts(void) {
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(GLAD_GL_CONTEXT.max_loaded_major < 3) {
+#endif
+        return glad_exts_build_from_string(&GLAD_GL_CONTEXT.extensions, (const char *)glGetString(GL_EXTENSIONS));
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        int num_exts_i = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if (num_exts_i < 0) num_exts_i = 0;
+        return glad_exts_build_from_list(&GLAD_GL_CONTEXT.extensions, (unsigned int)num_exts_i, get_ext_i, NULL);
+    }
+#endif
+}
+
+static int has_ext(const char *ext) {
+    return glad_exts_has(&GLAD_GL_CONTEXT.extensions, ext);
+}
+
+int gladHasExtension(const char *ext) {
+    return has_ext(ext);
+}
+
+const GladExtensionSet *gladGetExtensions(void) {
+    return &GLAD_GL_CONTEXT.extensions;
+}
+
+GladGLContext glad_gl_default_context;
+
+#ifdef GLAD_MX
+GLAD_THREAD_LOCAL GladGLContext *glad_gl_current_context = &glad_gl_default_context;
+
+void gladMakeContextCurrentGL(GladGLContext *context) {
+    glad_gl_current_context = context != NULL ? context : &glad_gl_default_context;
+}
+
+GladGLContext *gladGetCurrentContextGL(void) {
+    return glad_gl_current_context;
+}
+
+void gladDestroyContextGL(GladGLContext *context) {
+    glad_exts_free(&context->extensions);
+    memset(context, 0, sizeof(*context));
+}
+#endif
+
+/* Lazy loading */
+typedef void (*GLADapiproc)(void);
+
+typedef struct {
+    const char *name;
+    GLADapiproc stub;
+} GladLazyEntry;
+
+/* Stubs are only handed out for the versions and extensions the context
+   advertises, as eager loading only loads those. An entry point the driver
+   still doesn't export can't be called, so it fails here by name rather than
+   as a jump to NULL. */
+static void glad_lazy_missing(const char *name) {
+    char message[256];
+    snprintf(message, sizeof(message), "glad: %s is advertised but the driver doesn't export it\n", name);
+    fputs(message, stderr);
+#if defined(_WIN32) || defined(__CYGWIN__)
+    OutputDebugStringA(message);
+#endif
+    abort();
+}
+
+/* Called by a stub on its first call. The stub patches the calling thread's
+   current table. Two threads racing on a shared table both store the same
+   pointer, so the stubs need no locking; only the count is shared. */
+static void* glad_lazy_resolve(const char *name) {
+    void *proc = GLAD_GL_CONTEXT.lazy_loader(name);
+    if(proc == NULL) glad_lazy_missing(name);
+#if defined(_WIN32) || defined(__CYGWIN__)
+    InterlockedIncrement(&GLAD_GL_CONTEXT.lazy_resolved);
+#else
+    __atomic_add_fetch(&GLAD_GL_CONTEXT.lazy_resolved, 1, __ATOMIC_RELAXED);
+#endif
+    return proc;
+}
+
+/* Lazy resolver stubs: generated, one per entry point */
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)glad_lazy_resolve("glActiveTexture");
+	glad_glActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)glad_lazy_resolve("glAttachShader");
+	glad_glAttachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_resolve("glBeginConditionalRender");
+	glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)glad_lazy_resolve("glBeginQuery");
+	glad_glBeginQuery(target, id);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glBeginTransformFeedback");
+	glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_resolve("glBindAttribLocation");
+	glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)glad_lazy_resolve("glBindBuffer");
+	glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glad_lazy_resolve("glBindBufferBase");
+	glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_resolve("glBindBufferRange");
+	glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_resolve("glBindFragDataLocation");
+	glad_glBindFragDataLocation(program, color, name);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_resolve("glBindFragDataLocationIndexed");
+	glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_resolve("glBindFramebuffer");
+	glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_resolve("glBindRenderbuffer");
+	glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)glad_lazy_resolve("glBindSampler");
+	glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)glad_lazy_resolve("glBindTexture");
+	glad_glBindTexture(target, texture);
+}
+static void APIENTRY glad_lazy_glBindTextureUnit(GLuint unit, GLuint texture) {
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)glad_lazy_resolve("glBindTextureUnit");
+	glad_glBindTextureUnit(unit, texture);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_resolve("glBindVertexArray");
+	glad_glBindVertexArray(array);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)glad_lazy_resolve("glBlendColor");
+	glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)glad_lazy_resolve("glBlendEquation");
+	glad_glBlendEquation(mode);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_resolve("glBlendEquationSeparate");
+	glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)glad_lazy_resolve("glBlendFunc");
+	glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_resolve("glBlendFuncSeparate");
+	glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_resolve("glBlitFramebuffer");
+	glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)glad_lazy_resolve("glBlitNamedFramebuffer");
+	glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)glad_lazy_resolve("glBufferData");
+	glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)glad_lazy_resolve("glBufferStorage");
+	glad_glBufferStorage(target, size, data, flags);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glad_lazy_resolve("glBufferSubData");
+	glad_glBufferSubData(target, offset, size, data);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_resolve("glCheckFramebufferStatus");
+	return glad_glCheckFramebufferStatus(target);
+}
+static GLenum APIENTRY glad_lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glad_lazy_resolve("glCheckNamedFramebufferStatus");
+	return glad_glCheckNamedFramebufferStatus(framebuffer, target);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)glad_lazy_resolve("glClampColor");
+	glad_glClampColor(target, clamp);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+	glad_glClear = (PFNGLCLEARPROC)glad_lazy_resolve("glClear");
+	glad_glClear(mask);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glad_lazy_resolve("glClearBufferfi");
+	glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glad_lazy_resolve("glClearBufferfv");
+	glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glad_lazy_resolve("glClearBufferiv");
+	glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_resolve("glClearBufferuiv");
+	glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)glad_lazy_resolve("glClearColor");
+	glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)glad_lazy_resolve("glClearDepth");
+	glad_glClearDepth(depth);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)glad_lazy_resolve("glClearNamedBufferData");
+	glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve("glClearNamedBufferSubData");
+	glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glad_lazy_resolve("glClearNamedFramebufferfi");
+	glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glad_lazy_resolve("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glad_lazy_resolve("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glad_lazy_resolve("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)glad_lazy_resolve("glClearStencil");
+	glad_glClearStencil(s);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_resolve("glClientWaitSync");
+	return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_glColorMask = (PFNGLCOLORMASKPROC)glad_lazy_resolve("glColorMask");
+	glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)glad_lazy_resolve("glColorMaski");
+	glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)glad_lazy_resolve("glColorP3ui");
+	glad_glColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)glad_lazy_resolve("glColorP3uiv");
+	glad_glColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)glad_lazy_resolve("glColorP4ui");
+	glad_glColorP4ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)glad_lazy_resolve("glColorP4uiv");
+	glad_glColorP4uiv(type, color);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)glad_lazy_resolve("glCompileShader");
+	glad_glCompileShader(shader);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_resolve("glCompressedTexImage1D");
+	glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_resolve("glCompressedTexImage2D");
+	glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_resolve("glCompressedTexImage3D");
+	glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCompressedTexSubImage1D");
+	glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glad_lazy_resolve("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glad_lazy_resolve("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glad_lazy_resolve("glCompressedTextureSubImage3D");
+	glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_resolve("glCopyBufferSubData");
+	glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve("glCopyNamedBufferSubData");
+	glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_resolve("glCopyTexImage1D");
+	glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_resolve("glCopyTexImage2D");
+	glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCopyTexSubImage2D");
+	glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCopyTexSubImage3D");
+	glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)glad_lazy_resolve("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)glad_lazy_resolve("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)glad_lazy_resolve("glCopyTextureSubImage3D");
+	glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)glad_lazy_resolve("glCreateBuffers");
+	glad_glCreateBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)glad_lazy_resolve("glCreateFramebuffers");
+	glad_glCreateFramebuffers(n, framebuffers);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)glad_lazy_resolve("glCreateProgram");
+	return glad_glCreateProgram();
+}
+static void APIENTRY glad_lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)glad_lazy_resolve("glCreateProgramPipelines");
+	glad_glCreateProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)glad_lazy_resolve("glCreateQueries");
+	glad_glCreateQueries(target, n, ids);
+}
+static void APIENTRY glad_lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)glad_lazy_resolve("glCreateRenderbuffers");
+	glad_glCreateRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)glad_lazy_resolve("glCreateSamplers");
+	glad_glCreateSamplers(n, samplers);
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)glad_lazy_resolve("glCreateShader");
+	return glad_glCreateShader(type);
+}
+static void APIENTRY glad_lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)glad_lazy_resolve("glCreateTextures");
+	glad_glCreateTextures(target, n, textures);
+}
+static void APIENTRY glad_lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)glad_lazy_resolve("glCreateTransformFeedbacks");
+	glad_glCreateTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)glad_lazy_resolve("glCreateVertexArrays");
+	glad_glCreateVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+	glad_glCullFace = (PFNGLCULLFACEPROC)glad_lazy_resolve("glCullFace");
+	glad_glCullFace(mode);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glad_lazy_resolve("glDeleteBuffers");
+	glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_resolve("glDeleteFramebuffers");
+	glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glad_lazy_resolve("glDeleteProgram");
+	glad_glDeleteProgram(program);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)glad_lazy_resolve("glDeleteQueries");
+	glad_glDeleteQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_resolve("glDeleteRenderbuffers");
+	glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glad_lazy_resolve("glDeleteSamplers");
+	glad_glDeleteSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)glad_lazy_resolve("glDeleteShader");
+	glad_glDeleteShader(shader);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)glad_lazy_resolve("glDeleteSync");
+	glad_glDeleteSync(sync);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)glad_lazy_resolve("glDeleteTextures");
+	glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_resolve("glDeleteVertexArrays");
+	glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)glad_lazy_resolve("glDepthFunc");
+	glad_glDepthFunc(func);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)glad_lazy_resolve("glDepthMask");
+	glad_glDepthMask(flag);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)glad_lazy_resolve("glDepthRange");
+	glad_glDepthRange(n, f);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)glad_lazy_resolve("glDetachShader");
+	glad_glDetachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+	glad_glDisable = (PFNGLDISABLEPROC)glad_lazy_resolve("glDisable");
+	glad_glDisable(cap);
+}
+static void APIENTRY glad_lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)glad_lazy_resolve("glDisableVertexArrayAttrib");
+	glad_glDisableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glDisableVertexAttribArray");
+	glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+	glad_glDisablei = (PFNGLDISABLEIPROC)glad_lazy_resolve("glDisablei");
+	glad_glDisablei(target, index);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)glad_lazy_resolve("glDrawArrays");
+	glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)glad_lazy_resolve("glDrawArraysIndirect");
+	glad_glDrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_resolve("glDrawArraysInstanced");
+	glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_lazy_resolve("glDrawArraysInstancedBaseInstance");
+	glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)glad_lazy_resolve("glDrawBuffer");
+	glad_glDrawBuffer(buf);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glad_lazy_resolve("glDrawBuffers");
+	glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)glad_lazy_resolve("glDrawElements");
+	glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsBaseVertex");
+	glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve("glDrawElementsIndirect");
+	glad_glDrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_resolve("glDrawElementsInstanced");
+	glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_lazy_resolve("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsInstancedBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_lazy_resolve("glDrawElementsInstancedBaseVertexBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_resolve("glDrawRangeElements");
+	glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawRangeElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+	glad_glEnable = (PFNGLENABLEPROC)glad_lazy_resolve("glEnable");
+	glad_glEnable(cap);
+}
+static void APIENTRY glad_lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)glad_lazy_resolve("glEnableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glEnableVertexAttribArray");
+	glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+	glad_glEnablei = (PFNGLENABLEIPROC)glad_lazy_resolve("glEnablei");
+	glad_glEnablei(target, index);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_resolve("glEndConditionalRender");
+	glad_glEndConditionalRender();
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+	glad_glEndQuery = (PFNGLENDQUERYPROC)glad_lazy_resolve("glEndQuery");
+	glad_glEndQuery(target);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glEndTransformFeedback");
+	glad_glEndTransformFeedback();
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)glad_lazy_resolve("glFenceSync");
+	return glad_glFenceSync(condition, flags);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+	glad_glFinish = (PFNGLFINISHPROC)glad_lazy_resolve("glFinish");
+	glad_glFinish();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+	glad_glFlush = (PFNGLFLUSHPROC)glad_lazy_resolve("glFlush");
+	glad_glFlush();
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_resolve("glFlushMappedBufferRange");
+	glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY glad_lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glad_lazy_resolve("glFlushMappedNamedBufferRange");
+	glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve("glFramebufferRenderbuffer");
+	glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve("glFramebufferTexture");
+	glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_resolve("glFramebufferTexture1D");
+	glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_resolve("glFramebufferTexture2D");
+	glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_resolve("glFramebufferTexture3D");
+	glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve("glFramebufferTextureLayer");
+	glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)glad_lazy_resolve("glFrontFace");
+	glad_glFrontFace(mode);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)glad_lazy_resolve("glGenBuffers");
+	glad_glGenBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_resolve("glGenFramebuffers");
+	glad_glGenFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)glad_lazy_resolve("glGenQueries");
+	glad_glGenQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_resolve("glGenRenderbuffers");
+	glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)glad_lazy_resolve("glGenSamplers");
+	glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)glad_lazy_resolve("glGenTextures");
+	glad_glGenTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_resolve("glGenVertexArrays");
+	glad_glGenVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glad_lazy_resolve("glGenerateMipmap");
+	glad_glGenerateMipmap(target);
+}
+static void APIENTRY glad_lazy_glGenerateTextureMipmap(GLuint texture) {
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)glad_lazy_resolve("glGenerateTextureMipmap");
+	glad_glGenerateTextureMipmap(texture);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_resolve("glGetActiveAttrib");
+	glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_resolve("glGetActiveUniform");
+	glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_resolve("glGetActiveUniformBlockName");
+	glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_resolve("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_resolve("glGetActiveUniformName");
+	glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_resolve("glGetActiveUniformsiv");
+	glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_resolve("glGetAttachedShaders");
+	glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_resolve("glGetAttribLocation");
+	return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glad_lazy_resolve("glGetBooleani_v");
+	glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)glad_lazy_resolve("glGetBooleanv");
+	glad_glGetBooleanv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_resolve("glGetBufferParameteri64v");
+	glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetBufferParameteriv");
+	glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_resolve("glGetBufferPointerv");
+	glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_resolve("glGetBufferSubData");
+	glad_glGetBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve("glGetCompressedTexImage");
+	glad_glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glad_lazy_resolve("glGetCompressedTextureImage");
+	glad_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)glad_lazy_resolve("glGetDoublev");
+	glad_glGetDoublev(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+	glad_glGetError = (PFNGLGETERRORPROC)glad_lazy_resolve("glGetError");
+	return glad_glGetError();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)glad_lazy_resolve("glGetFloatv");
+	glad_glGetFloatv(pname, data);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_resolve("glGetFragDataIndex");
+	return glad_glGetFragDataIndex(program, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_resolve("glGetFragDataLocation");
+	return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve("glGetFramebufferAttachmentParameteriv");
+	glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glad_lazy_resolve("glGetInteger64i_v");
+	glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)glad_lazy_resolve("glGetInteger64v");
+	glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glad_lazy_resolve("glGetIntegeri_v");
+	glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)glad_lazy_resolve("glGetIntegerv");
+	glad_glGetIntegerv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_resolve("glGetMultisamplefv");
+	glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glad_lazy_resolve("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferParameteri64v(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteriv(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)glad_lazy_resolve("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferPointerv(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve("glGetNamedBufferSubData");
+	glad_glGetNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+static void APIENTRY glad_lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetNamedRenderbufferParameteriv");
+	glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)glad_lazy_resolve("glGetProgramBinary");
+	glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_resolve("glGetProgramInfoLog");
+	glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glad_lazy_resolve("glGetProgramiv");
+	glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)glad_lazy_resolve("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)glad_lazy_resolve("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glad_lazy_resolve("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)glad_lazy_resolve("glGetQueryBufferObjectuiv");
+	glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_resolve("glGetQueryObjecti64v");
+	glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_resolve("glGetQueryObjectiv");
+	glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_resolve("glGetQueryObjectui64v");
+	glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_resolve("glGetQueryObjectuiv");
+	glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)glad_lazy_resolve("glGetQueryiv");
+	glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetRenderbufferParameteriv");
+	glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glGetSamplerParameterIuiv");
+	glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glGetSamplerParameteriv");
+	glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_resolve("glGetShaderInfoLog");
+	glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glad_lazy_resolve("glGetShaderSource");
+	glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)glad_lazy_resolve("glGetShaderiv");
+	glad_glGetShaderiv(shader, pname, params);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetString(GLenum name) {
+	glad_glGetString = (PFNGLGETSTRINGPROC)glad_lazy_resolve("glGetString");
+	return glad_glGetString(name);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)glad_lazy_resolve("glGetStringi");
+	return glad_glGetStringi(name, index);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)glad_lazy_resolve("glGetSynciv");
+	glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)glad_lazy_resolve("glGetTexImage");
+	glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_resolve("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_resolve("glGetTexLevelParameteriv");
+	glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_resolve("glGetTexParameterIiv");
+	glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_resolve("glGetTexParameterIuiv");
+	glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_resolve("glGetTexParameterfv");
+	glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_resolve("glGetTexParameteriv");
+	glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)glad_lazy_resolve("glGetTextureImage");
+	glad_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)glad_lazy_resolve("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameterfv(texture, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)glad_lazy_resolve("glGetTextureLevelParameteriv");
+	glad_glGetTextureLevelParameteriv(texture, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)glad_lazy_resolve("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)glad_lazy_resolve("glGetTextureParameterIuiv");
+	glad_glGetTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)glad_lazy_resolve("glGetTextureParameterfv");
+	glad_glGetTextureParameterfv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)glad_lazy_resolve("glGetTextureParameteriv");
+	glad_glGetTextureParameteriv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_resolve("glGetTransformFeedbackVarying");
+	glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)glad_lazy_resolve("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbackiv(xfb, pname, param);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_resolve("glGetUniformBlockIndex");
+	return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_resolve("glGetUniformIndices");
+	glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_resolve("glGetUniformLocation");
+	return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glad_lazy_resolve("glGetUniformfv");
+	glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glad_lazy_resolve("glGetUniformiv");
+	glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glad_lazy_resolve("glGetUniformuiv");
+	glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)glad_lazy_resolve("glGetVertexArrayIndexed64iv");
+	glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)glad_lazy_resolve("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)glad_lazy_resolve("glGetVertexArrayiv");
+	glad_glGetVertexArrayiv(vaobj, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_resolve("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_resolve("glGetVertexAttribIuiv");
+	glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_resolve("glGetVertexAttribPointerv");
+	glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_resolve("glGetVertexAttribdv");
+	glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_resolve("glGetVertexAttribfv");
+	glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_resolve("glGetVertexAttribiv");
+	glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+	glad_glHint = (PFNGLHINTPROC)glad_lazy_resolve("glHint");
+	glad_glHint(target, mode);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glad_lazy_resolve("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glad_lazy_resolve("glInvalidateNamedFramebufferSubData");
+	glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)glad_lazy_resolve("glIsBuffer");
+	return glad_glIsBuffer(buffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)glad_lazy_resolve("glIsEnabled");
+	return glad_glIsEnabled(cap);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)glad_lazy_resolve("glIsEnabledi");
+	return glad_glIsEnabledi(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glad_lazy_resolve("glIsFramebuffer");
+	return glad_glIsFramebuffer(framebuffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)glad_lazy_resolve("glIsProgram");
+	return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+	glad_glIsQuery = (PFNGLISQUERYPROC)glad_lazy_resolve("glIsQuery");
+	return glad_glIsQuery(id);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glad_lazy_resolve("glIsRenderbuffer");
+	return glad_glIsRenderbuffer(renderbuffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)glad_lazy_resolve("glIsSampler");
+	return glad_glIsSampler(sampler);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+	glad_glIsShader = (PFNGLISSHADERPROC)glad_lazy_resolve("glIsShader");
+	return glad_glIsShader(shader);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+	glad_glIsSync = (PFNGLISSYNCPROC)glad_lazy_resolve("glIsSync");
+	return glad_glIsSync(sync);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)glad_lazy_resolve("glIsTexture");
+	return glad_glIsTexture(texture);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glad_lazy_resolve("glIsVertexArray");
+	return glad_glIsVertexArray(array);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)glad_lazy_resolve("glLineWidth");
+	glad_glLineWidth(width);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)glad_lazy_resolve("glLinkProgram");
+	glad_glLinkProgram(program);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+	glad_glLogicOp = (PFNGLLOGICOPPROC)glad_lazy_resolve("glLogicOp");
+	glad_glLogicOp(opcode);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)glad_lazy_resolve("glMapBuffer");
+	return glad_glMapBuffer(target, access);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_resolve("glMapBufferRange");
+	return glad_glMapBufferRange(target, offset, length, access);
+}
+static void * APIENTRY glad_lazy_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)glad_lazy_resolve("glMapNamedBuffer");
+	return glad_glMapNamedBuffer(buffer, access);
+}
+static void * APIENTRY glad_lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)glad_lazy_resolve("glMapNamedBufferRange");
+	return glad_glMapNamedBufferRange(buffer, offset, length, access);
+}
+static void APIENTRY glad_lazy_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glad_lazy_resolve("glMaxShaderCompilerThreadsKHR");
+	glad_glMaxShaderCompilerThreadsKHR(count);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_resolve("glMultiDrawArrays");
+	glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_lazy_resolve("glMultiDrawArraysIndirect");
+	glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_resolve("glMultiDrawElements");
+	glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glMultiDrawElementsBaseVertex");
+	glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve("glMultiDrawElementsIndirect");
+	glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_resolve("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_resolve("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_resolve("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_resolve("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_resolve("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_resolve("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_resolve("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_resolve("glMultiTexCoordP4uiv");
+	glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)glad_lazy_resolve("glNamedBufferData");
+	glad_glNamedBufferData(buffer, size, data, usage);
+}
+static void APIENTRY glad_lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)glad_lazy_resolve("glNamedBufferStorage");
+	glad_glNamedBufferStorage(buffer, size, data, flags);
+}
+static void APIENTRY glad_lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve("glNamedBufferSubData");
+	glad_glNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glad_lazy_resolve("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glad_lazy_resolve("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glad_lazy_resolve("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glad_lazy_resolve("glNamedFramebufferReadBuffer");
+	glad_glNamedFramebufferReadBuffer(framebuffer, src);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glad_lazy_resolve("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve("glNamedRenderbufferStorageMultisample");
+	glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)glad_lazy_resolve("glNormalP3ui");
+	glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glad_lazy_resolve("glNormalP3uiv");
+	glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)glad_lazy_resolve("glPixelStoref");
+	glad_glPixelStoref(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)glad_lazy_resolve("glPixelStorei");
+	glad_glPixelStorei(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glad_lazy_resolve("glPointParameterf");
+	glad_glPointParameterf(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_resolve("glPointParameterfv");
+	glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glad_lazy_resolve("glPointParameteri");
+	glad_glPointParameteri(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_resolve("glPointParameteriv");
+	glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)glad_lazy_resolve("glPointSize");
+	glad_glPointSize(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)glad_lazy_resolve("glPolygonMode");
+	glad_glPolygonMode(face, mode);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)glad_lazy_resolve("glPolygonOffset");
+	glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_resolve("glPrimitiveRestartIndex");
+	glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)glad_lazy_resolve("glProgramBinary");
+	glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)glad_lazy_resolve("glProgramParameteri");
+	glad_glProgramParameteri(program, pname, value);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_resolve("glProvokingVertex");
+	glad_glProvokingVertex(mode);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)glad_lazy_resolve("glQueryCounter");
+	glad_glQueryCounter(id, target);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)glad_lazy_resolve("glReadBuffer");
+	glad_glReadBuffer(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)glad_lazy_resolve("glReadPixels");
+	glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_resolve("glRenderbufferStorage");
+	glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve("glRenderbufferStorageMultisample");
+	glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_resolve("glSampleCoverage");
+	glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)glad_lazy_resolve("glSampleMaski");
+	glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glSamplerParameterIiv");
+	glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glSamplerParameterIuiv");
+	glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_resolve("glSamplerParameterf");
+	glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glSamplerParameterfv");
+	glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_resolve("glSamplerParameteri");
+	glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glSamplerParameteriv");
+	glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glScissor = (PFNGLSCISSORPROC)glad_lazy_resolve("glScissor");
+	glad_glScissor(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_resolve("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_resolve("glSecondaryColorP3uiv");
+	glad_glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)glad_lazy_resolve("glShaderSource");
+	glad_glShaderSource(shader, count, string, length);
 }
-#endif
-
-static
-void* get_proc(const char *namez) {
-    void* result = NULL;
-    if(libGL == NULL) return NULL;
-
-#if !defined(__APPLE__) && !defined(__HAIKU__)
-    if(gladGetProcAddressPtr != NULL) {
-        result = gladGetProcAddressPtr(namez);
-    }
-#endif
-    if(result == NULL) {
-#if defined(_WIN32) || defined(__CYGWIN__)
-        result = (void*)GetProcAddress((HMODULE) libGL, namez);
-#else
-        result = dlsym(libGL, namez);
-#endif
-    }
-
-    return result;
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)glad_lazy_resolve("glStencilFunc");
+	glad_glStencilFunc(func, ref, mask);
 }
-
-int gladLoadGL(void) {
-    int status = 0;
-
-    if(open_gl()) {
-        status = gladLoadGLLoader(&get_proc);
-        close_gl();
-    }
-
-    return status;
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_resolve("glStencilFuncSeparate");
+	glad_glStencilFuncSeparate(face, func, ref, mask);
 }
-
-struct gladGLversionStruct GLVersion = { 0, 0 };
-
-#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
-#define _GLAD_IS_SOME_NEW_VERSION 1
-#endif
-
-static int max_loaded_major;
-static int max_loaded_minor;
-
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
-
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
-            return 0;
-        }
-
-        for(index = 0; index < num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
-
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
-    }
-#endif
-    return 1;
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)glad_lazy_resolve("glStencilMask");
+	glad_glStencilMask(mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_resolve("glStencilMaskSeparate");
+	glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)glad_lazy_resolve("glStencilOp");
+	glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_resolve("glStencilOpSeparate");
+	glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)glad_lazy_resolve("glTexBuffer");
+	glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glad_lazy_resolve("glTexCoordP1ui");
+	glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_resolve("glTexCoordP1uiv");
+	glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glad_lazy_resolve("glTexCoordP2ui");
+	glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_resolve("glTexCoordP2uiv");
+	glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glad_lazy_resolve("glTexCoordP3ui");
+	glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_resolve("glTexCoordP3uiv");
+	glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glad_lazy_resolve("glTexCoordP4ui");
+	glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_resolve("glTexCoordP4uiv");
+	glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)glad_lazy_resolve("glTexImage1D");
+	glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)glad_lazy_resolve("glTexImage2D");
+	glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage2DMultisample");
+	glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)glad_lazy_resolve("glTexImage3D");
+	glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage3DMultisample");
+	glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_resolve("glTexParameterIiv");
+	glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_resolve("glTexParameterIuiv");
+	glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)glad_lazy_resolve("glTexParameterf");
+	glad_glTexParameterf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)glad_lazy_resolve("glTexParameterfv");
+	glad_glTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)glad_lazy_resolve("glTexParameteri");
+	glad_glTexParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)glad_lazy_resolve("glTexParameteriv");
+	glad_glTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_resolve("glTexSubImage1D");
+	glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_resolve("glTexSubImage2D");
+	glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_resolve("glTexSubImage3D");
+	glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)glad_lazy_resolve("glTextureBuffer");
+	glad_glTextureBuffer(texture, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)glad_lazy_resolve("glTextureBufferRange");
+	glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)glad_lazy_resolve("glTextureParameterIiv");
+	glad_glTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)glad_lazy_resolve("glTextureParameterIuiv");
+	glad_glTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)glad_lazy_resolve("glTextureParameterf");
+	glad_glTextureParameterf(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)glad_lazy_resolve("glTextureParameterfv");
+	glad_glTextureParameterfv(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)glad_lazy_resolve("glTextureParameteri");
+	glad_glTextureParameteri(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)glad_lazy_resolve("glTextureParameteriv");
+	glad_glTextureParameteriv(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)glad_lazy_resolve("glTextureStorage1D");
+	glad_glTextureStorage1D(texture, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)glad_lazy_resolve("glTextureStorage2D");
+	glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTextureStorage2DMultisample");
+	glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)glad_lazy_resolve("glTextureStorage3D");
+	glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTextureStorage3DMultisample");
+	glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)glad_lazy_resolve("glTextureSubImage1D");
+	glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)glad_lazy_resolve("glTextureSubImage2D");
+	glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)glad_lazy_resolve("glTextureSubImage3D");
+	glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glad_lazy_resolve("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glad_lazy_resolve("glTransformFeedbackBufferRange");
+	glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_resolve("glTransformFeedbackVaryings");
+	glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)glad_lazy_resolve("glUniform1f");
+	glad_glUniform1f(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)glad_lazy_resolve("glUniform1fv");
+	glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)glad_lazy_resolve("glUniform1i");
+	glad_glUniform1i(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)glad_lazy_resolve("glUniform1iv");
+	glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)glad_lazy_resolve("glUniform1ui");
+	glad_glUniform1ui(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glad_lazy_resolve("glUniform1uiv");
+	glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)glad_lazy_resolve("glUniform2f");
+	glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)glad_lazy_resolve("glUniform2fv");
+	glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)glad_lazy_resolve("glUniform2i");
+	glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)glad_lazy_resolve("glUniform2iv");
+	glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)glad_lazy_resolve("glUniform2ui");
+	glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glad_lazy_resolve("glUniform2uiv");
+	glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)glad_lazy_resolve("glUniform3f");
+	glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)glad_lazy_resolve("glUniform3fv");
+	glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)glad_lazy_resolve("glUniform3i");
+	glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)glad_lazy_resolve("glUniform3iv");
+	glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)glad_lazy_resolve("glUniform3ui");
+	glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glad_lazy_resolve("glUniform3uiv");
+	glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)glad_lazy_resolve("glUniform4f");
+	glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)glad_lazy_resolve("glUniform4fv");
+	glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)glad_lazy_resolve("glUniform4i");
+	glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)glad_lazy_resolve("glUniform4iv");
+	glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)glad_lazy_resolve("glUniform4ui");
+	glad_glUniform4ui(location, v0, v1, v2, v3);
 }
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glad_lazy_resolve("glUniform4uiv");
+	glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_resolve("glUniformBlockBinding");
+	glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_resolve("glUniformMatrix2fv");
+	glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve("glUniformMatrix2x3fv");
+	glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve("glUniformMatrix2x4fv");
+	glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_resolve("glUniformMatrix3fv");
+	glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve("glUniformMatrix3x2fv");
+	glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve("glUniformMatrix3x4fv");
+	glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_resolve("glUniformMatrix4fv");
+	glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve("glUniformMatrix4x2fv");
+	glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve("glUniformMatrix4x3fv");
+	glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glad_lazy_resolve("glUnmapBuffer");
+	return glad_glUnmapBuffer(target);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapNamedBuffer(GLuint buffer) {
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)glad_lazy_resolve("glUnmapNamedBuffer");
+	return glad_glUnmapNamedBuffer(buffer);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)glad_lazy_resolve("glUseProgram");
+	glad_glUseProgram(program);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_resolve("glValidateProgram");
+	glad_glValidateProgram(program);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)glad_lazy_resolve("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)glad_lazy_resolve("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)glad_lazy_resolve("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)glad_lazy_resolve("glVertexArrayAttribLFormat");
+	glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)glad_lazy_resolve("glVertexArrayBindingDivisor");
+	glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+static void APIENTRY glad_lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)glad_lazy_resolve("glVertexArrayElementBuffer");
+	glad_glVertexArrayElementBuffer(vaobj, buffer);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)glad_lazy_resolve("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glad_lazy_resolve("glVertexArrayVertexBuffers");
+	glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_resolve("glVertexAttrib1d");
+	glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_resolve("glVertexAttrib1dv");
+	glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_resolve("glVertexAttrib1f");
+	glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_resolve("glVertexAttrib1fv");
+	glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_resolve("glVertexAttrib1s");
+	glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_resolve("glVertexAttrib1sv");
+	glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_resolve("glVertexAttrib2d");
+	glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_resolve("glVertexAttrib2dv");
+	glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_resolve("glVertexAttrib2f");
+	glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_resolve("glVertexAttrib2fv");
+	glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_resolve("glVertexAttrib2s");
+	glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_resolve("glVertexAttrib2sv");
+	glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_resolve("glVertexAttrib3d");
+	glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_resolve("glVertexAttrib3dv");
+	glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_resolve("glVertexAttrib3f");
+	glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_resolve("glVertexAttrib3fv");
+	glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_resolve("glVertexAttrib3s");
+	glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_resolve("glVertexAttrib3sv");
+	glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_resolve("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_resolve("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_resolve("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_resolve("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_resolve("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_resolve("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_resolve("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_resolve("glVertexAttrib4bv");
+	glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_resolve("glVertexAttrib4d");
+	glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_resolve("glVertexAttrib4dv");
+	glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_resolve("glVertexAttrib4f");
+	glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_resolve("glVertexAttrib4fv");
+	glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_resolve("glVertexAttrib4iv");
+	glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_resolve("glVertexAttrib4s");
+	glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_resolve("glVertexAttrib4sv");
+	glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_resolve("glVertexAttrib4ubv");
+	glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_resolve("glVertexAttrib4uiv");
+	glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_resolve("glVertexAttrib4usv");
+	glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_resolve("glVertexAttribDivisor");
+	glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_resolve("glVertexAttribI1i");
+	glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_resolve("glVertexAttribI1iv");
+	glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_resolve("glVertexAttribI1ui");
+	glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_resolve("glVertexAttribI1uiv");
+	glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_resolve("glVertexAttribI2i");
+	glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_resolve("glVertexAttribI2iv");
+	glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_resolve("glVertexAttribI2ui");
+	glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_resolve("glVertexAttribI2uiv");
+	glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_resolve("glVertexAttribI3i");
+	glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_resolve("glVertexAttribI3iv");
+	glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_resolve("glVertexAttribI3ui");
+	glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_resolve("glVertexAttribI3uiv");
+	glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_resolve("glVertexAttribI4bv");
+	glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_resolve("glVertexAttribI4i");
+	glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_resolve("glVertexAttribI4iv");
+	glad_glVertexAttribI4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_resolve("glVertexAttribI4sv");
+	glad_glVertexAttribI4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_resolve("glVertexAttribI4ubv");
+	glad_glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_resolve("glVertexAttribI4ui");
+	glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_resolve("glVertexAttribI4uiv");
+	glad_glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_resolve("glVertexAttribI4usv");
+	glad_glVertexAttribI4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_resolve("glVertexAttribIPointer");
+	glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_resolve("glVertexAttribP1ui");
+	glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_resolve("glVertexAttribP1uiv");
+	glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_resolve("glVertexAttribP2ui");
+	glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_resolve("glVertexAttribP2uiv");
+	glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_resolve("glVertexAttribP3ui");
+	glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_resolve("glVertexAttribP3uiv");
+	glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_resolve("glVertexAttribP4ui");
+	glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_resolve("glVertexAttribP4uiv");
+	glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_resolve("glVertexAttribPointer");
+	glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)glad_lazy_resolve("glVertexP2ui");
+	glad_glVertexP2ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glad_lazy_resolve("glVertexP2uiv");
+	glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)glad_lazy_resolve("glVertexP3ui");
+	glad_glVertexP3ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glad_lazy_resolve("glVertexP3uiv");
+	glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)glad_lazy_resolve("glVertexP4ui");
+	glad_glVertexP4ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glad_lazy_resolve("glVertexP4uiv");
+	glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glViewport = (PFNGLVIEWPORTPROC)glad_lazy_resolve("glViewport");
+	glad_glViewport(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)glad_lazy_resolve("glWaitSync");
+	glad_glWaitSync(sync, flags, timeout);
+}
+static const GladLazyEntry glad_lazy_entries[] = {
+	{"glActiveTexture", (GLADapiproc)glad_lazy_glActiveTexture},
+	{"glAttachShader", (GLADapiproc)glad_lazy_glAttachShader},
+	{"glBeginConditionalRender", (GLADapiproc)glad_lazy_glBeginConditionalRender},
+	{"glBeginQuery", (GLADapiproc)glad_lazy_glBeginQuery},
+	{"glBeginTransformFeedback", (GLADapiproc)glad_lazy_glBeginTransformFeedback},
+	{"glBindAttribLocation", (GLADapiproc)glad_lazy_glBindAttribLocation},
+	{"glBindBuffer", (GLADapiproc)glad_lazy_glBindBuffer},
+	{"glBindBufferBase", (GLADapiproc)glad_lazy_glBindBufferBase},
+	{"glBindBufferRange", (GLADapiproc)glad_lazy_glBindBufferRange},
+	{"glBindFragDataLocation", (GLADapiproc)glad_lazy_glBindFragDataLocation},
+	{"glBindFragDataLocationIndexed", (GLADapiproc)glad_lazy_glBindFragDataLocationIndexed},
+	{"glBindFramebuffer", (GLADapiproc)glad_lazy_glBindFramebuffer},
+	{"glBindRenderbuffer", (GLADapiproc)glad_lazy_glBindRenderbuffer},
+	{"glBindSampler", (GLADapiproc)glad_lazy_glBindSampler},
+	{"glBindTexture", (GLADapiproc)glad_lazy_glBindTexture},
+	{"glBindTextureUnit", (GLADapiproc)glad_lazy_glBindTextureUnit},
+	{"glBindVertexArray", (GLADapiproc)glad_lazy_glBindVertexArray},
+	{"glBlendColor", (GLADapiproc)glad_lazy_glBlendColor},
+	{"glBlendEquation", (GLADapiproc)glad_lazy_glBlendEquation},
+	{"glBlendEquationSeparate", (GLADapiproc)glad_lazy_glBlendEquationSeparate},
+	{"glBlendFunc", (GLADapiproc)glad_lazy_glBlendFunc},
+	{"glBlendFuncSeparate", (GLADapiproc)glad_lazy_glBlendFuncSeparate},
+	{"glBlitFramebuffer", (GLADapiproc)glad_lazy_glBlitFramebuffer},
+	{"glBlitNamedFramebuffer", (GLADapiproc)glad_lazy_glBlitNamedFramebuffer},
+	{"glBufferData", (GLADapiproc)glad_lazy_glBufferData},
+	{"glBufferStorage", (GLADapiproc)glad_lazy_glBufferStorage},
+	{"glBufferSubData", (GLADapiproc)glad_lazy_glBufferSubData},
+	{"glCheckFramebufferStatus", (GLADapiproc)glad_lazy_glCheckFramebufferStatus},
+	{"glCheckNamedFramebufferStatus", (GLADapiproc)glad_lazy_glCheckNamedFramebufferStatus},
+	{"glClampColor", (GLADapiproc)glad_lazy_glClampColor},
+	{"glClear", (GLADapiproc)glad_lazy_glClear},
+	{"glClearBufferfi", (GLADapiproc)glad_lazy_glClearBufferfi},
+	{"glClearBufferfv", (GLADapiproc)glad_lazy_glClearBufferfv},
+	{"glClearBufferiv", (GLADapiproc)glad_lazy_glClearBufferiv},
+	{"glClearBufferuiv", (GLADapiproc)glad_lazy_glClearBufferuiv},
+	{"glClearColor", (GLADapiproc)glad_lazy_glClearColor},
+	{"glClearDepth", (GLADapiproc)glad_lazy_glClearDepth},
+	{"glClearNamedBufferData", (GLADapiproc)glad_lazy_glClearNamedBufferData},
+	{"glClearNamedBufferSubData", (GLADapiproc)glad_lazy_glClearNamedBufferSubData},
+	{"glClearNamedFramebufferfi", (GLADapiproc)glad_lazy_glClearNamedFramebufferfi},
+	{"glClearNamedFramebufferfv", (GLADapiproc)glad_lazy_glClearNamedFramebufferfv},
+	{"glClearNamedFramebufferiv", (GLADapiproc)glad_lazy_glClearNamedFramebufferiv},
+	{"glClearNamedFramebufferuiv", (GLADapiproc)glad_lazy_glClearNamedFramebufferuiv},
+	{"glClearStencil", (GLADapiproc)glad_lazy_glClearStencil},
+	{"glClientWaitSync", (GLADapiproc)glad_lazy_glClientWaitSync},
+	{"glColorMask", (GLADapiproc)glad_lazy_glColorMask},
+	{"glColorMaski", (GLADapiproc)glad_lazy_glColorMaski},
+	{"glColorP3ui", (GLADapiproc)glad_lazy_glColorP3ui},
+	{"glColorP3uiv", (GLADapiproc)glad_lazy_glColorP3uiv},
+	{"glColorP4ui", (GLADapiproc)glad_lazy_glColorP4ui},
+	{"glColorP4uiv", (GLADapiproc)glad_lazy_glColorP4uiv},
+	{"glCompileShader", (GLADapiproc)glad_lazy_glCompileShader},
+	{"glCompressedTexImage1D", (GLADapiproc)glad_lazy_glCompressedTexImage1D},
+	{"glCompressedTexImage2D", (GLADapiproc)glad_lazy_glCompressedTexImage2D},
+	{"glCompressedTexImage3D", (GLADapiproc)glad_lazy_glCompressedTexImage3D},
+	{"glCompressedTexSubImage1D", (GLADapiproc)glad_lazy_glCompressedTexSubImage1D},
+	{"glCompressedTexSubImage2D", (GLADapiproc)glad_lazy_glCompressedTexSubImage2D},
+	{"glCompressedTexSubImage3D", (GLADapiproc)glad_lazy_glCompressedTexSubImage3D},
+	{"glCompressedTextureSubImage1D", (GLADapiproc)glad_lazy_glCompressedTextureSubImage1D},
+	{"glCompressedTextureSubImage2D", (GLADapiproc)glad_lazy_glCompressedTextureSubImage2D},
+	{"glCompressedTextureSubImage3D", (GLADapiproc)glad_lazy_glCompressedTextureSubImage3D},
+	{"glCopyBufferSubData", (GLADapiproc)glad_lazy_glCopyBufferSubData},
+	{"glCopyNamedBufferSubData", (GLADapiproc)glad_lazy_glCopyNamedBufferSubData},
+	{"glCopyTexImage1D", (GLADapiproc)glad_lazy_glCopyTexImage1D},
+	{"glCopyTexImage2D", (GLADapiproc)glad_lazy_glCopyTexImage2D},
+	{"glCopyTexSubImage1D", (GLADapiproc)glad_lazy_glCopyTexSubImage1D},
+	{"glCopyTexSubImage2D", (GLADapiproc)glad_lazy_glCopyTexSubImage2D},
+	{"glCopyTexSubImage3D", (GLADapiproc)glad_lazy_glCopyTexSubImage3D},
+	{"glCopyTextureSubImage1D", (GLADapiproc)glad_lazy_glCopyTextureSubImage1D},
+	{"glCopyTextureSubImage2D", (GLADapiproc)glad_lazy_glCopyTextureSubImage2D},
+	{"glCopyTextureSubImage3D", (GLADapiproc)glad_lazy_glCopyTextureSubImage3D},
+	{"glCreateBuffers", (GLADapiproc)glad_lazy_glCreateBuffers},
+	{"glCreateFramebuffers", (GLADapiproc)glad_lazy_glCreateFramebuffers},
+	{"glCreateProgram", (GLADapiproc)glad_lazy_glCreateProgram},
+	{"glCreateProgramPipelines", (GLADapiproc)glad_lazy_glCreateProgramPipelines},
+	{"glCreateQueries", (GLADapiproc)glad_lazy_glCreateQueries},
+	{"glCreateRenderbuffers", (GLADapiproc)glad_lazy_glCreateRenderbuffers},
+	{"glCreateSamplers", (GLADapiproc)glad_lazy_glCreateSamplers},
+	{"glCreateShader", (GLADapiproc)glad_lazy_glCreateShader},
+	{"glCreateTextures", (GLADapiproc)glad_lazy_glCreateTextures},
+	{"glCreateTransformFeedbacks", (GLADapiproc)glad_lazy_glCreateTransformFeedbacks},
+	{"glCreateVertexArrays", (GLADapiproc)glad_lazy_glCreateVertexArrays},
+	{"glCullFace", (GLADapiproc)glad_lazy_glCullFace},
+	{"glDeleteBuffers", (GLADapiproc)glad_lazy_glDeleteBuffers},
+	{"glDeleteFramebuffers", (GLADapiproc)glad_lazy_glDeleteFramebuffers},
+	{"glDeleteProgram", (GLADapiproc)glad_lazy_glDeleteProgram},
+	{"glDeleteQueries", (GLADapiproc)glad_lazy_glDeleteQueries},
+	{"glDeleteRenderbuffers", (GLADapiproc)glad_lazy_glDeleteRenderbuffers},
+	{"glDeleteSamplers", (GLADapiproc)glad_lazy_glDeleteSamplers},
+	{"glDeleteShader", (GLADapiproc)glad_lazy_glDeleteShader},
+	{"glDeleteSync", (GLADapiproc)glad_lazy_glDeleteSync},
+	{"glDeleteTextures", (GLADapiproc)glad_lazy_glDeleteTextures},
+	{"glDeleteVertexArrays", (GLADapiproc)glad_lazy_glDeleteVertexArrays},
+	{"glDepthFunc", (GLADapiproc)glad_lazy_glDepthFunc},
+	{"glDepthMask", (GLADapiproc)glad_lazy_glDepthMask},
+	{"glDepthRange", (GLADapiproc)glad_lazy_glDepthRange},
+	{"glDetachShader", (GLADapiproc)glad_lazy_glDetachShader},
+	{"glDisable", (GLADapiproc)glad_lazy_glDisable},
+	{"glDisableVertexArrayAttrib", (GLADapiproc)glad_lazy_glDisableVertexArrayAttrib},
+	{"glDisableVertexAttribArray", (GLADapiproc)glad_lazy_glDisableVertexAttribArray},
+	{"glDisablei", (GLADapiproc)glad_lazy_glDisablei},
+	{"glDrawArrays", (GLADapiproc)glad_lazy_glDrawArrays},
+	{"glDrawArraysIndirect", (GLADapiproc)glad_lazy_glDrawArraysIndirect},
+	{"glDrawArraysInstanced", (GLADapiproc)glad_lazy_glDrawArraysInstanced},
+	{"glDrawArraysInstancedBaseInstance", (GLADapiproc)glad_lazy_glDrawArraysInstancedBaseInstance},
+	{"glDrawBuffer", (GLADapiproc)glad_lazy_glDrawBuffer},
+	{"glDrawBuffers", (GLADapiproc)glad_lazy_glDrawBuffers},
+	{"glDrawElements", (GLADapiproc)glad_lazy_glDrawElements},
+	{"glDrawElementsBaseVertex", (GLADapiproc)glad_lazy_glDrawElementsBaseVertex},
+	{"glDrawElementsIndirect", (GLADapiproc)glad_lazy_glDrawElementsIndirect},
+	{"glDrawElementsInstanced", (GLADapiproc)glad_lazy_glDrawElementsInstanced},
+	{"glDrawElementsInstancedBaseInstance", (GLADapiproc)glad_lazy_glDrawElementsInstancedBaseInstance},
+	{"glDrawElementsInstancedBaseVertex", (GLADapiproc)glad_lazy_glDrawElementsInstancedBaseVertex},
+	{"glDrawElementsInstancedBaseVertexBaseInstance", (GLADapiproc)glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance},
+	{"glDrawRangeElements", (GLADapiproc)glad_lazy_glDrawRangeElements},
+	{"glDrawRangeElementsBaseVertex", (GLADapiproc)glad_lazy_glDrawRangeElementsBaseVertex},
+	{"glEnable", (GLADapiproc)glad_lazy_glEnable},
+	{"glEnableVertexArrayAttrib", (GLADapiproc)glad_lazy_glEnableVertexArrayAttrib},
+	{"glEnableVertexAttribArray", (GLADapiproc)glad_lazy_glEnableVertexAttribArray},
+	{"glEnablei", (GLADapiproc)glad_lazy_glEnablei},
+	{"glEndConditionalRender", (GLADapiproc)glad_lazy_glEndConditionalRender},
+	{"glEndQuery", (GLADapiproc)glad_lazy_glEndQuery},
+	{"glEndTransformFeedback", (GLADapiproc)glad_lazy_glEndTransformFeedback},
+	{"glFenceSync", (GLADapiproc)glad_lazy_glFenceSync},
+	{"glFinish", (GLADapiproc)glad_lazy_glFinish},
+	{"glFlush", (GLADapiproc)glad_lazy_glFlush},
+	{"glFlushMappedBufferRange", (GLADapiproc)glad_lazy_glFlushMappedBufferRange},
+	{"glFlushMappedNamedBufferRange", (GLADapiproc)glad_lazy_glFlushMappedNamedBufferRange},
+	{"glFramebufferRenderbuffer", (GLADapiproc)glad_lazy_glFramebufferRenderbuffer},
+	{"glFramebufferTexture", (GLADapiproc)glad_lazy_glFramebufferTexture},
+	{"glFramebufferTexture1D", (GLADapiproc)glad_lazy_glFramebufferTexture1D},
+	{"glFramebufferTexture2D", (GLADapiproc)glad_lazy_glFramebufferTexture2D},
+	{"glFramebufferTexture3D", (GLADapiproc)glad_lazy_glFramebufferTexture3D},
+	{"glFramebufferTextureLayer", (GLADapiproc)glad_lazy_glFramebufferTextureLayer},
+	{"glFrontFace", (GLADapiproc)glad_lazy_glFrontFace},
+	{"glGenBuffers", (GLADapiproc)glad_lazy_glGenBuffers},
+	{"glGenFramebuffers", (GLADapiproc)glad_lazy_glGenFramebuffers},
+	{"glGenQueries", (GLADapiproc)glad_lazy_glGenQueries},
+	{"glGenRenderbuffers", (GLADapiproc)glad_lazy_glGenRenderbuffers},
+	{"glGenSamplers", (GLADapiproc)glad_lazy_glGenSamplers},
+	{"glGenTextures", (GLADapiproc)glad_lazy_glGenTextures},
+	{"glGenVertexArrays", (GLADapiproc)glad_lazy_glGenVertexArrays},
+	{"glGenerateMipmap", (GLADapiproc)glad_lazy_glGenerateMipmap},
+	{"glGenerateTextureMipmap", (GLADapiproc)glad_lazy_glGenerateTextureMipmap},
+	{"glGetActiveAttrib", (GLADapiproc)glad_lazy_glGetActiveAttrib},
+	{"glGetActiveUniform", (GLADapiproc)glad_lazy_glGetActiveUniform},
+	{"glGetActiveUniformBlockName", (GLADapiproc)glad_lazy_glGetActiveUniformBlockName},
+	{"glGetActiveUniformBlockiv", (GLADapiproc)glad_lazy_glGetActiveUniformBlockiv},
+	{"glGetActiveUniformName", (GLADapiproc)glad_lazy_glGetActiveUniformName},
+	{"glGetActiveUniformsiv", (GLADapiproc)glad_lazy_glGetActiveUniformsiv},
+	{"glGetAttachedShaders", (GLADapiproc)glad_lazy_glGetAttachedShaders},
+	{"glGetAttribLocation", (GLADapiproc)glad_lazy_glGetAttribLocation},
+	{"glGetBooleani_v", (GLADapiproc)glad_lazy_glGetBooleani_v},
+	{"glGetBooleanv", (GLADapiproc)glad_lazy_glGetBooleanv},
+	{"glGetBufferParameteri64v", (GLADapiproc)glad_lazy_glGetBufferParameteri64v},
+	{"glGetBufferParameteriv", (GLADapiproc)glad_lazy_glGetBufferParameteriv},
+	{"glGetBufferPointerv", (GLADapiproc)glad_lazy_glGetBufferPointerv},
+	{"glGetBufferSubData", (GLADapiproc)glad_lazy_glGetBufferSubData},
+	{"glGetCompressedTexImage", (GLADapiproc)glad_lazy_glGetCompressedTexImage},
+	{"glGetCompressedTextureImage", (GLADapiproc)glad_lazy_glGetCompressedTextureImage},
+	{"glGetDoublev", (GLADapiproc)glad_lazy_glGetDoublev},
+	{"glGetError", (GLADapiproc)glad_lazy_glGetError},
+	{"glGetFloatv", (GLADapiproc)glad_lazy_glGetFloatv},
+	{"glGetFragDataIndex", (GLADapiproc)glad_lazy_glGetFragDataIndex},
+	{"glGetFragDataLocation", (GLADapiproc)glad_lazy_glGetFragDataLocation},
+	{"glGetFramebufferAttachmentParameteriv", (GLADapiproc)glad_lazy_glGetFramebufferAttachmentParameteriv},
+	{"glGetInteger64i_v", (GLADapiproc)glad_lazy_glGetInteger64i_v},
+	{"glGetInteger64v", (GLADapiproc)glad_lazy_glGetInteger64v},
+	{"glGetIntegeri_v", (GLADapiproc)glad_lazy_glGetIntegeri_v},
+	{"glGetIntegerv", (GLADapiproc)glad_lazy_glGetIntegerv},
+	{"glGetMultisamplefv", (GLADapiproc)glad_lazy_glGetMultisamplefv},
+	{"glGetNamedBufferParameteri64v", (GLADapiproc)glad_lazy_glGetNamedBufferParameteri64v},
+	{"glGetNamedBufferParameteriv", (GLADapiproc)glad_lazy_glGetNamedBufferParameteriv},
+	{"glGetNamedBufferPointerv", (GLADapiproc)glad_lazy_glGetNamedBufferPointerv},
+	{"glGetNamedBufferSubData", (GLADapiproc)glad_lazy_glGetNamedBufferSubData},
+	{"glGetNamedFramebufferAttachmentParameteriv", (GLADapiproc)glad_lazy_glGetNamedFramebufferAttachmentParameteriv},
+	{"glGetNamedFramebufferParameteriv", (GLADapiproc)glad_lazy_glGetNamedFramebufferParameteriv},
+	{"glGetNamedRenderbufferParameteriv", (GLADapiproc)glad_lazy_glGetNamedRenderbufferParameteriv},
+	{"glGetProgramBinary", (GLADapiproc)glad_lazy_glGetProgramBinary},
+	{"glGetProgramInfoLog", (GLADapiproc)glad_lazy_glGetProgramInfoLog},
+	{"glGetProgramiv", (GLADapiproc)glad_lazy_glGetProgramiv},
+	{"glGetQueryBufferObjecti64v", (GLADapiproc)glad_lazy_glGetQueryBufferObjecti64v},
+	{"glGetQueryBufferObjectiv", (GLADapiproc)glad_lazy_glGetQueryBufferObjectiv},
+	{"glGetQueryBufferObjectui64v", (GLADapiproc)glad_lazy_glGetQueryBufferObjectui64v},
+	{"glGetQueryBufferObjectuiv", (GLADapiproc)glad_lazy_glGetQueryBufferObjectuiv},
+	{"glGetQueryObjecti64v", (GLADapiproc)glad_lazy_glGetQueryObjecti64v},
+	{"glGetQueryObjectiv", (GLADapiproc)glad_lazy_glGetQueryObjectiv},
+	{"glGetQueryObjectui64v", (GLADapiproc)glad_lazy_glGetQueryObjectui64v},
+	{"glGetQueryObjectuiv", (GLADapiproc)glad_lazy_glGetQueryObjectuiv},
+	{"glGetQueryiv", (GLADapiproc)glad_lazy_glGetQueryiv},
+	{"glGetRenderbufferParameteriv", (GLADapiproc)glad_lazy_glGetRenderbufferParameteriv},
+	{"glGetSamplerParameterIiv", (GLADapiproc)glad_lazy_glGetSamplerParameterIiv},
+	{"glGetSamplerParameterIuiv", (GLADapiproc)glad_lazy_glGetSamplerParameterIuiv},
+	{"glGetSamplerParameterfv", (GLADapiproc)glad_lazy_glGetSamplerParameterfv},
+	{"glGetSamplerParameteriv", (GLADapiproc)glad_lazy_glGetSamplerParameteriv},
+	{"glGetShaderInfoLog", (GLADapiproc)glad_lazy_glGetShaderInfoLog},
+	{"glGetShaderSource", (GLADapiproc)glad_lazy_glGetShaderSource},
+	{"glGetShaderiv", (GLADapiproc)glad_lazy_glGetShaderiv},
+	{"glGetString", (GLADapiproc)glad_lazy_glGetString},
+	{"glGetStringi", (GLADapiproc)glad_lazy_glGetStringi},
+	{"glGetSynciv", (GLADapiproc)glad_lazy_glGetSynciv},
+	{"glGetTexImage", (GLADapiproc)glad_lazy_glGetTexImage},
+	{"glGetTexLevelParameterfv", (GLADapiproc)glad_lazy_glGetTexLevelParameterfv},
+	{"glGetTexLevelParameteriv", (GLADapiproc)glad_lazy_glGetTexLevelParameteriv},
+	{"glGetTexParameterIiv", (GLADapiproc)glad_lazy_glGetTexParameterIiv},
+	{"glGetTexParameterIuiv", (GLADapiproc)glad_lazy_glGetTexParameterIuiv},
+	{"glGetTexParameterfv", (GLADapiproc)glad_lazy_glGetTexParameterfv},
+	{"glGetTexParameteriv", (GLADapiproc)glad_lazy_glGetTexParameteriv},
+	{"glGetTextureImage", (GLADapiproc)glad_lazy_glGetTextureImage},
+	{"glGetTextureLevelParameterfv", (GLADapiproc)glad_lazy_glGetTextureLevelParameterfv},
+	{"glGetTextureLevelParameteriv", (GLADapiproc)glad_lazy_glGetTextureLevelParameteriv},
+	{"glGetTextureParameterIiv", (GLADapiproc)glad_lazy_glGetTextureParameterIiv},
+	{"glGetTextureParameterIuiv", (GLADapiproc)glad_lazy_glGetTextureParameterIuiv},
+	{"glGetTextureParameterfv", (GLADapiproc)glad_lazy_glGetTextureParameterfv},
+	{"glGetTextureParameteriv", (GLADapiproc)glad_lazy_glGetTextureParameteriv},
+	{"glGetTransformFeedbackVarying", (GLADapiproc)glad_lazy_glGetTransformFeedbackVarying},
+	{"glGetTransformFeedbackiv", (GLADapiproc)glad_lazy_glGetTransformFeedbackiv},
+	{"glGetUniformBlockIndex", (GLADapiproc)glad_lazy_glGetUniformBlockIndex},
+	{"glGetUniformIndices", (GLADapiproc)glad_lazy_glGetUniformIndices},
+	{"glGetUniformLocation", (GLADapiproc)glad_lazy_glGetUniformLocation},
+	{"glGetUniformfv", (GLADapiproc)glad_lazy_glGetUniformfv},
+	{"glGetUniformiv", (GLADapiproc)glad_lazy_glGetUniformiv},
+	{"glGetUniformuiv", (GLADapiproc)glad_lazy_glGetUniformuiv},
+	{"glGetVertexArrayIndexed64iv", (GLADapiproc)glad_lazy_glGetVertexArrayIndexed64iv},
+	{"glGetVertexArrayIndexediv", (GLADapiproc)glad_lazy_glGetVertexArrayIndexediv},
+	{"glGetVertexArrayiv", (GLADapiproc)glad_lazy_glGetVertexArrayiv},
+	{"glGetVertexAttribIiv", (GLADapiproc)glad_lazy_glGetVertexAttribIiv},
+	{"glGetVertexAttribIuiv", (GLADapiproc)glad_lazy_glGetVertexAttribIuiv},
+	{"glGetVertexAttribPointerv", (GLADapiproc)glad_lazy_glGetVertexAttribPointerv},
+	{"glGetVertexAttribdv", (GLADapiproc)glad_lazy_glGetVertexAttribdv},
+	{"glGetVertexAttribfv", (GLADapiproc)glad_lazy_glGetVertexAttribfv},
+	{"glGetVertexAttribiv", (GLADapiproc)glad_lazy_glGetVertexAttribiv},
+	{"glHint", (GLADapiproc)glad_lazy_glHint},
+	{"glInvalidateNamedFramebufferData", (GLADapiproc)glad_lazy_glInvalidateNamedFramebufferData},
+	{"glInvalidateNamedFramebufferSubData", (GLADapiproc)glad_lazy_glInvalidateNamedFramebufferSubData},
+	{"glIsBuffer", (GLADapiproc)glad_lazy_glIsBuffer},
+	{"glIsEnabled", (GLADapiproc)glad_lazy_glIsEnabled},
+	{"glIsEnabledi", (GLADapiproc)glad_lazy_glIsEnabledi},
+	{"glIsFramebuffer", (GLADapiproc)glad_lazy_glIsFramebuffer},
+	{"glIsProgram", (GLADapiproc)glad_lazy_glIsProgram},
+	{"glIsQuery", (GLADapiproc)glad_lazy_glIsQuery},
+	{"glIsRenderbuffer", (GLADapiproc)glad_lazy_glIsRenderbuffer},
+	{"glIsSampler", (GLADapiproc)glad_lazy_glIsSampler},
+	{"glIsShader", (GLADapiproc)glad_lazy_glIsShader},
+	{"glIsSync", (GLADapiproc)glad_lazy_glIsSync},
+	{"glIsTexture", (GLADapiproc)glad_lazy_glIsTexture},
+	{"glIsVertexArray", (GLADapiproc)glad_lazy_glIsVertexArray},
+	{"glLineWidth", (GLADapiproc)glad_lazy_glLineWidth},
+	{"glLinkProgram", (GLADapiproc)glad_lazy_glLinkProgram},
+	{"glLogicOp", (GLADapiproc)glad_lazy_glLogicOp},
+	{"glMapBuffer", (GLADapiproc)glad_lazy_glMapBuffer},
+	{"glMapBufferRange", (GLADapiproc)glad_lazy_glMapBufferRange},
+	{"glMapNamedBuffer", (GLADapiproc)glad_lazy_glMapNamedBuffer},
+	{"glMapNamedBufferRange", (GLADapiproc)glad_lazy_glMapNamedBufferRange},
+	{"glMaxShaderCompilerThreadsKHR", (GLADapiproc)glad_lazy_glMaxShaderCompilerThreadsKHR},
+	{"glMultiDrawArrays", (GLADapiproc)glad_lazy_glMultiDrawArrays},
+	{"glMultiDrawArraysIndirect", (GLADapiproc)glad_lazy_glMultiDrawArraysIndirect},
+	{"glMultiDrawElements", (GLADapiproc)glad_lazy_glMultiDrawElements},
+	{"glMultiDrawElementsBaseVertex", (GLADapiproc)glad_lazy_glMultiDrawElementsBaseVertex},
+	{"glMultiDrawElementsIndirect", (GLADapiproc)glad_lazy_glMultiDrawElementsIndirect},
+	{"glMultiTexCoordP1ui", (GLADapiproc)glad_lazy_glMultiTexCoordP1ui},
+	{"glMultiTexCoordP1uiv", (GLADapiproc)glad_lazy_glMultiTexCoordP1uiv},
+	{"glMultiTexCoordP2ui", (GLADapiproc)glad_lazy_glMultiTexCoordP2ui},
+	{"glMultiTexCoordP2uiv", (GLADapiproc)glad_lazy_glMultiTexCoordP2uiv},
+	{"glMultiTexCoordP3ui", (GLADapiproc)glad_lazy_glMultiTexCoordP3ui},
+	{"glMultiTexCoordP3uiv", (GLADapiproc)glad_lazy_glMultiTexCoordP3uiv},
+	{"glMultiTexCoordP4ui", (GLADapiproc)glad_lazy_glMultiTexCoordP4ui},
+	{"glMultiTexCoordP4uiv", (GLADapiproc)glad_lazy_glMultiTexCoordP4uiv},
+	{"glNamedBufferData", (GLADapiproc)glad_lazy_glNamedBufferData},
+	{"glNamedBufferStorage", (GLADapiproc)glad_lazy_glNamedBufferStorage},
+	{"glNamedBufferSubData", (GLADapiproc)glad_lazy_glNamedBufferSubData},
+	{"glNamedFramebufferDrawBuffer", (GLADapiproc)glad_lazy_glNamedFramebufferDrawBuffer},
+	{"glNamedFramebufferDrawBuffers", (GLADapiproc)glad_lazy_glNamedFramebufferDrawBuffers},
+	{"glNamedFramebufferParameteri", (GLADapiproc)glad_lazy_glNamedFramebufferParameteri},
+	{"glNamedFramebufferReadBuffer", (GLADapiproc)glad_lazy_glNamedFramebufferReadBuffer},
+	{"glNamedFramebufferRenderbuffer", (GLADapiproc)glad_lazy_glNamedFramebufferRenderbuffer},
+	{"glNamedFramebufferTexture", (GLADapiproc)glad_lazy_glNamedFramebufferTexture},
+	{"glNamedFramebufferTextureLayer", (GLADapiproc)glad_lazy_glNamedFramebufferTextureLayer},
+	{"glNamedRenderbufferStorage", (GLADapiproc)glad_lazy_glNamedRenderbufferStorage},
+	{"glNamedRenderbufferStorageMultisample", (GLADapiproc)glad_lazy_glNamedRenderbufferStorageMultisample},
+	{"glNormalP3ui", (GLADapiproc)glad_lazy_glNormalP3ui},
+	{"glNormalP3uiv", (GLADapiproc)glad_lazy_glNormalP3uiv},
+	{"glPixelStoref", (GLADapiproc)glad_lazy_glPixelStoref},
+	{"glPixelStorei", (GLADapiproc)glad_lazy_glPixelStorei},
+	{"glPointParameterf", (GLADapiproc)glad_lazy_glPointParameterf},
+	{"glPointParameterfv", (GLADapiproc)glad_lazy_glPointParameterfv},
+	{"glPointParameteri", (GLADapiproc)glad_lazy_glPointParameteri},
+	{"glPointParameteriv", (GLADapiproc)glad_lazy_glPointParameteriv},
+	{"glPointSize", (GLADapiproc)glad_lazy_glPointSize},
+	{"glPolygonMode", (GLADapiproc)glad_lazy_glPolygonMode},
+	{"glPolygonOffset", (GLADapiproc)glad_lazy_glPolygonOffset},
+	{"glPrimitiveRestartIndex", (GLADapiproc)glad_lazy_glPrimitiveRestartIndex},
+	{"glProgramBinary", (GLADapiproc)glad_lazy_glProgramBinary},
+	{"glProgramParameteri", (GLADapiproc)glad_lazy_glProgramParameteri},
+	{"glProvokingVertex", (GLADapiproc)glad_lazy_glProvokingVertex},
+	{"glQueryCounter", (GLADapiproc)glad_lazy_glQueryCounter},
+	{"glReadBuffer", (GLADapiproc)glad_lazy_glReadBuffer},
+	{"glReadPixels", (GLADapiproc)glad_lazy_glReadPixels},
+	{"glRenderbufferStorage", (GLADapiproc)glad_lazy_glRenderbufferStorage},
+	{"glRenderbufferStorageMultisample", (GLADapiproc)glad_lazy_glRenderbufferStorageMultisample},
+	{"glSampleCoverage", (GLADapiproc)glad_lazy_glSampleCoverage},
+	{"glSampleMaski", (GLADapiproc)glad_lazy_glSampleMaski},
+	{"glSamplerParameterIiv", (GLADapiproc)glad_lazy_glSamplerParameterIiv},
+	{"glSamplerParameterIuiv", (GLADapiproc)glad_lazy_glSamplerParameterIuiv},
+	{"glSamplerParameterf", (GLADapiproc)glad_lazy_glSamplerParameterf},
+	{"glSamplerParameterfv", (GLADapiproc)glad_lazy_glSamplerParameterfv},
+	{"glSamplerParameteri", (GLADapiproc)glad_lazy_glSamplerParameteri},
+	{"glSamplerParameteriv", (GLADapiproc)glad_lazy_glSamplerParameteriv},
+	{"glScissor", (GLADapiproc)glad_lazy_glScissor},
+	{"glSecondaryColorP3ui", (GLADapiproc)glad_lazy_glSecondaryColorP3ui},
+	{"glSecondaryColorP3uiv", (GLADapiproc)glad_lazy_glSecondaryColorP3uiv},
+	{"glShaderSource", (GLADapiproc)glad_lazy_glShaderSource},
+	{"glStencilFunc", (GLADapiproc)glad_lazy_glStencilFunc},
+	{"glStencilFuncSeparate", (GLADapiproc)glad_lazy_glStencilFuncSeparate},
+	{"glStencilMask", (GLADapiproc)glad_lazy_glStencilMask},
+	{"glStencilMaskSeparate", (GLADapiproc)glad_lazy_glStencilMaskSeparate},
+	{"glStencilOp", (GLADapiproc)glad_lazy_glStencilOp},
+	{"glStencilOpSeparate", (GLADapiproc)glad_lazy_glStencilOpSeparate},
+	{"glTexBuffer", (GLADapiproc)glad_lazy_glTexBuffer},
+	{"glTexCoordP1ui", (GLADapiproc)glad_lazy_glTexCoordP1ui},
+	{"glTexCoordP1uiv", (GLADapiproc)glad_lazy_glTexCoordP1uiv},
+	{"glTexCoordP2ui", (GLADapiproc)glad_lazy_glTexCoordP2ui},
+	{"glTexCoordP2uiv", (GLADapiproc)glad_lazy_glTexCoordP2uiv},
+	{"glTexCoordP3ui", (GLADapiproc)glad_lazy_glTexCoordP3ui},
+	{"glTexCoordP3uiv", (GLADapiproc)glad_lazy_glTexCoordP3uiv},
+	{"glTexCoordP4ui", (GLADapiproc)glad_lazy_glTexCoordP4ui},
+	{"glTexCoordP4uiv", (GLADapiproc)glad_lazy_glTexCoordP4uiv},
+	{"glTexImage1D", (GLADapiproc)glad_lazy_glTexImage1D},
+	{"glTexImage2D", (GLADapiproc)glad_lazy_glTexImage2D},
+	{"glTexImage2DMultisample", (GLADapiproc)glad_lazy_glTexImage2DMultisample},
+	{"glTexImage3D", (GLADapiproc)glad_lazy_glTexImage3D},
+	{"glTexImage3DMultisample", (GLADapiproc)glad_lazy_glTexImage3DMultisample},
+	{"glTexParameterIiv", (GLADapiproc)glad_lazy_glTexParameterIiv},
+	{"glTexParameterIuiv", (GLADapiproc)glad_lazy_glTexParameterIuiv},
+	{"glTexParameterf", (GLADapiproc)glad_lazy_glTexParameterf},
+	{"glTexParameterfv", (GLADapiproc)glad_lazy_glTexParameterfv},
+	{"glTexParameteri", (GLADapiproc)glad_lazy_glTexParameteri},
+	{"glTexParameteriv", (GLADapiproc)glad_lazy_glTexParameteriv},
+	{"glTexSubImage1D", (GLADapiproc)glad_lazy_glTexSubImage1D},
+	{"glTexSubImage2D", (GLADapiproc)glad_lazy_glTexSubImage2D},
+	{"glTexSubImage3D", (GLADapiproc)glad_lazy_glTexSubImage3D},
+	{"glTextureBuffer", (GLADapiproc)glad_lazy_glTextureBuffer},
+	{"glTextureBufferRange", (GLADapiproc)glad_lazy_glTextureBufferRange},
+	{"glTextureParameterIiv", (GLADapiproc)glad_lazy_glTextureParameterIiv},
+	{"glTextureParameterIuiv", (GLADapiproc)glad_lazy_glTextureParameterIuiv},
+	{"glTextureParameterf", (GLADapiproc)glad_lazy_glTextureParameterf},
+	{"glTextureParameterfv", (GLADapiproc)glad_lazy_glTextureParameterfv},
+	{"glTextureParameteri", (GLADapiproc)glad_lazy_glTextureParameteri},
+	{"glTextureParameteriv", (GLADapiproc)glad_lazy_glTextureParameteriv},
+	{"glTextureStorage1D", (GLADapiproc)glad_lazy_glTextureStorage1D},
+	{"glTextureStorage2D", (GLADapiproc)glad_lazy_glTextureStorage2D},
+	{"glTextureStorage2DMultisample", (GLADapiproc)glad_lazy_glTextureStorage2DMultisample},
+	{"glTextureStorage3D", (GLADapiproc)glad_lazy_glTextureStorage3D},
+	{"glTextureStorage3DMultisample", (GLADapiproc)glad_lazy_glTextureStorage3DMultisample},
+	{"glTextureSubImage1D", (GLADapiproc)glad_lazy_glTextureSubImage1D},
+	{"glTextureSubImage2D", (GLADapiproc)glad_lazy_glTextureSubImage2D},
+	{"glTextureSubImage3D", (GLADapiproc)glad_lazy_glTextureSubImage3D},
+	{"glTransformFeedbackBufferBase", (GLADapiproc)glad_lazy_glTransformFeedbackBufferBase},
+	{"glTransformFeedbackBufferRange", (GLADapiproc)glad_lazy_glTransformFeedbackBufferRange},
+	{"glTransformFeedbackVaryings", (GLADapiproc)glad_lazy_glTransformFeedbackVaryings},
+	{"glUniform1f", (GLADapiproc)glad_lazy_glUniform1f},
+	{"glUniform1fv", (GLADapiproc)glad_lazy_glUniform1fv},
+	{"glUniform1i", (GLADapiproc)glad_lazy_glUniform1i},
+	{"glUniform1iv", (GLADapiproc)glad_lazy_glUniform1iv},
+	{"glUniform1ui", (GLADapiproc)glad_lazy_glUniform1ui},
+	{"glUniform1uiv", (GLADapiproc)glad_lazy_glUniform1uiv},
+	{"glUniform2f", (GLADapiproc)glad_lazy_glUniform2f},
+	{"glUniform2fv", (GLADapiproc)glad_lazy_glUniform2fv},
+	{"glUniform2i", (GLADapiproc)glad_lazy_glUniform2i},
+	{"glUniform2iv", (GLADapiproc)glad_lazy_glUniform2iv},
+	{"glUniform2ui", (GLADapiproc)glad_lazy_glUniform2ui},
+	{"glUniform2uiv", (GLADapiproc)glad_lazy_glUniform2uiv},
+	{"glUniform3f", (GLADapiproc)glad_lazy_glUniform3f},
+	{"glUniform3fv", (GLADapiproc)glad_lazy_glUniform3fv},
+	{"glUniform3i", (GLADapiproc)glad_lazy_glUniform3i},
+	{"glUniform3iv", (GLADapiproc)glad_lazy_glUniform3iv},
+	{"glUniform3ui", (GLADapiproc)glad_lazy_glUniform3ui},
+	{"glUniform3uiv", (GLADapiproc)glad_lazy_glUniform3uiv},
+	{"glUniform4f", (GLADapiproc)glad_lazy_glUniform4f},
+	{"glUniform4fv", (GLADapiproc)glad_lazy_glUniform4fv},
+	{"glUniform4i", (GLADapiproc)glad_lazy_glUniform4i},
+	{"glUniform4iv", (GLADapiproc)glad_lazy_glUniform4iv},
+	{"glUniform4ui", (GLADapiproc)glad_lazy_glUniform4ui},
+	{"glUniform4uiv", (GLADapiproc)glad_lazy_glUniform4uiv},
+	{"glUniformBlockBinding", (GLADapiproc)glad_lazy_glUniformBlockBinding},
+	{"glUniformMatrix2fv", (GLADapiproc)glad_lazy_glUniformMatrix2fv},
+	{"glUniformMatrix2x3fv", (GLADapiproc)glad_lazy_glUniformMatrix2x3fv},
+	{"glUniformMatrix2x4fv", (GLADapiproc)glad_lazy_glUniformMatrix2x4fv},
+	{"glUniformMatrix3fv", (GLADapiproc)glad_lazy_glUniformMatrix3fv},
+	{"glUniformMatrix3x2fv", (GLADapiproc)glad_lazy_glUniformMatrix3x2fv},
+	{"glUniformMatrix3x4fv", (GLADapiproc)glad_lazy_glUniformMatrix3x4fv},
+	{"glUniformMatrix4fv", (GLADapiproc)glad_lazy_glUniformMatrix4fv},
+	{"glUniformMatrix4x2fv", (GLADapiproc)glad_lazy_glUniformMatrix4x2fv},
+	{"glUniformMatrix4x3fv", (GLADapiproc)glad_lazy_glUniformMatrix4x3fv},
+	{"glUnmapBuffer", (GLADapiproc)glad_lazy_glUnmapBuffer},
+	{"glUnmapNamedBuffer", (GLADapiproc)glad_lazy_glUnmapNamedBuffer},
+	{"glUseProgram", (GLADapiproc)glad_lazy_glUseProgram},
+	{"glValidateProgram", (GLADapiproc)glad_lazy_glValidateProgram},
+	{"glVertexArrayAttribBinding", (GLADapiproc)glad_lazy_glVertexArrayAttribBinding},
+	{"glVertexArrayAttribFormat", (GLADapiproc)glad_lazy_glVertexArrayAttribFormat},
+	{"glVertexArrayAttribIFormat", (GLADapiproc)glad_lazy_glVertexArrayAttribIFormat},
+	{"glVertexArrayAttribLFormat", (GLADapiproc)glad_lazy_glVertexArrayAttribLFormat},
+	{"glVertexArrayBindingDivisor", (GLADapiproc)glad_lazy_glVertexArrayBindingDivisor},
+	{"glVertexArrayElementBuffer", (GLADapiproc)glad_lazy_glVertexArrayElementBuffer},
+	{"glVertexArrayVertexBuffer", (GLADapiproc)glad_lazy_glVertexArrayVertexBuffer},
+	{"glVertexArrayVertexBuffers", (GLADapiproc)glad_lazy_glVertexArrayVertexBuffers},
+	{"glVertexAttrib1d", (GLADapiproc)glad_lazy_glVertexAttrib1d},
+	{"glVertexAttrib1dv", (GLADapiproc)glad_lazy_glVertexAttrib1dv},
+	{"glVertexAttrib1f", (GLADapiproc)glad_lazy_glVertexAttrib1f},
+	{"glVertexAttrib1fv", (GLADapiproc)glad_lazy_glVertexAttrib1fv},
+	{"glVertexAttrib1s", (GLADapiproc)glad_lazy_glVertexAttrib1s},
+	{"glVertexAttrib1sv", (GLADapiproc)glad_lazy_glVertexAttrib1sv},
+	{"glVertexAttrib2d", (GLADapiproc)glad_lazy_glVertexAttrib2d},
+	{"glVertexAttrib2dv", (GLADapiproc)glad_lazy_glVertexAttrib2dv},
+	{"glVertexAttrib2f", (GLADapiproc)glad_lazy_glVertexAttrib2f},
+	{"glVertexAttrib2fv", (GLADapiproc)glad_lazy_glVertexAttrib2fv},
+	{"glVertexAttrib2s", (GLADapiproc)glad_lazy_glVertexAttrib2s},
+	{"glVertexAttrib2sv", (GLADapiproc)glad_lazy_glVertexAttrib2sv},
+	{"glVertexAttrib3d", (GLADapiproc)glad_lazy_glVertexAttrib3d},
+	{"glVertexAttrib3dv", (GLADapiproc)glad_lazy_glVertexAttrib3dv},
+	{"glVertexAttrib3f", (GLADapiproc)glad_lazy_glVertexAttrib3f},
+	{"glVertexAttrib3fv", (GLADapiproc)glad_lazy_glVertexAttrib3fv},
+	{"glVertexAttrib3s", (GLADapiproc)glad_lazy_glVertexAttrib3s},
+	{"glVertexAttrib3sv", (GLADapiproc)glad_lazy_glVertexAttrib3sv},
+	{"glVertexAttrib4Nbv", (GLADapiproc)glad_lazy_glVertexAttrib4Nbv},
+	{"glVertexAttrib4Niv", (GLADapiproc)glad_lazy_glVertexAttrib4Niv},
+	{"glVertexAttrib4Nsv", (GLADapiproc)glad_lazy_glVertexAttrib4Nsv},
+	{"glVertexAttrib4Nub", (GLADapiproc)glad_lazy_glVertexAttrib4Nub},
+	{"glVertexAttrib4Nubv", (GLADapiproc)glad_lazy_glVertexAttrib4Nubv},
+	{"glVertexAttrib4Nuiv", (GLADapiproc)glad_lazy_glVertexAttrib4Nuiv},
+	{"glVertexAttrib4Nusv", (GLADapiproc)glad_lazy_glVertexAttrib4Nusv},
+	{"glVertexAttrib4bv", (GLADapiproc)glad_lazy_glVertexAttrib4bv},
+	{"glVertexAttrib4d", (GLADapiproc)glad_lazy_glVertexAttrib4d},
+	{"glVertexAttrib4dv", (GLADapiproc)glad_lazy_glVertexAttrib4dv},
+	{"glVertexAttrib4f", (GLADapiproc)glad_lazy_glVertexAttrib4f},
+	{"glVertexAttrib4fv", (GLADapiproc)glad_lazy_glVertexAttrib4fv},
+	{"glVertexAttrib4iv", (GLADapiproc)glad_lazy_glVertexAttrib4iv},
+	{"glVertexAttrib4s", (GLADapiproc)glad_lazy_glVertexAttrib4s},
+	{"glVertexAttrib4sv", (GLADapiproc)glad_lazy_glVertexAttrib4sv},
+	{"glVertexAttrib4ubv", (GLADapiproc)glad_lazy_glVertexAttrib4ubv},
+	{"glVertexAttrib4uiv", (GLADapiproc)glad_lazy_glVertexAttrib4uiv},
+	{"glVertexAttrib4usv", (GLADapiproc)glad_lazy_glVertexAttrib4usv},
+	{"glVertexAttribDivisor", (GLADapiproc)glad_lazy_glVertexAttribDivisor},
+	{"glVertexAttribI1i", (GLADapiproc)glad_lazy_glVertexAttribI1i},
+	{"glVertexAttribI1iv", (GLADapiproc)glad_lazy_glVertexAttribI1iv},
+	{"glVertexAttribI1ui", (GLADapiproc)glad_lazy_glVertexAttribI1ui},
+	{"glVertexAttribI1uiv", (GLADapiproc)glad_lazy_glVertexAttribI1uiv},
+	{"glVertexAttribI2i", (GLADapiproc)glad_lazy_glVertexAttribI2i},
+	{"glVertexAttribI2iv", (GLADapiproc)glad_lazy_glVertexAttribI2iv},
+	{"glVertexAttribI2ui", (GLADapiproc)glad_lazy_glVertexAttribI2ui},
+	{"glVertexAttribI2uiv", (GLADapiproc)glad_lazy_glVertexAttribI2uiv},
+	{"glVertexAttribI3i", (GLADapiproc)glad_lazy_glVertexAttribI3i},
+	{"glVertexAttribI3iv", (GLADapiproc)glad_lazy_glVertexAttribI3iv},
+	{"glVertexAttribI3ui", (GLADapiproc)glad_lazy_glVertexAttribI3ui},
+	{"glVertexAttribI3uiv", (GLADapiproc)glad_lazy_glVertexAttribI3uiv},
+	{"glVertexAttribI4bv", (GLADapiproc)glad_lazy_glVertexAttribI4bv},
+	{"glVertexAttribI4i", (GLADapiproc)glad_lazy_glVertexAttribI4i},
+	{"glVertexAttribI4iv", (GLADapiproc)glad_lazy_glVertexAttribI4iv},
+	{"glVertexAttribI4sv", (GLADapiproc)glad_lazy_glVertexAttribI4sv},
+	{"glVertexAttribI4ubv", (GLADapiproc)glad_lazy_glVertexAttribI4ubv},
+	{"glVertexAttribI4ui", (GLADapiproc)glad_lazy_glVertexAttribI4ui},
+	{"glVertexAttribI4uiv", (GLADapiproc)glad_lazy_glVertexAttribI4uiv},
+	{"glVertexAttribI4usv", (GLADapiproc)glad_lazy_glVertexAttribI4usv},
+	{"glVertexAttribIPointer", (GLADapiproc)glad_lazy_glVertexAttribIPointer},
+	{"glVertexAttribP1ui", (GLADapiproc)glad_lazy_glVertexAttribP1ui},
+	{"glVertexAttribP1uiv", (GLADapiproc)glad_lazy_glVertexAttribP1uiv},
+	{"glVertexAttribP2ui", (GLADapiproc)glad_lazy_glVertexAttribP2ui},
+	{"glVertexAttribP2uiv", (GLADapiproc)glad_lazy_glVertexAttribP2uiv},
+	{"glVertexAttribP3ui", (GLADapiproc)glad_lazy_glVertexAttribP3ui},
+	{"glVertexAttribP3uiv", (GLADapiproc)glad_lazy_glVertexAttribP3uiv},
+	{"glVertexAttribP4ui", (GLADapiproc)glad_lazy_glVertexAttribP4ui},
+	{"glVertexAttribP4uiv", (GLADapiproc)glad_lazy_glVertexAttribP4uiv},
+	{"glVertexAttribPointer", (GLADapiproc)glad_lazy_glVertexAttribPointer},
+	{"glVertexP2ui", (GLADapiproc)glad_lazy_glVertexP2ui},
+	{"glVertexP2uiv", (GLADapiproc)glad_lazy_glVertexP2uiv},
+	{"glVertexP3ui", (GLADapiproc)glad_lazy_glVertexP3ui},
+	{"glVertexP3uiv", (GLADapiproc)glad_lazy_glVertexP3uiv},
+	{"glVertexP4ui", (GLADapiproc)glad_lazy_glVertexP4ui},
+	{"glVertexP4uiv", (GLADapiproc)glad_lazy_glVertexP4uiv},
+	{"glViewport", (GLADapiproc)glad_lazy_glViewport},
+	{"glWaitSync", (GLADapiproc)glad_lazy_glWaitSync},
+};
+#define GLAD_LAZY_ENTRY_COUNT (sizeof(glad_lazy_entries) / sizeof(glad_lazy_entries[0]))
+/* End of lazy resolver stubs */
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+/* The entries are sorted by name */
+static int glad_lazy_find(const char *name) {
+    int low = 0;
+    int high = (int)GLAD_LAZY_ENTRY_COUNT - 1;
+    while(low <= high) {
+        int mid = (low + high) / 2;
+        int cmp = strcmp(name, glad_lazy_entries[mid].name);
+        if(cmp == 0) return mid;
+        if(cmp < 0) high = mid - 1;
+        else low = mid + 1;
     }
+    return -1;
 }
 
-static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
-        }
+/* Stands in for the real loader: hands out stubs instead of resolving */
+static void* glad_lazy_load(const char *name) {
+    int index = glad_lazy_find(name);
+    if(index < 0 || GLAD_GL_CONTEXT.lazy_hot[index]) {
+        return GLAD_GL_CONTEXT.lazy_loader(name);
     }
-#endif
-
-    return 0;
+    return (void*)glad_lazy_entries[index].stub;
 }
-int GLAD_GL_VERSION_1_0 = 0;
-int GLAD_GL_VERSION_1_1 = 0;
-int GLAD_GL_VERSION_1_2 = 0;
-int GLAD_GL_VERSION_1_3 = 0;
-int GLAD_GL_VERSION_1_4 = 0;
-int GLAD_GL_VERSION_1_5 = 0;
-int GLAD_GL_VERSION_2_0 = 0;
-int GLAD_GL_VERSION_2_1 = 0;
-int GLAD_GL_VERSION_3_0 = 0;
-int GLAD_GL_VERSION_3_1 = 0;
-int GLAD_GL_VERSION_3_2 = 0;
-int GLAD_GL_VERSION_3_3 = 0;
-PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
-PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
-PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
-PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
-PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
-PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
-PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
-PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
-PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
-PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
-PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
-PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
-PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
-PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
-PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
-PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
-PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
-PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
-PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
-PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
-PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
-PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
-PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
-PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
-PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
-PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
-PFNGLCLEARPROC glad_glClear = NULL;
-PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
-PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
-PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
-PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
-PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
-PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
-PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
-PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
-PFNGLCOLORMASKPROC glad_glColorMask = NULL;
-PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
-PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
-PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
-PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
-PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
-PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
-PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
-PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
-PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
-PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
-PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
-PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
-PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
-PFNGLCULLFACEPROC glad_glCullFace = NULL;
-PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
-PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
-PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
-PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
-PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
-PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
-PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
-PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
-PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
-PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
-PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
-PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
-PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
-PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
-PFNGLDISABLEPROC glad_glDisable = NULL;
-PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
-PFNGLDISABLEIPROC glad_glDisablei = NULL;
-PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
-PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
-PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
-PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
-PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
-PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
-PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
-PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
-PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
-PFNGLENABLEPROC glad_glEnable = NULL;
-PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
-PFNGLENABLEIPROC glad_glEnablei = NULL;
-PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
-PFNGLENDQUERYPROC glad_glEndQuery = NULL;
-PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
-PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
-PFNGLFINISHPROC glad_glFinish = NULL;
-PFNGLFLUSHPROC glad_glFlush = NULL;
-PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
-PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
-PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
-PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
-PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
-PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
-PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
-PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
-PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
-PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
-PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
-PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
-PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
-PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
-PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
-PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
-PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
-PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
-PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
-PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
-PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
-PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
-PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
-PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
-PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
-PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
-PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
-PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
-PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
-PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
-PFNGLGETERRORPROC glad_glGetError = NULL;
-PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
-PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
-PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
-PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
-PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
-PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
-PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
-PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
-PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
-PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
-PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
-PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
-PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
-PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
-PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
-PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
-PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
-PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
-PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
-PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
-PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
-PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
-PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
-PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
-PFNGLGETSTRINGPROC glad_glGetString = NULL;
-PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
-PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
-PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
-PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
-PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
-PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
-PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
-PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
-PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
-PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
-PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
-PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
-PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
-PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
-PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
-PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
-PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
-PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
-PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
-PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
-PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
-PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
-PFNGLHINTPROC glad_glHint = NULL;
-PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
-PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
-PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
-PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
-PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
-PFNGLISQUERYPROC glad_glIsQuery = NULL;
-PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
-PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
-PFNGLISSHADERPROC glad_glIsShader = NULL;
-PFNGLISSYNCPROC glad_glIsSync = NULL;
-PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
-PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
-PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
-PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
-PFNGLLOGICOPPROC glad_glLogicOp = NULL;
-PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
-PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
-PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
-PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
-PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
-PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
-PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
-PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
-PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
-PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
-PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
-PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
-PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
-PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
-PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
-PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
-PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
-PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
-PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
-PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
-PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
-PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
-PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
-PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
-PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
-PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
-PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
-PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
-PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
-PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
-PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
-PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
-PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
-PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
-PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
-PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
-PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
-PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
-PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
-PFNGLSCISSORPROC glad_glScissor = NULL;
-PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
-PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
-PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
-PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
-PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
-PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
-PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
-PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
-PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
-PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
-PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
-PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
-PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
-PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
-PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
-PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
-PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
-PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
-PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
-PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
-PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
-PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
-PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
-PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
-PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
-PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
-PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
-PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
-PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
-PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
-PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
-PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
-PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
-PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
-PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
-PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
-PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
-PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
-PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
-PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
-PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
-PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
-PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
-PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
-PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
-PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
-PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
-PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
-PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
-PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
-PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
-PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
-PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
-PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
-PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
-PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
-PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
-PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
-PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
-PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
-PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
-PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
-PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
-PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
-PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
-PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
-PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
-PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
-PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
-PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
-PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
-PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
-PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
-PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
-PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
-PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
-PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
-PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
-PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
-PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
-PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
-PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
-PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
-PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
-PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
-PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
-PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
-PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
-PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
-PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
-PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
-PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
-PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
-PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
-PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
-PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
-PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
-PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
-PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
-PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
-PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
-PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
-PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
-PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
-PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
-PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
-PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
-PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
-PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
-PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
-PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
-PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
-PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
-PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
-PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
-PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
-PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
-PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
-PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
-PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
-PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
-PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
-PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
-PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
-PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
-PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
-PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
-PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
-PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
-PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
-PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
-PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
-PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
-PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
-PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
-PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
-PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
-PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
-PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
-PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
-PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
-PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
-PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
-PFNGLVIEWPORTPROC glad_glViewport = NULL;
-PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1054,10 +3117,143 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+static void load_GL_ARB_base_instance(GLADloadproc load) {
+	if(!GLAD_GL_ARB_base_instance) return;
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
+}
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_direct_state_access(GLADloadproc load) {
+	if(!GLAD_GL_ARB_direct_state_access) return;
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+}
+static void load_GL_ARB_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_draw_indirect) return;
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+}
+static void load_GL_ARB_multi_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
+	GLAD_GL_ARB_base_instance = has_ext("GL_ARB_base_instance");
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
+	GLAD_GL_ARB_direct_state_access = has_ext("GL_ARB_direct_state_access");
+	GLAD_GL_ARB_draw_indirect = has_ext("GL_ARB_draw_indirect");
+	GLAD_GL_ARB_multi_draw_indirect = has_ext("GL_ARB_multi_draw_indirect");
 	return 1;
 }
 
@@ -1096,7 +3292,7 @@ static void find_coreGL(void) {
 #endif
 
     GLVersion.major = major; GLVersion.minor = minor;
-    max_loaded_major = major; max_loaded_minor = minor;
+    GLAD_GL_CONTEXT.max_loaded_major = major; GLAD_GL_CONTEXT.max_loaded_minor = minor;
 	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
 	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
 	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
@@ -1110,8 +3306,8 @@ static void find_coreGL(void) {
 	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
 	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
 	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
-		max_loaded_major = 3;
-		max_loaded_minor = 3;
+		GLAD_GL_CONTEXT.max_loaded_major = 3;
+		GLAD_GL_CONTEXT.max_loaded_minor = 3;
 	}
 }
 
@@ -1135,6 +3331,40 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_get_program_binary(load);
+	load_GL_KHR_parallel_shader_compile(load);
+	load_GL_ARB_base_instance(load);
+	load_GL_ARB_buffer_storage(load);
+	load_GL_ARB_direct_state_access(load);
+	load_GL_ARB_draw_indirect(load);
+	load_GL_ARB_multi_draw_indirect(load);
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+int gladLoadGLLoaderLazy(GLADloadproc load, const char *const *hot_list, int hot_count) {
+	int i;
+	int status;
+	/* Entries named in the hot list, only needed while loading */
+	unsigned char hot[GLAD_LAZY_ENTRY_COUNT];
+	memset(hot, 0, sizeof(hot));
+	for (i = 0; i < hot_count; i++) {
+		int index = glad_lazy_find(hot_list[i]);
+		if (index >= 0) hot[index] = 1;
+	}
+	GLAD_GL_CONTEXT.lazy_loader = load;
+	GLAD_GL_CONTEXT.lazy_resolved = 0;
+	GLAD_GL_CONTEXT.lazy_hot = hot;
+	status = gladLoadGLLoader(&glad_lazy_load);
+	GLAD_GL_CONTEXT.lazy_hot = NULL;
+	return status;
+}
+
+int gladLoadGLLazy(const char *const *hot_list, int hot_count) {
+	if(!open_gl()) return 0;
+	return gladLoadGLLoaderLazy(&get_proc, hot_list, hot_count);
+}
+
+int gladGetLazyResolveCount(void) {
+	return (int)GLAD_GL_CONTEXT.lazy_resolved;
+}
+
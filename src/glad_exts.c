@@ -0,0 +1,152 @@
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad_exts.h>
+
+static unsigned int glad_exts_hash(const char *name, size_t length) {
+    /* FNV-1a */
+    unsigned int hash = 2166136261u;
+    size_t i;
+    for(i = 0; i < length; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static int glad_exts_alloc(GladExtensionSet *set, unsigned int count, size_t names_size) {
+    unsigned int slot_count = 16;
+    size_t slots_size;
+
+    glad_exts_free(set);
+
+    /* Keep the table at most half full so probes stay short */
+    while(slot_count < count * 2) {
+        slot_count *= 2;
+    }
+    slots_size = slot_count * sizeof(GladExtensionSlot);
+
+    set->block = malloc(slots_size + names_size);
+    if(set->block == NULL) {
+        return 0;
+    }
+    set->allocations = 1;
+
+    set->slots = (GladExtensionSlot*)set->block;
+    set->names = (char*)set->block + slots_size;
+    set->slot_count = slot_count;
+    memset(set->slots, 0, slots_size);
+    return 1;
+}
+
+static void glad_exts_insert(GladExtensionSet *set, const char *name, size_t length) {
+    unsigned int hash = glad_exts_hash(name, length);
+    unsigned int mask = set->slot_count - 1;
+    unsigned int index = hash & mask;
+    char *copy = set->names + set->names_used;
+
+    memcpy(copy, name, length);
+    copy[length] = '\0';
+
+    while(set->slots[index].offset != 0) {
+        const GladExtensionSlot *slot = &set->slots[index];
+        if(slot->hash == hash && strcmp(set->names + slot->offset - 1, copy) == 0) {
+            return; /* Listed twice */
+        }
+        index = (index + 1) & mask;
+    }
+
+    set->slots[index].hash = hash;
+    set->slots[index].offset = (unsigned int)set->names_used + 1;
+    set->names_used += length + 1;
+    set->count++;
+}
+
+int glad_exts_build_from_string(GladExtensionSet *set, const char *extensions) {
+    unsigned int count = 0;
+    const char *cursor;
+
+    if(extensions == NULL) {
+        return 0;
+    }
+
+    for(cursor = extensions; *cursor != '\0'; cursor++) {
+        if(*cursor != ' ' && (cursor == extensions || cursor[-1] == ' ')) {
+            count++;
+        }
+    }
+
+    if(!glad_exts_alloc(set, count, (size_t)(cursor - extensions) + 1)) {
+        return 0;
+    }
+
+    cursor = extensions;
+    while(*cursor != '\0') {
+        const char *end = cursor;
+        while(*end != ' ' && *end != '\0') {
+            end++;
+        }
+        if(end != cursor) {
+            glad_exts_insert(set, cursor, (size_t)(end - cursor));
+        }
+        cursor = (*end == ' ') ? end + 1 : end;
+    }
+
+    return 1;
+}
+
+int glad_exts_build_from_list(GladExtensionSet *set, unsigned int count, GLADextensionproc get, void *user) {
+    size_t names_size = 0;
+    unsigned int index;
+
+    /* Size everything first so the whole set is one allocation */
+    for(index = 0; index < count; index++) {
+        const char *name = get(index, user);
+        if(name != NULL) {
+            names_size += strlen(name) + 1;
+        }
+    }
+
+    if(!glad_exts_alloc(set, count, names_size)) {
+        return 0;
+    }
+
+    for(index = 0; index < count; index++) {
+        const char *name = get(index, user);
+        if(name != NULL) {
+            glad_exts_insert(set, name, strlen(name));
+        }
+    }
+
+    return 1;
+}
+
+int glad_exts_has(const GladExtensionSet *set, const char *name) {
+    size_t length;
+    unsigned int hash;
+    unsigned int mask;
+    unsigned int index;
+
+    if(set->slots == NULL || name == NULL) {
+        return 0;
+    }
+
+    length = strlen(name);
+    hash = glad_exts_hash(name, length);
+    mask = set->slot_count - 1;
+    index = hash & mask;
+
+    while(set->slots[index].offset != 0) {
+        const GladExtensionSlot *slot = &set->slots[index];
+        if(slot->hash == hash && strcmp(set->names + slot->offset - 1, name) == 0) {
+            return 1;
+        }
+        index = (index + 1) & mask;
+    }
+
+    return 0;
+}
+
+void glad_exts_free(GladExtensionSet *set) {
+    free(set->block);
+    memset(set, 0, sizeof(*set));
+}
@@ -165,17 +165,10 @@ void gladUnloadWGL(void) {
 
 static HDC GLADWGLhdc = (HDC)INVALID_HANDLE_VALUE;
 
-static int get_exts(void) {
-    return 1;
-}
-
-static void free_exts(void) {
-    return;
-}
+/* Built by find_extensionsWGL and kept for gladHasWGLExtension */
+static GladExtensionSet glad_wgl_exts;
 
-static int has_ext(const char *ext) {
-    const char *terminator;
-    const char *loc;
+static int get_exts(void) {
     const char *extensions;
 
     if(wglGetExtensionsStringEXT == NULL && wglGetExtensionsStringARB == NULL)
@@ -186,25 +179,17 @@ static int has_ext(const char *ext) {
     else
         extensions = wglGetExtensionsStringARB(GLADWGLhdc);
 
-    if(extensions == NULL || ext == NULL)
-        return 0;
-
-    while(1) {
-        loc = strstr(extensions, ext);
-        if(loc == NULL)
-            break;
+    return glad_exts_build_from_string(&glad_wgl_exts, extensions);
+}
 
-        terminator = loc + strlen(ext);
-        if((loc == extensions || *(loc - 1) == ' ') &&
-            (*terminator == ' ' || *terminator == '\0'))
-        {
-            return 1;
-        }
-        extensions = terminator;
-    }
+static int has_ext(const char *ext) {
+    return glad_exts_has(&glad_wgl_exts, ext);
+}
 
-    return 0;
+int gladHasWGLExtension(const char *ext) {
+    return has_ext(ext);
 }
+
 int GLAD_WGL_VERSION_1_0 = 0;
 int GLAD_WGL_ARB_create_context = 0;
 int GLAD_WGL_ARB_extensions_string = 0;
@@ -249,7 +234,6 @@ static int find_extensionsWGL(void) {
 	GLAD_WGL_ARB_pixel_format = has_ext("WGL_ARB_pixel_format");
 	GLAD_WGL_EXT_extensions_string = has_ext("WGL_EXT_extensions_string");
 	GLAD_WGL_EXT_swap_control = has_ext("WGL_EXT_swap_control");
-	free_exts();
 	return 1;
 }
 
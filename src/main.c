@@ -7,6 +7,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
@@ -14,6 +15,25 @@
 #include "glad/glad.h"
 #include "glad/glad_wgl.h"
 
+#include "batch.h"
+#include "command_list.h"
+#include "damage.h"
+#include "frame_graph.h"
+#include "gl_capture.h"
+#include "gl_caps.h"
+#include "gl_state.h"
+#include "mesh_arena.h"
+#include "program_cache.h"
+#include "raster.h"
+#include "shader_compiler.h"
+#include "texture_stream.h"
+#include "vertex_format.h"
+
+#ifdef VULKAN_RENDERER
+#define VK_USE_PLATFORM_WIN32_KHR
+#include "vulkan_renderer.h"
+#endif
+
 #pragma comment(lib, "user32")
 #pragma comment(lib, "gdi32")
 #pragma comment(lib, "opengl32")
@@ -28,7 +48,14 @@ const char *vertex_shader_source =
 
     "out vec3 color;\n"
 
-    "uniform float modifier = 1.0;\n"
+    "layout (std140) uniform FrameConstants {\n"
+    "    vec2 viewport_size;\n"
+    "    float time;\n"
+    "};\n"
+
+    "layout (std140) uniform ObjectConstants {\n"
+    "    float modifier;\n"
+    "};\n"
 
     "void main()\n"
     "{\n"
@@ -47,6 +74,65 @@ const char *fragment_shader_source =
     "    fragColor = vec4(color, 1.0f);\n"
     "}\n\0";
 
+const char *batch_vertex_shader_source =
+    "#version 330 core\n"
+
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 2) in vec4 iTransform;\n"
+    "layout (location = 3) in vec2 iTranslation;\n"
+    "layout (location = 4) in vec4 iColor;\n"
+    "layout (location = 5) in vec4 iUV;\n"
+
+    "out vec4 color;\n"
+    "out vec2 uv;\n"
+
+    "layout (std140) uniform FrameConstants {\n"
+    "    vec2 viewport_size;\n"
+    "    float time;\n"
+    "};\n"
+
+    "void main()\n"
+    "{\n"
+    "    vec2 pixel = mat2(iTransform.xy, iTransform.zw) * aPos.xy + iTranslation;\n"
+    "    vec2 ndc = pixel / viewport_size * 2.0 - 1.0;\n"
+    "    gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);\n"
+    "    color = iColor;\n"
+    "    uv = mix(iUV.xy, iUV.zw, aPos.xy + 0.5);\n"
+    "}\0";
+
+const char *batch_fragment_shader_source =
+    "#version 330 core\n"
+
+    "in vec4 color;\n"
+    "in vec2 uv;\n"
+    "out vec4 fragColor;\n"
+
+    "void main()\n"
+    "{\n"
+    "    fragColor = color;\n"
+    "}\n\0";
+
+// Drawn while the real programs are still compiling
+const char *fallback_vertex_shader_source =
+    "#version 330 core\n"
+
+    "layout (location = 0) in vec3 aPos;\n"
+
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos, 1.0);\n"
+    "}\0";
+
+const char *fallback_fragment_shader_source =
+    "#version 330 core\n"
+
+    "out vec4 fragColor;\n"
+
+    "void main()\n"
+    "{\n"
+    "    fragColor = vec4(0.5, 0.5, 0.5, 1.0);\n"
+    "}\n\0";
+
 const float vertices[] = {                // (x, y, z, r, g, b)
      0.5f,  0.5f, 0.0f, 1.0f, 0.0f, 0.0f, // top right
      0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // bottom right
@@ -54,160 +140,2927 @@ const float vertices[] = {                // (x, y, z, r, g, b)
     -0.5f,  0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // top left
 };
 
-const unsigned int indices[] = {
-    0, 1, 2, // first triangle
-    0, 2, 3, // second triangle
-};
+const uint32_t indices[] = {
+    0, 1, 2, // first triangle
+    0, 2, 3, // second triangle
+};
+
+// Stored as half-float positions and unorm8 colours (12 bytes instead of 24)
+const VertexAttrib quad_attribs[] = {
+    { 0, 3, VERTEX_HALF },
+    { 1, 3, VERTEX_UNORM8 },
+};
+
+#ifdef BENCH_VERTEX
+// Heightfield used by the vertex format benchmark, with a lit surface so normals matter
+#define MESH_VERTEX_SHADER_BODY \
+    "layout (location = 0) in vec3 aPos;\n" \
+    "layout (location = 2) in vec4 aColor;\n" \
+    "#ifdef OCT_NORMALS\n" \
+    "layout (location = 1) in vec2 aNormal;\n" \
+    VERTEX_OCT_DECODE_GLSL \
+    "#define NORMAL oct_decode(aNormal)\n" \
+    "#else\n" \
+    "layout (location = 1) in vec3 aNormal;\n" \
+    "#define NORMAL aNormal\n" \
+    "#endif\n" \
+    \
+    "out vec4 color;\n" \
+    \
+    "void main()\n" \
+    "{\n" \
+    "    float light = 0.3 + 0.7 * max(dot(normalize(NORMAL), normalize(vec3(0.3, 0.5, 1.0))), 0.0);\n" \
+    "    gl_Position = vec4(aPos.xy * 0.9, aPos.z * 0.5, 1.0);\n" \
+    "    color = vec4(aColor.rgb * light, aColor.a);\n" \
+    "}\n"
+
+const char *mesh_vertex_shader_sources[2] = {
+    "#version 330 core\n" MESH_VERTEX_SHADER_BODY,
+    "#version 330 core\n#define OCT_NORMALS\n" MESH_VERTEX_SHADER_BODY,
+};
+
+const char *mesh_fragment_shader_source =
+    "#version 330 core\n"
+
+    "in vec4 color;\n"
+    "out vec4 fragColor;\n"
+
+    "void main()\n"
+    "{\n"
+    "    fragColor = color;\n"
+    "}\n\0";
+
+// Full precision, as meshes were stored before: 40 bytes per vertex and 32-bit indices
+const VertexAttrib mesh_float_attribs[] = {
+    { 0, 3, VERTEX_FLOAT32 },
+    { 1, 3, VERTEX_FLOAT32 },
+    { 2, 4, VERTEX_FLOAT32 },
+};
+
+// 16 bytes per vertex, and 16-bit indices when the mesh is small enough
+const VertexAttrib mesh_compact_attribs[] = {
+    { 0, 3, VERTEX_HALF },
+    { 1, 3, VERTEX_OCT16 },
+    { 2, 4, VERTEX_UNORM8 },
+};
+#endif
+
+#ifdef BENCH_TEXTURE
+// The unit quad placed over `rect` (NDC min.xy, max.zw) and textured edge to edge
+const char *texture_vertex_shader_source =
+    "#version 330 core\n"
+
+    "layout (location = 0) in vec3 aPos;\n"
+
+    "uniform vec4 rect;\n"
+
+    "out vec2 uv;\n"
+
+    "void main()\n"
+    "{\n"
+    "    uv = aPos.xy + 0.5;\n"
+    "    gl_Position = vec4(mix(rect.xy, rect.zw, uv), 0.0, 1.0);\n"
+    "}\0";
+
+const char *texture_fragment_shader_source =
+    "#version 330 core\n"
+
+    "in vec2 uv;\n"
+    "out vec4 fragColor;\n"
+
+    "uniform sampler2D image;\n"
+
+    "void main()\n"
+    "{\n"
+    "    fragColor = texture(image, uv);\n"
+    "}\n\0";
+#endif
+
+#ifdef BENCH_COMMANDS
+// The unit quad placed over `rect` (NDC min.xy, max.zw) in a palette colour
+const char *command_vertex_shader_source =
+    "#version 330 core\n"
+
+    "layout (location = 0) in vec3 aPos;\n"
+
+    "layout (std140) uniform CommandPalette {\n"
+    "    vec4 colors[16];\n"
+    "};\n"
+
+    "uniform vec4 rect;\n"
+    "uniform int color_index;\n"
+
+    "out vec4 color;\n"
+
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(mix(rect.xy, rect.zw, aPos.xy + 0.5), 0.0, 1.0);\n"
+    "    color = colors[color_index];\n"
+    "}\0";
+
+const char *command_fragment_shader_source =
+    "#version 330 core\n"
+
+    "in vec4 color;\n"
+    "out vec4 fragColor;\n"
+
+    "void main()\n"
+    "{\n"
+    "    fragColor = color;\n"
+    "}\n\0";
+#endif
+
+#ifdef BENCH_FRAMEGRAPH
+// A bloom chain and a debug view run through the frame graph. The vertex
+// shader covers the target with one triangle made from gl_VertexID.
+const char *post_vertex_shader_source =
+    "#version 330 core\n"
+
+    "out vec2 uv;\n"
+
+    "void main()\n"
+    "{\n"
+    "    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+    "    uv = corner;\n"
+    "    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);\n"
+    "}\0";
+
+#define POST_FRAGMENT_SHADER_BODY \
+    "in vec2 uv;\n" \
+    "out vec4 fragColor;\n" \
+    \
+    "uniform sampler2D source;\n" \
+    "uniform sampler2D bloom;\n" \
+    "uniform vec2 direction;\n" /* One texel along the blur axis */ \
+    \
+    "void main()\n" \
+    "{\n" \
+    "#if defined(BRIGHT)\n" \
+    "    fragColor = vec4(max(texture(source, uv).rgb - 0.6, 0.0) * 2.5, 1.0);\n" \
+    "#elif defined(BLUR)\n" \
+    "    const float weights[5] = float[](0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);\n" \
+    "    vec3 sum = texture(source, uv).rgb * weights[0];\n" \
+    "    for (int i = 1; i < 5; i++) {\n" \
+    "        sum += (texture(source, uv + direction * i).rgb + texture(source, uv - direction * i).rgb) * weights[i];\n" \
+    "    }\n" \
+    "    fragColor = vec4(sum, 1.0);\n" \
+    "#elif defined(COMPOSITE)\n" \
+    "    fragColor = vec4(texture(source, uv).rgb + texture(bloom, uv).rgb, 1.0);\n" \
+    "#else\n" \
+    "    fragColor = vec4(vec3(dot(texture(source, uv).rgb, vec3(0.2126, 0.7152, 0.0722))), 1.0);\n" \
+    "#endif\n" \
+    "}\n"
+
+enum PostProgram {
+    POST_BRIGHT,
+    POST_BLUR,
+    POST_COMPOSITE,
+    POST_LUMA,
+    POST_PROGRAM_COUNT,
+};
+
+const char *post_fragment_shader_sources[POST_PROGRAM_COUNT] = {
+    "#version 330 core\n#define BRIGHT\n" POST_FRAGMENT_SHADER_BODY,
+    "#version 330 core\n#define BLUR\n" POST_FRAGMENT_SHADER_BODY,
+    "#version 330 core\n#define COMPOSITE\n" POST_FRAGMENT_SHADER_BODY,
+    "#version 330 core\n#define LUMA\n" POST_FRAGMENT_SHADER_BODY,
+};
+#endif
+
+// --------------------------------------------------
+// ----- CONSTANTS
+const float pi = 3.14159265358979f;
+const int window_width = 800;
+const int window_height = 600;
+
+// Dynamic resolution
+const float min_render_scale = 0.25f;
+const float render_budget_fraction = 0.5f; // Share of the refresh interval the scene may take
+const float scale_gain_interactive = 1.0f; // How much of the correction is applied per frame
+const float scale_gain_animating = 0.1f;
+const float scale_deadband = 0.02f;        // Ignore corrections smaller than this
+
+// --------------------------------------------------
+// ----- GLOBALS
+// Used for timing
+static int64_t perf_freq;
+static int64_t initial_perf_count;
+
+static HGLRC render_context;
+static GLuint vao;
+static VertexLayout quad_layout;
+static Mesh quad;
+static GLuint shader_program;  // 0 until the compiler hands it over
+static GLuint batch_program;
+static GLuint fallback_program;
+static BatchRenderer batch;
+static bool batch_ready; // batch_init succeeded; the batch path is skipped otherwise
+
+// Uniform block binding points, assigned to blocks by name at link time
+enum UniformBlockBinding {
+    BLOCK_BINDING_FRAME  = 0,
+    BLOCK_BINDING_OBJECT = 1,
+#ifdef BENCH_COMMANDS
+    BLOCK_BINDING_PALETTE = 2,
+#endif
+};
+
+#define MAX_PROGRAM_UNIFORMS 16
+#define MAX_PROGRAM_BLOCKS 4
+#define MAX_UNIFORM_NAME 32
+
+typedef struct {
+    char name[MAX_UNIFORM_NAME];
+    GLint location;
+    GLenum type;
+} UniformInfo;
+
+typedef struct {
+    char name[MAX_UNIFORM_NAME];
+    GLuint index;
+    GLint data_size;
+} UniformBlockInfo;
+
+// Reflection data gathered once after linking so nothing is looked up by name per frame
+typedef struct {
+    GLuint program;
+    int uniform_count;
+    UniformInfo uniforms[MAX_PROGRAM_UNIFORMS];
+    int block_count;
+    UniformBlockInfo blocks[MAX_PROGRAM_BLOCKS];
+} ProgramInfo;
+
+static ProgramInfo scene_program_info;
+static ProgramInfo batch_program_info;
+
+static ProgramCache program_cache;
+static ShaderCompiler shader_compiler;
+static HGLRC compile_context;
+static int scene_program_job = -1;
+static int batch_program_job = -1;
+
+// std140 layouts, must match the blocks in the shaders
+typedef struct {
+    float viewport_size[2];
+    float time;
+    float pad0;
+} FrameConstants;
+
+typedef struct {
+    float modifier;
+    float pad0[3];
+} ObjectConstants;
+
+#define MAX_OBJECTS 1
+
+#if defined(BENCH_STREAM) && !defined(BENCH_BATCH)
+#define BENCH_BATCH // The upload comparison runs on top of the batch benchmark
+#endif
+
+#ifdef BENCH_BATCH
+// Instance counts stepped through by the batch benchmark. Build with NO_VSYNC
+// as well, otherwise every step is capped at the refresh rate.
+const int bench_instance_counts[] = { 1000, 10000, 100000, 250000, 500000, 1000000 };
+const int bench_frames_per_step = 120;
+
+// Every count runs once per mode, on the same scene. Modes above gl_caps.tier are skipped.
+typedef struct {
+    const char *name;
+    bool naive_upload;
+    GLTier tier;
+} BenchMode;
+
+const BenchMode bench_modes[] = {
+#ifdef BENCH_STREAM
+    { "glBufferData", true, GL_TIER_33 },
+#endif
+    { "stream ring", false, GL_TIER_33 },
+    { "persistent + MDI", false, GL_TIER_45 },
+};
+#endif
+
+#ifdef BENCH_VERTEX
+// Vertices per side of the benchmark grid. Each size runs with the float layout, then the compact one.
+const int bench_mesh_sizes[] = { 256, 1024 };
+const int bench_mesh_draws = 8; // Per frame, so vertex fetch dominates the frame
+const int bench_mesh_frames_per_step = 120;
+
+static int mesh_program_jobs[2] = { -1, -1 };
+static GLuint mesh_programs[2]; // Float normals, octahedral normals
+static VertexLayout mesh_layouts[2];
+#endif
+
+#ifdef BENCH_ARENA
+// Mesh counts stepped through by the arena benchmark. Each count runs with a
+// VAO and buffer pair per mesh, then with every mesh in one arena.
+const int bench_arena_mesh_counts[] = { 1000, 5000 };
+const int bench_arena_frames_per_step = 120;
+const int bench_arena_churn = 32; // Meshes replaced by a new random shape every frame
+#define ARENA_BENCH_MAX_SIDES 64
+#define ARENA_BENCH_VERTEX_CAPACITY (256 * 1024)
+#define ARENA_BENCH_INDEX_CAPACITY (4 * 1024 * 1024)
+#endif
+
+#ifdef BENCH_TEXTURE
+// More generated 1024x1024 textures than fit the residency limit, shown a grid
+// at a time; the grid scrolls down a row every few frames
+const int bench_texture_count = 48;
+const int bench_texture_columns = 4;
+const int bench_texture_rows = 3;
+const int bench_texture_frames_per_row = 30;
+const int bench_texture_frames_per_report = 120;
+const size_t bench_texture_residency_limit = 96 * 1024 * 1024;
+const size_t bench_texture_upload_budget = 4 * 1024 * 1024; // Per frame
+
+static int texture_program_job = -1;
+static GLuint texture_program;
+static GLint texture_rect_location;
+#endif
+
+#ifdef BENCH_COMMANDS
+// A grid of small quads, each with its own uniforms and draw call, laid out
+// again every frame. Each mode runs for a while before the next one starts.
+const int bench_command_columns = 96;
+const int bench_command_rows = 64;
+const int bench_command_frames_per_mode = 120;
+const size_t bench_command_list_capacity = 1024 * 1024;
+#define COMMAND_BENCH_PALETTE_SIZE 16 // Matches CommandPalette
+
+static int command_program_job = -1;
+static GLuint command_program;
+static GLint command_rect_location;
+static GLint command_color_location;
+#endif
+
+// Per-frame and per-object constants live in one buffer written once per frame
+static GLuint constants_ubo;
+static GLintptr object_constants_offset;
+static GLintptr object_constants_stride;
+static GLsizeiptr constants_size;
+static uint8_t *constants_staging;
+
+// Persistent copy of the last rendered frame. When nothing that affects the
+// image has changed, WM_PAINT is satisfied by blitting this to the backbuffer.
+// Otherwise only its damaged parts are drawn again. It is the current entry of
+// frame_cache, which keeps the frames of the last few sizes.
+static GLuint frame_fbo;
+static GLuint frame_texture;
+
+// The pixel format swaps by copying, so the backbuffer still holds the last
+// presented frame and a present only has to blit what changed
+static bool present_preserved;
+static GLuint gpu_timer_query;
+static GLuint scene_timer_query;
+
+// Pass tags of the frame graph
+enum FramePass {
+    FRAME_PASS_SCENE,
+#ifdef BENCH_FRAMEGRAPH
+    FRAME_PASS_BRIGHT,
+    FRAME_PASS_BLUR_H,
+    FRAME_PASS_BLUR_V,
+    FRAME_PASS_COMPOSITE,
+    FRAME_PASS_LUMA,
+#endif
+};
+
+static FrameGraph frame_graph;
+
+#ifdef BENCH_FRAMEGRAPH
+static int post_program_jobs[POST_PROGRAM_COUNT] = { -1, -1, -1, -1 };
+static GLuint post_programs[POST_PROGRAM_COUNT];
+static GLint post_direction_locations[POST_PROGRAM_COUNT];
+
+// Resource handles of this frame's declaration
+typedef struct {
+    int scene;
+    int bright;
+    int blur_a;
+    int blur_b;
+} PostResources;
+
+static PostResources post_resources;
+#endif
+
+// --------------------------------------------------
+// ----- HELPERS
+int64_t get_perf_count() {
+    LARGE_INTEGER count;
+    QueryPerformanceCounter(&count);
+    return (int64_t)count.QuadPart;
+}
+
+void timer_init() {
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    perf_freq =  freq.QuadPart;
+    initial_perf_count = get_perf_count();
+}
+
+double time_duration_seconds(int64_t start_count, int64_t end_count) {
+    return (double)(end_count - start_count) / (double)perf_freq;
+}
+
+double get_time_now() {
+    int64_t count_now = get_perf_count();
+    return time_duration_seconds(initial_perf_count, count_now);
+}
+
+// Directory containing the executable, without a trailing separator
+void get_exe_directory(char *buf, DWORD buf_size) {
+    DWORD length = GetModuleFileNameA(NULL, buf, buf_size);
+    while (length > 0 && buf[length - 1] != '\\' && buf[length - 1] != '/') length--;
+    buf[length > 0 ? length - 1 : 0] = '\0';
+}
+
+bool is_key_repeating(LPARAM lParam) {
+    return (lParam & (1 << 30)) >> 30;
+}
+
+GLintptr align_up(GLintptr value, GLintptr alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void reflect_program(ProgramInfo *info, GLuint program) {
+    memset(info, 0, sizeof(*info));
+    info->program = program;
+
+    GLint uniform_count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniform_count);
+    for (GLint i = 0; i < uniform_count && info->uniform_count < MAX_PROGRAM_UNIFORMS; i++) {
+        UniformInfo *uniform = &info->uniforms[info->uniform_count];
+        GLint size;
+        glGetActiveUniform(program, (GLuint)i, MAX_UNIFORM_NAME, NULL, &size, &uniform->type, uniform->name);
+        uniform->location = glGetUniformLocation(program, uniform->name);
+        if (uniform->location != -1) info->uniform_count++; // Block members have no location
+    }
+
+    GLint block_count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &block_count);
+    for (GLint i = 0; i < block_count && info->block_count < MAX_PROGRAM_BLOCKS; i++) {
+        UniformBlockInfo *block = &info->blocks[info->block_count++];
+        block->index = (GLuint)i;
+        glGetActiveUniformBlockName(program, block->index, MAX_UNIFORM_NAME, NULL, block->name);
+        glGetActiveUniformBlockiv(program, block->index, GL_UNIFORM_BLOCK_DATA_SIZE, &block->data_size);
+    }
+}
+
+// Assigns a block to a binding point, checking its size against the CPU struct
+void bind_program_block(const ProgramInfo *info, const char *name, GLuint binding, GLint expected_size) {
+    for (int i = 0; i < info->block_count; i++) {
+        const UniformBlockInfo *block = &info->blocks[i];
+        if (strcmp(block->name, name) != 0) continue;
+
+        glUniformBlockBinding(info->program, block->index, binding);
+        if (block->data_size != expected_size) {
+            char err_buf[128];
+            sprintf_s(err_buf, sizeof(err_buf), "Uniform block %s is %d bytes, expected %d\n",
+                      name, block->data_size, expected_size);
+            OutputDebugStringA(err_buf);
+        }
+        return;
+    }
+}
+
+// --------------------------------------------------
+
+enum EventFlags {
+    EVENT_TERMINATE       = 1 << 0,
+    EVENT_SIZECHANGED     = 1 << 1,
+    EVENT_TOGGLEANIMATION = 1 << 2,
+    EVENT_ENTERSIZEMOVE   = 1 << 3,
+    EVENT_EXITSIZEMOVE    = 1 << 4,
+    EVENT_PAINT           = 1 << 5,
+};
+
+typedef struct {
+    HWND hwnd;
+    CRITICAL_SECTION crit_sect;
+    CONDITION_VARIABLE cond_var;
+    int width;
+    int height;
+    int new_width;
+    int new_height;
+    uint32_t flags;
+    bool render_stopped; // WM_PAINT no longer waits for a frame
+
+    // How long WM_PAINT waited for a frame at a new size, written by
+    // WindowProc under crit_sect, so every renderer's resize can be compared
+    uint64_t resize_count;
+    double resize_seconds;
+    double resize_max_seconds;
+} WindowData;
+
+// Everything that determines the contents of a frame. If this matches the
+// cached frame, the frame does not need to be rendered again.
+typedef struct {
+    int width;
+    int height;
+    float time;
+    float modifier;
+    float scale;
+    int programs_ready;
+} FrameKey;
+
+// Frames of the last few sizes, so a drag back to one of them with nothing
+// else changed presents the frame kept for it instead of drawing it again
+#define FRAME_CACHE_SIZE 4
+
+typedef struct {
+    GLuint texture;
+    FrameKey key;
+    bool valid;        // The texture holds the frame for key
+    uint64_t last_used;
+} CachedFrame;
+
+static CachedFrame frame_cache[FRAME_CACHE_SIZE];
+static int frame_cache_current = -1; // The entry attached to frame_fbo
+static uint64_t frame_cache_uses;
+
+// Picks the scale the scene is rendered at so its GPU time stays within
+// budget. The scaled image is upscaled to the window when presented.
+typedef struct {
+    float scale;
+    float budget_ms;
+    float last_gpu_ms;
+    uint64_t decreases;
+    uint64_t increases;
+    uint64_t holds;
+    uint64_t resets;
+} ResolutionController;
+
+typedef struct {
+    uint64_t frames_rendered;
+    uint64_t frames_reused;
+    uint64_t gpu_ns_rendered;
+    uint64_t gpu_ns_reused;
+    uint64_t gl_calls_issued;
+    uint64_t gl_calls_elided;
+
+    // Pixels drawn against what redrawing everything would have drawn
+    uint64_t pixels_shaded;
+    uint64_t pixels_shaded_full;
+    uint64_t pixels_presented;
+    uint64_t pixels_presented_full;
+} FrameStats;
+
+bool frame_key_equal(const FrameKey *a, const FrameKey *b) {
+    return a->width == b->width && a->height == b->height &&
+           a->time == b->time && a->modifier == b->modifier && a->scale == b->scale &&
+           a->programs_ready == b->programs_ready;
+}
+
+int scaled_extent(int extent, float scale) {
+    int scaled = (int)ceilf((float)extent * scale);
+    return scaled < 1 ? 1 : scaled;
+}
+
+void resolution_controller_init(ResolutionController *controller, HDC hdc) {
+    memset(controller, 0, sizeof(*controller));
+    controller->scale = 1.0f;
+
+    int refresh_rate = GetDeviceCaps(hdc, VREFRESH);
+    if (refresh_rate <= 1) refresh_rate = 60; // 0 and 1 mean "hardware default"
+    controller->budget_ms = render_budget_fraction * 1000.0f / (float)refresh_rate;
+}
+
+// Idle windows always go back to native resolution
+void resolution_controller_reset(ResolutionController *controller) {
+    if (controller->scale != 1.0f) {
+        controller->scale = 1.0f;
+        controller->resets++;
+    }
+}
+
+void resolution_controller_update(ResolutionController *controller, float gpu_ms, bool interactive) {
+    controller->last_gpu_ms = gpu_ms;
+    if (gpu_ms <= 0.0f) return;
+
+    // Fill cost scales with area, so the scale that meets the budget is
+    // proportional to the square root of the time ratio.
+    float target = controller->scale * sqrtf(controller->budget_ms / gpu_ms);
+    if (target > 1.0f) target = 1.0f;
+    if (target < min_render_scale) target = min_render_scale;
+
+    float delta = target - controller->scale;
+    if (fabsf(delta) < scale_deadband) {
+        controller->holds++;
+        return;
+    }
+
+    // React to overruns immediately while resizing; otherwise move smoothly.
+    // Growing back is always gradual so a single fast frame can't cause a spike.
+    float gain = interactive ? scale_gain_interactive : scale_gain_animating;
+    if (delta > 0.0f) {
+        gain = scale_gain_animating;
+        controller->increases++;
+    } else {
+        controller->decreases++;
+    }
+
+    controller->scale += delta * gain;
+    if (target == 1.0f && 1.0f - controller->scale < scale_deadband) controller->scale = 1.0f;
+}
+
+void attach_cached_frame(int index) {
+    frame_cache_current = index;
+    frame_cache[index].last_used = ++frame_cache_uses;
+    frame_texture = frame_cache[index].texture;
+    gl_state_bind_framebuffer(GL_FRAMEBUFFER, frame_fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, frame_texture, 0);
+}
+
+// Makes the frame kept for this key the current one. Returns false if there
+// is none.
+bool use_cached_frame(const FrameKey *key) {
+    for (int i = 0; i < FRAME_CACHE_SIZE; i++) {
+        if (frame_cache[i].valid && frame_key_equal(&frame_cache[i].key, key)) {
+            if (i != frame_cache_current) attach_cached_frame(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Records that the current frame now holds the frame for this key
+void keep_cached_frame(const FrameKey *key) {
+    frame_cache[frame_cache_current].key = *key;
+    frame_cache[frame_cache_current].valid = true;
+}
+
+// Makes a frame of the new size current: the entry kept for that size, or
+// else the least recently used one. The current one is kept for its size, and
+// there is never more than one entry per size, so the backbuffer only ever
+// holds the current entry's frame at its size. With `preserve`, the part of
+// the old frame that still fits is copied into the new one, anchored at the
+// bottom left like GL window coordinates, so only the damage of the resize
+// has to be drawn again.
+void resize_frame_cache(int width, int height, bool preserve) {
+    static GLuint copy_fbo;
+
+    if (!frame_fbo) {
+        glGenFramebuffers(1, &frame_fbo);
+        glGenFramebuffers(1, &copy_fbo);
+    }
+
+    int index = -1;
+    for (int i = 0; i < FRAME_CACHE_SIZE; i++) {
+        if (i == frame_cache_current) continue;
+        const CachedFrame *frame = &frame_cache[i];
+        if (frame->valid && frame->key.width == width && frame->key.height == height) {
+            index = i;
+            break;
+        }
+        if (index < 0 || frame->last_used < frame_cache[index].last_used) index = i;
+    }
+    CachedFrame *frame = &frame_cache[index];
+    if (!frame->texture) glGenTextures(1, &frame->texture);
+    frame->valid = false;
+
+    gl_state_bind_texture(0, GL_TEXTURE_2D, frame->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    int old_index = frame_cache_current;
+    attach_cached_frame(index);
+
+    if (old_index >= 0 && preserve) {
+        const FrameKey *old_key = &frame_cache[old_index].key;
+        int copy_width = width < old_key->width ? width : old_key->width;
+        int copy_height = height < old_key->height ? height : old_key->height;
+        gl_state_bind_framebuffer(GL_READ_FRAMEBUFFER, copy_fbo);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                               frame_cache[old_index].texture, 0);
+        glBlitFramebuffer(0, 0, copy_width, copy_height, 0, 0, copy_width, copy_height,
+                          GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    }
+}
+
+void destroy_frame_cache() {
+    for (int i = 0; i < FRAME_CACHE_SIZE; i++) glDeleteTextures(1, &frame_cache[i].texture);
+    glDeleteFramebuffers(1, &frame_fbo);
+}
+
+// Adds the pixels the quad covers in a width x height scene. Its corners sit
+// at +-0.5 * modifier in NDC; the bounds are rounded outward with a pixel to
+// spare, so rasterization at the edges never reaches outside them.
+void add_quad_damage(DamageRegion *damage, int width, int height, float modifier) {
+    float half_extent = 0.25f * modifier;
+    int x0 = (int)floorf((0.5f - half_extent) * (float)width) - 1;
+    int y0 = (int)floorf((0.5f - half_extent) * (float)height) - 1;
+    int x1 = (int)ceilf((0.5f + half_extent) * (float)width) + 1;
+    int y1 = (int)ceilf((0.5f + half_extent) * (float)height) + 1;
+    damage_add(damage, x0, y0, x1 - x0, y1 - y0);
+}
+
+// Works out what has to be drawn again to turn the cached frame into this one.
+// The background is one colour that only changes with time, and the quad only
+// moves with the modifier and the extent. Everything else, and every
+// benchmark that draws more than the quad, redraws the whole scene.
+void compute_scene_damage(DamageRegion *damage, const FrameKey *key, const FrameKey *cached_key,
+                          bool cache_valid) {
+    int width = scaled_extent(key->width, key->scale);
+    int height = scaled_extent(key->height, key->scale);
+    damage_reset(damage, width, height);
+
+#if defined(BENCH_BATCH) || defined(BENCH_VERTEX) || defined(BENCH_ARENA) || \
+    defined(BENCH_TEXTURE) || defined(BENCH_COMMANDS) || defined(BENCH_FRAMEGRAPH)
+    // These draw over the whole scene, or (the frame graph) draw it into a
+    // transient that starts cleared every frame
+    bool background_changed = true;
+#elif defined(BENCH_DAMAGE)
+    bool background_changed = false;
+#else
+    bool background_changed = key->time != cached_key->time;
+#endif
+
+    if (!cache_valid || background_changed || key->scale != cached_key->scale ||
+        key->programs_ready != cached_key->programs_ready) {
+        damage_add_full(damage);
+        return;
+    }
+
+    // The copy kept by resize_frame_cache covers the old extent; the rest is new
+    int old_width = scaled_extent(cached_key->width, cached_key->scale);
+    int old_height = scaled_extent(cached_key->height, cached_key->scale);
+    if (width > old_width) damage_add(damage, old_width, 0, width - old_width, height);
+    if (height > old_height) damage_add(damage, 0, old_height, width, height - old_height);
+
+    if (width != old_width || height != old_height || key->modifier != cached_key->modifier) {
+        add_quad_damage(damage, old_width, old_height, cached_key->modifier);
+        add_quad_damage(damage, width, height, key->modifier);
+    }
+}
+
+#ifdef BENCH_FRAMEGRAPH
+// Picks up the post programs; true once all of them have arrived
+bool post_programs_ready() {
+    bool ready = true;
+    for (int i = 0; i < POST_PROGRAM_COUNT; i++) {
+        if (post_programs[i]) continue;
+
+        post_programs[i] = shader_compiler_poll(&shader_compiler, post_program_jobs[i]);
+        if (!post_programs[i]) {
+            ready = false;
+            continue;
+        }
+        gl_state_use_program(post_programs[i]);
+        glUniform1i(glGetUniformLocation(post_programs[i], "source"), 0);
+        glUniform1i(glGetUniformLocation(post_programs[i], "bloom"), 1);
+        post_direction_locations[i] = glGetUniformLocation(post_programs[i], "direction");
+    }
+    return ready;
+}
+
+// Runs one pass of the post chain into the target the frame graph bound
+void draw_post_pass(const FrameGraph *graph, int tag, int width, int height) {
+    int program = POST_LUMA;
+    int source = post_resources.scene;
+    int bloom = -1;
+    float direction[2] = { 0.0f, 0.0f };
+
+    switch (tag) {
+    case FRAME_PASS_BRIGHT:
+        program = POST_BRIGHT;
+        break;
+    case FRAME_PASS_BLUR_H:
+        program = POST_BLUR;
+        source = post_resources.bright;
+        direction[0] = 2.0f / (float)width; // A texel of the half resolution target
+        break;
+    case FRAME_PASS_BLUR_V:
+        program = POST_BLUR;
+        source = post_resources.blur_a;
+        direction[1] = 2.0f / (float)height;
+        break;
+    case FRAME_PASS_COMPOSITE:
+        program = POST_COMPOSITE;
+        bloom = post_resources.blur_b;
+        break;
+    }
+
+    gl_state_bind_vertex_array(vao);
+    gl_state_use_program(post_programs[program]);
+    gl_state_bind_texture(0, GL_TEXTURE_2D, frame_graph_texture(graph, source));
+    if (bloom >= 0) gl_state_bind_texture(1, GL_TEXTURE_2D, frame_graph_texture(graph, bloom));
+    glUniform2f(post_direction_locations[program], direction[0], direction[1]);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+#endif
+
+// Declares this frame's passes. The graph only recompiles when the declaration
+// or the extent changes, so this is cheap to repeat every frame.
+void declare_frame_graph(FrameGraph *graph, int width, int height) {
+    frame_graph_begin(graph, width, height);
+    int frame = frame_graph_import(graph, "frame", frame_texture, frame_fbo, width, height);
+
+#ifdef BENCH_FRAMEGRAPH
+    if (post_programs_ready()) {
+        PostResources *post = &post_resources;
+        post->scene = frame_graph_create_texture(graph, "scene", FRAME_GRAPH_RGBA8, 1.0f);
+        post->bright = frame_graph_create_texture(graph, "bright", FRAME_GRAPH_RGBA16F, 0.5f);
+        post->blur_a = frame_graph_create_texture(graph, "blur_a", FRAME_GRAPH_RGBA16F, 0.5f);
+        post->blur_b = frame_graph_create_texture(graph, "blur_b", FRAME_GRAPH_RGBA16F, 0.5f);
+        int luma = frame_graph_create_texture(graph, "luma", FRAME_GRAPH_RGBA8, 1.0f);
+
+        // Declared out of order on purpose: the graph sorts the chain, gives
+        // blur_b the texture bright is done with, and culls luma, which
+        // nothing reads
+        int pass = frame_graph_add_pass(graph, "composite", FRAME_PASS_COMPOSITE);
+        frame_graph_read(graph, pass, post->scene);
+        frame_graph_read(graph, pass, post->blur_b);
+        frame_graph_write(graph, pass, frame);
+
+        pass = frame_graph_add_pass(graph, "blur_v", FRAME_PASS_BLUR_V);
+        frame_graph_read(graph, pass, post->blur_a);
+        frame_graph_write(graph, pass, post->blur_b);
+
+        pass = frame_graph_add_pass(graph, "luma", FRAME_PASS_LUMA);
+        frame_graph_read(graph, pass, post->scene);
+        frame_graph_write(graph, pass, luma);
+
+        pass = frame_graph_add_pass(graph, "scene", FRAME_PASS_SCENE);
+        frame_graph_write(graph, pass, post->scene);
+
+        pass = frame_graph_add_pass(graph, "blur_h", FRAME_PASS_BLUR_H);
+        frame_graph_read(graph, pass, post->bright);
+        frame_graph_write(graph, pass, post->blur_a);
+
+        pass = frame_graph_add_pass(graph, "bright", FRAME_PASS_BRIGHT);
+        frame_graph_read(graph, pass, post->scene);
+        frame_graph_write(graph, pass, post->bright);
+        return;
+    }
+#endif
+
+    int pass = frame_graph_add_pass(graph, "scene", FRAME_PASS_SCENE);
+    frame_graph_write(graph, pass, frame);
+}
+
+#ifdef BENCH_BATCH
+typedef struct {
+    int step;
+    int frames;
+    int64_t cpu_counts;
+    int64_t upload_counts; // CPU time spent in batch_flush
+    uint64_t bytes_uploaded;
+    uint64_t gpu_ns;
+    uint64_t draw_calls;
+} BatchBenchmark;
+
+int bench_mode_count() {
+    int count = 0;
+    for (int i = 0; i < (int)(sizeof(bench_modes) / sizeof(bench_modes[0])); i++) {
+        if (bench_modes[i].tier <= gl_caps.tier) count++;
+    }
+    return count;
+}
+
+int bench_step_count() {
+    return (int)(sizeof(bench_instance_counts) / sizeof(bench_instance_counts[0])) * bench_mode_count();
+}
+
+int bench_instance_count(int step) {
+    return bench_instance_counts[step / bench_mode_count()];
+}
+
+// The table is ordered by tier, so the supported modes come first
+const BenchMode *bench_mode(int step) {
+    return &bench_modes[step % bench_mode_count()];
+}
+
+// A grid of small spinning rectangles covering the window
+void fill_bench_batch(BatchRenderer *batch, int instance_count, int width, int height, float time) {
+    int columns = (int)ceilf(sqrtf((float)instance_count * (float)width / (float)(height > 0 ? height : 1)));
+    if (columns < 1) columns = 1;
+    int rows = (instance_count + columns - 1) / columns;
+    float cell_w = (float)width / (float)columns;
+    float cell_h = (float)height / (float)(rows > 0 ? rows : 1);
+
+    for (int i = 0; i < instance_count; i++) {
+        int column = i % columns;
+        int row = i / columns;
+        float phase = time + (float)i * 0.001f;
+        uint32_t color = pack_rgba8((float)column / (float)columns, (float)row / (float)rows,
+                                    0.5f + 0.5f * sinf(phase), 1.0f);
+        batch_push_rect(batch, ((float)column + 0.5f) * cell_w, ((float)row + 0.5f) * cell_h,
+                        cell_w * 0.8f, cell_h * 0.8f, phase, color);
+    }
+}
+
+void record_batch_benchmark(BatchBenchmark *bench, const BatchRenderer *batch,
+                            int64_t cpu_counts, int64_t upload_counts, uint64_t gpu_ns) {
+    if (bench->step >= bench_step_count()) return;
+
+    bench->frames++;
+    bench->cpu_counts += cpu_counts;
+    bench->upload_counts += upload_counts;
+    bench->bytes_uploaded += batch->bytes_uploaded;
+    bench->gpu_ns += gpu_ns;
+    bench->draw_calls = batch->draw_calls;
+    if (bench->frames < bench_frames_per_step) return;
+
+    double upload_seconds = time_duration_seconds(0, bench->upload_counts);
+    char buf[384];
+    sprintf_s(buf, sizeof(buf),
+              "Batch bench: %7d instances, %llu draws, GL %s %s | CPU %.2f ms/frame (flush %.2f ms, %.0f MB/s) | "
+              "GPU %.2f ms/frame | orphans %llu stalls %llu\n",
+              bench_instance_count(bench->step), (unsigned long long)bench->draw_calls,
+              gl_tier_name(batch->tier), bench_mode(bench->step)->name,
+              1000.0 * time_duration_seconds(0, bench->cpu_counts) / bench->frames,
+              1000.0 * upload_seconds / bench->frames,
+              upload_seconds > 0.0 ? (double)bench->bytes_uploaded / (1024.0 * 1024.0) / upload_seconds : 0.0,
+              (double)bench->gpu_ns / 1e6 / bench->frames,
+              (unsigned long long)batch->instance_stream.orphans,
+              (unsigned long long)batch->instance_stream.stalls);
+    OutputDebugStringA(buf);
+
+    int next_step = bench->step + 1;
+    memset(bench, 0, sizeof(*bench));
+    bench->step = next_step;
+}
+#endif
+
+#ifdef BENCH_VERTEX
+typedef struct {
+    int step;
+    int frames;
+    uint64_t gpu_ns;
+    bool mesh_ready;
+    Mesh mesh;
+    GLuint vao;
+} VertexBenchmark;
+
+int vertex_bench_step_count() {
+    return (int)(sizeof(bench_mesh_sizes) / sizeof(bench_mesh_sizes[0])) * 2;
+}
+
+// A wavy heightfield over [-1, 1], with analytic normals
+bool build_bench_mesh(VertexBenchmark *bench) {
+    int side = bench_mesh_sizes[bench->step / 2];
+    int compact = bench->step % 2;
+    size_t vertex_count = (size_t)side * (size_t)side;
+    size_t index_count = (size_t)(side - 1) * (size_t)(side - 1) * 6;
+
+    float *positions = (float*)malloc(vertex_count * 3 * sizeof(float));
+    float *normals = (float*)malloc(vertex_count * 3 * sizeof(float));
+    float *colors = (float*)malloc(vertex_count * 4 * sizeof(float));
+    uint32_t *mesh_indices = (uint32_t*)malloc(index_count * sizeof(uint32_t));
+    bool built = false;
+
+    if (positions && normals && colors && mesh_indices) {
+        const float frequency = 4.0f * pi;
+        for (int row = 0; row < side; row++) {
+            for (int column = 0; column < side; column++) {
+                size_t i = (size_t)row * (size_t)side + (size_t)column;
+                float x = 2.0f * (float)column / (float)(side - 1) - 1.0f;
+                float y = 2.0f * (float)row / (float)(side - 1) - 1.0f;
+                float dzdx = 0.2f * frequency * cosf(frequency * x) * cosf(frequency * y);
+                float dzdy = -0.2f * frequency * sinf(frequency * x) * sinf(frequency * y);
+                float length = sqrtf(dzdx * dzdx + dzdy * dzdy + 1.0f);
+
+                positions[i * 3 + 0] = x;
+                positions[i * 3 + 1] = y;
+                positions[i * 3 + 2] = 0.2f * sinf(frequency * x) * cosf(frequency * y);
+                normals[i * 3 + 0] = -dzdx / length;
+                normals[i * 3 + 1] = -dzdy / length;
+                normals[i * 3 + 2] = 1.0f / length;
+                colors[i * 4 + 0] = 0.5f + 0.5f * x;
+                colors[i * 4 + 1] = 0.5f + 0.5f * y;
+                colors[i * 4 + 2] = 0.7f;
+                colors[i * 4 + 3] = 1.0f;
+            }
+        }
+
+        uint32_t *index = mesh_indices;
+        for (int row = 0; row + 1 < side; row++) {
+            for (int column = 0; column + 1 < side; column++) {
+                uint32_t corner = (uint32_t)(row * side + column);
+                uint32_t above = corner + (uint32_t)side;
+                *index++ = corner; *index++ = corner + 1; *index++ = above + 1;
+                *index++ = corner; *index++ = above + 1;  *index++ = above;
+            }
+        }
+
+        VertexSource sources[] = {
+            { positions, 3 },
+            { normals, 3 },
+            { colors, 4 },
+        };
+        // The float layout keeps 32-bit indices, as every mesh used them before
+        built = mesh_create(&bench->mesh, &mesh_layouts[compact], sources, vertex_count,
+                            mesh_indices, index_count, !compact);
+    }
+
+    free(positions);
+    free(normals);
+    free(colors);
+    free(mesh_indices);
+    if (!built) return false;
+
+    glGenVertexArrays(1, &bench->vao);
+    mesh_setup_vao(&bench->mesh, bench->vao);
+    gl_state_invalidate();
+    bench->mesh_ready = true;
+    return true;
+}
+
+void release_bench_mesh(VertexBenchmark *bench) {
+    if (!bench->mesh_ready) return;
+    gl_state_bind_vertex_array(0);
+    glDeleteVertexArrays(1, &bench->vao);
+    mesh_destroy(&bench->mesh);
+    bench->mesh_ready = false;
+}
+
+// Draws the current step's mesh into the bound framebuffer, building it first if needed
+void draw_vertex_benchmark(VertexBenchmark *bench) {
+    if (bench->step >= vertex_bench_step_count()) return;
+
+    int compact = bench->step % 2;
+    if (!mesh_programs[compact]) {
+        mesh_programs[compact] = shader_compiler_poll(&shader_compiler, mesh_program_jobs[compact]);
+        if (!mesh_programs[compact]) return;
+    }
+    if (!bench->mesh_ready && !build_bench_mesh(bench)) {
+        bench->step = vertex_bench_step_count(); // Out of memory, give up
+        return;
+    }
+
+    gl_state_bind_vertex_array(bench->vao);
+    gl_state_use_program(mesh_programs[compact]);
+    for (int i = 0; i < bench_mesh_draws; i++) {
+        glDrawElements(GL_TRIANGLES, bench->mesh.index_count, bench->mesh.index_type, 0);
+    }
+}
+
+void record_vertex_benchmark(VertexBenchmark *bench, uint64_t gpu_ns) {
+    if (!bench->mesh_ready) return;
+
+    bench->frames++;
+    bench->gpu_ns += gpu_ns;
+    if (bench->frames < bench_mesh_frames_per_step) return;
+
+    const Mesh *mesh = &bench->mesh;
+    double gpu_ms = (double)bench->gpu_ns / 1e6 / bench->frames;
+    char buf[320];
+    sprintf_s(buf, sizeof(buf),
+              "Vertex bench: %7llu vertices, %s layout (%d B/vertex, %d-bit indices) | "
+              "vertex buffer %.1f MB, index buffer %.1f MB | GPU %.2f ms/frame (%.3f ms/draw)\n",
+              (unsigned long long)mesh->vertex_count, bench->step % 2 ? "compact" : "float",
+              mesh->layout->stride, mesh->index_type == GL_UNSIGNED_SHORT ? 16 : 32,
+              (double)mesh->vertex_bytes / (1024.0 * 1024.0), (double)mesh->index_bytes / (1024.0 * 1024.0),
+              gpu_ms, gpu_ms / bench_mesh_draws);
+    OutputDebugStringA(buf);
+
+    release_bench_mesh(bench);
+    bench->step++;
+    bench->frames = 0;
+    bench->gpu_ns = 0;
+}
+#endif
+
+#ifdef BENCH_ARENA
+typedef struct {
+    Mesh mesh;       // Separate mode
+    GLuint vao;
+    ArenaMesh range; // Arena mode
+} BenchShape;
+
+typedef struct {
+    int step;
+    int frames;
+    bool ready;
+    bool use_arena;
+    MeshArena arena;
+    BenchShape *shapes;
+    int shape_count;
+    uint32_t rng;
+
+    int64_t submit_counts;
+    uint64_t gpu_ns;
+    uint64_t state_calls; // gl_state calls that reached the driver during the mesh pass
+    uint64_t draws;
+    float max_fragmentation;
+} ArenaBenchmark;
+
+int arena_bench_step_count() {
+    return (int)(sizeof(bench_arena_mesh_counts) / sizeof(bench_arena_mesh_counts[0])) * 2;
+}
+
+float arena_bench_random(ArenaBenchmark *bench) {
+    bench->rng ^= bench->rng << 13;
+    bench->rng ^= bench->rng >> 17;
+    bench->rng ^= bench->rng << 5;
+    return (float)(bench->rng >> 8) / (float)(1 << 24);
+}
+
+// A small random polygon, drawn as a fan around its centre
+bool create_bench_shape(ArenaBenchmark *bench, BenchShape *shape) {
+    int sides = 3 + (int)(arena_bench_random(bench) * (ARENA_BENCH_MAX_SIDES - 3));
+    float cx = 1.8f * arena_bench_random(bench) - 0.9f;
+    float cy = 1.8f * arena_bench_random(bench) - 0.9f;
+    float radius = 0.01f + 0.04f * arena_bench_random(bench);
+
+    float shape_vertices[(ARENA_BENCH_MAX_SIDES + 1) * 6];
+    uint32_t shape_indices[ARENA_BENCH_MAX_SIDES * 3];
+    float *vertex = shape_vertices;
+    *vertex++ = cx; *vertex++ = cy; *vertex++ = 0.0f;
+    *vertex++ = 1.0f; *vertex++ = 1.0f; *vertex++ = 1.0f;
+    for (int i = 0; i < sides; i++) {
+        float angle = 2.0f * pi * (float)i / (float)sides;
+        *vertex++ = cx + radius * cosf(angle);
+        *vertex++ = cy + radius * sinf(angle);
+        *vertex++ = 0.0f;
+        *vertex++ = 0.5f + 0.5f * cosf(angle);
+        *vertex++ = 0.5f + 0.5f * sinf(angle);
+        *vertex++ = arena_bench_random(bench);
+        shape_indices[i * 3 + 0] = 0;
+        shape_indices[i * 3 + 1] = (uint32_t)(1 + i);
+        shape_indices[i * 3 + 2] = (uint32_t)(1 + (i + 1) % sides);
+    }
+
+    VertexSource sources[] = {
+        { shape_vertices, 6 },
+        { shape_vertices + 3, 6 },
+    };
+    size_t vertex_count = (size_t)sides + 1;
+    size_t index_count = (size_t)sides * 3;
+
+    memset(shape, 0, sizeof(*shape));
+    if (bench->use_arena) {
+        return mesh_arena_upload(&bench->arena, sources, vertex_count, shape_indices, index_count, &shape->range);
+    }
+    if (!mesh_create(&shape->mesh, &quad_layout, sources, vertex_count, shape_indices, index_count, false)) {
+        return false;
+    }
+    glGenVertexArrays(1, &shape->vao);
+    mesh_setup_vao(&shape->mesh, shape->vao);
+    return true;
+}
+
+void release_bench_shape(ArenaBenchmark *bench, BenchShape *shape) {
+    if (bench->use_arena) {
+        mesh_arena_free(&bench->arena, &shape->range);
+    } else if (shape->vao) {
+        glDeleteVertexArrays(1, &shape->vao);
+        mesh_destroy(&shape->mesh);
+        shape->vao = 0;
+    }
+}
+
+void release_arena_benchmark(ArenaBenchmark *bench) {
+    if (!bench->ready) return;
+    gl_state_bind_vertex_array(0);
+    for (int i = 0; i < bench->shape_count; i++) release_bench_shape(bench, &bench->shapes[i]);
+    if (bench->use_arena) mesh_arena_destroy(&bench->arena);
+    free(bench->shapes);
+    bench->shapes = NULL;
+    bench->ready = false;
+}
+
+bool prepare_arena_benchmark(ArenaBenchmark *bench) {
+    bench->use_arena = bench->step % 2 == 1;
+    bench->shape_count = bench_arena_mesh_counts[bench->step / 2];
+    bench->rng = 0x9E3779B9u; // Same shapes in both modes
+    bench->shapes = (BenchShape*)calloc((size_t)bench->shape_count, sizeof(BenchShape));
+    if (!bench->shapes) return false;
+    if (bench->use_arena &&
+        !mesh_arena_init(&bench->arena, &quad_layout, ARENA_BENCH_VERTEX_CAPACITY, ARENA_BENCH_INDEX_CAPACITY)) {
+        free(bench->shapes);
+        bench->shapes = NULL;
+        return false;
+    }
+
+    bench->ready = true;
+    for (int i = 0; i < bench->shape_count; i++) create_bench_shape(bench, &bench->shapes[i]);
+    gl_state_invalidate();
+    return true;
+}
+
+// Replaces a few shapes, then draws them all with the scene program
+void draw_arena_benchmark(ArenaBenchmark *bench) {
+    if (bench->step >= arena_bench_step_count() || !shader_program) return;
+    if (!bench->ready && !prepare_arena_benchmark(bench)) {
+        bench->step = arena_bench_step_count(); // Out of memory, give up
+        return;
+    }
+
+    for (int i = 0; i < bench_arena_churn; i++) {
+        BenchShape *shape = &bench->shapes[(int)(arena_bench_random(bench) * (float)bench->shape_count)];
+        release_bench_shape(bench, shape);
+        create_bench_shape(bench, shape);
+    }
+    if (!bench->use_arena) gl_state_invalidate(); // mesh_create binds directly
+
+    uint64_t issued_before = gl_state_counters.issued;
+    int64_t submit_start = get_perf_count();
+    gl_state_use_program(shader_program);
+
+    if (bench->use_arena) {
+        mesh_arena_reset_stats(&bench->arena);
+        mesh_arena_bind(&bench->arena);
+        for (int i = 0; i < bench->shape_count; i++) {
+            if (bench->shapes[i].range.vertex_count) mesh_arena_draw(&bench->arena, &bench->shapes[i].range);
+        }
+        bench->draws += bench->arena.draws;
+
+        float fragmentation = range_allocator_fragmentation(&bench->arena.vertices);
+        if (fragmentation > bench->max_fragmentation) bench->max_fragmentation = fragmentation;
+    } else {
+        for (int i = 0; i < bench->shape_count; i++) {
+            const BenchShape *shape = &bench->shapes[i];
+            if (!shape->vao) continue;
+            gl_state_bind_vertex_array(shape->vao);
+            glDrawElements(GL_TRIANGLES, shape->mesh.index_count, shape->mesh.index_type, 0);
+            bench->draws++;
+        }
+    }
+
+    bench->submit_counts += get_perf_count() - submit_start;
+    bench->state_calls += gl_state_counters.issued - issued_before;
+}
+
+void record_arena_benchmark(ArenaBenchmark *bench, uint64_t gpu_ns) {
+    if (!bench->ready) return;
+
+    bench->frames++;
+    bench->gpu_ns += gpu_ns;
+    if (bench->frames < bench_arena_frames_per_step) return;
+
+    char buf[384];
+    int length = sprintf_s(buf, sizeof(buf),
+                           "Arena bench: %5d meshes, %s | submit %.3f ms/frame | GPU %.2f ms/frame | "
+                           "%.0f draws, %.1f binds/frame",
+                           bench->shape_count, bench->use_arena ? "one arena" : "VAO per mesh",
+                           1000.0 * time_duration_seconds(0, bench->submit_counts) / bench->frames,
+                           (double)bench->gpu_ns / 1e6 / bench->frames,
+                           (double)bench->draws / bench->frames, (double)bench->state_calls / bench->frames);
+    if (bench->use_arena) {
+        const MeshArena *arena = &bench->arena;
+        sprintf_s(buf + length, sizeof(buf) - length,
+                  " | vertices %u/%u in %d free ranges, fragmentation %.2f (max %.2f), indices %.2f | %llu failed uploads\n",
+                  arena->vertices.used, arena->vertices.capacity, arena->vertices.free_count,
+                  range_allocator_fragmentation(&arena->vertices), bench->max_fragmentation,
+                  range_allocator_fragmentation(&arena->indices), (unsigned long long)arena->failed_uploads);
+    } else {
+        sprintf_s(buf + length, sizeof(buf) - length, "\n");
+    }
+    OutputDebugStringA(buf);
+
+    release_arena_benchmark(bench);
+    int next_step = bench->step + 1;
+    memset(bench, 0, sizeof(*bench));
+    bench->step = next_step;
+}
+#endif
+
+#ifdef BENCH_TEXTURE
+typedef struct {
+    bool started;
+    TextureStream stream;
+    int handles[TEXTURE_STREAM_MAX_TEXTURES];
+    int frame;
+
+    // Since the last report
+    int frames;
+    int64_t update_counts;
+    int64_t max_update_counts;
+    int cells_drawn;
+    int cells_sharp; // Drawn with every level the cell needs resident
+    uint64_t bytes_uploaded;
+    uint64_t evictions;
+    uint64_t budget_deferrals;
+} TextureBenchmark;
+
+bool start_texture_benchmark(TextureBenchmark *bench) {
+    bool persistent = gl_caps.buffer_storage && gl_caps.direct_state_access;
+    if (!texture_stream_start(&bench->stream, bench_texture_residency_limit, bench_texture_upload_budget, persistent)) {
+        return false;
+    }
+    gl_state_invalidate();
+
+    for (int i = 0; i < bench_texture_count; i++) bench->handles[i] = texture_stream_create(&bench->stream, NULL, (uint32_t)i);
+    bench->started = true;
+    return true;
+}
+
+void stop_texture_benchmark(TextureBenchmark *bench) {
+    if (!bench->started) return;
+    texture_stream_stop(&bench->stream);
+    bench->started = false;
+}
+
+// The finest level whose texels are still no smaller than the cell's pixels
+int texture_bench_wanted_level(const StreamedTexture *tex, int cell_width, int cell_height) {
+    int level = 0;
+    while (level + 1 < tex->levels && (tex->width >> (level + 1)) >= cell_width &&
+           (tex->height >> (level + 1)) >= cell_height) {
+        level++;
+    }
+    return level;
+}
+
+// Draws the visible page of textures, then lets the stream upload and evict for the next frame
+void draw_texture_benchmark(TextureBenchmark *bench, int width, int height) {
+    if (!texture_program) {
+        texture_program = shader_compiler_poll(&shader_compiler, texture_program_job);
+        if (!texture_program) return;
+        texture_rect_location = glGetUniformLocation(texture_program, "rect");
+    }
+    if (!bench->started && !start_texture_benchmark(bench)) return;
+
+    int cell_width = width / bench_texture_columns;
+    int cell_height = height / bench_texture_rows;
+    int first = (bench->frame / bench_texture_frames_per_row) * bench_texture_columns;
+
+    gl_state_bind_vertex_array(vao);
+    gl_state_use_program(texture_program);
+    for (int row = 0; row < bench_texture_rows; row++) {
+        for (int column = 0; column < bench_texture_columns; column++) {
+            int handle = bench->handles[(first + row * bench_texture_columns + column) % bench_texture_count];
+            const StreamedTexture *tex = &bench->stream.textures[handle];
+            int wanted = tex->width ? texture_bench_wanted_level(tex, cell_width, cell_height) : 0;
+
+            GLuint texture = texture_stream_use(&bench->stream, handle, wanted);
+            bench->cells_drawn++;
+            if (!texture) continue;
+            if (tex->resident_level <= wanted) bench->cells_sharp++;
+
+            float x0 = 2.0f * (float)column / (float)bench_texture_columns - 1.0f;
+            float y0 = 1.0f - 2.0f * (float)(row + 1) / (float)bench_texture_rows;
+            gl_state_bind_texture(0, GL_TEXTURE_2D, texture);
+            glUniform4f(texture_rect_location, x0, y0, x0 + 2.0f / bench_texture_columns, y0 + 2.0f / bench_texture_rows);
+            glDrawElements(GL_TRIANGLES, quad.index_count, quad.index_type, 0);
+        }
+    }
+
+    int64_t update_start = get_perf_count();
+    texture_stream_update(&bench->stream);
+    int64_t update_counts = get_perf_count() - update_start;
+    bench->update_counts += update_counts;
+    if (update_counts > bench->max_update_counts) bench->max_update_counts = update_counts;
+    bench->frame++;
+}
+
+void record_texture_benchmark(TextureBenchmark *bench) {
+    if (!bench->started) return;
+
+    bench->frames++;
+    if (bench->frames < bench_texture_frames_per_report) return;
+
+    const TextureStream *stream = &bench->stream;
+    double seconds = time_duration_seconds(0, bench->update_counts);
+    char buf[384];
+    sprintf_s(buf, sizeof(buf),
+              "Texture bench: resident %.1f/%.0f MB | uploaded %.2f MB/frame (budget %.0f MB), %llu frames deferred | "
+              "update %.3f ms avg, %.3f ms max | %llu evictions | %.0f%% of cells sharp | decode %.1f ms total\n",
+              (double)stream->resident_bytes / (1024.0 * 1024.0),
+              (double)stream->residency_limit / (1024.0 * 1024.0),
+              (double)(stream->bytes_uploaded - bench->bytes_uploaded) / (1024.0 * 1024.0) / bench->frames,
+              (double)stream->upload_budget / (1024.0 * 1024.0),
+              (unsigned long long)(stream->budget_deferrals - bench->budget_deferrals),
+              1000.0 * seconds / bench->frames, 1000.0 * time_duration_seconds(0, bench->max_update_counts),
+              (unsigned long long)(stream->evictions - bench->evictions),
+              100.0 * bench->cells_sharp / (bench->cells_drawn ? bench->cells_drawn : 1),
+              1000.0 * time_duration_seconds(0, (int64_t)stream->decode_counts));
+    OutputDebugStringA(buf);
+
+    bench->frames = 0;
+    bench->update_counts = 0;
+    bench->max_update_counts = 0;
+    bench->cells_drawn = 0;
+    bench->cells_sharp = 0;
+    bench->bytes_uploaded = stream->bytes_uploaded;
+    bench->evictions = stream->evictions;
+    bench->budget_deferrals = stream->budget_deferrals;
+}
+#endif
+
+#ifdef BENCH_COMMANDS
+enum CommandBenchMode {
+    COMMAND_MODE_IMMEDIATE, // Layout and GL calls on the render thread
+    COMMAND_MODE_RECORDED,  // Recorded, then replayed, on the render thread
+    COMMAND_MODE_WORKER,    // Recorded on a worker during the previous frame; only replayed here
+    COMMAND_MODE_COUNT,
+};
+
+const char *const command_mode_names[COMMAND_MODE_COUNT] = { "immediate", "recorded", "worker" };
+
+typedef struct {
+    CommandList list;
+    bool requested; // Handed to the worker, which records frame/width/height into it
+    bool recorded;
+    uint64_t frame;
+    int width;
+    int height;
+} CommandBenchSlot;
+
+typedef struct {
+    bool started;
+    HANDLE thread;
+    CRITICAL_SECTION crit_sect;
+    CONDITION_VARIABLE cond_var;
+    bool stop;
+
+    // Frame N replays one while the worker records frame N + 1 into the other
+    CommandBenchSlot slots[2];
+    GLuint palette_ubo;
+    uint64_t frame;
+
+    // Since the last report
+    int frames;
+    int64_t render_counts; // Render thread time spent on the benchmark, waits included
+    int64_t worker_counts; // Written by the worker, under the lock
+    int stale_lists;       // Recorded by the worker for another extent, so recorded again
+    uint32_t list_bytes;
+    uint32_t list_commands;
+    uint32_t list_draws;
+} CommandBenchmark;
+
+// The layout pass, standing in for UI layout or scene traversal: where each
+// cell goes this frame and which colour it takes. Cells keep a pixel apart.
+void layout_command_cell(int index, uint64_t frame, int width, int height, float rect[4], int *color_index) {
+    int column = index % bench_command_columns;
+    int row = index / bench_command_columns;
+    float phase = (float)frame * 0.05f + (float)column * 0.2f + (float)row * 0.3f;
+    float size = 0.6f + 0.3f * sinf(phase) * cosf(0.5f * phase);
+
+    float cell_width = 2.0f / (float)bench_command_columns;
+    float cell_height = 2.0f / (float)bench_command_rows;
+    float center_x = -1.0f + cell_width * ((float)column + 0.5f + 0.2f * sinf(0.7f * phase));
+    float center_y = -1.0f + cell_height * ((float)row + 0.5f + 0.2f * cosf(0.9f * phase));
+    float half_width = 0.5f * cell_width * size - 1.0f / (float)width;
+    float half_height = 0.5f * cell_height * size - 1.0f / (float)height;
+
+    rect[0] = center_x - half_width;
+    rect[1] = center_y - half_height;
+    rect[2] = center_x + half_width;
+    rect[3] = center_y + half_height;
+    *color_index = (index + (int)(frame / 8)) % COMMAND_BENCH_PALETTE_SIZE;
+}
+
+void fill_command_palette(float *palette, uint64_t frame) {
+    for (int i = 0; i < COMMAND_BENCH_PALETTE_SIZE; i++) {
+        float hue = (float)i / (float)COMMAND_BENCH_PALETTE_SIZE * 2.0f * pi + (float)frame * 0.02f;
+        palette[i * 4 + 0] = 0.5f + 0.5f * sinf(hue);
+        palette[i * 4 + 1] = 0.5f + 0.5f * sinf(hue + 2.0f * pi / 3.0f);
+        palette[i * 4 + 2] = 0.5f + 0.5f * sinf(hue + 4.0f * pi / 3.0f);
+        palette[i * 4 + 3] = 1.0f;
+    }
+}
+
+// Any thread: makes no GL calls
+void record_command_bench_frame(CommandList *list, GLuint palette_ubo, uint64_t frame, int width, int height) {
+    float palette[COMMAND_BENCH_PALETTE_SIZE * 4];
+    fill_command_palette(palette, frame);
+
+    command_list_reset(list);
+    command_list_buffer_write(list, GL_UNIFORM_BUFFER, palette_ubo, 0, palette, sizeof(palette));
+    command_list_bind_vertex_array(list, vao);
+    command_list_use_program(list, command_program);
+    command_list_bind_buffer_range(list, GL_UNIFORM_BUFFER, BLOCK_BINDING_PALETTE, palette_ubo, 0, sizeof(palette));
+    for (int i = 0; i < bench_command_columns * bench_command_rows; i++) {
+        float rect[4];
+        int color_index;
+        layout_command_cell(i, frame, width, height, rect, &color_index);
+        command_list_uniform(list, COMMAND_UNIFORM_VEC4, command_rect_location, 1, rect);
+        command_list_uniform(list, COMMAND_UNIFORM_INT, command_color_location, 1, &color_index);
+        command_list_draw_elements(list, GL_TRIANGLES, quad.index_count, quad.index_type, 0, 1, 0);
+    }
+}
+
+// The same calls, made directly
+void draw_command_bench_frame(GLuint palette_ubo, uint64_t frame, int width, int height) {
+    float palette[COMMAND_BENCH_PALETTE_SIZE * 4];
+    fill_command_palette(palette, frame);
+
+    if (gl_caps.direct_state_access) {
+        glNamedBufferSubData(palette_ubo, 0, sizeof(palette), palette);
+    } else {
+        gl_state_bind_buffer(GL_UNIFORM_BUFFER, palette_ubo);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(palette), palette);
+    }
+    gl_state_bind_vertex_array(vao);
+    gl_state_use_program(command_program);
+    gl_state_bind_buffer_range(GL_UNIFORM_BUFFER, BLOCK_BINDING_PALETTE, palette_ubo, 0, sizeof(palette));
+    for (int i = 0; i < bench_command_columns * bench_command_rows; i++) {
+        float rect[4];
+        int color_index;
+        layout_command_cell(i, frame, width, height, rect, &color_index);
+        glUniform4fv(command_rect_location, 1, rect);
+        glUniform1iv(command_color_location, 1, &color_index);
+        glDrawElements(GL_TRIANGLES, quad.index_count, quad.index_type, 0);
+    }
+}
+
+DWORD command_bench_thread_func(LPVOID lParam) {
+    CommandBenchmark *bench = (CommandBenchmark*)lParam;
+
+    while (true) {
+        EnterCriticalSection(&bench->crit_sect);
+        CommandBenchSlot *slot = NULL;
+        while (!bench->stop && !slot) {
+            for (int i = 0; i < 2; i++) {
+                if (bench->slots[i].requested && !bench->slots[i].recorded) slot = &bench->slots[i];
+            }
+            if (!slot) SleepConditionVariableCS(&bench->cond_var, &bench->crit_sect, INFINITE);
+        }
+        bool stop = bench->stop;
+        LeaveCriticalSection(&bench->crit_sect);
+
+        if (stop) break;
+
+        // The render thread leaves a requested slot alone until it is recorded
+        int64_t start_count = get_perf_count();
+        record_command_bench_frame(&slot->list, bench->palette_ubo, slot->frame, slot->width, slot->height);
+        int64_t counts = get_perf_count() - start_count;
+
+        EnterCriticalSection(&bench->crit_sect);
+        slot->recorded = true;
+        bench->worker_counts += counts;
+        WakeAllConditionVariable(&bench->cond_var);
+        LeaveCriticalSection(&bench->crit_sect);
+    }
+    return 0;
+}
+
+bool start_command_benchmark(CommandBenchmark *bench) {
+    memset(bench, 0, sizeof(*bench));
+    for (int i = 0; i < 2; i++) {
+        if (!command_list_init(&bench->slots[i].list, bench_command_list_capacity)) return false;
+    }
+
+    glGenBuffers(1, &bench->palette_ubo);
+    gl_state_bind_buffer(GL_UNIFORM_BUFFER, bench->palette_ubo);
+    glBufferData(GL_UNIFORM_BUFFER, COMMAND_BENCH_PALETTE_SIZE * 4 * sizeof(float), NULL, GL_DYNAMIC_DRAW);
+
+    InitializeCriticalSection(&bench->crit_sect);
+    InitializeConditionVariable(&bench->cond_var);
+    bench->thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)command_bench_thread_func, bench, 0, NULL);
+    bench->started = bench->thread != NULL;
+    return bench->started;
+}
+
+void stop_command_benchmark(CommandBenchmark *bench) {
+    if (bench->thread) {
+        EnterCriticalSection(&bench->crit_sect);
+        bench->stop = true;
+        WakeAllConditionVariable(&bench->cond_var);
+        LeaveCriticalSection(&bench->crit_sect);
+
+        WaitForSingleObject(bench->thread, INFINITE);
+        CloseHandle(bench->thread);
+        bench->thread = NULL;
+        DeleteCriticalSection(&bench->crit_sect);
+    }
+    for (int i = 0; i < 2; i++) command_list_destroy(&bench->slots[i].list);
+    if (bench->palette_ubo) glDeleteBuffers(1, &bench->palette_ubo);
+    bench->palette_ubo = 0;
+    bench->started = false;
+}
+
+// Takes this frame's slot back from the worker, waiting if it is still
+// recording. True when the worker recorded it for this frame at this extent.
+bool take_command_bench_slot(CommandBenchmark *bench, CommandBenchSlot *slot, int width, int height) {
+    EnterCriticalSection(&bench->crit_sect);
+    while (slot->requested && !slot->recorded) {
+        SleepConditionVariableCS(&bench->cond_var, &bench->crit_sect, INFINITE);
+    }
+    bool requested = slot->requested;
+    slot->requested = false;
+    slot->recorded = false;
+    LeaveCriticalSection(&bench->crit_sect);
+
+    bool current = requested && slot->frame == bench->frame && slot->width == width && slot->height == height;
+    if (requested && !current) bench->stale_lists++;
+    return current;
+}
+
+void draw_command_benchmark(CommandBenchmark *bench, int width, int height) {
+    if (!command_program) {
+        command_program = shader_compiler_poll(&shader_compiler, command_program_job);
+        if (!command_program) return;
+        command_rect_location = glGetUniformLocation(command_program, "rect");
+        command_color_location = glGetUniformLocation(command_program, "color_index");
+        glUniformBlockBinding(command_program, glGetUniformBlockIndex(command_program, "CommandPalette"),
+                              BLOCK_BINDING_PALETTE);
+    }
+    if (!bench->started && !start_command_benchmark(bench)) return;
+
+    int mode = (int)(bench->frame / bench_command_frames_per_mode % COMMAND_MODE_COUNT);
+    int64_t start_count = get_perf_count();
+
+    CommandBenchSlot *slot = &bench->slots[bench->frame & 1];
+    bool recorded = take_command_bench_slot(bench, slot, width, height);
+
+    if (mode == COMMAND_MODE_IMMEDIATE) {
+        draw_command_bench_frame(bench->palette_ubo, bench->frame, width, height);
+    } else {
+        if (!recorded) record_command_bench_frame(&slot->list, bench->palette_ubo, bench->frame, width, height);
+
+        // Hand the next frame to the worker before replaying this one, so it
+        // records while this frame replays and presents. The extent is a
+        // guess; a resize in between makes the list stale.
+        if (mode == COMMAND_MODE_WORKER) {
+            CommandBenchSlot *next = &bench->slots[(bench->frame + 1) & 1];
+            EnterCriticalSection(&bench->crit_sect);
+            next->frame = bench->frame + 1;
+            next->width = width;
+            next->height = height;
+            next->requested = true;
+            WakeAllConditionVariable(&bench->cond_var);
+            LeaveCriticalSection(&bench->crit_sect);
+        }
+
+        command_list_replay(&slot->list);
+        bench->list_bytes = (uint32_t)slot->list.size;
+        bench->list_commands = slot->list.commands;
+        bench->list_draws = slot->list.draws;
+    }
+
+    bench->render_counts += get_perf_count() - start_count;
+    bench->frame++;
+}
+
+// Reports each mode once it has run its frames
+void record_command_benchmark(CommandBenchmark *bench) {
+    if (!bench->started) return;
+
+    bench->frames++;
+    if (bench->frame % bench_command_frames_per_mode != 0) return;
+
+    int mode = (int)((bench->frame - 1) / bench_command_frames_per_mode % COMMAND_MODE_COUNT);
+    EnterCriticalSection(&bench->crit_sect);
+    int64_t worker_counts = bench->worker_counts;
+    bench->worker_counts = 0;
+    LeaveCriticalSection(&bench->crit_sect);
+
+    char buf[320];
+    sprintf_s(buf, sizeof(buf),
+              "Command bench (%s): render thread %.3f ms/frame | worker %.3f ms/frame | "
+              "%d draws per frame, list %u commands, %.1f KB | %d stale lists recorded again\n",
+              command_mode_names[mode],
+              1000.0 * time_duration_seconds(0, bench->render_counts) / bench->frames,
+              1000.0 * time_duration_seconds(0, worker_counts) / bench->frames,
+              bench_command_columns * bench_command_rows,
+              mode == COMMAND_MODE_IMMEDIATE ? 0 : bench->list_commands,
+              mode == COMMAND_MODE_IMMEDIATE ? 0.0 : (double)bench->list_bytes / 1024.0,
+              bench->stale_lists);
+    OutputDebugStringA(buf);
+
+    bench->frames = 0;
+    bench->render_counts = 0;
+    bench->stale_lists = 0;
+}
+#endif
+
+void report_frame_stats(const FrameStats *stats, const ResolutionController *controller) {
+    double rendered_us = stats->frames_rendered
+        ? (double)stats->gpu_ns_rendered / (double)stats->frames_rendered / 1000.0 : 0.0;
+    double reused_us = stats->frames_reused
+        ? (double)stats->gpu_ns_reused / (double)stats->frames_reused / 1000.0 : 0.0;
+
+    char buf[256];
+    sprintf_s(buf, sizeof(buf),
+              "Frames rendered: %llu (avg GPU %.1f us) | reused: %llu (avg GPU %.1f us)\n",
+              (unsigned long long)stats->frames_rendered, rendered_us,
+              (unsigned long long)stats->frames_reused, reused_us);
+    OutputDebugStringA(buf);
+
+    uint64_t frames = stats->frames_rendered + stats->frames_reused;
+    sprintf_s(buf, sizeof(buf), "State calls per frame: %.1f issued, %.1f elided\n",
+              frames ? (double)stats->gl_calls_issued / (double)frames : 0.0,
+              frames ? (double)stats->gl_calls_elided / (double)frames : 0.0);
+    OutputDebugStringA(buf);
+
+    double shaded = stats->frames_rendered ? (double)stats->pixels_shaded / (double)stats->frames_rendered : 0.0;
+    double shaded_full = stats->frames_rendered
+        ? (double)stats->pixels_shaded_full / (double)stats->frames_rendered : 0.0;
+    double presented = frames ? (double)stats->pixels_presented / (double)frames : 0.0;
+    double presented_full = frames ? (double)stats->pixels_presented_full / (double)frames : 0.0;
+    sprintf_s(buf, sizeof(buf),
+              "Pixels per rendered frame: %.0f shaded of %.0f (%.1f%%) | per frame: %.0f presented of %.0f (%.1f%%)%s\n",
+              shaded, shaded_full, shaded_full > 0.0 ? 100.0 * shaded / shaded_full : 0.0,
+              presented, presented_full, presented_full > 0.0 ? 100.0 * presented / presented_full : 0.0,
+              present_preserved ? "" : ", backbuffer not preserved");
+    OutputDebugStringA(buf);
+
+    sprintf_s(buf, sizeof(buf),
+              "Render scale: %.2f (scene GPU %.2f ms, budget %.2f ms) | down: %llu up: %llu hold: %llu reset: %llu\n",
+              controller->scale, controller->last_gpu_ms, controller->budget_ms,
+              (unsigned long long)controller->decreases, (unsigned long long)controller->increases,
+              (unsigned long long)controller->holds, (unsigned long long)controller->resets);
+    OutputDebugStringA(buf);
+}
+
+// --------------------------------------------------
+// ----- Startup profiling
+// --------------------------------------------------
+#define MAX_STARTUP_PHASES 16
+#define STARTUP_BENCH_TIMEOUT_MS 10000
+
+// Phases run on several threads, so each records its own begin and end
+typedef struct {
+    const char *name;
+    DWORD thread_id;
+    double begin_ms;
+    double end_ms;
+} StartupPhase;
+
+static StartupPhase startup_phases[MAX_STARTUP_PHASES];
+static volatile LONG startup_phase_count;
+static HANDLE startup_present_event; // Set on the first present when launched by the startup benchmark
+
+int startup_phase_begin(const char *name) {
+    LONG index = InterlockedIncrement(&startup_phase_count) - 1;
+    if (index >= MAX_STARTUP_PHASES) return -1;
+
+    startup_phases[index].name = name;
+    startup_phases[index].thread_id = GetCurrentThreadId();
+    startup_phases[index].begin_ms = 1000.0 * get_time_now();
+    return index;
+}
+
+void startup_phase_end(int phase) {
+    if (phase >= 0) startup_phases[phase].end_ms = 1000.0 * get_time_now();
+}
+
+void report_startup(HWND hwnd) {
+    char buf[256];
+    sprintf_s(buf, sizeof(buf), "Startup: first present %.2f ms after launch\n", 1000.0 * get_time_now());
+    OutputDebugStringA(buf);
+
+    LONG count = startup_phase_count < MAX_STARTUP_PHASES ? startup_phase_count : MAX_STARTUP_PHASES;
+    for (LONG i = 0; i < count; i++) {
+        const StartupPhase *phase = &startup_phases[i];
+        sprintf_s(buf, sizeof(buf), "  %-24s %8.2f - %8.2f ms (%7.2f ms, thread %lu)\n", phase->name,
+                  phase->begin_ms, phase->end_ms, phase->end_ms - phase->begin_ms, (unsigned long)phase->thread_id);
+        OutputDebugStringA(buf);
+    }
+
+    // Launched by the startup benchmark, which only wants the time to here
+    if (startup_present_event) {
+        SetEvent(startup_present_event);
+        PostMessage(hwnd, WM_CLOSE, 0, 0);
+    }
+}
+
+void default_pixel_format(PIXELFORMATDESCRIPTOR *pfd) {
+    memset(pfd, 0, sizeof(*pfd));
+    pfd->nSize = sizeof(PIXELFORMATDESCRIPTOR);
+    pfd->nVersion = 1;
+    pfd->dwFlags = PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER;
+    pfd->iPixelType = PFD_TYPE_RGBA;
+    pfd->cColorBits = 32;
+    pfd->cDepthBits = 24;
+    pfd->cStencilBits = 8;
+    pfd->iLayerType = PFD_MAIN_PLANE;
+}
+
+// Entry points called every frame are resolved while loading; everything
+// else is resolved by its first call
+static const char *const gl_hot_list[] = {
+    "glBeginQuery", "glBindBuffer", "glBindBufferRange", "glBindFramebuffer", "glBindTexture",
+    "glBindVertexArray", "glBlitFramebuffer", "glBufferData", "glBufferSubData", "glClear",
+    "glClearColor", "glClientWaitSync", "glDeleteSync", "glDisable", "glDrawElements",
+    "glDrawElementsInstanced", "glEnable", "glEndQuery", "glFenceSync", "glGetIntegerv",
+    "glGetQueryObjectui64v", "glGetString", "glGetStringi", "glMapBufferRange",
+    "glMultiDrawElementsIndirect", "glNamedBufferSubData", "glScissor", "glTexSubImage2D", "glUnmapBuffer",
+    "glUseProgram", "glVertexAttribPointer", "glViewport",
+};
+#define GL_HOT_COUNT (int)(sizeof(gl_hot_list) / sizeof(gl_hot_list[0]))
+
+#ifdef BENCH_LOADER
+#define BENCH_LOADER_RUNS 50
+#define BENCH_LOADER_LOOKUPS 10000
+
+static const char *bench_extension_queries[] = {
+    "GL_ARB_get_program_binary", "GL_KHR_parallel_shader_compile", "GL_ARB_buffer_storage", "GL_EXT_not_an_extension",
+};
+
+// How extensions were looked up before they were hashed
+bool has_extension_linear(const char *name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++) {
+        if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), name) == 0) return true;
+    }
+    return false;
+}
+
+// A plain process wide pointer, to compare with calls through the dispatch table
+static PFNGLGETERRORPROC bench_global_get_error;
+
+// Compares eager and lazy loading on the bootstrap context. Lazy loading runs
+// last so its table is the one left installed.
+void run_loader_benchmark() {
+    int64_t start_count = get_perf_count();
+    for (int i = 0; i < BENCH_LOADER_RUNS; i++) gladLoadGL();
+    double eager_ms = 1000.0 * time_duration_seconds(start_count, get_perf_count()) / BENCH_LOADER_RUNS;
+
+    start_count = get_perf_count();
+    for (int i = 0; i < BENCH_LOADER_RUNS; i++) gladLoadGLLazy(gl_hot_list, GL_HOT_COUNT);
+    double lazy_ms = 1000.0 * time_duration_seconds(start_count, get_perf_count()) / BENCH_LOADER_RUNS;
+
+    // The first call goes through the stub and resolves it, the second goes straight to the driver
+    double first_call_us = 0.0;
+    double next_call_us = 0.0;
+    for (int i = 0; i < BENCH_LOADER_RUNS; i++) {
+        gladLoadGLLazy(gl_hot_list, GL_HOT_COUNT);
+        int64_t first_count = get_perf_count();
+        glGetError();
+        int64_t next_count = get_perf_count();
+        glGetError();
+        int64_t end_count = get_perf_count();
+        first_call_us += 1e6 * time_duration_seconds(first_count, next_count);
+        next_call_us += 1e6 * time_duration_seconds(next_count, end_count);
+    }
+
+    char buf[256];
+    sprintf_s(buf, sizeof(buf),
+              "Loader: eager %.3f ms, lazy %.3f ms (%d hot) | first call %.2f us, later calls %.2f us\n",
+              eager_ms, lazy_ms, GL_HOT_COUNT, first_call_us / BENCH_LOADER_RUNS, next_call_us / BENCH_LOADER_RUNS);
+    OutputDebugStringA(buf);
+
+    const int query_count = sizeof(bench_extension_queries) / sizeof(bench_extension_queries[0]);
+    int found = 0;
+    start_count = get_perf_count();
+    for (int i = 0; i < BENCH_LOADER_LOOKUPS; i++) found += gladHasExtension(bench_extension_queries[i % query_count]);
+    double hashed_ns = 1e9 * time_duration_seconds(start_count, get_perf_count()) / BENCH_LOADER_LOOKUPS;
+
+    start_count = get_perf_count();
+    for (int i = 0; i < BENCH_LOADER_LOOKUPS; i++) found += has_extension_linear(bench_extension_queries[i % query_count]);
+    double linear_ns = 1e9 * time_duration_seconds(start_count, get_perf_count()) / BENCH_LOADER_LOOKUPS;
+
+    // The old loader copied every name into its own allocation plus one for the table
+    const GladExtensionSet *extensions = gladGetExtensions();
+    sprintf_s(buf, sizeof(buf),
+              "Extensions: %u in %d allocation(s), was %u | lookup hashed %.1f ns, linear %.1f ns (%d found)\n",
+              extensions->count, extensions->allocations, extensions->count + 1, hashed_ns, linear_ns, found);
+    OutputDebugStringA(buf);
+
+    glGetError(); // Resolve the stub first
+    bench_global_get_error = glad_glGetError;
+
+    start_count = get_perf_count();
+    for (int i = 0; i < BENCH_LOADER_LOOKUPS; i++) glGetError();
+    double table_ns = 1e9 * time_duration_seconds(start_count, get_perf_count()) / BENCH_LOADER_LOOKUPS;
+
+    start_count = get_perf_count();
+    for (int i = 0; i < BENCH_LOADER_LOOKUPS; i++) bench_global_get_error();
+    double global_ns = 1e9 * time_duration_seconds(start_count, get_perf_count()) / BENCH_LOADER_LOOKUPS;
+
+#ifdef GLAD_MX
+    const char *table_kind = "thread-local";
+#else
+    const char *table_kind = "global";
+#endif
+    sprintf_s(buf, sizeof(buf), "Dispatch: %s table %.2f ns per call, plain global pointer %.2f ns per call\n",
+              table_kind, table_ns, global_ns);
+    OutputDebugStringA(buf);
+}
+#endif
+
+typedef struct {
+    HINSTANCE instance;
+    bool loaded;
+} GLBootstrap;
+
+// Loads the driver and the GL/WGL entry points through a hidden window of its
+// own, so the main thread can register its class and create the real window
+// at the same time. Also reads cached program binaries while it has a context.
+DWORD gl_bootstrap_thread_func(LPVOID lParam) {
+    GLBootstrap *bootstrap = (GLBootstrap*)lParam;
+
+    int phase = startup_phase_begin("dummy context");
+    WNDCLASSEX wind_class = {};
+    wind_class.cbSize = sizeof(WNDCLASSEX);
+    wind_class.style = CS_OWNDC;
+    wind_class.lpfnWndProc = DefWindowProc;
+    wind_class.hInstance = bootstrap->instance;
+    wind_class.lpszClassName = L"GLBootstrapWindow";
+    RegisterClassEx(&wind_class);
+
+    HWND hwnd = CreateWindowEx(0, wind_class.lpszClassName, L"", WS_OVERLAPPEDWINDOW, 0, 0, 1, 1,
+                               NULL, NULL, bootstrap->instance, NULL);
+    HDC hdc = GetDC(hwnd);
+
+    PIXELFORMATDESCRIPTOR pfd;
+    default_pixel_format(&pfd);
+    SetPixelFormat(hdc, ChoosePixelFormat(hdc, &pfd), &pfd);
+
+    HGLRC dummy_context = wglCreateContext(hdc);
+    wglMakeCurrent(hdc, dummy_context);
+    startup_phase_end(phase);
+
+#ifdef BENCH_LOADER
+    if (dummy_context) run_loader_benchmark();
+#endif
+
+    phase = startup_phase_begin("load GL/WGL");
+    bootstrap->loaded = dummy_context && gladLoadGLLazy(gl_hot_list, GL_HOT_COUNT) && gladLoadWGL(hdc);
+    startup_phase_end(phase);
+
+    if (bootstrap->loaded) {
+        phase = startup_phase_begin("program cache prefetch");
+        char cache_dir[MAX_PATH];
+        get_exe_directory(cache_dir, sizeof(cache_dir));
+        strcat_s(cache_dir, sizeof(cache_dir), "\\shader_cache");
+        program_cache_init(&program_cache, cache_dir);
+
+        program_cache_prefetch(&program_cache, fallback_vertex_shader_source, fallback_fragment_shader_source);
+        program_cache_prefetch(&program_cache, vertex_shader_source, fragment_shader_source);
+        program_cache_prefetch(&program_cache, batch_vertex_shader_source, batch_fragment_shader_source);
+        startup_phase_end(phase);
+    }
+
+    wglMakeCurrent(NULL, NULL);
+    wglDeleteContext(dummy_context);
+    ReleaseDC(hwnd, hdc);
+    DestroyWindow(hwnd);
+    UnregisterClass(wind_class.lpszClassName, bootstrap->instance);
+
+    return 0;
+}
+
+int compare_doubles(const void *a, const void *b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Launches this executable `launches` times and reports the time from
+// CreateProcess to each child's first present. The child signals an inherited
+// event when it presents and then closes itself.
+int run_startup_benchmark(int launches, bool purge_cache) {
+    wchar_t exe_path[MAX_PATH];
+    GetModuleFileNameW(NULL, exe_path, MAX_PATH);
+
+    char cache_dir[MAX_PATH];
+    get_exe_directory(cache_dir, sizeof(cache_dir));
+    strcat_s(cache_dir, sizeof(cache_dir), "\\shader_cache");
+
+    SECURITY_ATTRIBUTES inheritable = { sizeof(SECURITY_ATTRIBUTES), NULL, TRUE };
+    HANDLE present_event = CreateEvent(&inheritable, TRUE, FALSE, NULL);
+    double *samples = (double*)malloc(launches * sizeof(double));
+    if (!present_event || !samples) return 1;
+
+    int completed = 0;
+    int timeouts = 0;
+    for (int i = 0; i < launches; i++) {
+        if (purge_cache) program_cache_purge(cache_dir);
+        ResetEvent(present_event);
+
+        wchar_t cmd[MAX_PATH + 64];
+        swprintf_s(cmd, MAX_PATH + 64, L"\"%s\" --startup-child %llu", exe_path,
+                   (unsigned long long)(uintptr_t)present_event);
+
+        STARTUPINFOW startup_info = {};
+        startup_info.cb = sizeof(startup_info);
+        PROCESS_INFORMATION process = {};
+
+        int64_t launch_count = get_perf_count();
+        if (!CreateProcessW(NULL, cmd, NULL, NULL, TRUE, 0, NULL, NULL, &startup_info, &process)) {
+            OutputDebugString(L"Startup benchmark: could not launch child\n");
+            break;
+        }
+
+        DWORD wait = WaitForSingleObject(present_event, STARTUP_BENCH_TIMEOUT_MS);
+        int64_t present_count = get_perf_count();
+
+        WaitForSingleObject(process.hProcess, INFINITE);
+        CloseHandle(process.hThread);
+        CloseHandle(process.hProcess);
+
+        if (wait == WAIT_OBJECT_0) samples[completed++] = 1000.0 * time_duration_seconds(launch_count, present_count);
+        else timeouts++;
+    }
+
+    CloseHandle(present_event);
+
+    char buf[256];
+    if (completed) {
+        qsort(samples, completed, sizeof(double), compare_doubles);
+        double total = 0.0;
+        for (int i = 0; i < completed; i++) total += samples[i];
+
+        sprintf_s(buf, sizeof(buf),
+                  "Startup benchmark: %d launches%s, time to first present min %.2f / median %.2f / p95 %.2f / max %.2f / mean %.2f ms (%d timed out)\n",
+                  completed, purge_cache ? " without program cache" : "", samples[0], samples[completed / 2],
+                  samples[(completed * 95) / 100 < completed ? (completed * 95) / 100 : completed - 1],
+                  samples[completed - 1], total / completed, timeouts);
+    } else {
+        sprintf_s(buf, sizeof(buf), "Startup benchmark: no launch presented (%d timed out)\n", timeouts);
+    }
+    OutputDebugStringA(buf);
+
+    free(samples);
+    return completed ? 0 : 1;
+}
+
+// --------------------------------------------------
+// ----- Render thread
+// --------------------------------------------------
+// Takes the flags WindowProc and the main thread set for this frame and clears
+// them. Unless told not to wait, sleeps until there are some or until the
+// timeout, and reports how long it slept.
+uint32_t take_window_flags(WindowData *window, bool wait, DWORD timeout, float *sleep_time) {
+    EnterCriticalSection(&window->crit_sect);
+
+    *sleep_time = 0;
+    if (wait && !window->flags) {
+        float before_sleep_time = (float)get_time_now();
+        SleepConditionVariableCS(&window->cond_var, &window->crit_sect, timeout);
+        float end_sleep_time = (float)get_time_now();
+        *sleep_time = end_sleep_time - before_sleep_time;
+    }
+
+    uint32_t flags = window->flags; // Cache this frame's flags
+    window->flags = 0;              // Reset next frame's flags
+
+    LeaveCriticalSection(&window->crit_sect);
+    return flags;
+}
+
+// Called as the render thread exits, so a paint that arrives after it doesn't
+// wait for a frame that will never come
+void window_render_stopped(WindowData *window) {
+    EnterCriticalSection(&window->crit_sect);
+    window->render_stopped = true;
+    WakeConditionVariable(&window->cond_var);
+    LeaveCriticalSection(&window->crit_sect);
+}
+
+void report_resize_latency(WindowData *window) {
+    EnterCriticalSection(&window->crit_sect);
+    uint64_t count = window->resize_count;
+    double seconds = window->resize_seconds;
+    double max_seconds = window->resize_max_seconds;
+    LeaveCriticalSection(&window->crit_sect);
+
+    if (!count) return;
+    char buf[128];
+    sprintf_s(buf, sizeof(buf), "Resizes: %llu (avg wait %.2f ms, max %.2f ms)\n", (unsigned long long)count,
+              1000.0 * seconds / (double)count, 1000.0 * max_seconds);
+    OutputDebugStringA(buf);
+}
+
+// The scene's animation, shared by every renderer so they draw the same frames
+float quad_modifier(float time) {
+    return 0.25f * sinf(4.0f * (time + pi / 8.0f)) + 0.75f;
+}
+
+float background_color(float time) {
+#ifdef BENCH_DAMAGE
+    UNREFERENCED_PARAMETER(time);
+    return 0.25f; // Held still, so only the quad is damaged
+#else
+    return 1 - (0.5f * sinf(2.0f * time + pi / 2.0f) + 0.5f);
+#endif
+}
+
+// Moves the animation on by the time since the last frame that wasn't spent
+// waiting for events
+void advance_animation(float *time, float *start_time, float sleep_time, bool animating) {
+    float end_time = (float)get_time_now();
+    if (animating) {
+        *time += end_time - *start_time - sleep_time;
+        if (*time > 2 * pi) {
+            *time -= (2 *pi);
+        }
+    }
+    *start_time = end_time;
+}
+
+// Picks up programs finished by the compiler thread. Returns true if any arrived.
+bool poll_programs() {
+    bool arrived = false;
+
+    if (!shader_program) {
+        shader_program = shader_compiler_poll(&shader_compiler, scene_program_job);
+        if (shader_program) {
+            reflect_program(&scene_program_info, shader_program);
+            bind_program_block(&scene_program_info, "FrameConstants", BLOCK_BINDING_FRAME, sizeof(FrameConstants));
+            bind_program_block(&scene_program_info, "ObjectConstants", BLOCK_BINDING_OBJECT, sizeof(ObjectConstants));
+            arrived = true;
+        }
+    }
+
+    if (!batch_program) {
+        batch_program = shader_compiler_poll(&shader_compiler, batch_program_job);
+        if (batch_program) {
+            reflect_program(&batch_program_info, batch_program);
+            bind_program_block(&batch_program_info, "FrameConstants", BLOCK_BINDING_FRAME, sizeof(FrameConstants));
+
+            // Only the batch needs its instance buffers, so they aren't set up before the first frame
+            batch_ready = batch_init(&batch, &quad, batch_program, gl_caps.tier);
+            if (!batch_ready) OutputDebugStringA("Batch: out of memory, instanced drawing disabled\n");
+            gl_state_invalidate();
+            arrived = true;
+        }
+    }
+
+    if (arrived && shader_program && batch_program) {
+        char buf[256];
+        sprintf_s(buf, sizeof(buf), "Startup: programs ready %.2f ms after launch (%d from cache, %d compiled%s)\n",
+                  1000.0 * get_time_now(), program_cache.hits, program_cache.misses,
+                  program_cache.enabled ? "" : ", cache unavailable");
+        OutputDebugStringA(buf);
+    }
+
+    return arrived;
+}
+
+bool programs_pending() {
+    return (!shader_program && !shader_compiler_failed(&shader_compiler, scene_program_job)) ||
+           (!batch_program && !shader_compiler_failed(&shader_compiler, batch_program_job));
+}
+
+DWORD render_thread_func(LPVOID lParam) {
+    WindowData* window = (WindowData*)lParam;
+    GLsync fence;
+
+    int first_frame_phase = startup_phase_begin("first frame");
+    bool presented = false;
+
+    HDC hdc = GetDC(window->hwnd);
+    wglMakeCurrent(hdc, render_context);
+
+    // The main thread set this context up with direct GL calls
+    gl_state_invalidate();
+
+    glGenQueries(1, &gpu_timer_query);
+    glGenQueries(1, &scene_timer_query);
+
+    float time = 0.0f;
+    float start_time = time;
+    bool animating = false;
+    bool interactive = false; // Inside a user move/size loop
+    bool minimized = false;
+    float modifier = 1.0f;
+
+    FrameKey cached_key = {};
+    bool cache_valid = false;
+    DamageRegion damage = {};
+    int presented_width = 0; // Extent of what the preserved backbuffer holds
+    int presented_height = 0;
+    FrameStats stats = {};
+    double last_report_time = 0.0;
+
+    ResolutionController controller;
+    resolution_controller_init(&controller, hdc);
+
+#ifdef BENCH_BATCH
+    // Runs while animating; press space to start it
+    BatchBenchmark bench = {};
+    int64_t bench_upload_counts = 0;
+#endif
+#ifdef BENCH_VERTEX
+    VertexBenchmark vertex_bench = {};
+#endif
+#ifdef BENCH_ARENA
+    ArenaBenchmark arena_bench = {};
+#endif
+#ifdef BENCH_TEXTURE
+    static TextureBenchmark texture_bench; // Too large for the stack
+#endif
+#ifdef BENCH_COMMANDS
+    static CommandBenchmark command_bench;
+#endif
+
+    // While the main thread hasn't signaled to stop
+    while (true) {
+        // Wake up periodically while programs are compiling to pick them up
+        float sleep_time = 0;
+        uint64_t flags = take_window_flags(window, !animating || minimized, programs_pending() ? 1 : INFINITE,
+                                           &sleep_time);
+
+        if (flags & EVENT_TERMINATE) break;
+
+        bool programs_arrived = poll_programs();
+
+        // Woken by the timeout with nothing new to show
+        if (!animating && !flags && !programs_arrived) {
+            start_time += sleep_time;
+            continue;
+        }
+
+#ifdef BENCH_BATCH
+        int64_t frame_start_count = get_perf_count();
+#endif
+
+        RECT rect;
+        GetClientRect(window->hwnd, &rect);
+
+        if (flags & EVENT_TOGGLEANIMATION) animating = !animating;
+        if (flags & EVENT_ENTERSIZEMOVE) interactive = true;
+        if (flags & EVENT_EXITSIZEMOVE) interactive = false;
+
+        if (!animating && !interactive) resolution_controller_reset(&controller);
+
+        if (animating) {
+            modifier = quad_modifier(time);
+        }
+
+        // Minimized: there is nothing to draw and no frame to keep at this
+        // size, and the animation waits for the next event like a still frame
+        minimized = rect.right <= 0 || rect.bottom <= 0;
+        if (minimized) {
+            advance_animation(&time, &start_time, sleep_time, animating);
+            WakeConditionVariable(&window->cond_var);
+            continue;
+        }
+
+        FrameKey key = {};
+        key.width = rect.right;
+        key.height = rect.bottom;
+        key.time = time;
+        key.modifier = modifier;
+        key.scale = controller.scale;
+        key.programs_ready = (shader_program != 0) + (batch_program != 0);
+
+        int scene_width = scaled_extent(key.width, key.scale);
+        int scene_height = scaled_extent(key.height, key.scale);
+
+        bool reuse_frame = use_cached_frame(&key);
+
+        gl_state_reset_counters();
+
+        if (reuse_frame) {
+            cached_key = key;
+            cache_valid = true;
+        } else {
+            compute_scene_damage(&damage, &key, &cached_key, cache_valid);
+            if (!cache_valid || key.width != cached_key.width || key.height != cached_key.height) {
+                resize_frame_cache(key.width, key.height, !damage.full);
+            }
+
+            glBeginQuery(GL_TIME_ELAPSED, scene_timer_query);
+
+            FrameConstants *frame_constants = (FrameConstants*)constants_staging;
+            frame_constants->viewport_size[0] = (float)key.width; // Logical pixels, independent of render scale
+            frame_constants->viewport_size[1] = (float)key.height;
+            frame_constants->time = time;
+
+            ObjectConstants *quad_constants = (ObjectConstants*)(constants_staging + object_constants_offset);
+            quad_constants->modifier = modifier;
+
+            if (gl_caps.direct_state_access) {
+                glNamedBufferSubData(constants_ubo, 0, constants_size, constants_staging);
+            } else {
+                gl_state_bind_buffer(GL_UNIFORM_BUFFER, constants_ubo);
+                glBufferSubData(GL_UNIFORM_BUFFER, 0, constants_size, constants_staging);
+            }
+
+            declare_frame_graph(&frame_graph, scene_width, scene_height);
+            frame_graph_compile(&frame_graph);
+
+            // Each pass comes with its target bound and its viewport set
+            const FrameGraphPass *pass;
+            while ((pass = frame_graph_next(&frame_graph))) {
+#ifdef BENCH_FRAMEGRAPH
+                if (pass->tag != FRAME_PASS_SCENE) {
+                    draw_post_pass(&frame_graph, pass->tag, scene_width, scene_height);
+                    continue;
+                }
+#endif
+                gl_state_bind_vertex_array(vao);
+                gl_state_use_program(shader_program ? shader_program : fallback_program);
+                gl_state_bind_buffer_range(GL_UNIFORM_BUFFER, BLOCK_BINDING_OBJECT, constants_ubo,
+                                           object_constants_offset, sizeof(ObjectConstants));
+
+                float back_color = background_color(time);
+                gl_state_clear_color(back_color, back_color, back_color, 1.0f);
+
+                // Everything outside the damage is already right in the cache
+                gl_state_set_enabled(GL_SCISSOR_TEST, !damage.full);
+                for (int i = 0; i < damage.count; i++) {
+                    const DamageRect *rect = &damage.rects[i];
+                    gl_state_scissor(rect->x, rect->y, rect->width, rect->height);
+                    glClear(GL_COLOR_BUFFER_BIT);
+                    glDrawElements(GL_TRIANGLES, quad.index_count, quad.index_type, 0);
+                }
+                gl_state_set_enabled(GL_SCISSOR_TEST, false); // It would clip blits too
+
+#ifdef BENCH_BATCH
+                if (batch_ready && bench.step < bench_step_count()) {
+                    const BenchMode *mode = bench_mode(bench.step);
+                    if (batch.tier != mode->tier) {
+                        batch_destroy(&batch);
+                        batch_ready = batch_init(&batch, &quad, batch_program, mode->tier);
+                        gl_state_invalidate();
+                    }
+                    if (batch_ready) {
+                        fill_bench_batch(&batch, bench_instance_count(bench.step), key.width, key.height, time);
+                        batch.naive_upload = mode->naive_upload;
+
+                        int64_t upload_start_count = get_perf_count();
+                        batch_flush(&batch);
+                        bench_upload_counts = get_perf_count() - upload_start_count;
+                    } else {
+                        bench.step = bench_step_count(); // Out of memory, give up
+                    }
+                }
+#endif
+#ifdef BENCH_VERTEX
+                if (animating) draw_vertex_benchmark(&vertex_bench);
+#endif
+#ifdef BENCH_ARENA
+                if (animating) draw_arena_benchmark(&arena_bench);
+#endif
+#ifdef BENCH_TEXTURE
+                if (animating) draw_texture_benchmark(&texture_bench, scene_width, scene_height);
+#endif
+#ifdef BENCH_COMMANDS
+                if (animating) draw_command_benchmark(&command_bench, scene_width, scene_height);
+#endif
+            }
+
+            glEndQuery(GL_TIME_ELAPSED);
+
+            keep_cached_frame(&key);
+            cached_key = key;
+            cache_valid = true;
+        }
+
+        // Present the cached frame, upscaling it if it was rendered at a lower
+        // resolution. A preserved backbuffer of the same extent already holds
+        // the last frame, so at native scale only the damage is copied to it,
+        // and a reused frame copies nothing.
+        bool partial_present = present_preserved && key.scale == 1.0f &&
+                               key.width == presented_width && key.height == presented_height;
+        uint64_t pixels_presented = 0;
+
+        glBeginQuery(GL_TIME_ELAPSED, gpu_timer_query);
+        gl_state_bind_framebuffer(GL_READ_FRAMEBUFFER, frame_fbo);
+        gl_state_bind_framebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        if (!partial_present) {
+            glBlitFramebuffer(0, 0, scene_width, scene_height, 0, 0, key.width, key.height,
+                              GL_COLOR_BUFFER_BIT, key.scale == 1.0f ? GL_NEAREST : GL_LINEAR);
+            pixels_presented = (uint64_t)key.width * key.height;
+        } else if (!reuse_frame) {
+            for (int i = 0; i < damage.count; i++) {
+                const DamageRect *rect = &damage.rects[i];
+                int x1 = rect->x + rect->width;
+                int y1 = rect->y + rect->height;
+                glBlitFramebuffer(rect->x, rect->y, x1, y1, rect->x, rect->y, x1, y1,
+                                  GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            }
+            pixels_presented = (uint64_t)damage_area(&damage);
+        }
+        glEndQuery(GL_TIME_ELAPSED);
+
+        presented_width = key.width;
+        presented_height = key.height;
+
+        SwapBuffers(hdc);
+        gl_capture_frame(key.width, key.height);
+
+#ifdef NO_VSYNC
+        Sleep(1);
+#endif
+
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        if (fence) {
+            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000);
+            glDeleteSync(fence);
+        }
+
+        if (!presented) {
+            presented = true;
+            startup_phase_end(first_frame_phase);
+            report_startup(window->hwnd);
+        }
+
+        stats.gl_calls_issued += gl_state_counters.issued;
+        stats.gl_calls_elided += gl_state_counters.elided;
+        stats.pixels_presented += pixels_presented;
+        stats.pixels_presented_full += (uint64_t)key.width * key.height;
+
+        // The fence above has already waited for the GPU, so these don't stall
+        GLuint64 gpu_ns = 0;
+        glGetQueryObjectui64v(gpu_timer_query, GL_QUERY_RESULT, &gpu_ns);
+        if (reuse_frame) {
+            stats.frames_reused++;
+            stats.gpu_ns_reused += gpu_ns;
+        } else {
+            GLuint64 scene_ns = 0;
+            glGetQueryObjectui64v(scene_timer_query, GL_QUERY_RESULT, &scene_ns);
+            stats.frames_rendered++;
+            stats.gpu_ns_rendered += gpu_ns + scene_ns;
+            stats.pixels_shaded += (uint64_t)damage_area(&damage);
+            stats.pixels_shaded_full += (uint64_t)scene_width * scene_height;
+
+            // The controller works in full-frame cost, and a partial redraw
+            // only shades the damage, so scale its time up by the area
+            int64_t shaded_area = damage_area(&damage);
+            if ((animating || interactive) && shaded_area > 0) {
+                double full_ns = (double)scene_ns * ((double)scene_width * scene_height / (double)shaded_area);
+                resolution_controller_update(&controller, (float)(full_ns / 1e6), interactive);
+            }
+
+#ifdef BENCH_BATCH
+            if (animating && batch_ready) {
+                record_batch_benchmark(&bench, &batch, get_perf_count() - frame_start_count,
+                                       bench_upload_counts, scene_ns);
+            }
+#endif
+#ifdef BENCH_VERTEX
+            if (animating) record_vertex_benchmark(&vertex_bench, scene_ns);
+#endif
+#ifdef BENCH_ARENA
+            if (animating) record_arena_benchmark(&arena_bench, scene_ns);
+#endif
+#ifdef BENCH_TEXTURE
+            if (animating) record_texture_benchmark(&texture_bench);
+#endif
+#ifdef BENCH_COMMANDS
+            if (animating) record_command_benchmark(&command_bench);
+#endif
+        }
+
+        advance_animation(&time, &start_time, sleep_time, animating);
+
+        double now = get_time_now();
+        if (now - last_report_time >= 1.0) {
+            report_frame_stats(&stats, &controller);
+            report_resize_latency(window);
+            last_report_time = now;
+        }
+
+        WakeConditionVariable(&window->cond_var);
+    }
+
+    report_frame_stats(&stats, &controller);
+    report_resize_latency(window);
+
+    char buf[128];
+    sprintf_s(buf, sizeof(buf), "GL entry points resolved on first call: %d\n", gladGetLazyResolveCount());
+    OutputDebugStringA(buf);
+
+    if (batch_ready) batch_destroy(&batch);
+#ifdef BENCH_VERTEX
+    release_bench_mesh(&vertex_bench);
+#endif
+#ifdef BENCH_ARENA
+    release_arena_benchmark(&arena_bench);
+#endif
+#ifdef BENCH_TEXTURE
+    stop_texture_benchmark(&texture_bench);
+#endif
+#ifdef BENCH_COMMANDS
+    stop_command_benchmark(&command_bench);
+#endif
+    frame_graph_destroy(&frame_graph);
+
+    glDeleteQueries(1, &gpu_timer_query);
+    glDeleteQueries(1, &scene_timer_query);
+    destroy_frame_cache();
+
+    ReleaseDC(window->hwnd, hdc);
+    OutputDebugStringA("RenderThread exiting\n");
+
+    window_render_stopped(window);
+
+    return 0;
+}
+
+// --------------------------------------------------
+// ----- Software renderer
+// --------------------------------------------------
+// Draws the scene of render_thread_func on the CPU and presents it through
+// GDI, for machines without a usable GL driver. It keeps the same handshake
+// with WindowProc: a WM_PAINT returns once a frame at the new size is on the
+// screen.
+
+#ifdef BENCH_RASTER
+#define RASTER_BENCH_FRAMES 120
+#define RASTER_BENCH_LAYERS 16
+
+typedef struct {
+    int step; // Past the last configuration, the benchmark is done
+    int frames;
+    int64_t raster_counts;
+    int64_t pixels;
+    double one_thread_mpixels; // What the scaling is measured against
+} RasterBenchmark;
+
+// Thread counts double up to every thread at the best SIMD level, then the
+// lower levels run on every thread
+bool raster_bench_config(const Rasterizer *raster, int step, int *threads, RasterSimd *simd) {
+    RasterSimd best = raster_best_simd();
+    for (int count = 1;; count = count * 2 < raster->thread_count ? count * 2 : raster->thread_count) {
+        if (step-- == 0) {
+            *threads = count;
+            *simd = best;
+            return true;
+        }
+        if (count == raster->thread_count) break;
+    }
+    for (int level = (int)best - 1; level >= 0; level--) {
+        if (step-- == 0) {
+            *threads = raster->thread_count;
+            *simd = (RasterSimd)level;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Rotated copies of the quad over the scene, so there is more to shade than the clear
+void draw_raster_bench_layers(Rasterizer *raster, int width, int height, float time) {
+    for (int i = 0; i < RASTER_BENCH_LAYERS; i++) {
+        float angle = time + (float)i * pi / RASTER_BENCH_LAYERS;
+        float size = 1.5f - (float)i / RASTER_BENCH_LAYERS;
+        RasterVertex layer[4];
+        for (int v = 0; v < 4; v++) {
+            float x = vertices[v * 6] * size;
+            float y = vertices[v * 6 + 1] * size;
+            layer[v].x = (x * cosf(angle) - y * sinf(angle)) * 0.5f * (float)height + 0.5f * (float)width;
+            layer[v].y = (x * sinf(angle) + y * cosf(angle) + 1.0f) * 0.5f * (float)height;
+            for (int c = 0; c < 3; c++) layer[v].color[c] = vertices[v * 6 + 3 + c];
+        }
+        raster_triangles(raster, layer, indices, 6);
+    }
+}
+
+// Sets up the configuration the current step measures; outside the
+// benchmark, every thread runs at the best SIMD level
+void configure_raster_benchmark(const RasterBenchmark *bench, Rasterizer *raster, bool animating) {
+    int threads = raster->thread_count;
+    RasterSimd simd = raster_best_simd();
+    if (animating) raster_bench_config(raster, bench->step, &threads, &simd);
+    raster_set_active_threads(raster, threads);
+    raster_set_simd(raster, simd);
+}
+
+// Reports each configuration once it has run its frames
+void record_raster_benchmark(RasterBenchmark *bench, Rasterizer *raster, int64_t raster_counts) {
+    int threads;
+    RasterSimd simd;
+    if (!raster_bench_config(raster, bench->step, &threads, &simd)) return;
+
+    bench->frames++;
+    bench->raster_counts += raster_counts;
+    bench->pixels += raster->pixels_written;
+    if (bench->frames < RASTER_BENCH_FRAMES) return;
+
+    double seconds = time_duration_seconds(0, bench->raster_counts);
+    double mpixels = (double)bench->pixels / seconds / 1e6;
+    if (bench->step == 0) bench->one_thread_mpixels = mpixels;
+
+    char buf[256];
+    sprintf_s(buf, sizeof(buf),
+              "Raster bench (%s, %d of %d threads): %.3f ms/frame, %.1f Mpixels/s, %.2fx one thread\n",
+              raster_simd_name(raster->simd), raster->active_count, raster->thread_count,
+              1000.0 * seconds / bench->frames, mpixels, mpixels / bench->one_thread_mpixels);
+    OutputDebugStringA(buf);
+
+    bench->step++;
+    bench->frames = 0;
+    bench->raster_counts = 0;
+    bench->pixels = 0;
+}
+#endif
+
+// The quad in window pixels, where the scene's vertex shader and the GL
+// viewport put it
+void place_raster_quad(RasterVertex quad_vertices[4], int width, int height, float modifier) {
+    for (int v = 0; v < 4; v++) {
+        quad_vertices[v].x = (vertices[v * 6] * modifier + 1.0f) * 0.5f * (float)width;
+        quad_vertices[v].y = (vertices[v * 6 + 1] * modifier + 1.0f) * 0.5f * (float)height;
+        for (int c = 0; c < 3; c++) quad_vertices[v].color[c] = vertices[v * 6 + 3 + c];
+    }
+}
+
+void report_software_stats(const FrameStats *stats, int64_t raster_counts, int64_t pixels_written) {
+    double seconds = time_duration_seconds(0, raster_counts);
+    char buf[256];
+    sprintf_s(buf, sizeof(buf), "Frames rendered: %llu (avg CPU %.2f ms, %.1f Mpixels/s) | reused: %llu\n",
+              (unsigned long long)stats->frames_rendered,
+              stats->frames_rendered ? 1000.0 * seconds / (double)stats->frames_rendered : 0.0,
+              seconds > 0.0 ? (double)pixels_written / seconds / 1e6 : 0.0,
+              (unsigned long long)stats->frames_reused);
+    OutputDebugStringA(buf);
+}
+
+DWORD software_render_thread_func(LPVOID lParam) {
+    WindowData* window = (WindowData*)lParam;
+
+    int first_frame_phase = startup_phase_begin("first frame");
+    bool presented = false;
+
+    HDC hdc = GetDC(window->hwnd);
+
+    Rasterizer raster;
+    raster_init(&raster, 0);
+
+    char buf[128];
+    sprintf_s(buf, sizeof(buf), "Software renderer: %d threads, %s\n", raster.thread_count,
+              raster_simd_name(raster.simd));
+    OutputDebugStringA(buf);
+
+    // A top-down DIB, so rows are in the order the rasterizer writes them
+    uint32_t *pixels = NULL;
+    BITMAPINFO bitmap = {};
+    bitmap.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bitmap.bmiHeader.biPlanes = 1;
+    bitmap.bmiHeader.biBitCount = 32;
+    bitmap.bmiHeader.biCompression = BI_RGB;
+
+    float time = 0.0f;
+    float start_time = time;
+    bool animating = false;
+    float modifier = 1.0f;
+
+    FrameKey cached_key = {};
+    bool cache_valid = false;
+    FrameStats stats = {};
+    int64_t raster_counts = 0;
+    int64_t pixels_written = 0;
+    double last_report_time = 0.0;
+
+#ifdef BENCH_RASTER
+    // Runs while animating; press space to start it
+    RasterBenchmark bench = {};
+#endif
+
+    // While the main thread hasn't signaled to stop
+    while (true) {
+        float sleep_time = 0;
+        uint32_t flags = take_window_flags(window, !animating, INFINITE, &sleep_time);
+
+        if (flags & EVENT_TERMINATE) break;
+
+        RECT rect;
+        GetClientRect(window->hwnd, &rect);
+
+        if (flags & EVENT_TOGGLEANIMATION) animating = !animating;
+
+        if (animating) {
+            modifier = quad_modifier(time);
+        }
+
+        FrameKey key = {};
+        key.width = rect.right;
+        key.height = rect.bottom;
+        key.time = time;
+        key.modifier = modifier;
+        key.scale = 1.0f;
+
+        bool reuse_frame = cache_valid && frame_key_equal(&key, &cached_key);
+        if (key.width <= 0 || key.height <= 0) reuse_frame = true; // Minimized: nothing to draw into
+
+        bool dropped = false; // No buffer to draw into
+        if (!reuse_frame && (!cache_valid || key.width != cached_key.width || key.height != cached_key.height)) {
+            free(pixels);
+            pixels = (uint32_t*)malloc((size_t)key.width * key.height * sizeof(uint32_t));
+            bitmap.bmiHeader.biWidth = key.width;
+            bitmap.bmiHeader.biHeight = -key.height;
+            cache_valid = false;
+
+            // Present nothing rather than stall the paint; the next frame tries again
+            if (!pixels) {
+                char buf[96];
+                sprintf_s(buf, sizeof(buf), "Software renderer: can't allocate a %dx%d frame\n", key.width, key.height);
+                OutputDebugStringA(buf);
+                dropped = true;
+            }
+        }
+
+        if (!reuse_frame && !dropped) {
+            float back_color = background_color(time);
+            float clear[3] = { back_color, back_color, back_color };
+            RasterVertex quad_vertices[4];
+            place_raster_quad(quad_vertices, key.width, key.height, modifier);
+
+#ifdef BENCH_RASTER
+            configure_raster_benchmark(&bench, &raster, animating);
+#endif
+            int64_t raster_start_count = get_perf_count();
+            raster_begin(&raster, pixels, key.width, key.height, key.width, clear);
+            raster_triangles(&raster, quad_vertices, indices, sizeof(indices) / sizeof(indices[0]));
+#ifdef BENCH_RASTER
+            if (animating) draw_raster_bench_layers(&raster, key.width, key.height, time);
+#endif
+            bool drawn = raster_end(&raster);
+            int64_t frame_raster_counts = get_perf_count() - raster_start_count;
+
+            if (drawn) {
+                stats.frames_rendered++;
+                raster_counts += frame_raster_counts;
+                pixels_written += raster.pixels_written;
+#ifdef BENCH_RASTER
+                if (animating) record_raster_benchmark(&bench, &raster, frame_raster_counts);
+#endif
+
+                cached_key = key;
+                cache_valid = true;
+            } else {
+                // The pixels were left alone, so the cached frame is still shown
+                OutputDebugStringA("Software renderer: out of memory, frame dropped\n");
+            }
+        } else if (reuse_frame) {
+            stats.frames_reused++;
+        }
+
+        // GDI keeps nothing between presents worth reusing, so every frame is copied whole
+        if (cache_valid) {
+            SetDIBitsToDevice(hdc, 0, 0, cached_key.width, cached_key.height, 0, 0, 0, cached_key.height, pixels,
+                              &bitmap, DIB_RGB_COLORS);
+            GdiFlush();
+        }
+
+        if (!presented && cache_valid) {
+            presented = true;
+            startup_phase_end(first_frame_phase);
+            report_startup(window->hwnd);
+        }
+
+        advance_animation(&time, &start_time, sleep_time, animating);
+
+        double now = get_time_now();
+        if (now - last_report_time >= 1.0) {
+            report_software_stats(&stats, raster_counts, pixels_written);
+            report_resize_latency(window);
+            last_report_time = now;
+        }
+
+        WakeConditionVariable(&window->cond_var);
+    }
 
-// --------------------------------------------------
-// ----- CONSTANTS
-const float pi = 3.14159265358979f;
-const int window_width = 800;
-const int window_height = 600;
+    report_software_stats(&stats, raster_counts, pixels_written);
+    report_resize_latency(window);
 
-// --------------------------------------------------
-// ----- GLOBALS
-// Used for timing
-static int64_t perf_freq;
-static int64_t initial_perf_count;
+    raster_destroy(&raster);
+    free(pixels);
 
-static HGLRC render_context;
-static GLuint vao;
-static GLuint shader_program;
+    ReleaseDC(window->hwnd, hdc);
+    OutputDebugStringA("RenderThread exiting\n");
 
-// --------------------------------------------------
-// ----- HELPERS
-int64_t get_perf_count() {
-    LARGE_INTEGER count;
-    QueryPerformanceCounter(&count);
-    return (int64_t)count.QuadPart;
-}
+    window_render_stopped(window);
 
-void timer_init() {
-    LARGE_INTEGER freq;
-    QueryPerformanceFrequency(&freq);
-    perf_freq =  freq.QuadPart;
-    initial_perf_count = get_perf_count();
+    return 0;
 }
 
-double time_duration_seconds(int64_t start_count, int64_t end_count) {
-    return (double)(end_count - start_count) / (double)perf_freq;
+#ifdef VULKAN_RENDERER
+// --------------------------------------------------
+// ----- Vulkan renderer
+// --------------------------------------------------
+VkResult create_win32_surface(VkInstance instance, PFN_vkGetInstanceProcAddr get_proc, void *user,
+                              VkSurfaceKHR *surface) {
+    PFN_vkCreateWin32SurfaceKHR create =
+        (PFN_vkCreateWin32SurfaceKHR)get_proc(instance, "vkCreateWin32SurfaceKHR");
+    if (!create) return VK_ERROR_EXTENSION_NOT_PRESENT;
+
+    VkWin32SurfaceCreateInfoKHR info = {};
+    info.sType = VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR;
+    info.hinstance = GetModuleHandle(NULL);
+    info.hwnd = (HWND)user;
+    return create(instance, &info, NULL, surface);
 }
 
-double get_time_now() {
-    int64_t count_now = get_perf_count();
-    return time_duration_seconds(initial_perf_count, count_now);
+void report_vulkan_stats(const VulkanRenderer *vk, uint64_t frames_presented, uint64_t frames_skipped,
+                         int64_t draw_counts) {
+    char buf[256];
+    sprintf_s(buf, sizeof(buf),
+              "Frames rendered: %llu (avg CPU %.2f ms) | skipped: %llu | swap chains: %llu, out of date: %llu, "
+              "suboptimal: %llu\n",
+              (unsigned long long)frames_presented,
+              frames_presented ? 1000.0 * time_duration_seconds(0, draw_counts) / (double)frames_presented : 0.0,
+              (unsigned long long)frames_skipped, (unsigned long long)vk->swapchains_created,
+              (unsigned long long)vk->out_of_date, (unsigned long long)vk->suboptimal);
+    OutputDebugStringA(buf);
 }
 
-bool is_key_repeating(LPARAM lParam) {
-    return (lParam & (1 << 30)) >> 30;
-}
-// --------------------------------------------------
+// Same frames and handshake as render_thread_func, with the swap chain in our
+// hands: it is recreated before the frame whenever the client area changed.
+// Falls back to the software renderer when there is no usable Vulkan driver.
+DWORD vulkan_render_thread_func(LPVOID lParam) {
+    WindowData* window = (WindowData*)lParam;
 
-enum EventFlags {
-    EVENT_TERMINATE       = 1 << 0,
-    EVENT_SIZECHANGED     = 1 << 1,
-    EVENT_TOGGLEANIMATION = 1 << 2,
-};
+    int first_frame_phase = startup_phase_begin("first frame");
+    bool presented = false;
 
-typedef struct {
-    HWND hwnd;
-    CRITICAL_SECTION crit_sect;
-    CONDITION_VARIABLE cond_var;
-    int width;
-    int height;
-    int new_width;
-    int new_height;
-    uint32_t flags;
-} WindowData;
+    HMODULE library = LoadLibraryA("vulkan-1.dll");
+    PFN_vkGetInstanceProcAddr get_proc =
+        library ? (PFN_vkGetInstanceProcAddr)(void*)GetProcAddress(library, "vkGetInstanceProcAddr") : NULL;
 
-DWORD render_thread_func(LPVOID lParam) {
-    WindowData* window = (WindowData*)lParam;
-    GLsync fence;
+    VulkanRendererDesc desc = {};
+    desc.get_proc = get_proc;
+    desc.surface_extension = VK_KHR_WIN32_SURFACE_EXTENSION_NAME;
+    desc.create_surface = create_win32_surface;
+    desc.surface_user = window->hwnd;
+#ifdef NO_VSYNC
+    desc.present_mode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+#elif defined(ADAPTIVE_VSYNC)
+    desc.present_mode = VK_PRESENT_MODE_FIFO_RELAXED_KHR; // A late frame tears instead of waiting for the next vblank
+#else
+    desc.present_mode = VK_PRESENT_MODE_FIFO_KHR;
+#endif
+    desc.vertices = vertices;
+    desc.vertex_count = (int)(sizeof(vertices) / sizeof(vertices[0]) / 6);
+    desc.indices = indices;
+    desc.index_count = (int)(sizeof(indices) / sizeof(indices[0]));
+
+    VulkanRenderer vk;
+    if (!get_proc || !vulkan_renderer_init(&vk, &desc)) {
+        OutputDebugStringA(get_proc ? vk.error : "Could not load vulkan-1.dll\n");
+        OutputDebugStringA("Falling back to the software renderer\n");
+        if (library) FreeLibrary(library);
+        startup_phase_end(first_frame_phase);
+        return software_render_thread_func(lParam);
+    }
 
-    HDC hdc = GetDC(window->hwnd);
-    wglMakeCurrent(hdc, render_context);
+    char buf[384];
+    sprintf_s(buf, sizeof(buf), "Vulkan renderer: %s, present mode %s\n", vk.device_name,
+              vulkan_present_mode_name(vk.present_mode));
+    OutputDebugStringA(buf);
 
     float time = 0.0f;
     float start_time = time;
     bool animating = false;
+    float modifier = 1.0f;
+
+    uint64_t frames_presented = 0;
+    uint64_t frames_skipped = 0;
+    int64_t draw_counts = 0;
+    double last_report_time = 0.0;
 
     // While the main thread hasn't signaled to stop
     while (true) {
-        EnterCriticalSection(&window->crit_sect);
-
         float sleep_time = 0;
-
-        if (!animating && !window->flags) {
-            float before_sleep_time = (float)get_time_now();
-            SleepConditionVariableCS(&window->cond_var, &window->crit_sect, INFINITE);
-            float end_sleep_time = (float)get_time_now();
-            sleep_time = end_sleep_time - before_sleep_time;
-        }
-
-        uint64_t flags = window->flags; // Cache this frame's flags
-        window->flags = 0;              // Reset next frame's flags
-
-        LeaveCriticalSection(&window->crit_sect);
+        uint32_t flags = take_window_flags(window, !animating, INFINITE, &sleep_time);
 
         if (flags & EVENT_TERMINATE) break;
 
-        if (flags & EVENT_SIZECHANGED) {
-            RECT rect;
-            GetClientRect(window->hwnd, &rect);
-            glViewport(0, 0, rect.right, rect.bottom);
-        }
+        RECT rect;
+        GetClientRect(window->hwnd, &rect);
 
         if (flags & EVENT_TOGGLEANIMATION) animating = !animating;
 
-        glBindVertexArray(vao);
-        glUseProgram(shader_program);
-
         if (animating) {
-            GLint modifier_uniform = glGetUniformLocation(shader_program, "modifier");
-            glUniform1f(modifier_uniform, 0.25f * sinf(4.0f * (time + pi / 8.0f)) + 0.75f);
+            modifier = quad_modifier(time);
         }
 
-        float back_color = 1 - (0.5f * sinf(2.0f * time + pi / 2.0f) + 0.5f);
-        glClearColor(back_color, back_color, back_color, 1.0f);
-
-        glClear(GL_COLOR_BUFFER_BIT);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-        glUseProgram(0);
-        glBindVertexArray(0);
+        VulkanFrame frame = {};
+        frame.width = rect.right;
+        frame.height = rect.bottom;
+        frame.background = background_color(time);
+        frame.modifier = modifier;
+
+        int64_t draw_start_count = get_perf_count();
+        VulkanFrameResult result = vulkan_renderer_draw(&vk, &frame);
+        if (result == VULKAN_FRAME_FAILED) {
+            OutputDebugStringA(vk.error);
+            break;
+        }
 
-        SwapBuffers(hdc);
+        // WindowProc is waiting for the frame to be finished, not just queued;
+        // otherwise frames stay in flight
+        if (flags & EVENT_PAINT) vulkan_renderer_finish(&vk);
 
-#ifdef NO_VSYNC
-        Sleep(1);
-#endif
+        if (result == VULKAN_FRAME_PRESENTED) {
+            frames_presented++;
+            draw_counts += get_perf_count() - draw_start_count;
+        } else {
+            frames_skipped++;
+        }
 
-        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-        if (fence) {
-            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000);
-            glDeleteSync(fence);
+        if (!presented && result == VULKAN_FRAME_PRESENTED) {
+            presented = true;
+            startup_phase_end(first_frame_phase);
+            report_startup(window->hwnd);
         }
 
-        float end_time = (float)get_time_now();
-        if (animating) {
-            time += end_time - start_time - sleep_time;
-            if (time > 2 * pi) {
-                time -= (2 *pi);
-            }
+        advance_animation(&time, &start_time, sleep_time, animating);
+
+        double now = get_time_now();
+        if (now - last_report_time >= 1.0) {
+            report_vulkan_stats(&vk, frames_presented, frames_skipped, draw_counts);
+            report_resize_latency(window);
+            last_report_time = now;
         }
-        start_time = end_time;
 
         WakeConditionVariable(&window->cond_var);
     }
 
-    ReleaseDC(window->hwnd, hdc);
+    report_vulkan_stats(&vk, frames_presented, frames_skipped, draw_counts);
+    report_resize_latency(window);
+
+    vulkan_renderer_destroy(&vk);
+    FreeLibrary(library);
+
     OutputDebugStringA("RenderThread exiting\n");
 
-    WakeConditionVariable(&window->cond_var);
+    window_render_stopped(window);
 
     return 0;
 }
+#endif
 
 LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
     WindowData *window = (WindowData*)GetWindowLongPtrW(hwnd, GWLP_USERDATA);
@@ -234,20 +3087,40 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 
         EnterCriticalSection(&window->crit_sect);
 
-        if ((window->width != window->new_width) | (window->height != window->new_height)) {
+        bool resized = (window->width != window->new_width) | (window->height != window->new_height);
+        if (resized) {
             window->new_width = window->width;
             window->new_height = window->height;
             window->flags |= EVENT_SIZECHANGED;
         }
+        window->flags |= EVENT_PAINT;
 
-        WakeConditionVariable(&window->cond_var);
-        SleepConditionVariableCS(&window->cond_var, &window->crit_sect, INFINITE);
+        int64_t wait_start_count = get_perf_count();
+        if (!window->render_stopped) {
+            WakeConditionVariable(&window->cond_var);
+            SleepConditionVariableCS(&window->cond_var, &window->crit_sect, INFINITE);
+        }
+        if (resized && !window->render_stopped) {
+            double waited = time_duration_seconds(wait_start_count, get_perf_count());
+            window->resize_count++;
+            window->resize_seconds += waited;
+            if (waited > window->resize_max_seconds) window->resize_max_seconds = waited;
+        }
         LeaveCriticalSection(&window->crit_sect);
 
         EndPaint(hwnd, NULL);
         return 0;
     }
 
+    case WM_ENTERSIZEMOVE:
+    case WM_EXITSIZEMOVE: {
+        EnterCriticalSection(&window->crit_sect);
+        window->flags |= (uMsg == WM_ENTERSIZEMOVE) ? EVENT_ENTERSIZEMOVE : EVENT_EXITSIZEMOVE;
+        WakeConditionVariable(&window->cond_var);
+        LeaveCriticalSection(&window->crit_sect);
+        return 0;
+    }
+
     case WM_SIZE: {
         window->width = LOWORD(lParam);
         window->height = HIWORD(lParam);
@@ -259,17 +3132,112 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
     }
 }
 
+// Hands the window to a render thread and runs the message loop until the
+// window is closed and the render thread has stopped
+int run_window(HWND hwnd, LPTHREAD_START_ROUTINE render_func) {
+    WindowData *window = (WindowData*)malloc(sizeof(WindowData));
+    memset(window, 0, sizeof(*window));
+    window->hwnd = hwnd;
+    InitializeCriticalSection(&window->crit_sect);
+    InitializeConditionVariable(&window->cond_var);
+    window->flags = 0;
+
+    SetWindowLongPtrW(hwnd, GWLP_USERDATA, (LONG_PTR)window); // Attach data to window
+    SetWindowLongPtrW(hwnd, GWLP_WNDPROC, (LONG_PTR)WindowProc); // Attach window procedure
+
+    HANDLE thread = CreateThread(NULL, 0, render_func, window, 0, NULL);
+
+    UpdateWindow(hwnd);
+    ShowWindow(hwnd, SW_SHOW);
+
+    // Enter main program loop
+    bool should_quit = false;
+    while (!should_quit) {
+        // Drain the message queue first
+        MSG msg;
+        while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
+            switch (msg.message) {
+            case WM_QUIT:
+                should_quit = true;
+            case WM_KEYDOWN:
+                if (msg.wParam == VK_ESCAPE)
+                    PostMessage(hwnd, WM_CLOSE, 0, 0);
+                else if (msg.wParam == VK_SPACE && !is_key_repeating(msg.lParam)) {
+                    EnterCriticalSection(&window->crit_sect);
+                    window->flags |= EVENT_TOGGLEANIMATION;
+                    WakeConditionVariable(&window->cond_var);
+                    LeaveCriticalSection(&window->crit_sect);
+                }
+            }
+            TranslateMessage(&msg);
+            DispatchMessage(&msg);
+        }
+
+        if (!should_quit)
+            WaitMessage();
+    }
+
+    // Stop and wait on render thread before exiting
+    WaitForSingleObject(thread, INFINITE);
+
+    return 0;
+}
+
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdLine, int nShowCmd) {
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
     UNREFERENCED_PARAMETER(nShowCmd);
 
     SetProcessDPIAware();
     timer_init();
 
+    // Relaunch this executable repeatedly and time each launch to its first present
+    const wchar_t *bench_arg = wcsstr(lpCmdLine, L"--startup-bench");
+    if (bench_arg) {
+        int launches = 100;
+        swscanf_s(bench_arg, L"--startup-bench %d", &launches);
+        return run_startup_benchmark(launches > 0 ? launches : 1, wcsstr(lpCmdLine, L"--purge-shader-cache") != NULL);
+    }
+
+    const wchar_t *child_arg = wcsstr(lpCmdLine, L"--startup-child");
+    if (child_arg) {
+        unsigned long long present_event = 0;
+        swscanf_s(child_arg, L"--startup-child %llu", &present_event);
+        startup_present_event = (HANDLE)(uintptr_t)present_event;
+    }
+
+    // Record every GL call into a trace for the replayer
+    char capture_path[MAX_PATH] = {};
+    const wchar_t *capture_arg = wcsstr(lpCmdLine, L"--capture ");
+    if (capture_arg) {
+        wchar_t path[MAX_PATH] = {};
+        swscanf_s(capture_arg, L"--capture %259ls", path, (unsigned)MAX_PATH);
+        WideCharToMultiByte(CP_ACP, 0, path, -1, capture_path, MAX_PATH, NULL, NULL);
+    }
+
+    // Draw on the CPU instead, without loading GL at all
+    bool software = wcsstr(lpCmdLine, L"--renderer software") != NULL;
+#ifdef VULKAN_RENDERER
+    bool vulkan = wcsstr(lpCmdLine, L"--renderer vulkan") != NULL;
+#else
+    bool vulkan = false;
+#endif
+
+    // Loading the driver doesn't need the real window, so it overlaps with creating it
+    GLBootstrap bootstrap = {};
+    bootstrap.instance = hInstance;
+    HANDLE bootstrap_thread = NULL;
+    if (!software && !vulkan) {
+        bootstrap_thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)gl_bootstrap_thread_func, &bootstrap, 0, NULL);
+        if (!bootstrap_thread) {
+            OutputDebugString(L"Could not start GL bootstrap thread\n");
+            return 1;
+        }
+    }
+
     // --------------------------------------------------
     // ----- Create the window
     // --------------------------------------------------
+    int phase = startup_phase_begin("create window");
     WNDCLASSEX wind_class = {};
     wind_class.cbSize = sizeof(WNDCLASSEX);
     wind_class.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC; // The first two flags together say: "WM_SIZE should trigger WM_PAINT"
@@ -300,41 +3268,28 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdLin
         OutputDebugString(L"Could not create Window\n");
         return 1;
     }
+    startup_phase_end(phase);
+
+    if (software) return run_window(hwnd, (LPTHREAD_START_ROUTINE)software_render_thread_func);
+#ifdef VULKAN_RENDERER
+    if (vulkan) return run_window(hwnd, (LPTHREAD_START_ROUTINE)vulkan_render_thread_func);
+#endif
 
     // --------------------------------------------------
     // ----- Set up OpenGL
     // --------------------------------------------------
-    PIXELFORMATDESCRIPTOR pfd = {};
-    pfd.nSize = sizeof(PIXELFORMATDESCRIPTOR);
-    pfd.nVersion = 1;
-    pfd.dwFlags = PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER;
-    pfd.iPixelType = PFD_TYPE_RGBA;
-    pfd.cColorBits = 32;
-    pfd.cDepthBits = 24;
-    pfd.cStencilBits = 8;
-    pfd.iLayerType = PFD_MAIN_PLANE;
-
-    HDC hdc = GetDC(hwnd);
-
-    int pf = ChoosePixelFormat(hdc, &pfd);
-    if (!pf) {
-        OutputDebugString(L"Could not find pixel format\n");
-        return 1;
-    }
-    SetPixelFormat(hdc, pf, &pfd);
+    phase = startup_phase_begin("wait for GL bootstrap");
+    WaitForSingleObject(bootstrap_thread, INFINITE);
+    CloseHandle(bootstrap_thread);
+    startup_phase_end(phase);
 
-    HGLRC dummy_context = wglCreateContext(hdc);
-    wglMakeCurrent(hdc, dummy_context);
-
-    if (!gladLoadGL()) {
+    if (!bootstrap.loaded) {
         OutputDebugString(L"Could not load OpenGL functions\n");
         return 1;
     }
 
-    if (!gladLoadWGL(hdc)) {
-        OutputDebugString(L"Could not load WGL functions\n");
-        return 1;
-    }
+    phase = startup_phase_begin("create context");
+    HDC hdc = GetDC(hwnd);
 
     int pf_attribs[] = {
       WGL_DRAW_TO_WINDOW_ARB, 1,
@@ -344,13 +3299,36 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdLin
       WGL_COLOR_BITS_ARB, 32,
       WGL_DEPTH_BITS_ARB, 24,
       WGL_STENCIL_BITS_ARB, 8,
+      WGL_SWAP_METHOD_ARB, WGL_SWAP_COPY_ARB, // Keep the backbuffer for partial presents
       0
     };
 
     UINT num_formats = 0;
-    pf = 0;
-    // Just get one pixel format
+    int pf = 0;
+    // Just get one pixel format, without the swap method if no format copies
     wglChoosePixelFormatARB(hdc, pf_attribs, 0, 1, &pf, &num_formats);
+    if (!num_formats) {
+        pf_attribs[14] = 0; // Ends the list at the swap method
+        wglChoosePixelFormatARB(hdc, pf_attribs, 0, 1, &pf, &num_formats);
+    }
+
+    PIXELFORMATDESCRIPTOR pfd;
+    if (num_formats) {
+        DescribePixelFormat(hdc, pf, sizeof(pfd), &pfd);
+
+        int swap_method_attrib = WGL_SWAP_METHOD_ARB;
+        int swap_method = 0;
+        wglGetPixelFormatAttribivARB(hdc, pf, 0, 1, &swap_method_attrib, &swap_method);
+        present_preserved = swap_method == WGL_SWAP_COPY_ARB;
+    } else {
+        default_pixel_format(&pfd);
+        pf = ChoosePixelFormat(hdc, &pfd);
+    }
+
+    if (!pf || !SetPixelFormat(hdc, pf, &pfd)) {
+        OutputDebugString(L"Could not find pixel format\n");
+        return 1;
+    }
 
     int context_attribs[] = {
         WGL_CONTEXT_MAJOR_VERSION_ARB, 3,
@@ -358,143 +3336,132 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdLin
         0,
     };
 
-    // Set global real context
-    render_context = wglCreateContextAttribsARB(hdc, dummy_context, context_attribs);
-    wglMakeCurrent(hdc, 0);
-    wglDeleteContext(dummy_context);
+    // Set global real context. The entry points loaded on the bootstrap
+    // thread are valid here too, since both contexts come from the same driver.
+    render_context = wglCreateContextAttribsARB(hdc, NULL, context_attribs);
+    if (!render_context) {
+        OutputDebugString(L"Could not create OpenGL context\n");
+        return 1;
+    }
     wglMakeCurrent(hdc, render_context);
+    program_cache_set_context(&program_cache);
+    gl_caps_detect(wcsstr(lpCmdLine, L"--gl-tier 3.3") || capture_path[0] ? GL_TIER_33 : GL_TIER_45);
+    if (capture_path[0]) {
+        // Persistent maps are written without a GL call and program binaries
+        // only load on the driver that made them, so neither can be traced
+        program_cache.enabled = false;
+        if (gl_capture_start(capture_path)) gl_capture_attach(&glad_gl_default_context);
+        else OutputDebugString(L"Could not open the capture file\n");
+    }
 
 #ifdef NO_VSYNC
     wglSwapIntervalEXT(0);
+#elif defined(ADAPTIVE_VSYNC)
+    // A late frame tears instead of waiting for the next vblank
+    wglSwapIntervalEXT(gladHasWGLExtension("WGL_EXT_swap_control_tear") ? -1 : 1);
 #else
     wglSwapIntervalEXT(1);
 #endif
+    startup_phase_end(phase);
 
     // --------------------------------------------------
     // ----- Compile shaders and create shader program
     // --------------------------------------------------
-    GLuint vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertex_shader, 1, &vertex_shader_source, NULL);
-    glCompileShader(vertex_shader);
-
-    int success;
-    char info_log[512];
-    char err_buf[512];
-    glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertex_shader, sizeof(info_log), NULL, info_log);
-        sprintf_s(err_buf, sizeof(err_buf), "Vertex shader compilation failed\n%s\n", info_log);
-        OutputDebugStringA(err_buf);
-    }
-
-    GLuint fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragment_shader, 1, &fragment_shader_source, NULL);
-    glCompileShader(fragment_shader);
-
-    glGetShaderiv(fragment_shader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertex_shader, sizeof(info_log), NULL, info_log);
-        sprintf_s(err_buf, sizeof(err_buf), "Fragment shader compilation failed\n%s\n", info_log);
-        OutputDebugStringA(err_buf);
-    }
-
-    shader_program = glCreateProgram();
-    glAttachShader(shader_program, vertex_shader);
-    glAttachShader(shader_program, fragment_shader);
-    glLinkProgram(shader_program);
-
-    glGetProgramiv(shader_program, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shader_program, sizeof(info_log), NULL, info_log);
-        sprintf_s(err_buf, sizeof(err_buf), "Shader program linking failed\n%s\n", info_log);
-        OutputDebugStringA(err_buf);
-    }
-    glDeleteShader(vertex_shader);
-    glDeleteShader(fragment_shader);
+    // The real programs are compiled on a worker thread with a shared context;
+    // only the tiny fallback is compiled before the window is shown
+    phase = startup_phase_begin("fallback program");
+    fallback_program = compile_program(&program_cache, fallback_vertex_shader_source, fallback_fragment_shader_source);
+    startup_phase_end(phase);
+
+    phase = startup_phase_begin("start shader compiler");
+    compile_context = wglCreateContextAttribsARB(hdc, render_context, context_attribs);
+    if (!compile_context || !shader_compiler_start(&shader_compiler, hdc, compile_context, &program_cache)) {
+        OutputDebugString(L"Could not start shader compiler thread\n");
+        return 1;
+    }
+    scene_program_job = shader_compiler_submit(&shader_compiler, vertex_shader_source, fragment_shader_source);
+    batch_program_job = shader_compiler_submit(&shader_compiler, batch_vertex_shader_source, batch_fragment_shader_source);
+#ifdef BENCH_VERTEX
+    for (int i = 0; i < 2; i++) {
+        mesh_program_jobs[i] = shader_compiler_submit(&shader_compiler, mesh_vertex_shader_sources[i],
+                                                      mesh_fragment_shader_source);
+    }
+    vertex_layout_init(&mesh_layouts[0], mesh_float_attribs, 3);
+    vertex_layout_init(&mesh_layouts[1], mesh_compact_attribs, 3);
+#endif
+#ifdef BENCH_FRAMEGRAPH
+    for (int i = 0; i < POST_PROGRAM_COUNT; i++) {
+        post_program_jobs[i] = shader_compiler_submit(&shader_compiler, post_vertex_shader_source,
+                                                      post_fragment_shader_sources[i]);
+    }
+#endif
+#ifdef BENCH_TEXTURE
+    texture_program_job = shader_compiler_submit(&shader_compiler, texture_vertex_shader_source,
+                                                 texture_fragment_shader_source);
+#endif
+#ifdef BENCH_COMMANDS
+    command_program_job = shader_compiler_submit(&shader_compiler, command_vertex_shader_source,
+                                                 command_fragment_shader_source);
+#endif
+    startup_phase_end(phase);
 
     // --------------------------------------------------
-    // ----- Set up vertex data and attributes
+    // ----- Set up per-frame constants
     // --------------------------------------------------
-    GLuint vbo, ebo;
-    glGenVertexArrays(1, &vao);
-    glGenBuffers(1, &vbo);
-    glGenBuffers(1, &ebo);
-
-    glBindVertexArray(vao);
-
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-    // Positions
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    // Colours
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+    phase = startup_phase_begin("buffers");
+    GLint ubo_alignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &ubo_alignment);
+
+    object_constants_offset = align_up(sizeof(FrameConstants), ubo_alignment);
+    object_constants_stride = align_up(sizeof(ObjectConstants), ubo_alignment);
+    constants_size = object_constants_offset + MAX_OBJECTS * object_constants_stride;
+
+    constants_staging = (uint8_t*)malloc(constants_size);
+    memset(constants_staging, 0, constants_size);
+    ((ObjectConstants*)(constants_staging + object_constants_offset))->modifier = 1.0f;
+
+    if (gl_caps.tier == GL_TIER_45) {
+        glCreateBuffers(1, &constants_ubo);
+        glNamedBufferStorage(constants_ubo, constants_size, constants_staging, GL_DYNAMIC_STORAGE_BIT);
+    } else {
+        glGenBuffers(1, &constants_ubo);
+        glBindBuffer(GL_UNIFORM_BUFFER, constants_ubo);
+        glBufferData(GL_UNIFORM_BUFFER, constants_size, constants_staging, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    glBindBufferRange(GL_UNIFORM_BUFFER, BLOCK_BINDING_FRAME, constants_ubo, 0, sizeof(FrameConstants));
 
     // --------------------------------------------------
-    // ----- Prepare and create render thread
+    // ----- Set up vertex data and attributes
     // --------------------------------------------------
-    wglMakeCurrent(hdc, NULL);
-
-    WindowData *window = (WindowData*)malloc(sizeof(WindowData));
-    memset(window, 0, sizeof(*window));
-    window->hwnd = hwnd;
-    InitializeCriticalSection(&window->crit_sect);
-    InitializeConditionVariable(&window->cond_var);
-    window->flags = 0;
-
-    SetWindowLongPtrW(hwnd, GWLP_USERDATA, (LONG_PTR)window); // Attach data to window
-    SetWindowLongPtrW(hwnd, GWLP_WNDPROC, (LONG_PTR)WindowProc); // Attach window procedure
+    // Also the unit quad every batch instance is drawn from
+    vertex_layout_init(&quad_layout, quad_attribs, (int)(sizeof(quad_attribs) / sizeof(quad_attribs[0])));
+    VertexSource quad_sources[] = {
+        { vertices, 6 },     // Positions
+        { vertices + 3, 6 }, // Colours
+    };
+    mesh_create(&quad, &quad_layout, quad_sources, sizeof(vertices) / sizeof(vertices[0]) / 6,
+                indices, sizeof(indices) / sizeof(indices[0]), false);
 
-    HANDLE thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)render_thread_func, window, 0, NULL);
+    glGenVertexArrays(1, &vao);
+    mesh_setup_vao(&quad, vao);
 
-    UpdateWindow(hwnd);
-    ShowWindow(hwnd, SW_SHOW);
+    startup_phase_end(phase);
 
     // --------------------------------------------------
-    // ----- Enter main program loop
+    // ----- Prepare and create render thread
     // --------------------------------------------------
-    bool should_quit = false;
-    while (!should_quit) {
-        // Drain the message queue first
-        MSG msg;
-        while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
-            switch (msg.message) {
-            case WM_QUIT:
-                should_quit = true;
-            case WM_KEYDOWN:
-                if (msg.wParam == VK_ESCAPE)
-                    PostMessage(hwnd, WM_CLOSE, 0, 0);
-                else if (msg.wParam == VK_SPACE && !is_key_repeating(msg.lParam)) {
-                    EnterCriticalSection(&window->crit_sect);
-                    window->flags |= EVENT_TOGGLEANIMATION;
-                    WakeConditionVariable(&window->cond_var);
-                    LeaveCriticalSection(&window->crit_sect);
-                }
-            }
-            TranslateMessage(&msg);
-            DispatchMessage(&msg);
-        }
-
-        if (!should_quit)
-            WaitMessage();
-    }
+    wglMakeCurrent(hdc, NULL);
 
-    // Stop and wait on render thread before exiting
-    WaitForSingleObject(thread, INFINITE);
+    int result = run_window(hwnd, (LPTHREAD_START_ROUTINE)render_thread_func);
+    shader_compiler_stop(&shader_compiler);
+    gl_capture_stop();
+    program_cache_destroy(&program_cache);
 
     // Clean up, if necessary
+    wglDeleteContext(compile_context);
     wglDeleteContext(render_context);
 
-    return 0;
+    return result;
 }
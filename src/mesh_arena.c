@@ -0,0 +1,256 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "gl_state.h"
+#include "mesh_arena.h"
+
+#define RANGE_ALLOCATOR_INITIAL_RANGES 64
+#define ARENA_INDEX_ALIGNMENT 4
+
+static GLuint align_up_u32(GLuint value, GLuint alignment) {
+    if (alignment <= 1) return value;
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// --------------------------------------------------
+// ----- Range allocator
+// --------------------------------------------------
+bool range_allocator_init(RangeAllocator *allocator, GLuint capacity) {
+    memset(allocator, 0, sizeof(*allocator));
+    allocator->free_ranges = (ArenaRange*)malloc(RANGE_ALLOCATOR_INITIAL_RANGES * sizeof(ArenaRange));
+    if (!allocator->free_ranges) return false;
+
+    allocator->free_capacity = RANGE_ALLOCATOR_INITIAL_RANGES;
+    allocator->capacity = capacity;
+    allocator->free_ranges[0].offset = 0;
+    allocator->free_ranges[0].size = capacity;
+    allocator->free_count = 1;
+    return true;
+}
+
+void range_allocator_destroy(RangeAllocator *allocator) {
+    free(allocator->free_ranges);
+    memset(allocator, 0, sizeof(*allocator));
+}
+
+static bool insert_free_range(RangeAllocator *allocator, int index, GLuint offset, GLuint size) {
+    if (allocator->free_count == allocator->free_capacity) {
+        int new_capacity = allocator->free_capacity * 2;
+        ArenaRange *grown = (ArenaRange*)realloc(allocator->free_ranges, (size_t)new_capacity * sizeof(ArenaRange));
+        if (!grown) return false;
+        allocator->free_ranges = grown;
+        allocator->free_capacity = new_capacity;
+    }
+    memmove(&allocator->free_ranges[index + 1], &allocator->free_ranges[index],
+            (size_t)(allocator->free_count - index) * sizeof(ArenaRange));
+    allocator->free_ranges[index].offset = offset;
+    allocator->free_ranges[index].size = size;
+    allocator->free_count++;
+    return true;
+}
+
+static void remove_free_range(RangeAllocator *allocator, int index) {
+    memmove(&allocator->free_ranges[index], &allocator->free_ranges[index + 1],
+            (size_t)(allocator->free_count - index - 1) * sizeof(ArenaRange));
+    allocator->free_count--;
+}
+
+// Best fit: the smallest free range that still holds the aligned allocation
+bool range_alloc(RangeAllocator *allocator, GLuint size, GLuint alignment, GLuint *offset) {
+    if (size == 0) return false;
+
+    int best = -1;
+    GLuint best_waste = 0;
+    for (int i = 0; i < allocator->free_count; i++) {
+        const ArenaRange *range = &allocator->free_ranges[i];
+        GLuint start = align_up_u32(range->offset, alignment);
+        GLuint padding = start - range->offset;
+        if (padding + size > range->size) continue;
+
+        GLuint waste = range->size - size;
+        if (best < 0 || waste < best_waste) {
+            best = i;
+            best_waste = waste;
+            if (waste == padding) break; // Nothing is left over past the allocation
+        }
+    }
+    if (best < 0) return false;
+
+    ArenaRange range = allocator->free_ranges[best];
+    GLuint start = align_up_u32(range.offset, alignment);
+    GLuint padding = start - range.offset;
+    GLuint tail = range.size - padding - size;
+
+    // Alignment padding stays free in front, the remainder behind
+    if (padding && tail) {
+        allocator->free_ranges[best].size = padding;
+        if (!insert_free_range(allocator, best + 1, start + size, tail)) {
+            allocator->free_ranges[best] = range;
+            return false;
+        }
+    } else if (padding) {
+        allocator->free_ranges[best].size = padding;
+    } else if (tail) {
+        allocator->free_ranges[best].offset = start + size;
+        allocator->free_ranges[best].size = tail;
+    } else {
+        remove_free_range(allocator, best);
+    }
+
+    allocator->used += size;
+    *offset = start;
+    return true;
+}
+
+void range_free(RangeAllocator *allocator, GLuint offset, GLuint size) {
+    // First free range after the freed one
+    int low = 0;
+    int high = allocator->free_count;
+    while (low < high) {
+        int middle = (low + high) / 2;
+        if (allocator->free_ranges[middle].offset < offset) low = middle + 1;
+        else high = middle;
+    }
+    int next = low;
+    allocator->used -= size;
+
+    bool merge_previous = next > 0 &&
+        allocator->free_ranges[next - 1].offset + allocator->free_ranges[next - 1].size == offset;
+    bool merge_next = next < allocator->free_count && offset + size == allocator->free_ranges[next].offset;
+
+    if (merge_previous && merge_next) {
+        allocator->free_ranges[next - 1].size += size + allocator->free_ranges[next].size;
+        remove_free_range(allocator, next);
+    } else if (merge_previous) {
+        allocator->free_ranges[next - 1].size += size;
+    } else if (merge_next) {
+        allocator->free_ranges[next].offset = offset;
+        allocator->free_ranges[next].size += size;
+    } else if (!insert_free_range(allocator, next, offset, size)) {
+        allocator->used += size; // Out of memory for the free list; the range is leaked
+    }
+}
+
+GLuint range_allocator_largest_free(const RangeAllocator *allocator) {
+    GLuint largest = 0;
+    for (int i = 0; i < allocator->free_count; i++) {
+        if (allocator->free_ranges[i].size > largest) largest = allocator->free_ranges[i].size;
+    }
+    return largest;
+}
+
+float range_allocator_fragmentation(const RangeAllocator *allocator) {
+    GLuint free_total = allocator->capacity - allocator->used;
+    if (!free_total) return 0.0f;
+    return 1.0f - (float)range_allocator_largest_free(allocator) / (float)free_total;
+}
+
+// --------------------------------------------------
+// ----- Arena
+// --------------------------------------------------
+bool mesh_arena_init(MeshArena *arena, const VertexLayout *layout, GLuint vertex_capacity, GLuint index_capacity_bytes) {
+    memset(arena, 0, sizeof(*arena));
+    arena->layout = layout;
+    if (!range_allocator_init(&arena->vertices, vertex_capacity)) return false;
+    if (!range_allocator_init(&arena->indices, index_capacity_bytes)) {
+        range_allocator_destroy(&arena->vertices);
+        return false;
+    }
+
+    glGenVertexArrays(1, &arena->vao);
+    glGenBuffers(1, &arena->vbo);
+    glGenBuffers(1, &arena->ebo);
+
+    glBindVertexArray(arena->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, arena->vbo);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)vertex_capacity * layout->stride, NULL, GL_STATIC_DRAW);
+    vertex_layout_apply(layout, 0);
+    vertex_layout_enable(layout, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, arena->ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_capacity_bytes, NULL, GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void mesh_arena_destroy(MeshArena *arena) {
+    glDeleteVertexArrays(1, &arena->vao);
+    glDeleteBuffers(1, &arena->vbo);
+    glDeleteBuffers(1, &arena->ebo);
+    range_allocator_destroy(&arena->vertices);
+    range_allocator_destroy(&arena->indices);
+    memset(arena, 0, sizeof(*arena));
+}
+
+// Uploads go through the copy-write target, which no draw state depends on
+static void upload_range(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+    gl_state_bind_buffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size, data);
+}
+
+bool mesh_arena_upload(MeshArena *arena, const VertexSource *sources, size_t vertex_count,
+                       const uint32_t *indices, size_t index_count, ArenaMesh *mesh) {
+    memset(mesh, 0, sizeof(*mesh));
+    mesh->vertex_count = (GLuint)vertex_count;
+    mesh->index_count = (GLsizei)index_count;
+    mesh->index_type = vertex_count <= 0x10000 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    GLuint index_size = mesh->index_type == GL_UNSIGNED_SHORT ? 2 : 4;
+    mesh->index_bytes = (GLuint)index_count * index_size;
+
+    if (!range_alloc(&arena->vertices, mesh->vertex_count, 1, &mesh->first_vertex)) {
+        arena->failed_uploads++;
+        return false;
+    }
+    if (!range_alloc(&arena->indices, mesh->index_bytes, ARENA_INDEX_ALIGNMENT, &mesh->index_offset)) {
+        range_free(&arena->vertices, mesh->first_vertex, mesh->vertex_count);
+        arena->failed_uploads++;
+        return false;
+    }
+
+    size_t vertex_bytes = vertex_count * (size_t)arena->layout->stride;
+    uint8_t *staging = (uint8_t*)malloc(vertex_bytes + mesh->index_bytes);
+    if (!staging) {
+        mesh_arena_free(arena, mesh);
+        arena->failed_uploads++;
+        return false;
+    }
+
+    vertex_layout_pack(arena->layout, staging, sources, vertex_count);
+    uint8_t *index_data = staging + vertex_bytes;
+    if (mesh->index_type == GL_UNSIGNED_SHORT) {
+        uint16_t *short_indices = (uint16_t*)index_data;
+        for (size_t i = 0; i < index_count; i++) short_indices[i] = (uint16_t)indices[i];
+    } else {
+        memcpy(index_data, indices, mesh->index_bytes);
+    }
+
+    upload_range(arena->vbo, (GLintptr)mesh->first_vertex * arena->layout->stride, (GLsizeiptr)vertex_bytes, staging);
+    upload_range(arena->ebo, mesh->index_offset, mesh->index_bytes, index_data);
+    free(staging);
+
+    arena->uploads++;
+    return true;
+}
+
+void mesh_arena_free(MeshArena *arena, ArenaMesh *mesh) {
+    if (!mesh->vertex_count) return;
+    range_free(&arena->vertices, mesh->first_vertex, mesh->vertex_count);
+    range_free(&arena->indices, mesh->index_offset, mesh->index_bytes);
+    memset(mesh, 0, sizeof(*mesh));
+}
+
+void mesh_arena_bind(const MeshArena *arena) {
+    gl_state_bind_vertex_array(arena->vao);
+}
+
+void mesh_arena_draw(MeshArena *arena, const ArenaMesh *mesh) {
+    glDrawElementsBaseVertex(GL_TRIANGLES, mesh->index_count, mesh->index_type,
+                             (void*)(uintptr_t)mesh->index_offset, (GLint)mesh->first_vertex);
+    arena->draws++;
+}
+
+void mesh_arena_reset_stats(MeshArena *arena) {
+    arena->draws = 0;
+    arena->uploads = 0;
+    arena->failed_uploads = 0;
+}
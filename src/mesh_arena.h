@@ -0,0 +1,81 @@
+#ifndef MESH_ARENA_H
+#define MESH_ARENA_H
+
+// Many meshes in one vertex buffer and one index buffer. Each mesh is a range
+// of vertices and a range of index bytes handed out by a free-list allocator;
+// indices stay local to the mesh and are offset with glDrawElementsBaseVertex,
+// so every mesh of the arena's layout draws through the same VAO.
+//
+// Capacity is fixed at init. Freed ranges are merged with free neighbours, and
+// allocations pick the smallest range that fits to keep large ranges intact.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "glad/glad.h"
+#include "vertex_format.h"
+
+typedef struct {
+    GLuint offset;
+    GLuint size;
+} ArenaRange;
+
+// Free ranges sorted by offset
+typedef struct {
+    ArenaRange *free_ranges;
+    int free_count;
+    int free_capacity;
+    GLuint capacity;
+    GLuint used;
+} RangeAllocator;
+
+bool range_allocator_init(RangeAllocator *allocator, GLuint capacity);
+void range_allocator_destroy(RangeAllocator *allocator);
+bool range_alloc(RangeAllocator *allocator, GLuint size, GLuint alignment, GLuint *offset);
+void range_free(RangeAllocator *allocator, GLuint offset, GLuint size);
+
+GLuint range_allocator_largest_free(const RangeAllocator *allocator);
+
+// 0 when all free space is one range, approaching 1 as it splinters
+float range_allocator_fragmentation(const RangeAllocator *allocator);
+
+typedef struct {
+    GLuint first_vertex;
+    GLuint vertex_count;
+    GLuint index_offset; // Bytes into the index buffer
+    GLuint index_bytes;
+    GLsizei index_count;
+    GLenum index_type;   // 16-bit whenever the mesh has at most 65536 vertices
+} ArenaMesh;
+
+typedef struct {
+    const VertexLayout *layout;
+    GLuint vao;
+    GLuint vbo;
+    GLuint ebo;
+    RangeAllocator vertices; // In vertices
+    RangeAllocator indices;  // In bytes
+
+    // Reset by mesh_arena_reset_stats
+    uint64_t draws;
+    uint64_t uploads;
+    uint64_t failed_uploads;
+} MeshArena;
+
+// Uses GL directly; call gl_state_invalidate() afterwards on the render thread
+bool mesh_arena_init(MeshArena *arena, const VertexLayout *layout, GLuint vertex_capacity, GLuint index_capacity_bytes);
+void mesh_arena_destroy(MeshArena *arena);
+
+// Packs the vertices into the arena's layout and copies both ranges to the GPU
+bool mesh_arena_upload(MeshArena *arena, const VertexSource *sources, size_t vertex_count,
+                       const uint32_t *indices, size_t index_count, ArenaMesh *mesh);
+void mesh_arena_free(MeshArena *arena, ArenaMesh *mesh);
+
+// Bind once, then draw any number of the arena's meshes
+void mesh_arena_bind(const MeshArena *arena);
+void mesh_arena_draw(MeshArena *arena, const ArenaMesh *mesh);
+
+void mesh_arena_reset_stats(MeshArena *arena);
+
+#endif
@@ -0,0 +1,222 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "program_cache.h"
+
+#define PROGRAM_CACHE_MAGIC 0x4E494250u // "PBIN"
+#define PROGRAM_CACHE_VERSION 2
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint64_t context_hash;
+    uint32_t binary_format;
+    uint32_t binary_length;
+} ProgramCacheHeader;
+
+static uint64_t fnv1a(uint64_t hash, const char *str) {
+    // Hash the terminator too so ("ab", "c") and ("a", "bc") differ
+    do {
+        hash ^= (uint8_t)*str;
+        hash *= 0x100000001B3ull;
+    } while (*str++);
+    return hash;
+}
+
+static uint64_t program_key(const ProgramCache *cache, const char *vs_source, const char *fs_source) {
+    uint64_t hash = fnv1a(cache->device_hash, vs_source);
+    return fnv1a(hash, fs_source);
+}
+
+static void entry_path(const ProgramCache *cache, uint64_t key, char *path, size_t path_size) {
+    sprintf_s(path, path_size, "%s\\%016llx.bin", cache->directory, (unsigned long long)key);
+}
+
+void program_cache_init(ProgramCache *cache, const char *directory) {
+    memset(cache, 0, sizeof(*cache));
+
+    GLint format_count = 0;
+    if (GLAD_GL_ARB_get_program_binary) glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+    if (format_count <= 0) return;
+
+    const char *vendor = (const char*)glGetString(GL_VENDOR);
+    const char *renderer = (const char*)glGetString(GL_RENDERER);
+
+    uint64_t hash = 0xCBF29CE484222325ull;
+    hash = fnv1a(hash, vendor ? vendor : "");
+    hash = fnv1a(hash, renderer ? renderer : "");
+    cache->device_hash = hash;
+
+    strcpy_s(cache->directory, sizeof(cache->directory), directory);
+    CreateDirectoryA(directory, NULL); // Fails harmlessly if it already exists
+    cache->enabled = true;
+}
+
+void program_cache_set_context(ProgramCache *cache) {
+    if (!cache->enabled) return;
+
+    GLint format_count = 0;
+    if (GLAD_GL_ARB_get_program_binary) glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+    if (format_count <= 0) {
+        cache->enabled = false;
+        return;
+    }
+
+    const char *version = (const char*)glGetString(GL_VERSION);
+    cache->context_hash = fnv1a(cache->device_hash, version ? version : "");
+}
+
+void program_cache_destroy(ProgramCache *cache) {
+    for (int i = 0; i < cache->prefetch_count; i++) free(cache->prefetched[i].binary);
+    cache->prefetch_count = 0;
+}
+
+// Reads and validates an entry. Returns false if it is missing or damaged.
+static bool read_entry(const ProgramCache *cache, uint64_t key, ProgramCacheBlob *blob) {
+    char path[MAX_PATH];
+    entry_path(cache, key, path, sizeof(path));
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    ProgramCacheHeader header;
+    DWORD bytes_read = 0;
+    void *binary = NULL;
+    bool valid = ReadFile(file, &header, sizeof(header), &bytes_read, NULL) && bytes_read == sizeof(header) &&
+                 header.magic == PROGRAM_CACHE_MAGIC && header.version == PROGRAM_CACHE_VERSION &&
+                 header.key == key && header.binary_length > 0;
+    if (valid) {
+        binary = malloc(header.binary_length);
+        valid = binary && ReadFile(file, binary, header.binary_length, &bytes_read, NULL) &&
+                bytes_read == header.binary_length;
+    }
+    CloseHandle(file);
+
+    if (!valid) {
+        free(binary);
+        return false;
+    }
+
+    blob->key = key;
+    blob->context_hash = header.context_hash;
+    blob->binary_format = header.binary_format;
+    blob->binary_length = header.binary_length;
+    blob->binary = binary;
+    return true;
+}
+
+void program_cache_prefetch(ProgramCache *cache, const char *vs_source, const char *fs_source) {
+    if (!cache->enabled || cache->prefetch_count == PROGRAM_CACHE_MAX_PREFETCH) return;
+
+    uint64_t key = program_key(cache, vs_source, fs_source);
+    if (read_entry(cache, key, &cache->prefetched[cache->prefetch_count])) cache->prefetch_count++;
+}
+
+GLuint program_cache_load(ProgramCache *cache, const char *vs_source, const char *fs_source) {
+    if (!cache->enabled || !cache->context_hash) return 0;
+
+    uint64_t key = program_key(cache, vs_source, fs_source);
+
+    // Take the prefetched copy if there is one, otherwise go to disk
+    ProgramCacheBlob blob = {};
+    bool found = false;
+    for (int i = 0; i < cache->prefetch_count; i++) {
+        if (cache->prefetched[i].key != key) continue;
+        blob = cache->prefetched[i];
+        cache->prefetched[i] = cache->prefetched[--cache->prefetch_count];
+        found = true;
+        break;
+    }
+    if (!found && !read_entry(cache, key, &blob)) {
+        cache->misses++;
+        return 0;
+    }
+    if (blob.context_hash != cache->context_hash) {
+        // Made by another driver version or kind of context; replaced on store
+        free(blob.binary);
+        cache->misses++;
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, blob.binary_format, blob.binary, (GLsizei)blob.binary_length);
+    free(blob.binary);
+
+    // The driver may refuse binaries from a different build even when the version string matches
+    GLint success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        glDeleteProgram(program);
+        cache->rejected++;
+        cache->misses++;
+        return 0;
+    }
+
+    cache->hits++;
+    return program;
+}
+
+void program_cache_store(ProgramCache *cache, GLuint program, const char *vs_source, const char *fs_source) {
+    if (!cache->enabled || !cache->context_hash) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    void *binary = malloc((size_t)length);
+    if (!binary) return;
+
+    ProgramCacheHeader header = {};
+    header.magic = PROGRAM_CACHE_MAGIC;
+    header.version = PROGRAM_CACHE_VERSION;
+    header.key = program_key(cache, vs_source, fs_source);
+    header.context_hash = cache->context_hash;
+
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, binary);
+    header.binary_format = format;
+    header.binary_length = (uint32_t)written;
+
+    // Write to a temporary file and move it into place so a crash never leaves a torn entry
+    char path[MAX_PATH];
+    char temp_path[MAX_PATH];
+    entry_path(cache, header.key, path, sizeof(path));
+    sprintf_s(temp_path, sizeof(temp_path), "%s.tmp", path);
+
+    HANDLE file = CreateFileA(temp_path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file != INVALID_HANDLE_VALUE) {
+        DWORD bytes_written = 0;
+        bool ok = written > 0 &&
+                  WriteFile(file, &header, sizeof(header), &bytes_written, NULL) &&
+                  WriteFile(file, binary, (DWORD)written, &bytes_written, NULL);
+        CloseHandle(file);
+
+        if (ok) MoveFileExA(temp_path, path, MOVEFILE_REPLACE_EXISTING);
+        else    DeleteFileA(temp_path);
+    }
+
+    free(binary);
+}
+
+void program_cache_purge(const char *directory) {
+    char pattern[MAX_PATH];
+    sprintf_s(pattern, sizeof(pattern), "%s\\*.bin", directory);
+
+    WIN32_FIND_DATAA find_data;
+    HANDLE find = FindFirstFileA(pattern, &find_data);
+    if (find == INVALID_HANDLE_VALUE) return;
+
+    do {
+        char path[MAX_PATH];
+        sprintf_s(path, sizeof(path), "%s\\%s", directory, find_data.cFileName);
+        DeleteFileA(path);
+    } while (FindNextFileA(find, &find_data));
+
+    FindClose(find);
+}
@@ -0,0 +1,63 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+// On-disk cache of linked program binaries (ARB_get_program_binary). Entries
+// are named by a hash of the driver's vendor/renderer strings and the shader
+// sources, and only load on a context with the version string they were made
+// on, so a driver update or a source change is a miss.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+#define PROGRAM_CACHE_MAX_PREFETCH 8
+
+// An entry read from disk ahead of time, waiting for program_cache_load
+typedef struct {
+    uint64_t key;
+    uint64_t context_hash;
+    uint32_t binary_format;
+    uint32_t binary_length;
+    void *binary;
+} ProgramCacheBlob;
+
+typedef struct {
+    bool enabled;          // False when the driver has no binary formats
+    char directory[260];
+    uint64_t device_hash;  // Vendor and renderer, known before the real context exists
+    uint64_t context_hash; // Device and version string of the context programs live on
+
+    ProgramCacheBlob prefetched[PROGRAM_CACHE_MAX_PREFETCH];
+    int prefetch_count;
+
+    // Statistics
+    int hits;
+    int misses;
+    int rejected;          // Found on disk but refused by the driver
+} ProgramCache;
+
+// Requires a current context from the same driver, which may be a temporary
+// one. `directory` is created if it doesn't exist.
+void program_cache_init(ProgramCache *cache, const char *directory);
+
+// Must be called with the context programs are created and loaded on current
+// before anything is loaded or stored. The version string can differ between
+// contexts of one driver, for example compatibility and core.
+void program_cache_set_context(ProgramCache *cache);
+void program_cache_destroy(ProgramCache *cache);
+
+// Reads an entry into memory without touching GL, so it can overlap with
+// other startup work. A later program_cache_load of the same sources uses it.
+void program_cache_prefetch(ProgramCache *cache, const char *vs_source, const char *fs_source);
+
+// Returns a linked program, or 0 if there is no usable cache entry
+GLuint program_cache_load(ProgramCache *cache, const char *vs_source, const char *fs_source);
+
+// Saves a linked program that had GL_PROGRAM_BINARY_RETRIEVABLE_HINT set before linking
+void program_cache_store(ProgramCache *cache, GLuint program, const char *vs_source, const char *fs_source);
+
+// Deletes every entry in `directory`; used by the startup benchmark to measure launches without a cache
+void program_cache_purge(const char *directory);
+
+#endif
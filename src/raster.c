@@ -0,0 +1,485 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "raster.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define RASTER_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// The AVX2 kernel is compiled for AVX2 on its own and only called when the CPU has it
+#if defined(RASTER_X86) && defined(__GNUC__)
+#define RASTER_AVX2_FUNCTION __attribute__((target("avx2")))
+#else
+#define RASTER_AVX2_FUNCTION
+#endif
+
+static int count_bits(int bits) {
+    int count = 0;
+    for (; bits; bits &= bits - 1) count++;
+    return count;
+}
+
+// GL's conversion to unorm8: clamp, scale and round to nearest even
+static uint32_t unorm8(float value) {
+    value = value < 0.0f ? 0.0f : value > 1.0f ? 1.0f : value;
+    return (uint32_t)lrintf(value * 255.0f);
+}
+
+static uint32_t pack_bgra(float r, float g, float b) {
+    return 0xFF000000u | (unorm8(r) << 16) | (unorm8(g) << 8) | unorm8(b);
+}
+
+// ----- Spans
+// --------------------------------------------------
+// Each kernel fills the pixels of one row in [x0, x1) that the triangle
+// covers and returns how many it wrote. All of them evaluate the edges and
+// colours with the same operations in the same order, so they write the same
+// values.
+
+typedef int64_t (*RasterSpanFunc)(const RasterTriangle *tri, uint32_t *row, int x0, int x1, float py);
+
+static int64_t span_scalar(const RasterTriangle *tri, uint32_t *row, int x0, int x1, float py) {
+    float row_terms[3];
+    for (int k = 0; k < 3; k++) row_terms[k] = (py - tri->y[k]) * tri->dx[k];
+
+    int64_t written = 0;
+    for (int x = x0; x < x1; x++) {
+        float px = (float)x + 0.5f;
+        float e[3];
+        bool inside = true;
+        for (int k = 0; k < 3; k++) {
+            e[k] = ((px - tri->x[k]) * tri->dy[k] - row_terms[k]) * tri->sign[k];
+            inside = inside && (e[k] > 0.0f || (e[k] == 0.0f && tri->top_left[k]));
+        }
+        if (!inside) continue;
+
+        float color[3];
+        for (int c = 0; c < 3; c++) {
+            color[c] = e[0] * tri->weight[0][c] + e[1] * tri->weight[1][c] + e[2] * tri->weight[2][c];
+        }
+        row[x] = pack_bgra(color[0], color[1], color[2]);
+        written++;
+    }
+    return written;
+}
+
+#ifdef RASTER_X86
+static int64_t span_sse2(const RasterTriangle *tri, uint32_t *row, int x0, int x1, float py) {
+    const __m128 lanes = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128i alpha = _mm_set1_epi32((int)0xFF000000u);
+
+    __m128 edge_x[3], edge_dy[3], row_terms[3], sign[3], top_left[3], weight[3][3];
+    for (int k = 0; k < 3; k++) {
+        edge_x[k] = _mm_set1_ps(tri->x[k]);
+        edge_dy[k] = _mm_set1_ps(tri->dy[k]);
+        row_terms[k] = _mm_set1_ps((py - tri->y[k]) * tri->dx[k]);
+        sign[k] = _mm_set1_ps(tri->sign[k]);
+        top_left[k] = _mm_castsi128_ps(_mm_set1_epi32(tri->top_left[k] ? -1 : 0));
+        for (int c = 0; c < 3; c++) weight[k][c] = _mm_set1_ps(tri->weight[k][c]);
+    }
+
+    int64_t written = 0;
+    for (int x = x0; x < x1; x += 4) {
+        __m128 px = _mm_add_ps(_mm_set1_ps((float)x), lanes);
+        __m128 e[3];
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int k = 0; k < 3; k++) {
+            e[k] = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_sub_ps(px, edge_x[k]), edge_dy[k]), row_terms[k]), sign[k]);
+            __m128 on_edge = _mm_and_ps(_mm_cmpeq_ps(e[k], zero), top_left[k]);
+            inside = _mm_and_ps(inside, _mm_or_ps(_mm_cmpgt_ps(e[k], zero), on_edge));
+        }
+        int bits = _mm_movemask_ps(inside);
+        if (x1 - x < 4) bits &= (1 << (x1 - x)) - 1;
+        if (!bits) continue;
+
+        __m128i channels[3];
+        for (int c = 0; c < 3; c++) {
+            __m128 value = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e[0], weight[0][c]), _mm_mul_ps(e[1], weight[1][c])),
+                                      _mm_mul_ps(e[2], weight[2][c]));
+            value = _mm_min_ps(_mm_max_ps(value, zero), one);
+            channels[c] = _mm_cvtps_epi32(_mm_mul_ps(value, scale));
+        }
+        __m128i packed = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(channels[0], 16), _mm_slli_epi32(channels[1], 8)),
+                                      _mm_or_si128(channels[2], alpha));
+
+        if (bits == 0xF) {
+            _mm_storeu_si128((__m128i*)(row + x), packed);
+        } else {
+            uint32_t values[4];
+            _mm_storeu_si128((__m128i*)values, packed);
+            for (int i = 0; i < 4; i++) {
+                if (bits & (1 << i)) row[x + i] = values[i];
+            }
+        }
+        written += count_bits(bits);
+    }
+    return written;
+}
+
+RASTER_AVX2_FUNCTION
+static int64_t span_avx2(const RasterTriangle *tri, uint32_t *row, int x0, int x1, float py) {
+    const __m256 lanes = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+    const __m256i lane_index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    const __m256i alpha = _mm256_set1_epi32((int)0xFF000000u);
+
+    __m256 edge_x[3], edge_dy[3], row_terms[3], sign[3], top_left[3], weight[3][3];
+    for (int k = 0; k < 3; k++) {
+        edge_x[k] = _mm256_set1_ps(tri->x[k]);
+        edge_dy[k] = _mm256_set1_ps(tri->dy[k]);
+        row_terms[k] = _mm256_set1_ps((py - tri->y[k]) * tri->dx[k]);
+        sign[k] = _mm256_set1_ps(tri->sign[k]);
+        top_left[k] = _mm256_castsi256_ps(_mm256_set1_epi32(tri->top_left[k] ? -1 : 0));
+        for (int c = 0; c < 3; c++) weight[k][c] = _mm256_set1_ps(tri->weight[k][c]);
+    }
+
+    int64_t written = 0;
+    for (int x = x0; x < x1; x += 8) {
+        __m256 px = _mm256_add_ps(_mm256_set1_ps((float)x), lanes);
+        __m256 e[3];
+        __m256 inside = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(x1 - x), lane_index));
+        for (int k = 0; k < 3; k++) {
+            e[k] = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_sub_ps(px, edge_x[k]), edge_dy[k]), row_terms[k]),
+                                 sign[k]);
+            __m256 on_edge = _mm256_and_ps(_mm256_cmp_ps(e[k], zero, _CMP_EQ_OQ), top_left[k]);
+            inside = _mm256_and_ps(inside, _mm256_or_ps(_mm256_cmp_ps(e[k], zero, _CMP_GT_OQ), on_edge));
+        }
+        int bits = _mm256_movemask_ps(inside);
+        if (!bits) continue;
+
+        __m256i channels[3];
+        for (int c = 0; c < 3; c++) {
+            __m256 value = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e[0], weight[0][c]),
+                                                       _mm256_mul_ps(e[1], weight[1][c])),
+                                         _mm256_mul_ps(e[2], weight[2][c]));
+            value = _mm256_min_ps(_mm256_max_ps(value, zero), one);
+            channels[c] = _mm256_cvtps_epi32(_mm256_mul_ps(value, scale));
+        }
+        __m256i packed = _mm256_or_si256(
+            _mm256_or_si256(_mm256_slli_epi32(channels[0], 16), _mm256_slli_epi32(channels[1], 8)),
+            _mm256_or_si256(channels[2], alpha));
+
+        // Lanes past x1 are never stored, so the row needs no padding
+        if (bits == 0xFF) _mm256_storeu_si256((__m256i*)(row + x), packed);
+        else _mm256_maskstore_epi32((int*)(row + x), _mm256_castps_si256(inside), packed);
+        written += count_bits(bits);
+    }
+    return written;
+}
+#endif
+
+static RasterSpanFunc span_func(RasterSimd simd) {
+#ifdef RASTER_X86
+    if (simd == RASTER_SIMD_AVX2) return span_avx2;
+    if (simd == RASTER_SIMD_SSE2) return span_sse2;
+#endif
+    return span_scalar;
+}
+
+// ----- Tiles
+// --------------------------------------------------
+
+static int64_t raster_tile(Rasterizer *raster, int tile) {
+    int x0 = (tile % raster->tiles_x) * RASTER_TILE_SIZE;
+    int y0 = (tile / raster->tiles_x) * RASTER_TILE_SIZE;
+    int x1 = x0 + RASTER_TILE_SIZE < raster->width ? x0 + RASTER_TILE_SIZE : raster->width;
+    int y1 = y0 + RASTER_TILE_SIZE < raster->height ? y0 + RASTER_TILE_SIZE : raster->height;
+
+    // Rows are stored top first; y counts up from the bottom
+    for (int y = y0; y < y1; y++) {
+        uint32_t *row = raster->pixels + (size_t)(raster->height - 1 - y) * raster->stride;
+        for (int x = x0; x < x1; x++) row[x] = raster->clear_value;
+    }
+    int64_t written = (int64_t)(x1 - x0) * (y1 - y0);
+
+    RasterSpanFunc span = span_func(raster->simd);
+    const RasterBin *bin = &raster->bins[tile];
+    for (int i = 0; i < bin->count; i++) {
+        const RasterTriangle *tri = &raster->triangles[bin->triangles[i]];
+        int tri_x0 = tri->min_x > x0 ? tri->min_x : x0;
+        int tri_x1 = tri->max_x + 1 < x1 ? tri->max_x + 1 : x1;
+        int tri_y0 = tri->min_y > y0 ? tri->min_y : y0;
+        int tri_y1 = tri->max_y + 1 < y1 ? tri->max_y + 1 : y1;
+        for (int y = tri_y0; y < tri_y1; y++) {
+            uint32_t *row = raster->pixels + (size_t)(raster->height - 1 - y) * raster->stride;
+            written += span(tri, row, tri_x0, tri_x1, (float)y + 0.5f);
+        }
+    }
+    return written;
+}
+
+// Takes tiles until none are left
+static void raster_work(Rasterizer *raster, int thread) {
+    int tile_count = raster->tiles_x * raster->tiles_y;
+    int64_t written = 0;
+    while (true) {
+        int tile = (int)InterlockedIncrement(&raster->next_tile) - 1;
+        if (tile >= tile_count) break;
+        written += raster_tile(raster, tile);
+    }
+    raster->thread_pixels[thread] = written;
+}
+
+static DWORD raster_worker_func(LPVOID lParam) {
+    RasterWorker *worker = (RasterWorker*)lParam;
+    Rasterizer *raster = worker->raster;
+    uint64_t generation = 0;
+
+    while (true) {
+        EnterCriticalSection(&raster->crit_sect);
+        while (!raster->stop && raster->generation == generation) {
+            SleepConditionVariableCS(&raster->cond_var, &raster->crit_sect, INFINITE);
+        }
+        generation = raster->generation;
+        bool stop = raster->stop;
+        bool active = worker->index < raster->active_count;
+        LeaveCriticalSection(&raster->crit_sect);
+
+        if (stop) break;
+        if (!active) continue;
+
+        raster_work(raster, worker->index);
+
+        // The frame is only done once every active worker has checked out, so
+        // a late one can't take tiles of the next frame while it's binned
+        EnterCriticalSection(&raster->crit_sect);
+        raster->workers_done++;
+        WakeAllConditionVariable(&raster->cond_var);
+        LeaveCriticalSection(&raster->crit_sect);
+    }
+    return 0;
+}
+
+// ----- Setup
+// --------------------------------------------------
+
+int raster_hardware_threads(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int count = (int)info.dwNumberOfProcessors;
+    return count < 1 ? 1 : count > RASTER_MAX_THREADS ? RASTER_MAX_THREADS : count;
+}
+
+RasterSimd raster_best_simd(void) {
+#if defined(RASTER_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        bool os_saves_ymm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        if (os_saves_ymm && (info[1] & (1 << 5))) return RASTER_SIMD_AVX2;
+    }
+    return RASTER_SIMD_SSE2;
+#elif defined(RASTER_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return RASTER_SIMD_AVX2;
+    return __builtin_cpu_supports("sse2") ? RASTER_SIMD_SSE2 : RASTER_SIMD_SCALAR;
+#else
+    return RASTER_SIMD_SCALAR;
+#endif
+}
+
+const char *raster_simd_name(RasterSimd simd) {
+    static const char *const names[RASTER_SIMD_COUNT] = { "scalar", "SSE2", "AVX2" };
+    return simd < RASTER_SIMD_COUNT ? names[simd] : "?";
+}
+
+bool raster_init(Rasterizer *raster, int thread_count) {
+    memset(raster, 0, sizeof(*raster));
+    if (thread_count <= 0) thread_count = raster_hardware_threads();
+    if (thread_count > RASTER_MAX_THREADS) thread_count = RASTER_MAX_THREADS;
+
+    raster->simd = raster_best_simd();
+    InitializeCriticalSection(&raster->crit_sect);
+    InitializeConditionVariable(&raster->cond_var);
+
+    // The thread calling raster_end is thread 0
+    raster->thread_count = 1;
+    for (int i = 1; i < thread_count; i++) {
+        RasterWorker *worker = &raster->workers[i - 1];
+        worker->raster = raster;
+        worker->index = i;
+        worker->thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)raster_worker_func, worker, 0, NULL);
+        if (!worker->thread) break;
+        raster->thread_count++;
+    }
+    raster->active_count = raster->thread_count;
+    return true;
+}
+
+void raster_destroy(Rasterizer *raster) {
+    EnterCriticalSection(&raster->crit_sect);
+    raster->stop = true;
+    WakeAllConditionVariable(&raster->cond_var);
+    LeaveCriticalSection(&raster->crit_sect);
+
+    for (int i = 0; i < raster->thread_count - 1; i++) {
+        WaitForSingleObject(raster->workers[i].thread, INFINITE);
+        CloseHandle(raster->workers[i].thread);
+    }
+    DeleteCriticalSection(&raster->crit_sect);
+
+    for (int i = 0; i < raster->bin_capacity; i++) free(raster->bins[i].triangles);
+    free(raster->bins);
+    free(raster->triangles);
+    memset(raster, 0, sizeof(*raster));
+}
+
+void raster_set_active_threads(Rasterizer *raster, int thread_count) {
+    if (thread_count < 1) thread_count = 1;
+    raster->active_count = thread_count < raster->thread_count ? thread_count : raster->thread_count;
+}
+
+void raster_set_simd(Rasterizer *raster, RasterSimd simd) {
+    RasterSimd best = raster_best_simd();
+    raster->simd = simd < best ? simd : best;
+}
+
+// ----- Frames
+// --------------------------------------------------
+
+bool raster_begin(Rasterizer *raster, uint32_t *pixels, int width, int height, int stride, const float clear[3]) {
+    raster->failed = false;
+    raster->pixels = pixels;
+    raster->width = width > 0 ? width : 0;
+    raster->height = height > 0 ? height : 0;
+    raster->stride = stride;
+    raster->clear_value = pack_bgra(clear[0], clear[1], clear[2]);
+    raster->triangle_count = 0;
+
+    raster->tiles_x = (raster->width + RASTER_TILE_SIZE - 1) / RASTER_TILE_SIZE;
+    raster->tiles_y = (raster->height + RASTER_TILE_SIZE - 1) / RASTER_TILE_SIZE;
+    int tile_count = raster->tiles_x * raster->tiles_y;
+    if (tile_count > raster->bin_capacity) {
+        RasterBin *bins = (RasterBin*)realloc(raster->bins, tile_count * sizeof(RasterBin));
+        if (!bins) {
+            raster->failed = true;
+            return false;
+        }
+        raster->bins = bins;
+        memset(raster->bins + raster->bin_capacity, 0, (tile_count - raster->bin_capacity) * sizeof(RasterBin));
+        raster->bin_capacity = tile_count;
+    }
+    for (int i = 0; i < tile_count; i++) raster->bins[i].count = 0;
+    return true;
+}
+
+static bool bin_triangle(Rasterizer *raster, int index) {
+    const RasterTriangle *tri = &raster->triangles[index];
+    for (int ty = tri->min_y / RASTER_TILE_SIZE; ty <= tri->max_y / RASTER_TILE_SIZE; ty++) {
+        for (int tx = tri->min_x / RASTER_TILE_SIZE; tx <= tri->max_x / RASTER_TILE_SIZE; tx++) {
+            RasterBin *bin = &raster->bins[ty * raster->tiles_x + tx];
+            if (bin->count == bin->capacity) {
+                int capacity = bin->capacity ? bin->capacity * 2 : 16;
+                uint32_t *triangles = (uint32_t*)realloc(bin->triangles, capacity * sizeof(uint32_t));
+                if (!triangles) return false;
+                bin->triangles = triangles;
+                bin->capacity = capacity;
+            }
+            bin->triangles[bin->count++] = (uint32_t)index;
+        }
+    }
+    return true;
+}
+
+// Returns false for triangles with no area or entirely off the target
+static bool setup_triangle(const Rasterizer *raster, const RasterVertex *v[3], RasterTriangle *tri) {
+    float area = (v[1]->x - v[0]->x) * (v[2]->y - v[0]->y) - (v[2]->x - v[0]->x) * (v[1]->y - v[0]->y);
+    if (area == 0.0f || area != area) return false;
+
+    float min_x = fminf(v[0]->x, fminf(v[1]->x, v[2]->x));
+    float max_x = fmaxf(v[0]->x, fmaxf(v[1]->x, v[2]->x));
+    float min_y = fminf(v[0]->y, fminf(v[1]->y, v[2]->y));
+    float max_y = fmaxf(v[0]->y, fmaxf(v[1]->y, v[2]->y));
+
+    // Pixels whose centres might be inside, a pixel wider than needed
+    tri->min_x = (int)fmaxf(floorf(min_x - 0.5f), 0.0f);
+    tri->min_y = (int)fmaxf(floorf(min_y - 0.5f), 0.0f);
+    tri->max_x = (int)fminf(ceilf(max_x - 0.5f), (float)(raster->width - 1));
+    tri->max_y = (int)fminf(ceilf(max_y - 0.5f), (float)(raster->height - 1));
+    if (tri->min_x > tri->max_x || tri->min_y > tri->max_y) return false;
+
+    for (int k = 0; k < 3; k++) {
+        const RasterVertex *a = v[(k + 1) % 3];
+        const RasterVertex *b = v[(k + 2) % 3];
+        bool swapped = b->x < a->x || (b->x == a->x && b->y < a->y);
+        if (swapped) {
+            const RasterVertex *t = a;
+            a = b;
+            b = t;
+        }
+        tri->x[k] = a->x;
+        tri->y[k] = a->y;
+        tri->dx[k] = b->x - a->x;
+        tri->dy[k] = b->y - a->y;
+
+        // Vertex k is where the function is negative for a counter-clockwise
+        // triangle with the edge in its own order
+        float sign = area > 0.0f ? -1.0f : 1.0f;
+        tri->sign[k] = swapped ? -sign : sign;
+
+        // The inside is to the right of a left edge, and below a top edge
+        float normal_x = tri->sign[k] * tri->dy[k];
+        float normal_y = -tri->sign[k] * tri->dx[k];
+        tri->top_left[k] = normal_x > 0.0f || (normal_x == 0.0f && normal_y < 0.0f);
+
+        for (int c = 0; c < 3; c++) tri->weight[k][c] = v[k]->color[c] / fabsf(area);
+    }
+    return true;
+}
+
+bool raster_triangles(Rasterizer *raster, const RasterVertex *vertices, const uint32_t *indices, int index_count) {
+    for (int i = 0; i + 2 < index_count && !raster->failed; i += 3) {
+        if (raster->triangle_count == raster->triangle_capacity) {
+            int capacity = raster->triangle_capacity ? raster->triangle_capacity * 2 : 64;
+            RasterTriangle *triangles = (RasterTriangle*)realloc(raster->triangles, capacity * sizeof(RasterTriangle));
+            if (!triangles) {
+                raster->failed = true;
+                break;
+            }
+            raster->triangles = triangles;
+            raster->triangle_capacity = capacity;
+        }
+
+        const RasterVertex *v[3] = { &vertices[indices[i]], &vertices[indices[i + 1]], &vertices[indices[i + 2]] };
+        if (!setup_triangle(raster, v, &raster->triangles[raster->triangle_count])) continue;
+        if (!bin_triangle(raster, raster->triangle_count)) raster->failed = true;
+        raster->triangle_count++;
+    }
+    return !raster->failed;
+}
+
+bool raster_end(Rasterizer *raster) {
+    raster->pixels_written = 0;
+    if (raster->failed) return false;
+
+    int workers = raster->active_count - 1;
+
+    EnterCriticalSection(&raster->crit_sect);
+    raster->next_tile = 0;
+    raster->workers_done = 0;
+    raster->generation++;
+    WakeAllConditionVariable(&raster->cond_var);
+    LeaveCriticalSection(&raster->crit_sect);
+
+    raster_work(raster, 0);
+
+    EnterCriticalSection(&raster->crit_sect);
+    while (raster->workers_done < workers) SleepConditionVariableCS(&raster->cond_var, &raster->crit_sect, INFINITE);
+    LeaveCriticalSection(&raster->crit_sect);
+
+    for (int i = 0; i <= workers; i++) raster->pixels_written += raster->thread_pixels[i];
+    return true;
+}
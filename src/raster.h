@@ -0,0 +1,127 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+// A triangle rasterizer on the CPU, for where there is no usable GL driver.
+// It fills a 32-bit BGRA image (top row first, as a top-down DIB wants it)
+// the way GL would fill the same window: coordinates are in window pixels
+// with the origin at the bottom left, pixels are sampled at their centres,
+// edges shared by two triangles are filled once (top-left rule) and colours
+// are interpolated linearly across each triangle.
+//
+// A frame is recorded between raster_begin and raster_end. Triangles are set
+// up and binned into RASTER_TILE_SIZE square tiles as they arrive; raster_end
+// hands the tiles to the worker threads, works on them itself, and returns
+// when the image is complete. Each tile is cleared and then gets its
+// triangles in submission order, so no two threads ever touch one pixel.
+//
+// The inner loop tests 4 (SSE2) or 8 (AVX2) pixels of a row at once, picked
+// at init from what the CPU supports.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define RASTER_TILE_SIZE 64
+#define RASTER_MAX_THREADS 64
+
+typedef enum {
+    RASTER_SIMD_SCALAR,
+    RASTER_SIMD_SSE2, // 4 pixels at a time
+    RASTER_SIMD_AVX2, // 8 pixels at a time
+    RASTER_SIMD_COUNT,
+} RasterSimd;
+
+typedef struct {
+    float x; // Window pixels, origin bottom left
+    float y;
+    float color[3];
+} RasterVertex;
+
+// Edge k runs between the two vertices other than k. Its function is
+// evaluated from whichever endpoint sorts first, so the two triangles sharing
+// an edge compute bit-identical values of opposite sign.
+typedef struct {
+    float x[3]; // First endpoint
+    float y[3];
+    float dx[3];
+    float dy[3];
+    float sign[3];     // Makes the inside positive
+    bool top_left[3];  // Pixels exactly on the edge belong to this triangle
+    float weight[3][3]; // Colour of vertex k divided by twice the area, per channel
+    int min_x, min_y, max_x, max_y; // Pixel bounds, clipped to the target
+} RasterTriangle;
+
+typedef struct {
+    uint32_t *triangles; // Indices into the frame's triangles
+    int count;
+    int capacity;
+} RasterBin;
+
+typedef struct Rasterizer Rasterizer;
+
+typedef struct {
+    Rasterizer *raster;
+    HANDLE thread;
+    int index;
+} RasterWorker;
+
+struct Rasterizer {
+    RasterSimd simd;
+    int thread_count;  // Including the thread calling raster_end
+    int active_count;  // Threads sharing the tiles; at most thread_count
+
+    RasterWorker workers[RASTER_MAX_THREADS - 1];
+    CRITICAL_SECTION crit_sect;
+    CONDITION_VARIABLE cond_var;
+    uint64_t generation; // Bumped by raster_end to wake the workers
+    int workers_done;    // Active workers finished with this generation
+    bool stop;
+
+    // The frame being recorded
+    uint32_t *pixels;
+    int width;
+    int height;
+    int stride; // In pixels
+    uint32_t clear_value;
+    RasterTriangle *triangles;
+    int triangle_count;
+    int triangle_capacity;
+    RasterBin *bins;
+    int tiles_x;
+    int tiles_y;
+    int bin_capacity; // Tiles the bins array has room for
+    bool failed;      // An allocation failed; the frame is dropped
+
+    volatile LONG next_tile;
+    int64_t thread_pixels[RASTER_MAX_THREADS]; // Written by each thread, summed by raster_end
+
+    int64_t pixels_written; // Clears and triangle pixels of the last frame
+};
+
+// Starts thread_count - 1 workers; 0 means one thread per logical processor
+bool raster_init(Rasterizer *raster, int thread_count);
+void raster_destroy(Rasterizer *raster);
+
+int raster_hardware_threads(void);
+RasterSimd raster_best_simd(void);
+const char *raster_simd_name(RasterSimd simd);
+
+// Both are clamped to what init set up and the CPU supports. For comparing
+// configurations; they don't change the image.
+void raster_set_active_threads(Rasterizer *raster, int thread_count);
+void raster_set_simd(Rasterizer *raster, RasterSimd simd);
+
+// Starts a frame that clears `pixels` to an RGB colour. Each call below
+// returns false once an allocation for the frame has failed; the rest of the
+// frame is then ignored, and raster_end leaves `pixels` untouched.
+bool raster_begin(Rasterizer *raster, uint32_t *pixels, int width, int height, int stride, const float clear[3]);
+
+// Triangles in the order they are drawn. Either winding is filled.
+bool raster_triangles(Rasterizer *raster, const RasterVertex *vertices, const uint32_t *indices, int index_count);
+
+// Rasterizes the frame; the image is complete on return
+bool raster_end(Rasterizer *raster);
+
+#endif
@@ -0,0 +1,261 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "gl_capture.h"
+#include "shader_compiler.h"
+
+static void log_shader_error(GLuint shader, const char *label) {
+    char info_log[512];
+    char err_buf[640];
+    glGetShaderInfoLog(shader, sizeof(info_log), NULL, info_log);
+    sprintf_s(err_buf, sizeof(err_buf), "%s shader compilation failed\n%s\n", label, info_log);
+    OutputDebugStringA(err_buf);
+}
+
+// Issues the compile and link without querying any status, so a driver with
+// parallel compilation can work on it in the background
+static void begin_job(ShaderJob *job, bool retrievable) {
+    job->vertex_shader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(job->vertex_shader, 1, &job->vs_source, NULL);
+    glCompileShader(job->vertex_shader);
+
+    job->fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(job->fragment_shader, 1, &job->fs_source, NULL);
+    glCompileShader(job->fragment_shader);
+
+    job->program = glCreateProgram();
+    glAttachShader(job->program, job->vertex_shader);
+    glAttachShader(job->program, job->fragment_shader);
+    if (retrievable) glProgramParameteri(job->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(job->program);
+}
+
+static bool is_job_complete(const ShaderJob *job) {
+    GLint complete = GL_TRUE;
+    glGetProgramiv(job->program, GL_COMPLETION_STATUS_KHR, &complete);
+    return complete == GL_TRUE;
+}
+
+// Blocks until the link finished (unless it is already known to be complete), then checks the results
+static bool end_job(ShaderJob *job, ProgramCache *cache) {
+    int success;
+    glGetShaderiv(job->vertex_shader, GL_COMPILE_STATUS, &success);
+    if (!success) log_shader_error(job->vertex_shader, "Vertex");
+
+    glGetShaderiv(job->fragment_shader, GL_COMPILE_STATUS, &success);
+    if (!success) log_shader_error(job->fragment_shader, "Fragment");
+
+    glGetProgramiv(job->program, GL_LINK_STATUS, &success);
+    if (!success) {
+        char info_log[512];
+        char err_buf[640];
+        glGetProgramInfoLog(job->program, sizeof(info_log), NULL, info_log);
+        sprintf_s(err_buf, sizeof(err_buf), "Shader program linking failed\n%s\n", info_log);
+        OutputDebugStringA(err_buf);
+    } else if (cache) {
+        program_cache_store(cache, job->program, job->vs_source, job->fs_source);
+    }
+
+    glDeleteShader(job->vertex_shader);
+    glDeleteShader(job->fragment_shader);
+    job->vertex_shader = 0;
+    job->fragment_shader = 0;
+
+    if (!success) {
+        glDeleteProgram(job->program);
+        job->program = 0;
+    }
+    return success != 0;
+}
+
+GLuint compile_program(ProgramCache *cache, const char *vs_source, const char *fs_source) {
+    if (cache) {
+        GLuint cached = program_cache_load(cache, vs_source, fs_source);
+        if (cached) return cached;
+    }
+
+    ShaderJob job = {};
+    job.vs_source = vs_source;
+    job.fs_source = fs_source;
+    begin_job(&job, cache && cache->enabled);
+    end_job(&job, cache);
+    return job.program;
+}
+
+static void publish_job(ShaderCompiler *compiler, ShaderJob *job, bool success) {
+    GLsync fence = 0;
+    if (success) {
+        // Flush so the fence (and the link before it) becomes visible to the render context
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+    }
+
+    EnterCriticalSection(&compiler->crit_sect);
+    job->ready_fence = fence;
+    job->state = success ? SHADER_JOB_DONE : SHADER_JOB_FAILED;
+    LeaveCriticalSection(&compiler->crit_sect);
+}
+
+static DWORD shader_compiler_thread_func(LPVOID lParam) {
+    ShaderCompiler *compiler = (ShaderCompiler*)lParam;
+    wglMakeCurrent(compiler->hdc, compiler->context);
+#ifdef GLAD_MX
+    // Every entry point is resolved on first use, against this context
+    gladMakeContextCurrentGL(&compiler->gl);
+    gladLoadGLLazy(NULL, 0);
+    gl_capture_attach(&compiler->gl);
+#endif
+
+    bool parallel = GLAD_GL_KHR_parallel_shader_compile != 0;
+    if (parallel) glMaxShaderCompilerThreadsKHR(0xFFFFFFFF); // Let the driver pick
+
+    ShaderJob *batch[MAX_SHADER_JOBS];
+
+    while (true) {
+        EnterCriticalSection(&compiler->crit_sect);
+
+        int batch_count = 0;
+        while (!compiler->stop) {
+            for (int i = 0; i < MAX_SHADER_JOBS; i++) {
+                if (compiler->jobs[i].state == SHADER_JOB_QUEUED) {
+                    compiler->jobs[i].state = SHADER_JOB_COMPILING;
+                    batch[batch_count++] = &compiler->jobs[i];
+                }
+            }
+            if (batch_count) break;
+            SleepConditionVariableCS(&compiler->cond_var, &compiler->crit_sect, INFINITE);
+        }
+        bool stop = compiler->stop;
+
+        LeaveCriticalSection(&compiler->crit_sect);
+
+        if (stop) break;
+
+        // Start everything first, then collect results, so with parallel
+        // compilation all of the batch is in flight at the same time
+        int pending = 0;
+        for (int i = 0; i < batch_count; i++) {
+            ShaderJob *job = batch[i];
+            GLuint cached = compiler->cache ? program_cache_load(compiler->cache, job->vs_source, job->fs_source) : 0;
+            if (cached) {
+                job->program = cached;
+                publish_job(compiler, job, true);
+                continue;
+            }
+            begin_job(job, compiler->cache && compiler->cache->enabled);
+            batch[pending++] = job;
+        }
+
+        while (pending) {
+            int still_pending = 0;
+            for (int i = 0; i < pending; i++) {
+                ShaderJob *job = batch[i];
+                if (parallel && !is_job_complete(job)) {
+                    batch[still_pending++] = job;
+                    continue;
+                }
+                publish_job(compiler, job, end_job(job, compiler->cache));
+            }
+            pending = still_pending;
+            if (pending) Sleep(1);
+        }
+    }
+
+#ifdef GLAD_MX
+    gladMakeContextCurrentGL(NULL);
+    gladDestroyContextGL(&compiler->gl);
+#endif
+    wglMakeCurrent(NULL, NULL);
+    return 0;
+}
+
+bool shader_compiler_start(ShaderCompiler *compiler, HDC hdc, HGLRC context, ProgramCache *cache) {
+    memset(compiler, 0, sizeof(*compiler));
+    compiler->hdc = hdc;
+    compiler->context = context;
+    compiler->cache = cache;
+    InitializeCriticalSection(&compiler->crit_sect);
+    InitializeConditionVariable(&compiler->cond_var);
+
+    compiler->thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)shader_compiler_thread_func, compiler, 0, NULL);
+    return compiler->thread != NULL;
+}
+
+void shader_compiler_stop(ShaderCompiler *compiler) {
+    if (!compiler->thread) return;
+
+    EnterCriticalSection(&compiler->crit_sect);
+    compiler->stop = true;
+    WakeConditionVariable(&compiler->cond_var);
+    LeaveCriticalSection(&compiler->crit_sect);
+
+    WaitForSingleObject(compiler->thread, INFINITE);
+    CloseHandle(compiler->thread);
+    compiler->thread = NULL;
+    DeleteCriticalSection(&compiler->crit_sect);
+}
+
+int shader_compiler_submit(ShaderCompiler *compiler, const char *vs_source, const char *fs_source) {
+    int handle = -1;
+
+    EnterCriticalSection(&compiler->crit_sect);
+    for (int i = 0; i < MAX_SHADER_JOBS; i++) {
+        ShaderJob *job = &compiler->jobs[i];
+        if (job->state != SHADER_JOB_FREE) continue;
+
+        memset(job, 0, sizeof(*job));
+        job->vs_source = vs_source;
+        job->fs_source = fs_source;
+        job->state = SHADER_JOB_QUEUED;
+        handle = i;
+        WakeConditionVariable(&compiler->cond_var);
+        break;
+    }
+    LeaveCriticalSection(&compiler->crit_sect);
+
+    return handle;
+}
+
+GLuint shader_compiler_poll(ShaderCompiler *compiler, int handle) {
+    if (handle < 0 || handle >= MAX_SHADER_JOBS) return 0;
+    ShaderJob *job = &compiler->jobs[handle];
+
+    EnterCriticalSection(&compiler->crit_sect);
+    bool done = job->state == SHADER_JOB_DONE;
+    GLsync fence = job->ready_fence;
+    LeaveCriticalSection(&compiler->crit_sect);
+
+    if (!done) return 0;
+
+    // The worker only fences after linking; the program is usable here once that fence has passed
+    GLenum status = glClientWaitSync(fence, 0, 0);
+    if (status == GL_TIMEOUT_EXPIRED) return 0;
+
+    glDeleteSync(fence);
+
+    GLuint program = job->program;
+    if (status == GL_WAIT_FAILED) {
+        // The fence will never signal, so the worker's program can't be relied
+        // on here. Build it again on this context instead.
+        OutputDebugStringA("Shader compiler: waiting for a finished program failed, compiling it again\n");
+        glDeleteProgram(program);
+        program = compile_program(NULL, job->vs_source, job->fs_source);
+    }
+
+    EnterCriticalSection(&compiler->crit_sect);
+    job->ready_fence = 0;
+    job->program = program;
+    job->state = program ? SHADER_JOB_CONSUMED : SHADER_JOB_FAILED;
+    LeaveCriticalSection(&compiler->crit_sect);
+
+    return program;
+}
+
+bool shader_compiler_failed(ShaderCompiler *compiler, int handle) {
+    if (handle < 0 || handle >= MAX_SHADER_JOBS) return true;
+
+    EnterCriticalSection(&compiler->crit_sect);
+    bool failed = compiler->jobs[handle].state == SHADER_JOB_FAILED;
+    LeaveCriticalSection(&compiler->crit_sect);
+    return failed;
+}
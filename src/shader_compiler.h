@@ -0,0 +1,72 @@
+#ifndef SHADER_COMPILER_H
+#define SHADER_COMPILER_H
+
+// Compiles and links programs on a worker thread that owns a context shared
+// with the render context. Finished programs are handed over with a fence, so
+// the render thread can poll for them without blocking and draw with a
+// fallback program in the meantime. Uses KHR_parallel_shader_compile when the
+// driver has it, so several programs compile at once.
+
+#include <stdbool.h>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "glad/glad.h"
+#include "program_cache.h"
+
+#define MAX_SHADER_JOBS 16
+
+enum ShaderJobState {
+    SHADER_JOB_FREE,
+    SHADER_JOB_QUEUED,
+    SHADER_JOB_COMPILING,
+    SHADER_JOB_DONE,     // Program and fence are set
+    SHADER_JOB_FAILED,
+    SHADER_JOB_CONSUMED, // Handed to the render thread
+};
+
+typedef struct {
+    int state;
+    const char *vs_source;
+    const char *fs_source;
+    GLuint vertex_shader;
+    GLuint fragment_shader;
+    GLuint program;
+    GLsync ready_fence;
+} ShaderJob;
+
+typedef struct {
+    HANDLE thread;
+    HDC hdc;
+    HGLRC context;
+    ProgramCache *cache;
+#ifdef GLAD_MX
+    GladGLContext gl; // The compile context's own dispatch table
+#endif
+
+    CRITICAL_SECTION crit_sect;
+    CONDITION_VARIABLE cond_var;
+    bool stop;
+    ShaderJob jobs[MAX_SHADER_JOBS];
+} ShaderCompiler;
+
+// Compiles and links on the calling thread's current context
+GLuint compile_program(ProgramCache *cache, const char *vs_source, const char *fs_source);
+
+// `context` must already share objects with the render context and use a
+// pixel format compatible with `hdc`
+bool shader_compiler_start(ShaderCompiler *compiler, HDC hdc, HGLRC context, ProgramCache *cache);
+void shader_compiler_stop(ShaderCompiler *compiler);
+
+// Returns a job handle, or -1 if every slot is in use. Sources must stay alive until the job finishes.
+int shader_compiler_submit(ShaderCompiler *compiler, const char *vs_source, const char *fs_source);
+
+// Returns the program once it has been linked and its fence has signalled on
+// the calling thread's context, otherwise 0. Returns each program only once.
+// If waiting on the fence fails, the program is compiled again on the calling
+// thread, and the job fails if that does too.
+GLuint shader_compiler_poll(ShaderCompiler *compiler, int job);
+bool shader_compiler_failed(ShaderCompiler *compiler, int job);
+
+#endif
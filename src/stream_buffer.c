@@ -0,0 +1,178 @@
+#include <string.h>
+
+#include "gl_state.h"
+#include "stream_buffer.h"
+
+static GLintptr align_offset(GLintptr value, GLsizeiptr alignment) {
+    if (alignment <= 1) return value;
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+static void delete_fences(StreamBuffer *stream) {
+    for (int i = 0; i < STREAM_BUFFER_REGIONS; i++) {
+        if (stream->fences[i]) {
+            glDeleteSync(stream->fences[i]);
+            stream->fences[i] = 0;
+        }
+    }
+}
+
+// Drops the old storage (the driver keeps it alive for pending draws) and starts from region 0
+static void orphan(StreamBuffer *stream) {
+    gl_state_bind_buffer(stream->target, stream->buffer);
+    glBufferData(stream->target, stream->region_size * STREAM_BUFFER_REGIONS, NULL, GL_STREAM_DRAW);
+    delete_fences(stream);
+    stream->region = 0;
+    stream->cursor = 0;
+    stream->orphans++;
+}
+
+// Persistent storage stays put, so the only option is to wait for the GPU
+static void wait_for_region(StreamBuffer *stream, GLsync fence) {
+    GLenum status = glClientWaitSync(fence, 0, 0);
+    if (status != GL_TIMEOUT_EXPIRED) return;
+
+    stream->stalls++;
+    do {
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+    } while (status == GL_TIMEOUT_EXPIRED);
+}
+
+static void advance_region(StreamBuffer *stream) {
+    GLsync *fence = &stream->fences[stream->region];
+    if (*fence) glDeleteSync(*fence);
+    *fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    int next = (stream->region + 1) % STREAM_BUFFER_REGIONS;
+    GLsync next_fence = stream->fences[next];
+    if (next_fence) {
+        if (stream->persistent) {
+            wait_for_region(stream, next_fence);
+        } else {
+            GLenum status = glClientWaitSync(next_fence, 0, 0);
+            if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED) {
+                orphan(stream);
+                return;
+            }
+        }
+        glDeleteSync(next_fence);
+        stream->fences[next] = 0;
+        stream->regions_recycled++;
+    }
+
+    stream->region = next;
+    stream->cursor = 0;
+}
+
+static void create_storage(StreamBuffer *stream, bool persistent) {
+    GLsizeiptr size = stream->region_size * STREAM_BUFFER_REGIONS;
+
+    if (persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &stream->buffer);
+        glNamedBufferStorage(stream->buffer, size, NULL, flags);
+        stream->persistent_base = (uint8_t*)glMapNamedBufferRange(stream->buffer, 0, size, flags);
+        if (stream->persistent_base) {
+            stream->persistent = true;
+            return;
+        }
+        glDeleteBuffers(1, &stream->buffer); // Fall back to the mapped-per-write ring
+    }
+
+    glGenBuffers(1, &stream->buffer);
+    glBindBuffer(stream->target, stream->buffer);
+    glBufferData(stream->target, size, NULL, GL_STREAM_DRAW);
+    glBindBuffer(stream->target, 0);
+}
+
+static void delete_storage(StreamBuffer *stream) {
+    delete_fences(stream);
+    if (stream->persistent) glUnmapNamedBuffer(stream->buffer);
+    glDeleteBuffers(1, &stream->buffer);
+}
+
+void stream_buffer_init(StreamBuffer *stream, GLenum target, GLsizeiptr region_size, bool persistent) {
+    memset(stream, 0, sizeof(*stream));
+    stream->target = target;
+    stream->region_size = region_size;
+    create_storage(stream, persistent);
+}
+
+void stream_buffer_destroy(StreamBuffer *stream) {
+    delete_storage(stream);
+    memset(stream, 0, sizeof(*stream));
+}
+
+bool stream_buffer_reserve(StreamBuffer *stream, GLsizeiptr size) {
+    if (size <= stream->region_size) return false;
+
+    // The GL keeps the old storage alive for the draws still reading it
+    bool persistent = stream->persistent;
+    delete_storage(stream);
+    gl_state_invalidate(); // Deleting the buffer unbound it behind the cache's back
+
+    while (stream->region_size < size) stream->region_size *= 2;
+    stream->persistent = false;
+    stream->persistent_base = NULL;
+    stream->region = 0;
+    stream->cursor = 0;
+    stream->grows++;
+    create_storage(stream, persistent);
+    return true;
+}
+
+void *stream_buffer_map(StreamBuffer *stream, GLsizeiptr size, GLsizeiptr alignment, GLintptr *offset) {
+    if (size > stream->region_size) return NULL;
+
+    GLintptr start = align_offset(stream->cursor, alignment);
+    if (start + size > stream->region_size) {
+        advance_region(stream);
+        start = 0;
+    }
+
+    GLintptr buffer_offset = (GLintptr)stream->region * stream->region_size + start;
+
+    void *ptr;
+    if (stream->persistent) {
+        // Coherent, so writes through the pointer are visible to draws issued afterwards
+        ptr = stream->persistent_base + buffer_offset;
+    } else {
+        // The region's fence has signalled (or the buffer was orphaned), so nothing
+        // the GPU is still reading overlaps this range
+        gl_state_bind_buffer(stream->target, stream->buffer);
+        ptr = glMapBufferRange(stream->target, buffer_offset, size,
+                               GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (!ptr) return NULL;
+        stream->mapped = true;
+        stream->mapped_offset = buffer_offset;
+    }
+
+    stream->cursor = start + size;
+    stream->bytes_written += (uint64_t)size;
+    *offset = buffer_offset;
+    return ptr;
+}
+
+void stream_buffer_unmap(StreamBuffer *stream) {
+    if (!stream->mapped) return;
+    gl_state_bind_buffer(stream->target, stream->buffer);
+    glUnmapBuffer(stream->target);
+    stream->mapped = false;
+}
+
+bool stream_buffer_fits(const StreamBuffer *stream, GLsizeiptr size, GLsizeiptr alignment) {
+    return align_offset(stream->cursor, alignment) + size <= stream->region_size;
+}
+
+bool stream_buffer_write(StreamBuffer *stream, const void *data, GLsizeiptr size, GLsizeiptr alignment, GLintptr *offset) {
+    void *ptr = stream_buffer_map(stream, size, alignment, offset);
+    if (!ptr) return false;
+    memcpy(ptr, data, (size_t)size);
+    stream_buffer_unmap(stream);
+    return true;
+}
+
+void stream_buffer_end_frame(StreamBuffer *stream) {
+    if (stream->cursor == 0) return; // Nothing written this frame, keep the region
+    advance_region(stream);
+}
@@ -0,0 +1,71 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+// Ring allocator for per-frame dynamic data. One large buffer is split into
+// regions; each region is written with unsynchronized maps and only reused
+// once the fence placed after its last use has signalled. If the GPU is still
+// reading the next region, the whole buffer is orphaned instead of waiting.
+//
+// In persistent mode (GL 4.4 buffer storage) the buffer is mapped once,
+// coherent, for its whole lifetime. Map and unmap become pointer arithmetic;
+// immutable storage can't be orphaned, so a busy region is waited for instead.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+#define STREAM_BUFFER_REGIONS 4
+
+typedef struct {
+    GLuint buffer;
+    GLenum target;
+    GLsizeiptr region_size;
+
+    int region;        // Region currently being written
+    GLintptr cursor;   // Write offset within that region
+    GLsync fences[STREAM_BUFFER_REGIONS];
+
+    bool mapped;
+    GLintptr mapped_offset;
+
+    bool persistent;
+    uint8_t *persistent_base; // Whole buffer, mapped at init in persistent mode
+
+    // Statistics, never reset by the buffer itself
+    uint64_t bytes_written;
+    uint64_t regions_recycled;
+    uint64_t orphans;
+    uint64_t stalls; // Persistent mode: waits for the GPU to release a region
+    uint64_t grows;  // Times stream_buffer_reserve replaced the buffer
+} StreamBuffer;
+
+// persistent requires gl_caps.buffer_storage and gl_caps.direct_state_access
+void stream_buffer_init(StreamBuffer *stream, GLenum target, GLsizeiptr region_size, bool persistent);
+void stream_buffer_destroy(StreamBuffer *stream);
+
+// Doubles the region size until a region holds `size` bytes, so a frame that
+// writes that much is fenced once at its end instead of wrapping the ring onto
+// its own regions. The buffer is replaced when it grows, and true returned;
+// call between frames, and point anything bound to the old buffer at the new
+// one. Growing keeps the region size a multiple of what it was.
+bool stream_buffer_reserve(StreamBuffer *stream, GLsizeiptr size);
+
+// Maps `size` bytes at the next `alignment`-aligned offset and returns a write
+// pointer, with the buffer offset in `offset`. Returns NULL if size exceeds a
+// region. Must be followed by stream_buffer_unmap before drawing.
+void *stream_buffer_map(StreamBuffer *stream, GLsizeiptr size, GLsizeiptr alignment, GLintptr *offset);
+void stream_buffer_unmap(StreamBuffer *stream);
+
+// True if `size` bytes still fit in the current region, i.e. the next map won't
+// fence this region and move on
+bool stream_buffer_fits(const StreamBuffer *stream, GLsizeiptr size, GLsizeiptr alignment);
+
+// Convenience wrapper for map + memcpy + unmap
+bool stream_buffer_write(StreamBuffer *stream, const void *data, GLsizeiptr size, GLsizeiptr alignment, GLintptr *offset);
+
+// Fences the current region and moves to the next one. Call once per frame
+// after the draws that read this frame's data have been issued.
+void stream_buffer_end_frame(StreamBuffer *stream);
+
+#endif
@@ -0,0 +1,690 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gl_state.h"
+#include "texture_stream.h"
+
+#define GENERATED_TEXTURE_SIZE 1024
+#define MAX_IMAGE_SIZE 32768 // Keeps the chain within TEXTURE_STREAM_MAX_LEVELS and a row within a slot
+
+static int level_extent(int size, int level) {
+    int extent = size >> level;
+    return extent ? extent : 1;
+}
+
+static size_t level_bytes(int width, int height, int level) {
+    return (size_t)level_extent(width, level) * (size_t)level_extent(height, level) * 4;
+}
+
+// --------------------------------------------------
+// ----- Decoding (decode thread)
+// --------------------------------------------------
+typedef struct {
+    int width;
+    int height;
+    int levels;
+    uint8_t *pixels[TEXTURE_STREAM_MAX_LEVELS]; // RGBA8, bottom row first
+} DecodedImage;
+
+static void free_image(DecodedImage *image) {
+    for (int i = 0; i < image->levels; i++) free(image->pixels[i]);
+    memset(image, 0, sizeof(*image));
+}
+
+static uint32_t read_u16(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t read_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint8_t *read_file(const char *path, DWORD *size) {
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return NULL;
+
+    DWORD bytes_read = 0;
+    *size = GetFileSize(file, NULL);
+    uint8_t *data = *size != INVALID_FILE_SIZE ? (uint8_t*)malloc(*size) : NULL;
+    bool valid = data && ReadFile(file, data, *size, &bytes_read, NULL) && bytes_read == *size;
+    CloseHandle(file);
+
+    if (!valid) {
+        free(data);
+        return NULL;
+    }
+    return data;
+}
+
+// Uncompressed 24 or 32-bit BMP, either row order
+static bool load_bmp(const char *path, DecodedImage *image) {
+    DWORD size = 0;
+    uint8_t *file = read_file(path, &size);
+    if (!file) return false;
+
+    bool valid = size >= 54 && file[0] == 'B' && file[1] == 'M';
+    uint32_t pixel_offset = valid ? read_u32(file + 10) : 0;
+    int32_t width = valid ? (int32_t)read_u32(file + 18) : 0;
+    int32_t height = valid ? (int32_t)read_u32(file + 22) : 0;
+    uint32_t bits = valid ? read_u16(file + 28) : 0;
+    uint32_t compression = valid ? read_u32(file + 30) : 1;
+
+    bool top_down = height < 0;
+    if (top_down) height = -height;
+    size_t stride = ((size_t)width * bits + 31) / 32 * 4;
+
+    valid = valid && compression == 0 && (bits == 24 || bits == 32) &&
+            width > 0 && height > 0 && width <= MAX_IMAGE_SIZE && height <= MAX_IMAGE_SIZE &&
+            pixel_offset + stride * (size_t)height <= size;
+
+    uint8_t *pixels = valid ? (uint8_t*)malloc((size_t)width * (size_t)height * 4) : NULL;
+    if (!pixels) {
+        free(file);
+        return false;
+    }
+
+    int bytes_per_pixel = (int)bits / 8;
+    for (int y = 0; y < height; y++) {
+        const uint8_t *src = file + pixel_offset + stride * (size_t)(top_down ? height - 1 - y : y);
+        uint8_t *dst = pixels + (size_t)y * (size_t)width * 4;
+        for (int x = 0; x < width; x++) {
+            dst[0] = src[2];
+            dst[1] = src[1];
+            dst[2] = src[0];
+            dst[3] = 255; // BI_RGB leaves the fourth byte unused
+            src += bytes_per_pixel;
+            dst += 4;
+        }
+    }
+    free(file);
+
+    image->width = width;
+    image->height = height;
+    image->pixels[0] = pixels;
+    image->levels = 1;
+    return true;
+}
+
+static uint32_t hash_u32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// A checkerboard in two colours picked from the seed, under a diagonal
+// gradient, so every texture and every mip level is told apart at a glance
+static bool generate_image(uint32_t seed, DecodedImage *image) {
+    int size = GENERATED_TEXTURE_SIZE;
+    uint8_t *pixels = (uint8_t*)malloc((size_t)size * size * 4);
+    if (!pixels) return false;
+
+    uint32_t a = hash_u32(seed * 2 + 1);
+    uint32_t b = hash_u32(seed * 2 + 2);
+    int cell = 32 << (seed % 3);
+    for (int y = 0; y < size; y++) {
+        uint8_t *dst = pixels + (size_t)y * size * 4;
+        for (int x = 0; x < size; x++) {
+            uint32_t color = ((x / cell) + (y / cell)) & 1 ? a : b;
+            int shade = 160 + (x + y) * 95 / (2 * size);
+            dst[0] = (uint8_t)((color & 0xFF) * shade / 255);
+            dst[1] = (uint8_t)(((color >> 8) & 0xFF) * shade / 255);
+            dst[2] = (uint8_t)(((color >> 16) & 0xFF) * shade / 255);
+            dst[3] = 255;
+            dst += 4;
+        }
+    }
+
+    image->width = size;
+    image->height = size;
+    image->pixels[0] = pixels;
+    image->levels = 1;
+    return true;
+}
+
+// 2x2 box filter; the last row or column of an odd level is reused
+static bool build_mip_chain(DecodedImage *image) {
+    while (image->levels < TEXTURE_STREAM_MAX_LEVELS) {
+        int level = image->levels;
+        int src_width = level_extent(image->width, level - 1);
+        int src_height = level_extent(image->height, level - 1);
+        if (src_width == 1 && src_height == 1) break;
+
+        int width = level_extent(image->width, level);
+        int height = level_extent(image->height, level);
+        uint8_t *pixels = (uint8_t*)malloc((size_t)width * height * 4);
+        if (!pixels) return false;
+
+        const uint8_t *src = image->pixels[level - 1];
+        for (int y = 0; y < height; y++) {
+            int y0 = y * 2 < src_height ? y * 2 : src_height - 1;
+            int y1 = y * 2 + 1 < src_height ? y * 2 + 1 : src_height - 1;
+            for (int x = 0; x < width; x++) {
+                int x0 = x * 2 < src_width ? x * 2 : src_width - 1;
+                int x1 = x * 2 + 1 < src_width ? x * 2 + 1 : src_width - 1;
+                const uint8_t *p00 = src + ((size_t)y0 * src_width + x0) * 4;
+                const uint8_t *p01 = src + ((size_t)y0 * src_width + x1) * 4;
+                const uint8_t *p10 = src + ((size_t)y1 * src_width + x0) * 4;
+                const uint8_t *p11 = src + ((size_t)y1 * src_width + x1) * 4;
+                uint8_t *dst = pixels + ((size_t)y * width + x) * 4;
+                for (int c = 0; c < 4; c++) dst[c] = (uint8_t)((p00[c] + p01[c] + p10[c] + p11[c] + 2) / 4);
+            }
+        }
+        image->pixels[level] = pixels;
+        image->levels++;
+    }
+    return true;
+}
+
+// Waits for a mapped slot. Returns NULL when stopping or when the texture was dropped meanwhile.
+static StagingSlot *acquire_slot(TextureStream *stream) {
+    StagingSlot *slot = NULL;
+
+    EnterCriticalSection(&stream->crit_sect);
+    while (!stream->stop && !stream->decode_cancelled) {
+        for (int i = 0; i < TEXTURE_STREAM_SLOTS; i++) {
+            if (stream->slots[i].state == STAGING_WRITABLE) {
+                slot = &stream->slots[i];
+                slot->state = STAGING_WRITING;
+                break;
+            }
+        }
+        if (slot) break;
+        SleepConditionVariableCS(&stream->cond_var, &stream->crit_sect, INFINITE);
+    }
+    LeaveCriticalSection(&stream->crit_sect);
+
+    return slot;
+}
+
+static bool emit_level(TextureStream *stream, const DecodeRequest *request, const DecodedImage *image, int level) {
+    int width = level_extent(image->width, level);
+    int height = level_extent(image->height, level);
+    size_t row_bytes = (size_t)width * 4;
+    int band_rows = (int)(TEXTURE_STREAM_SLOT_SIZE / row_bytes);
+
+    for (int y = 0; y < height; y += band_rows) {
+        int rows = height - y < band_rows ? height - y : band_rows;
+        StagingSlot *slot = acquire_slot(stream);
+        if (!slot) return false;
+
+        memcpy(slot->ptr, image->pixels[level] + (size_t)y * row_bytes, (size_t)rows * row_bytes);
+
+        EnterCriticalSection(&stream->crit_sect);
+        slot->sequence = stream->next_sequence++;
+        slot->texture = request->texture;
+        slot->generation = request->generation;
+        slot->image_width = image->width;
+        slot->image_height = image->height;
+        slot->levels = image->levels;
+        slot->level = level;
+        slot->y = y;
+        slot->rows = rows;
+        slot->state = STAGING_FILLED;
+        LeaveCriticalSection(&stream->crit_sect);
+    }
+    return true;
+}
+
+static DWORD texture_stream_thread_func(LPVOID lParam) {
+    TextureStream *stream = (TextureStream*)lParam;
+
+    while (true) {
+        EnterCriticalSection(&stream->crit_sect);
+        while (!stream->stop && !stream->request_count) {
+            SleepConditionVariableCS(&stream->cond_var, &stream->crit_sect, INFINITE);
+        }
+        bool stop = stream->stop;
+        DecodeRequest request = {};
+        if (!stop) {
+            request = stream->requests[stream->request_head];
+            stream->request_head = (stream->request_head + 1) % TEXTURE_STREAM_MAX_REQUESTS;
+            stream->request_count--;
+            stream->decoding = request.texture;
+            stream->decode_cancelled = false;
+        }
+        LeaveCriticalSection(&stream->crit_sect);
+
+        if (stop) break;
+        if (request.texture < 0) continue; // Cancelled while queued
+
+        LARGE_INTEGER start, end;
+        QueryPerformanceCounter(&start);
+
+        DecodedImage image = {};
+        bool loaded = request.path[0] ? load_bmp(request.path, &image) : generate_image(request.seed, &image);
+        if (loaded && build_mip_chain(&image)) {
+            int finest = request.finest_level < image.levels ? request.finest_level : image.levels - 1;
+            int coarsest = request.coarsest_level >= 0 && request.coarsest_level < image.levels ?
+                           request.coarsest_level : image.levels - 1;
+            for (int level = coarsest; level >= finest; level--) {
+                if (!emit_level(stream, &request, &image, level)) break;
+            }
+        } else {
+            char err_buf[TEXTURE_STREAM_MAX_PATH + 64];
+            sprintf_s(err_buf, sizeof(err_buf), "Texture stream: could not load %s\n",
+                      request.path[0] ? request.path : "a generated image");
+            OutputDebugStringA(err_buf);
+        }
+        free_image(&image);
+
+        QueryPerformanceCounter(&end);
+
+        EnterCriticalSection(&stream->crit_sect);
+        stream->decoding = -1;
+        stream->decode_counts += (uint64_t)(end.QuadPart - start.QuadPart);
+        LeaveCriticalSection(&stream->crit_sect);
+    }
+    return 0;
+}
+
+// --------------------------------------------------
+// ----- Staging ring (render thread)
+// --------------------------------------------------
+// Persistent slots are mapped once for good, the others on every trip to the decode thread
+static bool create_slots(TextureStream *stream, bool persistent) {
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    bool mapped = true;
+    for (int i = 0; i < TEXTURE_STREAM_SLOTS; i++) {
+        StagingSlot *slot = &stream->slots[i];
+        if (persistent) {
+            glCreateBuffers(1, &slot->pbo);
+            glNamedBufferStorage(slot->pbo, TEXTURE_STREAM_SLOT_SIZE, NULL, flags);
+            slot->ptr = (uint8_t*)glMapNamedBufferRange(slot->pbo, 0, TEXTURE_STREAM_SLOT_SIZE, flags);
+            mapped = mapped && slot->ptr;
+        } else {
+            glGenBuffers(1, &slot->pbo);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot->pbo);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, TEXTURE_STREAM_SLOT_SIZE, NULL, GL_STREAM_DRAW);
+        }
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    if (mapped) return true;
+
+    for (int i = 0; i < TEXTURE_STREAM_SLOTS; i++) {
+        StagingSlot *slot = &stream->slots[i];
+        if (slot->ptr) glUnmapNamedBuffer(slot->pbo);
+        glDeleteBuffers(1, &slot->pbo);
+        slot->pbo = 0;
+        slot->ptr = NULL;
+    }
+    return false;
+}
+
+bool texture_stream_start(TextureStream *stream, size_t residency_limit, size_t upload_budget, bool persistent) {
+    memset(stream, 0, sizeof(*stream));
+    stream->residency_limit = residency_limit;
+    stream->upload_budget = upload_budget;
+    stream->decoding = -1;
+    stream->frame = 1; // A last_used_frame of 0 means never drawn
+    InitializeCriticalSection(&stream->crit_sect);
+    InitializeConditionVariable(&stream->cond_var);
+
+    stream->persistent = persistent && create_slots(stream, true);
+    if (!stream->persistent) create_slots(stream, false);
+
+    stream->thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)texture_stream_thread_func, stream, 0, NULL);
+    return stream->thread != NULL;
+}
+
+void texture_stream_stop(TextureStream *stream) {
+    if (stream->thread) {
+        EnterCriticalSection(&stream->crit_sect);
+        stream->stop = true;
+        WakeConditionVariable(&stream->cond_var);
+        LeaveCriticalSection(&stream->crit_sect);
+
+        WaitForSingleObject(stream->thread, INFINITE);
+        CloseHandle(stream->thread);
+        stream->thread = NULL;
+    }
+    DeleteCriticalSection(&stream->crit_sect);
+
+    for (int i = 0; i < TEXTURE_STREAM_SLOTS; i++) {
+        StagingSlot *slot = &stream->slots[i];
+        if (slot->fence) glDeleteSync(slot->fence);
+        if (slot->ptr) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot->pbo);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+        glDeleteBuffers(1, &slot->pbo);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    for (int i = 0; i < TEXTURE_STREAM_MAX_TEXTURES; i++) {
+        if (stream->textures[i].texture) glDeleteTextures(1, &stream->textures[i].texture);
+    }
+    memset(stream->slots, 0, sizeof(stream->slots));
+    memset(stream->textures, 0, sizeof(stream->textures));
+    gl_state_invalidate();
+}
+
+static void set_slot_state(TextureStream *stream, StagingSlot *slot, int state) {
+    EnterCriticalSection(&stream->crit_sect);
+    slot->state = state;
+    LeaveCriticalSection(&stream->crit_sect);
+}
+
+static void recycle_slots(TextureStream *stream) {
+    for (int i = 0; i < TEXTURE_STREAM_SLOTS; i++) {
+        StagingSlot *slot = &stream->slots[i];
+        if (slot->state != STAGING_IN_FLIGHT) continue;
+
+        GLenum status = glClientWaitSync(slot->fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) continue;
+        glDeleteSync(slot->fence);
+        slot->fence = 0;
+        set_slot_state(stream, slot, STAGING_FREE);
+    }
+}
+
+// Hands free slots to the decode thread. Without persistent mapping the old
+// contents are invalidated, and the fence already guarantees the GPU is done.
+static void publish_slots(TextureStream *stream) {
+    bool published = false;
+    for (int i = 0; i < TEXTURE_STREAM_SLOTS; i++) {
+        StagingSlot *slot = &stream->slots[i];
+        if (slot->state != STAGING_FREE) continue;
+
+        if (!stream->persistent) {
+            GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+            gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, slot->pbo);
+            slot->ptr = (uint8_t*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, TEXTURE_STREAM_SLOT_SIZE, access);
+            if (!slot->ptr) continue;
+        }
+        set_slot_state(stream, slot, STAGING_WRITABLE);
+        published = true;
+    }
+    gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (published) WakeConditionVariable(&stream->cond_var);
+}
+
+// --------------------------------------------------
+// ----- Textures (render thread)
+// --------------------------------------------------
+// Drops queued requests for the texture and stops the decode thread if it is working on it
+static void cancel_requests(TextureStream *stream, int handle) {
+    EnterCriticalSection(&stream->crit_sect);
+    for (int i = 0; i < stream->request_count; i++) {
+        DecodeRequest *request = &stream->requests[(stream->request_head + i) % TEXTURE_STREAM_MAX_REQUESTS];
+        if (request->texture == handle) request->texture = -1;
+    }
+    if (stream->decoding == handle) {
+        stream->decode_cancelled = true;
+        WakeConditionVariable(&stream->cond_var);
+    }
+    LeaveCriticalSection(&stream->crit_sect);
+}
+
+static bool queue_request(TextureStream *stream, int handle, int finest_level, int coarsest_level) {
+    StreamedTexture *tex = &stream->textures[handle];
+    bool queued = false;
+
+    EnterCriticalSection(&stream->crit_sect);
+    if (stream->request_count < TEXTURE_STREAM_MAX_REQUESTS) {
+        int index = (stream->request_head + stream->request_count) % TEXTURE_STREAM_MAX_REQUESTS;
+        DecodeRequest *request = &stream->requests[index];
+        request->texture = handle;
+        request->generation = tex->generation;
+        request->finest_level = finest_level;
+        request->coarsest_level = coarsest_level;
+        memcpy(request->path, tex->path, sizeof(request->path));
+        request->seed = tex->seed;
+        stream->request_count++;
+        WakeConditionVariable(&stream->cond_var);
+        queued = true;
+    }
+    LeaveCriticalSection(&stream->crit_sect);
+
+    if (queued) {
+        tex->loading_level = finest_level;
+        tex->request_pending = true;
+    }
+    return queued;
+}
+
+int texture_stream_create(TextureStream *stream, const char *path, uint32_t seed) {
+    for (int i = 0; i < TEXTURE_STREAM_MAX_TEXTURES; i++) {
+        StreamedTexture *tex = &stream->textures[i];
+        if (tex->active) continue;
+
+        // The generation carries over, so bands for a previous occupant are still recognised as stale
+        uint32_t generation = tex->generation + 1;
+        memset(tex, 0, sizeof(*tex));
+        tex->active = true;
+        tex->generation = generation;
+        if (path) sprintf_s(tex->path, sizeof(tex->path), "%s", path);
+        tex->seed = seed;
+        tex->wanted_level = TEXTURE_STREAM_MAX_LEVELS;
+        tex->loading_level = TEXTURE_STREAM_MAX_LEVELS;
+        return i;
+    }
+    return -1;
+}
+
+static void release_storage(TextureStream *stream, StreamedTexture *tex) {
+    for (int level = 0; level < tex->levels; level++) {
+        if (tex->level_rows[level] >= 0) stream->resident_bytes -= level_bytes(tex->width, tex->height, level);
+    }
+    if (tex->texture) {
+        glDeleteTextures(1, &tex->texture);
+        tex->texture = 0;
+        gl_state_invalidate();
+    }
+}
+
+void texture_stream_release(TextureStream *stream, int handle) {
+    if (handle < 0 || handle >= TEXTURE_STREAM_MAX_TEXTURES || !stream->textures[handle].active) return;
+    StreamedTexture *tex = &stream->textures[handle];
+
+    cancel_requests(stream, handle);
+    release_storage(stream, tex);
+    tex->active = false;
+    tex->generation++;
+}
+
+GLuint texture_stream_use(TextureStream *stream, int handle, int wanted_level) {
+    if (handle < 0 || handle >= TEXTURE_STREAM_MAX_TEXTURES || !stream->textures[handle].active) return 0;
+    StreamedTexture *tex = &stream->textures[handle];
+
+    tex->last_used_frame = stream->frame;
+    tex->wanted_level = wanted_level > 0 ? wanted_level : 0;
+    return tex->width && tex->resident_level < tex->levels ? tex->texture : 0;
+}
+
+// The first band tells the texture its size, and the storage is created then
+static void create_texture(StreamedTexture *tex, const StagingSlot *slot) {
+    tex->width = slot->image_width;
+    tex->height = slot->image_height;
+    tex->levels = slot->levels;
+    tex->resident_level = tex->levels;
+    if (tex->loading_level > tex->levels - 1) tex->loading_level = tex->levels - 1;
+
+    tex->tail_level = 0;
+    while (level_extent(tex->width, tex->tail_level) > TEXTURE_STREAM_TAIL_SIZE ||
+           level_extent(tex->height, tex->tail_level) > TEXTURE_STREAM_TAIL_SIZE) {
+        tex->tail_level++;
+    }
+    for (int level = 0; level < TEXTURE_STREAM_MAX_LEVELS; level++) tex->level_rows[level] = -1;
+
+    glGenTextures(1, &tex->texture);
+    gl_state_bind_texture(0, GL_TEXTURE_2D, tex->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, tex->levels - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, tex->levels - 1);
+}
+
+// Level storage is specified with no unpack buffer bound, since NULL would otherwise be an offset into it
+static void set_level_storage(TextureStream *stream, StreamedTexture *tex, int level, bool allocate) {
+    int width = allocate ? level_extent(tex->width, level) : 0;
+    int height = allocate ? level_extent(tex->height, level) : 0;
+    gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    gl_state_bind_texture(0, GL_TEXTURE_2D, tex->texture);
+    glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+    if (allocate) {
+        tex->level_rows[level] = 0;
+        stream->resident_bytes += level_bytes(tex->width, tex->height, level);
+    } else {
+        tex->level_rows[level] = -1;
+        stream->resident_bytes -= level_bytes(tex->width, tex->height, level);
+    }
+}
+
+static void set_resident_level(StreamedTexture *tex, int level) {
+    tex->resident_level = level;
+    gl_state_bind_texture(0, GL_TEXTURE_2D, tex->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level);
+}
+
+// Returns the band's size in bytes
+static size_t upload_band(TextureStream *stream, StagingSlot *slot) {
+    StreamedTexture *tex = slot->texture >= 0 ? &stream->textures[slot->texture] : NULL;
+    if (!tex || !tex->active || tex->generation != slot->generation) {
+        // Never seen by the GPU, so it goes straight back to the decode thread
+        stream->bands_dropped++;
+        set_slot_state(stream, slot, STAGING_WRITABLE);
+        WakeConditionVariable(&stream->cond_var);
+        return 0;
+    }
+
+    if (!tex->width) create_texture(tex, slot);
+    if (tex->level_rows[slot->level] < 0) set_level_storage(stream, tex, slot->level, true);
+
+    gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, slot->pbo);
+    if (!stream->persistent) {
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        slot->ptr = NULL;
+    }
+    int width = level_extent(tex->width, slot->level);
+    gl_state_bind_texture(0, GL_TEXTURE_2D, tex->texture);
+    glTexSubImage2D(GL_TEXTURE_2D, slot->level, 0, slot->y, width, slot->rows, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+    slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    set_slot_state(stream, slot, STAGING_IN_FLIGHT);
+
+    size_t bytes = (size_t)width * slot->rows * 4;
+    stream->bytes_uploaded += bytes;
+    stream->bands_uploaded++;
+    tex->level_rows[slot->level] += slot->rows;
+
+    // Levels complete coarsest first; sample only down to the finest complete one
+    int resident = tex->resident_level;
+    while (resident > 0 && tex->level_rows[resident - 1] == level_extent(tex->height, resident - 1)) resident--;
+    if (resident != tex->resident_level) set_resident_level(tex, resident);
+    if (tex->resident_level <= tex->loading_level) tex->request_pending = false;
+    return bytes;
+}
+
+static StagingSlot *oldest_filled_slot(TextureStream *stream) {
+    StagingSlot *oldest = NULL;
+
+    EnterCriticalSection(&stream->crit_sect);
+    for (int i = 0; i < TEXTURE_STREAM_SLOTS; i++) {
+        StagingSlot *slot = &stream->slots[i];
+        if (slot->state == STAGING_FILLED && (!oldest || slot->sequence < oldest->sequence)) oldest = slot;
+    }
+    LeaveCriticalSection(&stream->crit_sect);
+
+    return oldest;
+}
+
+static void upload_bands(TextureStream *stream) {
+    size_t uploaded = 0;
+    StagingSlot *slot;
+    while ((slot = oldest_filled_slot(stream))) {
+        size_t bytes = (size_t)level_extent(slot->image_width, slot->level) * slot->rows * 4;
+        if (uploaded && uploaded + bytes > stream->upload_budget) {
+            stream->budget_deferrals++;
+            break;
+        }
+        uploaded += upload_band(stream, slot);
+    }
+    gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+// Drops the finest level with storage, down to the tail. Bands still on their
+// way for it (or anything finer) belong to the old generation and are dropped.
+static bool evict_level(TextureStream *stream, int handle) {
+    StreamedTexture *tex = &stream->textures[handle];
+    int level = 0;
+    while (level < tex->tail_level && tex->level_rows[level] < 0) level++;
+    if (level >= tex->tail_level) return false;
+
+    cancel_requests(stream, handle);
+    set_level_storage(stream, tex, level, false);
+    if (tex->resident_level <= level) set_resident_level(tex, level + 1);
+    tex->loading_level = tex->resident_level;
+    tex->request_pending = false;
+    tex->generation++;
+    stream->evictions++;
+    return true;
+}
+
+// The least recently used texture that was not drawn this frame and still has levels above its tail
+static int eviction_candidate(const TextureStream *stream, int keep) {
+    int victim = -1;
+    for (int i = 0; i < TEXTURE_STREAM_MAX_TEXTURES; i++) {
+        const StreamedTexture *tex = &stream->textures[i];
+        if (i == keep || !tex->active || !tex->width || tex->last_used_frame >= stream->frame) continue;
+
+        bool evictable = false;
+        for (int level = 0; level < tex->tail_level && !evictable; level++) evictable = tex->level_rows[level] >= 0;
+        if (!evictable) continue;
+
+        if (victim < 0 || tex->last_used_frame < stream->textures[victim].last_used_frame) victim = i;
+    }
+    return victim;
+}
+
+static void enforce_residency(TextureStream *stream) {
+    while (stream->resident_bytes > stream->residency_limit) {
+        int victim = eviction_candidate(stream, -1);
+        if (victim < 0 || !evict_level(stream, victim)) break;
+    }
+}
+
+// Asks for finer levels of the textures drawn this frame, making room by
+// evicting others first; whatever still does not fit is requested coarser
+static void queue_requests(TextureStream *stream) {
+    for (int i = 0; i < TEXTURE_STREAM_MAX_TEXTURES; i++) {
+        StreamedTexture *tex = &stream->textures[i];
+        if (!tex->active || tex->request_pending || tex->last_used_frame != stream->frame) continue;
+
+        if (!tex->width) {
+            // The size is unknown until the image has been read, so the whole chain is asked for
+            if (!queue_request(stream, i, tex->wanted_level, -1)) return;
+            continue;
+        }
+
+        int target = tex->wanted_level < tex->levels ? tex->wanted_level : tex->levels - 1;
+        while (target < tex->resident_level) {
+            size_t needed = 0;
+            for (int level = target; level < tex->resident_level; level++) {
+                if (tex->level_rows[level] < 0) needed += level_bytes(tex->width, tex->height, level);
+            }
+            if (stream->resident_bytes + needed <= stream->residency_limit) break;
+
+            int victim = eviction_candidate(stream, i);
+            if (victim < 0 || !evict_level(stream, victim)) target++;
+        }
+        if (target >= tex->resident_level) continue;
+
+        if (!queue_request(stream, i, target, tex->resident_level - 1)) return;
+    }
+}
+
+void texture_stream_update(TextureStream *stream) {
+    recycle_slots(stream);
+    upload_bands(stream);
+    enforce_residency(stream);
+    queue_requests(stream);
+    publish_slots(stream);
+    stream->frame++;
+}
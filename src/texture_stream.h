@@ -0,0 +1,136 @@
+#ifndef TEXTURE_STREAM_H
+#define TEXTURE_STREAM_H
+
+// Streams textures in without stalling the render thread. A decode thread
+// reads or generates each image, builds its mip chain and writes it, one band
+// of rows at a time, into a ring of pixel buffer objects. The render thread
+// copies filled bands into textures with glTexSubImage2D, no more than an
+// upload budget per frame, and fences each staging buffer before reusing it.
+//
+// Mips arrive coarsest first, so a texture is drawable early and sharpens as
+// finer levels complete. A residency manager keeps the GPU memory held by
+// streamed levels under a limit by evicting the finest levels of the least
+// recently used textures; levels of TEXTURE_STREAM_TAIL_SIZE and below stay.
+//
+// Everything except the decode thread runs on the render thread, with the
+// context current.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include "glad/glad.h"
+
+#define TEXTURE_STREAM_MAX_TEXTURES 128
+#define TEXTURE_STREAM_MAX_LEVELS 16
+#define TEXTURE_STREAM_SLOTS 16
+#define TEXTURE_STREAM_SLOT_SIZE (1024 * 1024)
+#define TEXTURE_STREAM_MAX_REQUESTS 64
+#define TEXTURE_STREAM_MAX_PATH 260
+#define TEXTURE_STREAM_TAIL_SIZE 64
+
+enum StagingSlotState {
+    STAGING_FREE,      // Owned by the render thread
+    STAGING_WRITABLE,  // Mapped and waiting for the decode thread
+    STAGING_WRITING,   // Being filled by the decode thread
+    STAGING_FILLED,    // Holds one band, waiting for its upload
+    STAGING_IN_FLIGHT, // Upload issued, reusable once the fence signals
+};
+
+typedef struct {
+    int state;
+    GLuint pbo;
+    uint8_t *ptr; // Valid from WRITABLE to FILLED, or always when persistent
+    GLsync fence;
+
+    // The band, described by the decode thread
+    uint64_t sequence; // Bands are uploaded in the order they were filled
+    int texture;
+    uint32_t generation;
+    int image_width;
+    int image_height;
+    int levels;
+    int level;
+    int y;
+    int rows;
+} StagingSlot;
+
+typedef struct {
+    int texture;
+    uint32_t generation;
+    int finest_level;   // Levels finest_level..coarsest_level are decoded
+    int coarsest_level; // -1 for the whole chain
+    char path[TEXTURE_STREAM_MAX_PATH];
+    uint32_t seed;
+} DecodeRequest;
+
+typedef struct {
+    bool active;
+    GLuint texture;
+    char path[TEXTURE_STREAM_MAX_PATH]; // Empty for a generated image
+    uint32_t seed;
+
+    int width; // 0 until the first band arrives
+    int height;
+    int levels;
+    int tail_level;      // Coarsest level that may be evicted + 1
+    int resident_level;  // Finest complete level, == levels while none is
+    int loading_level;   // Finest level asked of the decode thread
+    int wanted_level;
+    bool request_pending;
+    int level_rows[TEXTURE_STREAM_MAX_LEVELS]; // Rows uploaded; -1 when the level has no storage
+    uint64_t last_used_frame;
+    uint32_t generation; // Bumped on eviction, so bands already in flight are dropped
+} StreamedTexture;
+
+typedef struct {
+    HANDLE thread;
+    CRITICAL_SECTION crit_sect;
+    CONDITION_VARIABLE cond_var;
+    bool stop;
+
+    bool persistent;
+    uint64_t next_sequence;
+    StagingSlot slots[TEXTURE_STREAM_SLOTS];
+    DecodeRequest requests[TEXTURE_STREAM_MAX_REQUESTS];
+    int request_head;
+    int request_count;
+    int decoding;         // Texture the decode thread is working on, or -1
+    bool decode_cancelled; // Tells the decode thread to abandon it
+
+    StreamedTexture textures[TEXTURE_STREAM_MAX_TEXTURES];
+    size_t residency_limit;
+    size_t upload_budget; // Bytes per frame; at least one band is always uploaded
+    size_t resident_bytes;
+    uint64_t frame;
+
+    // Statistics, never reset by the stream itself
+    uint64_t bytes_uploaded;
+    uint64_t bands_uploaded;
+    uint64_t bands_dropped;
+    uint64_t budget_deferrals; // Frames that left filled bands for the next frame
+    uint64_t evictions;
+    uint64_t decode_counts;    // Decode thread time, in performance counter ticks
+} TextureStream;
+
+// persistent requires gl_caps.buffer_storage and gl_caps.direct_state_access
+bool texture_stream_start(TextureStream *stream, size_t residency_limit, size_t upload_budget, bool persistent);
+void texture_stream_stop(TextureStream *stream);
+
+// Loads an uncompressed 24 or 32-bit BMP, or generates a pattern from `seed`
+// when path is NULL. Returns a handle, or -1 when every slot is in use.
+int texture_stream_create(TextureStream *stream, const char *path, uint32_t seed);
+void texture_stream_release(TextureStream *stream, int handle);
+
+// Marks the texture as drawn this frame and asks for `wanted_level` to be
+// streamed in. Returns the GL texture, or 0 while no level is resident yet.
+GLuint texture_stream_use(TextureStream *stream, int handle, int wanted_level);
+
+// Once per frame: recycles staging buffers, uploads filled bands within the
+// budget, evicts to stay under the limit and queues new decode requests.
+void texture_stream_update(TextureStream *stream);
+
+#endif
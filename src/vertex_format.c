@@ -0,0 +1,249 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vertex_format.h"
+
+static int stored_components(const VertexAttrib *attrib) {
+    return attrib->storage == VERTEX_OCT16 ? 2 : attrib->components;
+}
+
+static GLsizei storage_size(VertexStorage storage) {
+    switch (storage) {
+    case VERTEX_FLOAT32: return 4;
+    case VERTEX_UNORM8:  return 1;
+    default:             return 2;
+    }
+}
+
+static GLenum storage_type(VertexStorage storage) {
+    switch (storage) {
+    case VERTEX_FLOAT32: return GL_FLOAT;
+    case VERTEX_HALF:    return GL_HALF_FLOAT;
+    case VERTEX_UNORM8:  return GL_UNSIGNED_BYTE;
+    case VERTEX_UNORM16: return GL_UNSIGNED_SHORT;
+    default:             return GL_SHORT;
+    }
+}
+
+static GLboolean storage_normalized(VertexStorage storage) {
+    return storage != VERTEX_FLOAT32 && storage != VERTEX_HALF;
+}
+
+static GLintptr align4(GLintptr value) {
+    return (value + 3) & ~(GLintptr)3;
+}
+
+void vertex_layout_init(VertexLayout *layout, const VertexAttrib *attribs, int count) {
+    memset(layout, 0, sizeof(*layout));
+    if (count > VERTEX_LAYOUT_MAX_ATTRIBS) count = VERTEX_LAYOUT_MAX_ATTRIBS;
+
+    GLintptr offset = 0;
+    for (int i = 0; i < count; i++) {
+        layout->attribs[i] = attribs[i];
+        layout->offsets[i] = (GLuint)offset;
+        offset = align4(offset + stored_components(&attribs[i]) * storage_size(attribs[i].storage));
+    }
+    layout->count = count;
+    layout->stride = (GLsizei)offset;
+}
+
+void vertex_layout_apply(const VertexLayout *layout, GLintptr base) {
+    for (int i = 0; i < layout->count; i++) {
+        const VertexAttrib *attrib = &layout->attribs[i];
+        glVertexAttribPointer(attrib->location, stored_components(attrib), storage_type(attrib->storage),
+                              storage_normalized(attrib->storage), layout->stride,
+                              (void*)(base + layout->offsets[i]));
+    }
+}
+
+void vertex_layout_enable(const VertexLayout *layout, GLuint divisor) {
+    for (int i = 0; i < layout->count; i++) {
+        glEnableVertexAttribArray(layout->attribs[i].location);
+        if (divisor) glVertexAttribDivisor(layout->attribs[i].location, divisor);
+    }
+}
+
+void vertex_layout_apply_binding(const VertexLayout *layout, GLuint vao, GLuint binding) {
+    for (int i = 0; i < layout->count; i++) {
+        const VertexAttrib *attrib = &layout->attribs[i];
+        glVertexArrayAttribFormat(vao, attrib->location, stored_components(attrib), storage_type(attrib->storage),
+                                  storage_normalized(attrib->storage), layout->offsets[i]);
+        glVertexArrayAttribBinding(vao, attrib->location, binding);
+        glEnableVertexArrayAttrib(vao, attrib->location);
+    }
+}
+
+// --------------------------------------------------
+// ----- Packing
+// --------------------------------------------------
+// Round to nearest even, with overflow to infinity and gradual underflow
+uint16_t float_to_half(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t float_exponent = (bits >> 23) & 0xFFu;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+    int32_t exponent = (int32_t)float_exponent - 127 + 15;
+
+    if (float_exponent == 0xFFu) return (uint16_t)(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+    if (exponent >= 31) return (uint16_t)(sign | 0x7C00u);
+
+    if (exponent <= 0) {
+        if (exponent < -10) return (uint16_t)sign;
+        mantissa |= 0x800000u;
+        uint32_t shift = (uint32_t)(14 - exponent);
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1))) half++;
+        return (uint16_t)(sign | half);
+    }
+
+    // A carry out of the mantissa bumps the exponent, which is still correctly rounded
+    uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+    uint32_t remainder = mantissa & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1))) half++;
+    return (uint16_t)(sign | half);
+}
+
+static float clampf(float value, float low, float high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+static int16_t to_snorm16(float value) {
+    return (int16_t)lrintf(clampf(value, -1.0f, 1.0f) * 32767.0f);
+}
+
+static float sign_not_zero(float value) {
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+// Projects onto the octahedron |x| + |y| + |z| = 1 and folds the lower half over the upper one
+void oct_encode(const float normal[3], int16_t encoded[2]) {
+    float l1 = fabsf(normal[0]) + fabsf(normal[1]) + fabsf(normal[2]);
+    if (l1 == 0.0f) l1 = 1.0f;
+    float x = normal[0] / l1;
+    float y = normal[1] / l1;
+    if (normal[2] < 0.0f) {
+        float folded_x = (1.0f - fabsf(y)) * sign_not_zero(x);
+        float folded_y = (1.0f - fabsf(x)) * sign_not_zero(y);
+        x = folded_x;
+        y = folded_y;
+    }
+    encoded[0] = to_snorm16(x);
+    encoded[1] = to_snorm16(y);
+}
+
+static void pack_attrib(const VertexAttrib *attrib, const float *in, uint8_t *out) {
+    switch (attrib->storage) {
+    case VERTEX_FLOAT32:
+        memcpy(out, in, (size_t)attrib->components * sizeof(float));
+        break;
+    case VERTEX_HALF:
+        for (int c = 0; c < attrib->components; c++) {
+            uint16_t half = float_to_half(in[c]);
+            memcpy(out + c * 2, &half, 2);
+        }
+        break;
+    case VERTEX_UNORM8:
+        for (int c = 0; c < attrib->components; c++) {
+            out[c] = (uint8_t)lrintf(clampf(in[c], 0.0f, 1.0f) * 255.0f);
+        }
+        break;
+    case VERTEX_UNORM16:
+        for (int c = 0; c < attrib->components; c++) {
+            uint16_t value = (uint16_t)lrintf(clampf(in[c], 0.0f, 1.0f) * 65535.0f);
+            memcpy(out + c * 2, &value, 2);
+        }
+        break;
+    case VERTEX_SNORM16:
+        for (int c = 0; c < attrib->components; c++) {
+            int16_t value = to_snorm16(in[c]);
+            memcpy(out + c * 2, &value, 2);
+        }
+        break;
+    case VERTEX_OCT16: {
+        int16_t encoded[2];
+        oct_encode(in, encoded);
+        memcpy(out, encoded, sizeof(encoded));
+        break;
+    }
+    }
+}
+
+void vertex_layout_pack(const VertexLayout *layout, void *dst, const VertexSource *sources, size_t count) {
+    uint8_t *out = (uint8_t*)dst;
+    memset(out, 0, count * (size_t)layout->stride); // Padding bytes stay deterministic
+
+    for (size_t v = 0; v < count; v++) {
+        for (int i = 0; i < layout->count; i++) {
+            pack_attrib(&layout->attribs[i], sources[i].data + v * sources[i].stride, out + layout->offsets[i]);
+        }
+        out += layout->stride;
+    }
+}
+
+// --------------------------------------------------
+// ----- Meshes
+// --------------------------------------------------
+static GLuint create_static_buffer(GLsizeiptr size, const void *data) {
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, data, GL_STATIC_DRAW);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    return buffer;
+}
+
+// Uses GL directly and leaves the VAO binding alone; call gl_state_invalidate() afterwards on the render thread
+bool mesh_create(Mesh *mesh, const VertexLayout *layout, const VertexSource *sources, size_t vertex_count,
+                 const uint32_t *indices, size_t index_count, bool force_32bit_indices) {
+    memset(mesh, 0, sizeof(*mesh));
+    mesh->layout = layout;
+    mesh->vertex_count = vertex_count;
+    mesh->index_count = (GLsizei)index_count;
+    mesh->index_type = (vertex_count <= 0x10000 && !force_32bit_indices) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    mesh->vertex_bytes = vertex_count * (size_t)layout->stride;
+    mesh->index_bytes = index_count * (mesh->index_type == GL_UNSIGNED_SHORT ? 2 : 4);
+
+    void *vertex_data = malloc(mesh->vertex_bytes);
+    void *index_data = mesh->index_type == GL_UNSIGNED_SHORT ? malloc(mesh->index_bytes) : NULL;
+    if (!vertex_data || (mesh->index_type == GL_UNSIGNED_SHORT && !index_data)) {
+        free(vertex_data);
+        free(index_data);
+        return false;
+    }
+
+    vertex_layout_pack(layout, vertex_data, sources, vertex_count);
+    if (index_data) {
+        uint16_t *short_indices = (uint16_t*)index_data;
+        for (size_t i = 0; i < index_count; i++) short_indices[i] = (uint16_t)indices[i];
+    }
+
+    // The element array binding belongs to whichever VAO is bound, and 3.3
+    // core has no default VAO to hold it; mesh_setup_vao makes the binding
+    mesh->vbo = create_static_buffer((GLsizeiptr)mesh->vertex_bytes, vertex_data);
+    mesh->ebo = create_static_buffer((GLsizeiptr)mesh->index_bytes, index_data ? index_data : indices);
+
+    free(vertex_data);
+    free(index_data);
+    return true;
+}
+
+void mesh_destroy(Mesh *mesh) {
+    glDeleteBuffers(1, &mesh->vbo);
+    glDeleteBuffers(1, &mesh->ebo);
+    memset(mesh, 0, sizeof(*mesh));
+}
+
+void mesh_setup_vao(const Mesh *mesh, GLuint vao) {
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->vbo);
+    vertex_layout_apply(mesh->layout, 0);
+    vertex_layout_enable(mesh->layout, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->ebo);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
@@ -0,0 +1,95 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+// Vertex layouts described as data. A layout lists each attribute's location,
+// component count and storage type; offsets, stride and the attribute pointer
+// setup are derived from it, and vertex_layout_pack converts float source data
+// into the packed storage. Compact storage (half floats, normalized integers,
+// octahedral normals) is expanded by the vertex fetch, so shaders still read
+// floats; only octahedral normals need VERTEX_OCT_DECODE_GLSL.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+#define VERTEX_LAYOUT_MAX_ATTRIBS 8
+
+typedef enum {
+    VERTEX_FLOAT32,
+    VERTEX_HALF,    // IEEE 754 binary16
+    VERTEX_UNORM8,  // [0, 1]
+    VERTEX_UNORM16, // [0, 1]
+    VERTEX_SNORM16, // [-1, 1]
+    VERTEX_OCT16,   // Unit vector (3 source floats) stored as two snorm16, read as a vec2
+} VertexStorage;
+
+typedef struct {
+    GLuint location;
+    int components; // Source components; VERTEX_OCT16 takes 3
+    VertexStorage storage;
+} VertexAttrib;
+
+typedef struct {
+    VertexAttrib attribs[VERTEX_LAYOUT_MAX_ATTRIBS];
+    GLuint offsets[VERTEX_LAYOUT_MAX_ATTRIBS];
+    int count;
+    GLsizei stride;
+} VertexLayout;
+
+// Float source data for one attribute: `components` floats per vertex, `stride` floats apart
+typedef struct {
+    const float *data;
+    size_t stride;
+} VertexSource;
+
+// Every attribute starts on a 4-byte boundary, as drivers prefer
+void vertex_layout_init(VertexLayout *layout, const VertexAttrib *attribs, int count);
+
+// Points every attribute of the bound VAO at the buffer bound to GL_ARRAY_BUFFER, starting at `base`
+void vertex_layout_apply(const VertexLayout *layout, GLintptr base);
+
+// Enables the attributes of the bound VAO; a non-zero divisor makes them per instance
+void vertex_layout_enable(const VertexLayout *layout, GLuint divisor);
+
+// Direct state access version of apply + enable: formats relative to `binding` of `vao`
+void vertex_layout_apply_binding(const VertexLayout *layout, GLuint vao, GLuint binding);
+
+// Writes `count` vertices to dst, one source per attribute
+void vertex_layout_pack(const VertexLayout *layout, void *dst, const VertexSource *sources, size_t count);
+
+uint16_t float_to_half(float value);
+void oct_encode(const float normal[3], int16_t encoded[2]);
+
+// GLSL for VERTEX_OCT16 attributes, meant to be concatenated into a shader source
+#define VERTEX_OCT_DECODE_GLSL \
+    "vec3 oct_decode(vec2 e)\n" \
+    "{\n" \
+    "    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n" \
+    "    if (n.z < 0.0) n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);\n" \
+    "    return normalize(n);\n" \
+    "}\n"
+
+// Static vertex and index buffers in a given layout. Indices are stored as
+// 16-bit whenever every vertex can be addressed with them.
+typedef struct {
+    GLuint vbo;
+    GLuint ebo;
+    const VertexLayout *layout;
+    size_t vertex_count;
+    GLsizei index_count;
+    GLenum index_type;
+    size_t vertex_bytes;
+    size_t index_bytes;
+} Mesh;
+
+// force_32bit_indices keeps GL_UNSIGNED_INT regardless of the vertex count, for comparison
+bool mesh_create(Mesh *mesh, const VertexLayout *layout, const VertexSource *sources, size_t vertex_count,
+                 const uint32_t *indices, size_t index_count, bool force_32bit_indices);
+void mesh_destroy(Mesh *mesh);
+
+// Records the mesh's buffers and attribute pointers in `vao`, leaving no VAO bound
+void mesh_setup_vao(const Mesh *mesh, GLuint vao);
+
+#endif
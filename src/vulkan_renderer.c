@@ -0,0 +1,1063 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "vulkan_renderer.h"
+
+// ----- Entry points
+// --------------------------------------------------
+// Resolved at init through the loader, in the order they become available:
+// before the instance exists, from the instance, and from the device.
+
+#define VULKAN_GLOBAL_FUNCTIONS(X) \
+    X(vkCreateInstance)
+
+#define VULKAN_INSTANCE_FUNCTIONS(X)              \
+    X(vkDestroyInstance)                          \
+    X(vkEnumeratePhysicalDevices)                 \
+    X(vkGetPhysicalDeviceProperties)              \
+    X(vkGetPhysicalDeviceQueueFamilyProperties)   \
+    X(vkGetPhysicalDeviceMemoryProperties)        \
+    X(vkEnumerateDeviceExtensionProperties)       \
+    X(vkGetPhysicalDeviceSurfaceSupportKHR)       \
+    X(vkGetPhysicalDeviceSurfaceCapabilitiesKHR)  \
+    X(vkGetPhysicalDeviceSurfaceFormatsKHR)       \
+    X(vkGetPhysicalDeviceSurfacePresentModesKHR)  \
+    X(vkDestroySurfaceKHR)                        \
+    X(vkCreateDevice)                             \
+    X(vkGetDeviceProcAddr)
+
+#define VULKAN_DEVICE_FUNCTIONS(X)     \
+    X(vkDestroyDevice)                 \
+    X(vkGetDeviceQueue)                \
+    X(vkDeviceWaitIdle)                \
+    X(vkCreateSwapchainKHR)            \
+    X(vkDestroySwapchainKHR)           \
+    X(vkGetSwapchainImagesKHR)         \
+    X(vkAcquireNextImageKHR)           \
+    X(vkQueuePresentKHR)               \
+    X(vkCreateImageView)               \
+    X(vkDestroyImageView)              \
+    X(vkCreateRenderPass)              \
+    X(vkDestroyRenderPass)             \
+    X(vkCreateFramebuffer)             \
+    X(vkDestroyFramebuffer)            \
+    X(vkCreateShaderModule)            \
+    X(vkDestroyShaderModule)           \
+    X(vkCreatePipelineLayout)          \
+    X(vkDestroyPipelineLayout)         \
+    X(vkCreateGraphicsPipelines)       \
+    X(vkDestroyPipeline)               \
+    X(vkCreateBuffer)                  \
+    X(vkDestroyBuffer)                 \
+    X(vkGetBufferMemoryRequirements)   \
+    X(vkAllocateMemory)                \
+    X(vkFreeMemory)                    \
+    X(vkBindBufferMemory)              \
+    X(vkMapMemory)                     \
+    X(vkUnmapMemory)                   \
+    X(vkCreateCommandPool)             \
+    X(vkDestroyCommandPool)            \
+    X(vkAllocateCommandBuffers)        \
+    X(vkResetCommandBuffer)            \
+    X(vkBeginCommandBuffer)            \
+    X(vkEndCommandBuffer)              \
+    X(vkCmdBeginRenderPass)            \
+    X(vkCmdEndRenderPass)              \
+    X(vkCmdBindPipeline)               \
+    X(vkCmdSetViewport)                \
+    X(vkCmdSetScissor)                 \
+    X(vkCmdBindVertexBuffers)          \
+    X(vkCmdBindIndexBuffer)            \
+    X(vkCmdPushConstants)              \
+    X(vkCmdDrawIndexed)                \
+    X(vkCmdPipelineBarrier)            \
+    X(vkCmdCopyImageToBuffer)          \
+    X(vkCreateFence)                   \
+    X(vkDestroyFence)                  \
+    X(vkWaitForFences)                 \
+    X(vkResetFences)                   \
+    X(vkCreateSemaphore)               \
+    X(vkDestroySemaphore)              \
+    X(vkQueueSubmit)
+
+#define VULKAN_DECLARE_FUNCTION(name) static PFN_##name name;
+VULKAN_GLOBAL_FUNCTIONS(VULKAN_DECLARE_FUNCTION)
+VULKAN_INSTANCE_FUNCTIONS(VULKAN_DECLARE_FUNCTION)
+VULKAN_DEVICE_FUNCTIONS(VULKAN_DECLARE_FUNCTION)
+
+typedef struct {
+    const char *name;
+    PFN_vkVoidFunction *func;
+} VulkanFunction;
+
+#define VULKAN_FUNCTION_ENTRY(name) { #name, (PFN_vkVoidFunction*)&name },
+static const VulkanFunction global_functions[] = { VULKAN_GLOBAL_FUNCTIONS(VULKAN_FUNCTION_ENTRY) };
+static const VulkanFunction instance_functions[] = { VULKAN_INSTANCE_FUNCTIONS(VULKAN_FUNCTION_ENTRY) };
+static const VulkanFunction device_functions[] = { VULKAN_DEVICE_FUNCTIONS(VULKAN_FUNCTION_ENTRY) };
+
+#define VULKAN_COUNT(array) (int)(sizeof(array) / sizeof(array[0]))
+
+// ----- Shaders
+// --------------------------------------------------
+// SPIR-V 1.0 for the GL scene shaders, with the modifier in a push constant
+// and y negated for Vulkan's downward clip space, so the image comes out the
+// same way up as GL's:
+//
+//   layout(location = 0) in vec3 aPos;
+//   layout(location = 1) in vec3 aColor;
+//   layout(location = 0) out vec3 color;
+//   layout(push_constant) uniform ObjectConstants { float modifier; };
+//   void main() {
+//       gl_Position = vec4(aPos.x * modifier, -(aPos.y * modifier), aPos.z, 1.0);
+//       color = aColor;
+//   }
+//
+//   layout(location = 0) in vec3 color;
+//   layout(location = 0) out vec4 fragColor;
+//   void main() { fragColor = vec4(color, 1.0); }
+
+static const uint32_t scene_vertex_spirv[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000021, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0009000f, 0x00000000,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00000003, 0x00000004,
+    0x00000005, 0x00040047, 0x00000002, 0x0000001e, 0x00000000, 0x00040047,
+    0x00000003, 0x0000001e, 0x00000001, 0x00040047, 0x00000004, 0x0000001e,
+    0x00000000, 0x00040047, 0x00000005, 0x0000000b, 0x00000000, 0x00050048,
+    0x00000006, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000006,
+    0x00000002, 0x00020013, 0x00000007, 0x00030021, 0x00000008, 0x00000007,
+    0x00030016, 0x00000009, 0x00000020, 0x00040017, 0x0000000a, 0x00000009,
+    0x00000003, 0x00040017, 0x0000000b, 0x00000009, 0x00000004, 0x00040020,
+    0x0000000c, 0x00000001, 0x0000000a, 0x00040020, 0x0000000d, 0x00000003,
+    0x0000000a, 0x00040020, 0x0000000e, 0x00000003, 0x0000000b, 0x0003001e,
+    0x00000006, 0x00000009, 0x00040020, 0x0000000f, 0x00000009, 0x00000006,
+    0x00040020, 0x00000010, 0x00000009, 0x00000009, 0x00040015, 0x00000011,
+    0x00000020, 0x00000001, 0x0004002b, 0x00000011, 0x00000012, 0x00000000,
+    0x0004002b, 0x00000009, 0x00000013, 0x3f800000, 0x0004003b, 0x0000000c,
+    0x00000002, 0x00000001, 0x0004003b, 0x0000000c, 0x00000003, 0x00000001,
+    0x0004003b, 0x0000000d, 0x00000004, 0x00000003, 0x0004003b, 0x0000000e,
+    0x00000005, 0x00000003, 0x0004003b, 0x0000000f, 0x00000014, 0x00000009,
+    0x00050036, 0x00000007, 0x00000001, 0x00000000, 0x00000008, 0x000200f8,
+    0x00000015, 0x0004003d, 0x0000000a, 0x00000016, 0x00000002, 0x00050041,
+    0x00000010, 0x00000017, 0x00000014, 0x00000012, 0x0004003d, 0x00000009,
+    0x00000018, 0x00000017, 0x00050051, 0x00000009, 0x00000019, 0x00000016,
+    0x00000000, 0x00050051, 0x00000009, 0x0000001a, 0x00000016, 0x00000001,
+    0x00050051, 0x00000009, 0x0000001b, 0x00000016, 0x00000002, 0x00050085,
+    0x00000009, 0x0000001c, 0x00000019, 0x00000018, 0x00050085, 0x00000009,
+    0x0000001d, 0x0000001a, 0x00000018, 0x0004007f, 0x00000009, 0x0000001e,
+    0x0000001d, 0x00070050, 0x0000000b, 0x0000001f, 0x0000001c, 0x0000001e,
+    0x0000001b, 0x00000013, 0x0003003e, 0x00000005, 0x0000001f, 0x0004003d,
+    0x0000000a, 0x00000020, 0x00000003, 0x0003003e, 0x00000004, 0x00000020,
+    0x000100fd, 0x00010038,
+};
+
+static const uint32_t scene_fragment_spirv[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000012, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0007000f, 0x00000004,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00000003, 0x00030010,
+    0x00000001, 0x00000007, 0x00040047, 0x00000002, 0x0000001e, 0x00000000,
+    0x00040047, 0x00000003, 0x0000001e, 0x00000000, 0x00020013, 0x00000004,
+    0x00030021, 0x00000005, 0x00000004, 0x00030016, 0x00000006, 0x00000020,
+    0x00040017, 0x00000007, 0x00000006, 0x00000003, 0x00040017, 0x00000008,
+    0x00000006, 0x00000004, 0x00040020, 0x00000009, 0x00000001, 0x00000007,
+    0x00040020, 0x0000000a, 0x00000003, 0x00000008, 0x0004002b, 0x00000006,
+    0x0000000b, 0x3f800000, 0x0004003b, 0x00000009, 0x00000002, 0x00000001,
+    0x0004003b, 0x0000000a, 0x00000003, 0x00000003, 0x00050036, 0x00000004,
+    0x00000001, 0x00000000, 0x00000005, 0x000200f8, 0x0000000c, 0x0004003d,
+    0x00000007, 0x0000000d, 0x00000002, 0x00050051, 0x00000006, 0x0000000e,
+    0x0000000d, 0x00000000, 0x00050051, 0x00000006, 0x0000000f, 0x0000000d,
+    0x00000001, 0x00050051, 0x00000006, 0x00000010, 0x0000000d, 0x00000002,
+    0x00070050, 0x00000008, 0x00000011, 0x0000000e, 0x0000000f, 0x00000010,
+    0x0000000b, 0x0003003e, 0x00000003, 0x00000011, 0x000100fd, 0x00010038,
+};
+
+// ----- Helpers
+// --------------------------------------------------
+static bool fail(VulkanRenderer *vk, const char *what, VkResult result) {
+    snprintf(vk->error, sizeof(vk->error), "Vulkan: %s failed (VkResult %d)\n", what, (int)result);
+    return false;
+}
+
+static bool load_functions(VulkanRenderer *vk, const VulkanFunction *functions, int count,
+                           PFN_vkGetInstanceProcAddr get_instance_proc, PFN_vkGetDeviceProcAddr get_device_proc) {
+    for (int i = 0; i < count; i++) {
+        *functions[i].func = get_device_proc ? get_device_proc(vk->device, functions[i].name)
+                                             : get_instance_proc(vk->instance, functions[i].name);
+        if (!*functions[i].func) {
+            snprintf(vk->error, sizeof(vk->error), "Vulkan: the driver has no %s\n", functions[i].name);
+            return false;
+        }
+    }
+    return true;
+}
+
+static int find_memory_type(const VulkanRenderer *vk, uint32_t type_bits, VkMemoryPropertyFlags required,
+                            VkMemoryPropertyFlags preferred) {
+    VkPhysicalDeviceMemoryProperties memory;
+    vkGetPhysicalDeviceMemoryProperties(vk->physical_device, &memory);
+
+    int found = -1;
+    for (uint32_t i = 0; i < memory.memoryTypeCount; i++) {
+        VkMemoryPropertyFlags flags = memory.memoryTypes[i].propertyFlags;
+        if (!(type_bits & (1u << i)) || (flags & required) != required) continue;
+        if ((flags & preferred) == preferred) return (int)i;
+        if (found < 0) found = (int)i;
+    }
+    return found;
+}
+
+// A buffer in host visible memory, mapped for as long as it lives
+static bool create_host_buffer(VulkanRenderer *vk, VkDeviceSize size, VkBufferUsageFlags usage,
+                               VkMemoryPropertyFlags preferred, VkBuffer *buffer, VkDeviceMemory *memory,
+                               void **mapped) {
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = size;
+    buffer_info.usage = usage;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkResult result = vkCreateBuffer(vk->device, &buffer_info, NULL, buffer);
+    if (result != VK_SUCCESS) return fail(vk, "vkCreateBuffer", result);
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(vk->device, *buffer, &requirements);
+    int type = find_memory_type(vk, requirements.memoryTypeBits,
+                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, preferred);
+    if (type < 0) return fail(vk, "finding host visible memory", VK_ERROR_OUT_OF_DEVICE_MEMORY);
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = requirements.size;
+    alloc_info.memoryTypeIndex = (uint32_t)type;
+    result = vkAllocateMemory(vk->device, &alloc_info, NULL, memory);
+    if (result != VK_SUCCESS) return fail(vk, "vkAllocateMemory", result);
+
+    result = vkBindBufferMemory(vk->device, *buffer, *memory, 0);
+    if (result != VK_SUCCESS) return fail(vk, "vkBindBufferMemory", result);
+
+    result = vkMapMemory(vk->device, *memory, 0, VK_WHOLE_SIZE, 0, mapped);
+    if (result != VK_SUCCESS) return fail(vk, "vkMapMemory", result);
+    return true;
+}
+
+const char *vulkan_present_mode_name(VkPresentModeKHR mode) {
+    switch (mode) {
+    case VK_PRESENT_MODE_IMMEDIATE_KHR: return "immediate";
+    case VK_PRESENT_MODE_MAILBOX_KHR: return "mailbox";
+    case VK_PRESENT_MODE_FIFO_KHR: return "FIFO";
+    case VK_PRESENT_MODE_FIFO_RELAXED_KHR: return "FIFO relaxed";
+    default: return "other";
+    }
+}
+
+// ----- Device
+// --------------------------------------------------
+static bool has_device_extension(VkPhysicalDevice physical_device, const char *name) {
+    VkExtensionProperties extensions[256];
+    uint32_t count = VULKAN_COUNT(extensions);
+    if (vkEnumerateDeviceExtensionProperties(physical_device, NULL, &count, extensions) < 0) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        if (strcmp(extensions[i].extensionName, name) == 0) return true;
+    }
+    return false;
+}
+
+// Prefers a GPU, but takes a CPU driver such as lavapipe when that's all there is
+static int device_type_rank(VkPhysicalDeviceType type) {
+    switch (type) {
+    case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU: return 4;
+    case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: return 3;
+    case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU: return 2;
+    case VK_PHYSICAL_DEVICE_TYPE_CPU: return 1;
+    default: return 0;
+    }
+}
+
+// A device with a queue family that can both draw and present to the surface
+static bool pick_physical_device(VulkanRenderer *vk) {
+    VkPhysicalDevice devices[16];
+    uint32_t device_count = VULKAN_COUNT(devices);
+    VkResult result = vkEnumeratePhysicalDevices(vk->instance, &device_count, devices);
+    if (result < 0) return fail(vk, "vkEnumeratePhysicalDevices", result);
+
+    int best_rank = -1;
+    for (uint32_t i = 0; i < device_count; i++) {
+        if (!has_device_extension(devices[i], VK_KHR_SWAPCHAIN_EXTENSION_NAME)) continue;
+
+        VkQueueFamilyProperties families[32];
+        uint32_t family_count = VULKAN_COUNT(families);
+        vkGetPhysicalDeviceQueueFamilyProperties(devices[i], &family_count, families);
+
+        for (uint32_t family = 0; family < family_count; family++) {
+            VkBool32 can_present = VK_FALSE;
+            vkGetPhysicalDeviceSurfaceSupportKHR(devices[i], family, vk->surface, &can_present);
+            if (!(families[family].queueFlags & VK_QUEUE_GRAPHICS_BIT) || !can_present) continue;
+
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(devices[i], &properties);
+            int rank = device_type_rank(properties.deviceType);
+            if (rank > best_rank) {
+                best_rank = rank;
+                vk->physical_device = devices[i];
+                vk->queue_family = family;
+                snprintf(vk->device_name, sizeof(vk->device_name), "%s", properties.deviceName);
+            }
+            break;
+        }
+    }
+
+    if (best_rank < 0) return fail(vk, "finding a device that can present to the window", VK_ERROR_INCOMPATIBLE_DRIVER);
+    return true;
+}
+
+static bool create_device(VulkanRenderer *vk) {
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueFamilyIndex = vk->queue_family;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+
+    const char *extensions[] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    device_info.enabledExtensionCount = VULKAN_COUNT(extensions);
+    device_info.ppEnabledExtensionNames = extensions;
+
+    VkResult result = vkCreateDevice(vk->physical_device, &device_info, NULL, &vk->device);
+    if (result != VK_SUCCESS) return fail(vk, "vkCreateDevice", result);
+
+    // Straight to the driver, skipping the loader's dispatch for every call
+    if (!load_functions(vk, device_functions, VULKAN_COUNT(device_functions), NULL, vkGetDeviceProcAddr)) {
+        PFN_vkDestroyDevice destroy_device = (PFN_vkDestroyDevice)vkGetDeviceProcAddr(vk->device, "vkDestroyDevice");
+        if (destroy_device) destroy_device(vk->device, NULL);
+        vk->device = VK_NULL_HANDLE;
+        return false;
+    }
+
+    vkGetDeviceQueue(vk->device, vk->queue_family, 0, &vk->queue);
+    return true;
+}
+
+// Plain 8-bit BGRA or RGBA without sRGB encoding, like GL's default framebuffer
+static bool pick_surface_format(VulkanRenderer *vk) {
+    VkSurfaceFormatKHR formats[64];
+    uint32_t count = VULKAN_COUNT(formats);
+    VkResult result = vkGetPhysicalDeviceSurfaceFormatsKHR(vk->physical_device, vk->surface, &count, formats);
+    if (result < 0 || count == 0) return fail(vk, "vkGetPhysicalDeviceSurfaceFormatsKHR", result);
+
+    vk->surface_format = formats[0];
+    if (count == 1 && formats[0].format == VK_FORMAT_UNDEFINED) {
+        vk->surface_format.format = VK_FORMAT_B8G8R8A8_UNORM; // Anything goes
+        return true;
+    }
+
+    const VkFormat wanted[] = { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_R8G8B8A8_UNORM };
+    for (int w = 0; w < VULKAN_COUNT(wanted); w++) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (formats[i].format == wanted[w] && formats[i].colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
+                vk->surface_format = formats[i];
+                return true;
+            }
+        }
+    }
+    return true;
+}
+
+int vulkan_renderer_present_modes(const VulkanRenderer *vk, VkPresentModeKHR *modes, int max_modes) {
+    uint32_t count = (uint32_t)max_modes;
+    if (vkGetPhysicalDeviceSurfacePresentModesKHR(vk->physical_device, vk->surface, &count, modes) < 0) return 0;
+    return (int)count;
+}
+
+bool vulkan_renderer_set_present_mode(VulkanRenderer *vk, VkPresentModeKHR mode) {
+    VkPresentModeKHR modes[16];
+    int count = vulkan_renderer_present_modes(vk, modes, VULKAN_COUNT(modes));
+    for (int i = 0; i < count; i++) {
+        if (modes[i] != mode) continue;
+        if (vk->present_mode != mode) {
+            vk->present_mode = mode;
+            vk->swapchain_stale = true;
+        }
+        return true;
+    }
+    return false;
+}
+
+// ----- Pipeline
+// --------------------------------------------------
+static bool create_render_pass(VulkanRenderer *vk) {
+    VkAttachmentDescription attachment = {};
+    attachment.format = vk->surface_format.format;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED; // Every pixel is cleared
+    attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    VkAttachmentReference color_ref = {};
+    color_ref.attachment = 0;
+    color_ref.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &color_ref;
+
+    // The layout transition waits for the acquire semaphore, which the
+    // submission waits on at this stage
+    VkSubpassDependency dependency = {};
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+    VkRenderPassCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    info.attachmentCount = 1;
+    info.pAttachments = &attachment;
+    info.subpassCount = 1;
+    info.pSubpasses = &subpass;
+    info.dependencyCount = 1;
+    info.pDependencies = &dependency;
+
+    VkResult result = vkCreateRenderPass(vk->device, &info, NULL, &vk->render_pass);
+    if (result != VK_SUCCESS) return fail(vk, "vkCreateRenderPass", result);
+    return true;
+}
+
+static bool create_shader_module(VulkanRenderer *vk, const uint32_t *code, size_t size, VkShaderModule *module) {
+    VkShaderModuleCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    info.codeSize = size;
+    info.pCode = code;
+    VkResult result = vkCreateShaderModule(vk->device, &info, NULL, module);
+    if (result != VK_SUCCESS) return fail(vk, "vkCreateShaderModule", result);
+    return true;
+}
+
+// Viewport and scissor are dynamic, so nothing here depends on the swap chain's size
+static bool create_pipeline(VulkanRenderer *vk) {
+    VkPushConstantRange push_range = {};
+    push_range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    push_range.offset = 0;
+    push_range.size = sizeof(float);
+
+    VkPipelineLayoutCreateInfo layout_info = {};
+    layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layout_info.pushConstantRangeCount = 1;
+    layout_info.pPushConstantRanges = &push_range;
+    VkResult result = vkCreatePipelineLayout(vk->device, &layout_info, NULL, &vk->pipeline_layout);
+    if (result != VK_SUCCESS) return fail(vk, "vkCreatePipelineLayout", result);
+
+    VkShaderModule vertex_module = VK_NULL_HANDLE;
+    VkShaderModule fragment_module = VK_NULL_HANDLE;
+    bool ok = create_shader_module(vk, scene_vertex_spirv, sizeof(scene_vertex_spirv), &vertex_module) &&
+              create_shader_module(vk, scene_fragment_spirv, sizeof(scene_fragment_spirv), &fragment_module);
+
+    if (ok) {
+        VkPipelineShaderStageCreateInfo stages[2] = {};
+        stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+        stages[0].module = vertex_module;
+        stages[0].pName = "main";
+        stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        stages[1].module = fragment_module;
+        stages[1].pName = "main";
+
+        VkVertexInputBindingDescription binding = {};
+        binding.binding = 0;
+        binding.stride = 6 * sizeof(float);
+        binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+        VkVertexInputAttributeDescription attributes[2] = {};
+        attributes[0].location = 0;
+        attributes[0].format = VK_FORMAT_R32G32B32_SFLOAT;
+        attributes[0].offset = 0;
+        attributes[1].location = 1;
+        attributes[1].format = VK_FORMAT_R32G32B32_SFLOAT;
+        attributes[1].offset = 3 * sizeof(float);
+
+        VkPipelineVertexInputStateCreateInfo vertex_input = {};
+        vertex_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        vertex_input.vertexBindingDescriptionCount = 1;
+        vertex_input.pVertexBindingDescriptions = &binding;
+        vertex_input.vertexAttributeDescriptionCount = 2;
+        vertex_input.pVertexAttributeDescriptions = attributes;
+
+        VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
+        input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+        input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        VkPipelineViewportStateCreateInfo viewport = {};
+        viewport.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+        viewport.viewportCount = 1;
+        viewport.scissorCount = 1;
+
+        VkPipelineRasterizationStateCreateInfo rasterization = {};
+        rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+        rasterization.cullMode = VK_CULL_MODE_NONE;
+        rasterization.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        rasterization.lineWidth = 1.0f;
+
+        VkPipelineMultisampleStateCreateInfo multisample = {};
+        multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+        multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+        VkPipelineColorBlendAttachmentState blend_attachment = {};
+        blend_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+        VkPipelineColorBlendStateCreateInfo blend = {};
+        blend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+        blend.attachmentCount = 1;
+        blend.pAttachments = &blend_attachment;
+
+        const VkDynamicState dynamic_states[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+        VkPipelineDynamicStateCreateInfo dynamic = {};
+        dynamic.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamic.dynamicStateCount = VULKAN_COUNT(dynamic_states);
+        dynamic.pDynamicStates = dynamic_states;
+
+        VkGraphicsPipelineCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        info.stageCount = 2;
+        info.pStages = stages;
+        info.pVertexInputState = &vertex_input;
+        info.pInputAssemblyState = &input_assembly;
+        info.pViewportState = &viewport;
+        info.pRasterizationState = &rasterization;
+        info.pMultisampleState = &multisample;
+        info.pColorBlendState = &blend;
+        info.pDynamicState = &dynamic;
+        info.layout = vk->pipeline_layout;
+        info.renderPass = vk->render_pass;
+        info.subpass = 0;
+        info.basePipelineIndex = -1;
+
+        result = vkCreateGraphicsPipelines(vk->device, VK_NULL_HANDLE, 1, &info, NULL, &vk->pipeline);
+        if (result != VK_SUCCESS) ok = fail(vk, "vkCreateGraphicsPipelines", result);
+    }
+
+    if (vertex_module) vkDestroyShaderModule(vk->device, vertex_module, NULL);
+    if (fragment_module) vkDestroyShaderModule(vk->device, fragment_module, NULL);
+    return ok;
+}
+
+static bool create_mesh(VulkanRenderer *vk, const VulkanRendererDesc *desc) {
+    VkDeviceSize vertex_size = (VkDeviceSize)desc->vertex_count * 6 * sizeof(float);
+    VkDeviceSize index_size = (VkDeviceSize)desc->index_count * sizeof(uint32_t);
+    vk->index_offset = vertex_size;
+    vk->index_count = (uint32_t)desc->index_count;
+
+    // Four vertices don't justify a staging copy into device local memory
+    void *mapped = NULL;
+    if (!create_host_buffer(vk, vertex_size + index_size,
+                            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &vk->mesh_buffer, &vk->mesh_memory, &mapped)) {
+        return false;
+    }
+    memcpy(mapped, desc->vertices, (size_t)vertex_size);
+    memcpy((uint8_t*)mapped + vertex_size, desc->indices, (size_t)index_size);
+    vkUnmapMemory(vk->device, vk->mesh_memory);
+    return true;
+}
+
+static bool create_frame_slots(VulkanRenderer *vk) {
+    VkCommandPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex = vk->queue_family;
+    VkResult result = vkCreateCommandPool(vk->device, &pool_info, NULL, &vk->command_pool);
+    if (result != VK_SUCCESS) return fail(vk, "vkCreateCommandPool", result);
+
+    VkCommandBuffer commands[VULKAN_FRAMES_IN_FLIGHT];
+    VkCommandBufferAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.commandPool = vk->command_pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = VULKAN_FRAMES_IN_FLIGHT;
+    result = vkAllocateCommandBuffers(vk->device, &alloc_info, commands);
+    if (result != VK_SUCCESS) return fail(vk, "vkAllocateCommandBuffers", result);
+
+    // Signaled, so the first wait on each slot returns at once
+    VkFenceCreateInfo fence_info = {};
+    fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+    VkSemaphoreCreateInfo semaphore_info = {};
+    semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+    for (int i = 0; i < VULKAN_FRAMES_IN_FLIGHT; i++) {
+        VulkanFrameSlot *slot = &vk->slots[i];
+        slot->commands = commands[i];
+        result = vkCreateFence(vk->device, &fence_info, NULL, &slot->done);
+        if (result != VK_SUCCESS) return fail(vk, "vkCreateFence", result);
+        result = vkCreateSemaphore(vk->device, &semaphore_info, NULL, &slot->image_acquired);
+        if (result != VK_SUCCESS) return fail(vk, "vkCreateSemaphore", result);
+    }
+
+    // One per image for any swap chain, so recreating one doesn't touch them
+    for (int i = 0; i < VULKAN_MAX_SWAPCHAIN_IMAGES; i++) {
+        result = vkCreateSemaphore(vk->device, &semaphore_info, NULL, &vk->render_done[i]);
+        if (result != VK_SUCCESS) return fail(vk, "vkCreateSemaphore", result);
+    }
+    return true;
+}
+
+// ----- Swap chain
+// --------------------------------------------------
+static void destroy_swapchain_images(VulkanRenderer *vk) {
+    for (uint32_t i = 0; i < vk->image_count; i++) {
+        if (vk->framebuffers[i]) vkDestroyFramebuffer(vk->device, vk->framebuffers[i], NULL);
+        if (vk->views[i]) vkDestroyImageView(vk->device, vk->views[i], NULL);
+        vk->framebuffers[i] = VK_NULL_HANDLE;
+        vk->views[i] = VK_NULL_HANDLE;
+        vk->images[i] = VK_NULL_HANDLE;
+    }
+    vk->image_count = 0;
+}
+
+static bool create_swapchain_images(VulkanRenderer *vk) {
+    uint32_t count = VULKAN_MAX_SWAPCHAIN_IMAGES;
+    VkResult result = vkGetSwapchainImagesKHR(vk->device, vk->swapchain, &count, vk->images);
+    if (result != VK_SUCCESS) return fail(vk, "vkGetSwapchainImagesKHR", result);
+    vk->image_count = count;
+
+    for (uint32_t i = 0; i < count; i++) {
+        VkImageViewCreateInfo view_info = {};
+        view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        view_info.image = vk->images[i];
+        view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        view_info.format = vk->surface_format.format;
+        view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        view_info.subresourceRange.levelCount = 1;
+        view_info.subresourceRange.layerCount = 1;
+        result = vkCreateImageView(vk->device, &view_info, NULL, &vk->views[i]);
+        if (result != VK_SUCCESS) return fail(vk, "vkCreateImageView", result);
+
+        VkFramebufferCreateInfo framebuffer_info = {};
+        framebuffer_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebuffer_info.renderPass = vk->render_pass;
+        framebuffer_info.attachmentCount = 1;
+        framebuffer_info.pAttachments = &vk->views[i];
+        framebuffer_info.width = vk->extent.width;
+        framebuffer_info.height = vk->extent.height;
+        framebuffer_info.layers = 1;
+        result = vkCreateFramebuffer(vk->device, &framebuffer_info, NULL, &vk->framebuffers[i]);
+        if (result != VK_SUCCESS) return fail(vk, "vkCreateFramebuffer", result);
+    }
+    return true;
+}
+
+static uint32_t clamp_extent(int requested, uint32_t min_extent, uint32_t max_extent) {
+    uint32_t extent = requested > 0 ? (uint32_t)requested : 0;
+    if (extent < min_extent) extent = min_extent;
+    if (extent > max_extent) extent = max_extent;
+    return extent;
+}
+
+static bool recreate_swapchain(VulkanRenderer *vk, const VkSurfaceCapabilitiesKHR *caps, VkExtent2D extent) {
+    // Nothing may still be drawing into or presenting from the old images.
+    // The old swap chain is handed to the new one, so the window system can
+    // keep showing its last image until the new one has a frame.
+    vkDeviceWaitIdle(vk->device);
+    destroy_swapchain_images(vk);
+
+    VkSwapchainKHR old_swapchain = vk->swapchain;
+    vk->swapchain = VK_NULL_HANDLE;
+    vk->extent = extent;
+    vk->swapchain_stale = false;
+
+    if (extent.width == 0 || extent.height == 0) {
+        if (old_swapchain) vkDestroySwapchainKHR(vk->device, old_swapchain, NULL);
+        return true;
+    }
+
+    // One more than the minimum, so acquiring never waits for the compositor
+    // to release an image while the previous frame is still being shown
+    uint32_t image_count = caps->minImageCount + 1;
+    if (caps->maxImageCount && image_count > caps->maxImageCount) image_count = caps->maxImageCount;
+    if (image_count > VULKAN_MAX_SWAPCHAIN_IMAGES) image_count = VULKAN_MAX_SWAPCHAIN_IMAGES;
+
+    VkCompositeAlphaFlagBitsKHR composite_alpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    if (!(caps->supportedCompositeAlpha & composite_alpha)) {
+        composite_alpha = (VkCompositeAlphaFlagBitsKHR)(caps->supportedCompositeAlpha & (~caps->supportedCompositeAlpha + 1));
+    }
+
+    vk->readback_supported = (caps->supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) != 0;
+
+    VkSwapchainCreateInfoKHR info = {};
+    info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+    info.surface = vk->surface;
+    info.minImageCount = image_count;
+    info.imageFormat = vk->surface_format.format;
+    info.imageColorSpace = vk->surface_format.colorSpace;
+    info.imageExtent = extent;
+    info.imageArrayLayers = 1;
+    info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                      (vk->readback_supported ? VK_IMAGE_USAGE_TRANSFER_SRC_BIT : 0);
+    info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    info.preTransform = caps->currentTransform;
+    info.compositeAlpha = composite_alpha;
+    info.presentMode = vk->present_mode;
+    info.clipped = VK_TRUE;
+    info.oldSwapchain = old_swapchain;
+
+    VkResult result = vkCreateSwapchainKHR(vk->device, &info, NULL, &vk->swapchain);
+    if (old_swapchain) vkDestroySwapchainKHR(vk->device, old_swapchain, NULL);
+    if (result != VK_SUCCESS) {
+        vk->swapchain = VK_NULL_HANDLE;
+        return fail(vk, "vkCreateSwapchainKHR", result);
+    }
+
+    vk->swapchains_created++;
+    return create_swapchain_images(vk);
+}
+
+bool vulkan_renderer_update_swapchain(VulkanRenderer *vk, int width, int height) {
+    // The surface can only have changed size if the window has, or if a
+    // present said so
+    if (vk->swapchain && !vk->swapchain_stale && width == vk->requested_width && height == vk->requested_height) {
+        return true;
+    }
+    vk->requested_width = width;
+    vk->requested_height = height;
+
+    VkSurfaceCapabilitiesKHR caps;
+    VkResult result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vk->physical_device, vk->surface, &caps);
+    if (result != VK_SUCCESS) return fail(vk, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR", result);
+
+    // Window systems that dictate the extent report it as both the minimum
+    // and the maximum; others take whatever the swap chain has
+    VkExtent2D extent;
+    extent.width = clamp_extent(width, caps.minImageExtent.width, caps.maxImageExtent.width);
+    extent.height = clamp_extent(height, caps.minImageExtent.height, caps.maxImageExtent.height);
+
+    bool resized = extent.width != vk->extent.width || extent.height != vk->extent.height;
+    if (!resized && !vk->swapchain_stale && (vk->swapchain || extent.width == 0 || extent.height == 0)) return true;
+
+    return recreate_swapchain(vk, &caps, extent);
+}
+
+// ----- Frames
+// --------------------------------------------------
+static bool ensure_readback_buffer(VulkanRenderer *vk) {
+    VkDeviceSize size = (VkDeviceSize)vk->extent.width * vk->extent.height * 4;
+    if (vk->readback_size >= size) return true;
+
+    if (vk->readback_buffer) {
+        vkDeviceWaitIdle(vk->device);
+        vkDestroyBuffer(vk->device, vk->readback_buffer, NULL);
+        vkFreeMemory(vk->device, vk->readback_memory, NULL);
+        vk->readback_buffer = VK_NULL_HANDLE;
+        vk->readback_memory = VK_NULL_HANDLE;
+        vk->readback_size = 0;
+    }
+
+    if (!create_host_buffer(vk, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+                            &vk->readback_buffer, &vk->readback_memory, &vk->readback_mapped)) {
+        return false;
+    }
+    vk->readback_size = size;
+    return true;
+}
+
+static void image_barrier(VkCommandBuffer commands, VkImage image, VkImageLayout old_layout, VkImageLayout new_layout,
+                          VkAccessFlags src_access, VkAccessFlags dst_access, VkPipelineStageFlags src_stage,
+                          VkPipelineStageFlags dst_stage) {
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = src_access;
+    barrier.dstAccessMask = dst_access;
+    barrier.oldLayout = old_layout;
+    barrier.newLayout = new_layout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.layerCount = 1;
+    vkCmdPipelineBarrier(commands, src_stage, dst_stage, 0, 0, NULL, 0, NULL, 1, &barrier);
+}
+
+// Copies the finished image into the readback buffer, leaving it ready to present
+static void record_readback(VulkanRenderer *vk, VkCommandBuffer commands, VkImage image) {
+    image_barrier(commands, image, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                  VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                  VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.layerCount = 1;
+    region.imageExtent.width = vk->extent.width;
+    region.imageExtent.height = vk->extent.height;
+    region.imageExtent.depth = 1;
+    vkCmdCopyImageToBuffer(commands, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, vk->readback_buffer, 1, &region);
+
+    image_barrier(commands, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                  0, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+
+    VkMemoryBarrier host_barrier = {};
+    host_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    host_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    host_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(commands, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &host_barrier,
+                         0, NULL, 0, NULL);
+}
+
+static bool record_frame(VulkanRenderer *vk, VkCommandBuffer commands, uint32_t image_index, const VulkanFrame *frame) {
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkResetCommandBuffer(commands, 0);
+    VkResult result = vkBeginCommandBuffer(commands, &begin_info);
+    if (result != VK_SUCCESS) return fail(vk, "vkBeginCommandBuffer", result);
+
+    VkClearValue clear = {};
+    clear.color.float32[0] = frame->background;
+    clear.color.float32[1] = frame->background;
+    clear.color.float32[2] = frame->background;
+    clear.color.float32[3] = 1.0f;
+
+    VkRenderPassBeginInfo pass_info = {};
+    pass_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    pass_info.renderPass = vk->render_pass;
+    pass_info.framebuffer = vk->framebuffers[image_index];
+    pass_info.renderArea.extent = vk->extent;
+    pass_info.clearValueCount = 1;
+    pass_info.pClearValues = &clear;
+    vkCmdBeginRenderPass(commands, &pass_info, VK_SUBPASS_CONTENTS_INLINE);
+
+    VkViewport viewport = {};
+    viewport.width = (float)vk->extent.width;
+    viewport.height = (float)vk->extent.height;
+    viewport.maxDepth = 1.0f;
+    VkRect2D scissor = {};
+    scissor.extent = vk->extent;
+    vkCmdSetViewport(commands, 0, 1, &viewport);
+    vkCmdSetScissor(commands, 0, 1, &scissor);
+
+    VkDeviceSize vertex_offset = 0;
+    vkCmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS, vk->pipeline);
+    vkCmdBindVertexBuffers(commands, 0, 1, &vk->mesh_buffer, &vertex_offset);
+    vkCmdBindIndexBuffer(commands, vk->mesh_buffer, vk->index_offset, VK_INDEX_TYPE_UINT32);
+    vkCmdPushConstants(commands, vk->pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(float), &frame->modifier);
+    vkCmdDrawIndexed(commands, vk->index_count, 1, 0, 0, 0);
+
+    vkCmdEndRenderPass(commands);
+
+    if (frame->readback) record_readback(vk, commands, vk->images[image_index]);
+
+    result = vkEndCommandBuffer(commands);
+    if (result != VK_SUCCESS) return fail(vk, "vkEndCommandBuffer", result);
+    return true;
+}
+
+static void copy_readback(const VulkanRenderer *vk, uint32_t *pixels) {
+    size_t count = (size_t)vk->extent.width * vk->extent.height;
+    const uint32_t *source = (const uint32_t*)vk->readback_mapped;
+    if (vk->surface_format.format != VK_FORMAT_R8G8B8A8_UNORM) {
+        memcpy(pixels, source, count * sizeof(uint32_t));
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        uint32_t rgba = source[i];
+        pixels[i] = (rgba & 0xFF00FF00u) | ((rgba & 0xFFu) << 16) | ((rgba >> 16) & 0xFFu);
+    }
+}
+
+// Leaves a slot whose frame failed after acquiring as the next frame expects
+// it: an empty batch consumes the acquire semaphore and signals the fence
+static void abandon_frame(VulkanRenderer *vk, VulkanFrameSlot *slot) {
+    VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.waitSemaphoreCount = 1;
+    submit_info.pWaitSemaphores = &slot->image_acquired;
+    submit_info.pWaitDstStageMask = &wait_stage;
+    vkResetFences(vk->device, 1, &slot->done);
+    vkQueueSubmit(vk->queue, 1, &submit_info, slot->done);
+}
+
+VulkanFrameResult vulkan_renderer_draw(VulkanRenderer *vk, const VulkanFrame *frame) {
+    if (!vulkan_renderer_update_swapchain(vk, frame->width, frame->height)) return VULKAN_FRAME_FAILED;
+    if (!vk->swapchain) return VULKAN_FRAME_SKIPPED;
+
+    if (frame->readback) {
+        if (!vk->readback_supported) {
+            fail(vk, "reading back the swap chain", VK_ERROR_EXTENSION_NOT_PRESENT);
+            return VULKAN_FRAME_FAILED;
+        }
+        if (!ensure_readback_buffer(vk)) return VULKAN_FRAME_FAILED;
+    }
+
+    // The slot's last use was VULKAN_FRAMES_IN_FLIGHT frames ago, so this
+    // only blocks when the CPU is that far ahead of the GPU
+    VulkanFrameSlot *slot = &vk->slots[vk->frame_index % VULKAN_FRAMES_IN_FLIGHT];
+    vkWaitForFences(vk->device, 1, &slot->done, VK_TRUE, UINT64_MAX);
+
+    uint32_t image_index = 0;
+    VkResult result = vkAcquireNextImageKHR(vk->device, vk->swapchain, UINT64_MAX, slot->image_acquired,
+                                            VK_NULL_HANDLE, &image_index);
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+        // The window changed again since the size was checked
+        vk->out_of_date++;
+        vk->swapchain_stale = true;
+        if (!vulkan_renderer_update_swapchain(vk, frame->width, frame->height)) return VULKAN_FRAME_FAILED;
+        if (!vk->swapchain) return VULKAN_FRAME_SKIPPED;
+        if (frame->readback && !ensure_readback_buffer(vk)) return VULKAN_FRAME_FAILED;
+        result = vkAcquireNextImageKHR(vk->device, vk->swapchain, UINT64_MAX, slot->image_acquired,
+                                       VK_NULL_HANDLE, &image_index);
+        if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+            // Still moving; the next frame recreates it at the size it has by then
+            vk->out_of_date++;
+            return VULKAN_FRAME_SKIPPED;
+        }
+    }
+    if (result == VK_SUBOPTIMAL_KHR) {
+        // Still presentable; replaced after this frame
+        vk->suboptimal++;
+        vk->swapchain_stale = true;
+    } else if (result != VK_SUCCESS) {
+        fail(vk, "vkAcquireNextImageKHR", result);
+        return VULKAN_FRAME_FAILED;
+    }
+
+    if (!record_frame(vk, slot->commands, image_index, frame)) {
+        abandon_frame(vk, slot);
+        return VULKAN_FRAME_FAILED;
+    }
+
+    VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.waitSemaphoreCount = 1;
+    submit_info.pWaitSemaphores = &slot->image_acquired;
+    submit_info.pWaitDstStageMask = &wait_stage;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &slot->commands;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &vk->render_done[image_index];
+    vkResetFences(vk->device, 1, &slot->done);
+    result = vkQueueSubmit(vk->queue, 1, &submit_info, slot->done);
+    if (result != VK_SUCCESS) {
+        fail(vk, "vkQueueSubmit", result);
+        abandon_frame(vk, slot);
+        return VULKAN_FRAME_FAILED;
+    }
+    vk->frame_index++;
+
+    VkPresentInfoKHR present_info = {};
+    present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+    present_info.waitSemaphoreCount = 1;
+    present_info.pWaitSemaphores = &vk->render_done[image_index];
+    present_info.swapchainCount = 1;
+    present_info.pSwapchains = &vk->swapchain;
+    present_info.pImageIndices = &image_index;
+    result = vkQueuePresentKHR(vk->queue, &present_info);
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+        vk->out_of_date++;
+        vk->swapchain_stale = true;
+    } else if (result == VK_SUBOPTIMAL_KHR) {
+        vk->suboptimal++;
+        vk->swapchain_stale = true;
+    } else if (result != VK_SUCCESS) {
+        fail(vk, "vkQueuePresentKHR", result);
+        return VULKAN_FRAME_FAILED;
+    }
+
+    if (frame->readback) {
+        vkWaitForFences(vk->device, 1, &slot->done, VK_TRUE, UINT64_MAX);
+        copy_readback(vk, frame->readback);
+    }
+    return VULKAN_FRAME_PRESENTED;
+}
+
+void vulkan_renderer_finish(VulkanRenderer *vk) {
+    VkFence fences[VULKAN_FRAMES_IN_FLIGHT];
+    for (int i = 0; i < VULKAN_FRAMES_IN_FLIGHT; i++) fences[i] = vk->slots[i].done;
+    vkWaitForFences(vk->device, VULKAN_FRAMES_IN_FLIGHT, fences, VK_TRUE, UINT64_MAX);
+}
+
+// ----- Lifetime
+// --------------------------------------------------
+bool vulkan_renderer_init(VulkanRenderer *vk, const VulkanRendererDesc *desc) {
+    memset(vk, 0, sizeof(*vk));
+
+    if (!load_functions(vk, global_functions, VULKAN_COUNT(global_functions), desc->get_proc, NULL)) return false;
+
+    VkApplicationInfo app_info = {};
+    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app_info.pApplicationName = "Win32SmoothSizing";
+    app_info.apiVersion = VK_API_VERSION_1_0;
+
+    const char *extensions[] = { VK_KHR_SURFACE_EXTENSION_NAME, desc->surface_extension };
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.pApplicationInfo = &app_info;
+    instance_info.enabledExtensionCount = VULKAN_COUNT(extensions);
+    instance_info.ppEnabledExtensionNames = extensions;
+
+    VkResult result = vkCreateInstance(&instance_info, NULL, &vk->instance);
+    if (result != VK_SUCCESS) return fail(vk, "vkCreateInstance", result);
+
+    bool ok = load_functions(vk, instance_functions, VULKAN_COUNT(instance_functions), desc->get_proc, NULL);
+    if (ok) {
+        result = desc->create_surface(vk->instance, desc->get_proc, desc->surface_user, &vk->surface);
+        if (result != VK_SUCCESS) ok = fail(vk, "creating the surface", result);
+    }
+
+    ok = ok && pick_physical_device(vk) && create_device(vk) && pick_surface_format(vk);
+    if (ok) {
+        vk->present_mode = VK_PRESENT_MODE_FIFO_KHR;
+        vulkan_renderer_set_present_mode(vk, desc->present_mode);
+        vk->swapchain_stale = false;
+    }
+    ok = ok && create_render_pass(vk) && create_pipeline(vk) && create_mesh(vk, desc) && create_frame_slots(vk);
+
+    if (!ok) {
+        char error[sizeof(vk->error)];
+        memcpy(error, vk->error, sizeof(error));
+        vulkan_renderer_destroy(vk);
+        memcpy(vk->error, error, sizeof(error));
+    }
+    return ok;
+}
+
+void vulkan_renderer_destroy(VulkanRenderer *vk) {
+    if (vk->device) {
+        vkDeviceWaitIdle(vk->device);
+
+        destroy_swapchain_images(vk);
+        if (vk->swapchain) vkDestroySwapchainKHR(vk->device, vk->swapchain, NULL);
+
+        for (int i = 0; i < VULKAN_FRAMES_IN_FLIGHT; i++) {
+            if (vk->slots[i].done) vkDestroyFence(vk->device, vk->slots[i].done, NULL);
+            if (vk->slots[i].image_acquired) vkDestroySemaphore(vk->device, vk->slots[i].image_acquired, NULL);
+        }
+        for (int i = 0; i < VULKAN_MAX_SWAPCHAIN_IMAGES; i++) {
+            if (vk->render_done[i]) vkDestroySemaphore(vk->device, vk->render_done[i], NULL);
+        }
+        if (vk->command_pool) vkDestroyCommandPool(vk->device, vk->command_pool, NULL);
+
+        if (vk->readback_buffer) vkDestroyBuffer(vk->device, vk->readback_buffer, NULL);
+        if (vk->readback_memory) vkFreeMemory(vk->device, vk->readback_memory, NULL);
+        if (vk->mesh_buffer) vkDestroyBuffer(vk->device, vk->mesh_buffer, NULL);
+        if (vk->mesh_memory) vkFreeMemory(vk->device, vk->mesh_memory, NULL);
+
+        if (vk->pipeline) vkDestroyPipeline(vk->device, vk->pipeline, NULL);
+        if (vk->pipeline_layout) vkDestroyPipelineLayout(vk->device, vk->pipeline_layout, NULL);
+        if (vk->render_pass) vkDestroyRenderPass(vk->device, vk->render_pass, NULL);
+
+        vkDestroyDevice(vk->device, NULL);
+    }
+    if (vk->surface) vkDestroySurfaceKHR(vk->instance, vk->surface, NULL);
+    if (vk->instance && vkDestroyInstance) vkDestroyInstance(vk->instance, NULL);
+
+    memset(vk, 0, sizeof(*vk));
+}
@@ -0,0 +1,147 @@
+#ifndef VULKAN_RENDERER_H
+#define VULKAN_RENDERER_H
+
+// Draws the scene with Vulkan into a window surface, for comparing how the
+// window system and the driver behave during a resize when the swap chain is
+// in our hands instead of behind SwapBuffers.
+//
+// The swap chain is recreated explicitly whenever the window's size differs
+// from its extent, before the frame is acquired, and again whenever acquire
+// or present report it out of date. Up to VULKAN_FRAMES_IN_FLIGHT frames are
+// recorded ahead of the GPU, each with its own command buffer, fence and
+// acquire semaphore; vulkan_renderer_finish waits for the last one, which is
+// what the resize handshake needs before it lets the window procedure return.
+//
+// The module doesn't know the platform: the caller hands it the loader's
+// vkGetInstanceProcAddr, the name of the surface extension and a function that
+// creates the surface. Everything runs on the thread that called init.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef VK_NO_PROTOTYPES
+#define VK_NO_PROTOTYPES
+#endif
+#include <vulkan/vulkan.h>
+
+#define VULKAN_FRAMES_IN_FLIGHT 2
+#define VULKAN_MAX_SWAPCHAIN_IMAGES 8
+
+typedef VkResult (*VulkanCreateSurfaceFunc)(VkInstance instance, PFN_vkGetInstanceProcAddr get_proc, void *user,
+                                            VkSurfaceKHR *surface);
+
+typedef struct {
+    PFN_vkGetInstanceProcAddr get_proc;
+    const char *surface_extension;
+    VulkanCreateSurfaceFunc create_surface;
+    void *surface_user;
+
+    // Used when the surface supports it, otherwise FIFO, which always is
+    VkPresentModeKHR present_mode;
+
+    // The scene's quad: (x, y, z, r, g, b) per vertex
+    const float *vertices;
+    int vertex_count;
+    const uint32_t *indices;
+    int index_count;
+} VulkanRendererDesc;
+
+typedef struct {
+    int width;  // The window's client area; the surface may insist on its own
+    int height;
+    float background; // Grey level of the clear
+    float modifier;   // Scale of the quad, as in the GL vertex shader
+
+    // When set, receives the frame as top-down BGRA rows once it has been
+    // drawn. Waits for the frame. Needs a swap chain that allows copies.
+    uint32_t *readback;
+} VulkanFrame;
+
+typedef enum {
+    VULKAN_FRAME_PRESENTED,
+    VULKAN_FRAME_SKIPPED, // The surface has no area, e.g. a minimized window, or is still changing
+    VULKAN_FRAME_FAILED,  // See error
+} VulkanFrameResult;
+
+typedef struct {
+    VkCommandBuffer commands;
+    VkFence done; // Signaled when the GPU has finished the frame
+    VkSemaphore image_acquired;
+} VulkanFrameSlot;
+
+typedef struct {
+    VkInstance instance;
+    VkSurfaceKHR surface;
+    VkPhysicalDevice physical_device;
+    VkDevice device;
+    uint32_t queue_family;
+    VkQueue queue;
+    char device_name[256];
+
+    VkSwapchainKHR swapchain;
+    VkPresentModeKHR present_mode;
+    VkSurfaceFormatKHR surface_format;
+    VkExtent2D extent;
+    int requested_width; // Window size the swap chain was last checked against
+    int requested_height;
+    bool swapchain_stale; // Out of date or suboptimal: recreate before the next acquire
+    bool readback_supported;
+    uint32_t image_count;
+    VkImage images[VULKAN_MAX_SWAPCHAIN_IMAGES];
+    VkImageView views[VULKAN_MAX_SWAPCHAIN_IMAGES];
+    VkFramebuffer framebuffers[VULKAN_MAX_SWAPCHAIN_IMAGES];
+    VkSemaphore render_done[VULKAN_MAX_SWAPCHAIN_IMAGES]; // Per image, since presents finish out of order
+
+    VkRenderPass render_pass;
+    VkPipelineLayout pipeline_layout;
+    VkPipeline pipeline;
+
+    VkBuffer mesh_buffer; // Vertices, then indices
+    VkDeviceMemory mesh_memory;
+    VkDeviceSize index_offset;
+    uint32_t index_count;
+
+    VkBuffer readback_buffer;
+    VkDeviceMemory readback_memory;
+    VkDeviceSize readback_size;
+    void *readback_mapped;
+
+    VkCommandPool command_pool;
+    VulkanFrameSlot slots[VULKAN_FRAMES_IN_FLIGHT];
+    uint64_t frame_index; // Frames submitted; selects the slot
+
+    // Counters since init
+    uint64_t swapchains_created;
+    uint64_t out_of_date; // Acquires and presents that found the swap chain out of date
+    uint64_t suboptimal;
+
+    char error[256];
+} VulkanRenderer;
+
+// On failure, error says why and nothing is left to destroy
+bool vulkan_renderer_init(VulkanRenderer *vk, const VulkanRendererDesc *desc);
+void vulkan_renderer_destroy(VulkanRenderer *vk);
+
+const char *vulkan_present_mode_name(VkPresentModeKHR mode);
+
+// The present modes the surface offers; returns how many were written
+int vulkan_renderer_present_modes(const VulkanRenderer *vk, VkPresentModeKHR *modes, int max_modes);
+
+// Switches the present mode; takes effect through a swap chain recreation
+// before the next frame. Returns false when the surface doesn't offer it.
+bool vulkan_renderer_set_present_mode(VulkanRenderer *vk, VkPresentModeKHR mode);
+
+// Recreates the swap chain if the surface's size no longer matches it, or if
+// it went out of date or the present mode changed. Called by draw; callers
+// that want to time recreation on its own can call it first. A surface
+// without area leaves no swap chain, and draw skips frames until it has one.
+bool vulkan_renderer_update_swapchain(VulkanRenderer *vk, int width, int height);
+
+// Records, submits and presents a frame. Only waits for the GPU when the
+// slot it reuses is still in flight, or for a readback.
+VulkanFrameResult vulkan_renderer_draw(VulkanRenderer *vk, const VulkanFrame *frame);
+
+// Waits until the GPU has finished every submitted frame
+void vulkan_renderer_finish(VulkanRenderer *vk);
+
+#endif
@@ -0,0 +1,10 @@
+#!/bin/sh
+# Builds the headless Vulkan resize benchmark on Linux. Needs the Vulkan
+# headers and loader, and a driver with VK_EXT_headless_surface (Mesa's
+# lavapipe works without a GPU). Run from the root of the repo.
+
+mkdir -p build
+
+cmd="cc -O2 -Isrc -Ilinux vkbench/vk_bench.c src/vulkan_renderer.c linux/handshake.c -o build/vk_bench -lpthread -ldl -lm"
+echo $cmd
+$cmd
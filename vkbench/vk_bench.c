@@ -0,0 +1,257 @@
+// Drives the Vulkan renderer (src/vulkan_renderer.c) on a headless surface
+// through a scripted window drag, once per present mode, and reports how
+// long each resize took from the new size to a finished frame at that size:
+// what the window procedure waits for in the resize handshake. Then it runs
+// the animation without resizing, with frames in flight, for comparison.
+//
+// Usage: vk_bench [--resizes N] [--frames N] [--present-mode immediate|mailbox|fifo|fifo-relaxed] [--csv]
+//
+// A headless surface has no size of its own, so the swap chain takes the
+// size of the window being simulated, and every present succeeds: the
+// recreation measured here is the explicit one on a size change. Every 16th
+// resize, an extra untimed frame is read back to check it has the background
+// in the corners and the quad in the middle.
+
+#include <dlfcn.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "handshake.h"
+#include "vulkan_renderer.h"
+
+#define CHECK_INTERVAL 16
+
+// The scene of src/main.c
+static const float vertices[] = {        // (x, y, z, r, g, b)
+     0.5f,  0.5f, 0.0f, 1.0f, 0.0f, 0.0f, // top right
+     0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // bottom right
+    -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 1.0f, // bottom left
+    -0.5f,  0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // top left
+};
+
+static const uint32_t indices[] = {
+    0, 1, 2, // first triangle
+    0, 2, 3, // second triangle
+};
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static VkResult create_headless_surface(VkInstance instance, PFN_vkGetInstanceProcAddr get_proc, void *user,
+                                        VkSurfaceKHR *surface) {
+    (void)user;
+    PFN_vkCreateHeadlessSurfaceEXT create =
+        (PFN_vkCreateHeadlessSurfaceEXT)get_proc(instance, "vkCreateHeadlessSurfaceEXT");
+    if (!create) return VK_ERROR_EXTENSION_NOT_PRESENT;
+
+    VkHeadlessSurfaceCreateInfoEXT info = {};
+    info.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+    return create(instance, &info, NULL, surface);
+}
+
+// Same animation as the window
+static void animate(VulkanFrame *frame, float time) {
+    frame->modifier = quad_modifier(time);
+    frame->background = background_color(time);
+}
+
+static uint8_t grey_of(uint32_t bgra) {
+    return (uint8_t)(bgra & 0xFF);
+}
+
+// Corners hold the clear, the middle is inside the quad at any modifier
+static bool check_frame(const VulkanRenderer *vk, const VulkanFrame *frame, const uint32_t *pixels) {
+    uint32_t width = vk->extent.width;
+    uint32_t height = vk->extent.height;
+    if (width != (uint32_t)frame->width || height != (uint32_t)frame->height) return false;
+
+    uint32_t expected = (uint32_t)lrintf(frame->background * 255.0f);
+    uint32_t corners[4] = { pixels[0], pixels[width - 1], pixels[(height - 1) * width],
+                            pixels[height * width - 1] };
+    for (int i = 0; i < 4; i++) {
+        uint32_t grey = grey_of(corners[i]);
+        if (grey + 1 < expected || grey > expected + 1) return false;
+        if (((corners[i] >> 8) & 0xFF) != grey || ((corners[i] >> 16) & 0xFF) != grey) return false;
+    }
+
+    // Where the two triangles meet, red and blue are even and green is low
+    uint32_t middle = pixels[(height / 2) * width + width / 2];
+    return ((middle >> 16) & 0xFF) > 64 && (middle & 0xFF) > 64;
+}
+
+static bool parse_present_mode(const char *name, VkPresentModeKHR *mode) {
+    const char *names[] = { "immediate", "mailbox", "fifo", "fifo-relaxed" };
+    const VkPresentModeKHR modes[] = { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR,
+                                       VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_FIFO_RELAXED_KHR };
+    for (int i = 0; i < 4; i++) {
+        if (strcmp(name, names[i]) == 0) {
+            *mode = modes[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv) {
+    int resize_count = 320;
+    int frame_count = 600;
+    bool csv = false;
+    bool one_mode = false;
+    VkPresentModeKHR only_mode = VK_PRESENT_MODE_FIFO_KHR;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--resizes") == 0 && i + 1 < argc) {
+            resize_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frame_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--present-mode") == 0 && i + 1 < argc && parse_present_mode(argv[i + 1], &only_mode)) {
+            one_mode = true;
+            i++;
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else {
+            fprintf(stderr,
+                    "Usage: %s [--resizes N] [--frames N] [--present-mode immediate|mailbox|fifo|fifo-relaxed] [--csv]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (resize_count < 1) resize_count = 1;
+    if (frame_count < 1) frame_count = 1;
+
+    void *library = dlopen("libvulkan.so.1", RTLD_NOW | RTLD_LOCAL);
+    PFN_vkGetInstanceProcAddr get_proc =
+        library ? (PFN_vkGetInstanceProcAddr)dlsym(library, "vkGetInstanceProcAddr") : NULL;
+    if (!get_proc) {
+        fprintf(stderr, "Could not load libvulkan.so.1\n");
+        return 1;
+    }
+
+    VulkanRendererDesc desc = {};
+    desc.get_proc = get_proc;
+    desc.surface_extension = VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME;
+    desc.create_surface = create_headless_surface;
+    desc.present_mode = only_mode;
+    desc.vertices = vertices;
+    desc.vertex_count = (int)(sizeof(vertices) / sizeof(vertices[0]) / 6);
+    desc.indices = indices;
+    desc.index_count = (int)(sizeof(indices) / sizeof(indices[0]));
+
+    VulkanRenderer vk;
+    if (!vulkan_renderer_init(&vk, &desc)) {
+        fprintf(stderr, "%s", vk.error);
+        return 1;
+    }
+
+    VkPresentModeKHR modes[16];
+    int mode_count = one_mode ? 1 : vulkan_renderer_present_modes(&vk, modes, 16);
+    if (one_mode) modes[0] = only_mode;
+    printf("Vulkan on %s, %d resizes and %d animated frames per present mode\n", vk.device_name, resize_count,
+           frame_count);
+
+    double *recreate_ms = (double*)malloc(resize_count * sizeof(double));
+    double *frame_ms = (double*)malloc(resize_count * sizeof(double));
+    double *latency_ms = (double*)malloc(resize_count * sizeof(double));
+    double *animate_ms = (double*)malloc(frame_count * sizeof(double));
+    uint32_t *pixels = (uint32_t*)malloc(1280 * 960 * sizeof(uint32_t));
+    int failures = 0;
+
+    for (int m = 0; m < mode_count; m++) {
+        if (!vulkan_renderer_set_present_mode(&vk, modes[m])) {
+            printf("Present mode %s: not offered by the surface\n", vulkan_present_mode_name(modes[m]));
+            continue;
+        }
+
+        uint64_t created_before = vk.swapchains_created;
+        int resized = 0;
+        int animated = 0;
+        int checked = 0;
+        int wrong = 0;
+        float time = 0.0f;
+        VulkanFrame frame = {};
+
+        // Each step is one WM_PAINT: the new size arrives, and the window
+        // procedure returns once a frame at that size is finished
+        for (int i = 0; i < resize_count; i++) {
+            drag_size(i, &frame.width, &frame.height);
+            animate(&frame, time);
+            time += 1.0f / 60.0f;
+
+            double start = now_seconds();
+            if (!vulkan_renderer_update_swapchain(&vk, frame.width, frame.height)) break;
+            double recreated = now_seconds();
+            if (vulkan_renderer_draw(&vk, &frame) != VULKAN_FRAME_PRESENTED) break;
+            vulkan_renderer_finish(&vk);
+            double end = now_seconds();
+
+            recreate_ms[i] = 1000.0 * (recreated - start);
+            frame_ms[i] = 1000.0 * (end - recreated);
+            latency_ms[i] = 1000.0 * (end - start);
+            resized++;
+            if (csv) {
+                printf("%s,resize,%d,%d,%d,%.4f,%.4f\n", vulkan_present_mode_name(modes[m]), i, frame.width,
+                       frame.height, recreate_ms[i], frame_ms[i]);
+            }
+
+            if (i % CHECK_INTERVAL == 0 && vk.readback_supported) {
+                frame.readback = pixels;
+                bool drawn = vulkan_renderer_draw(&vk, &frame) == VULKAN_FRAME_PRESENTED;
+                frame.readback = NULL;
+                checked++;
+                if (!drawn || !check_frame(&vk, &frame, pixels)) wrong++;
+            }
+        }
+        if (vk.error[0]) {
+            fprintf(stderr, "%s", vk.error);
+            failures++;
+            break;
+        }
+
+        // Animation at a fixed size, letting the CPU run ahead of the GPU
+        double last = now_seconds();
+        for (int i = 0; i < frame_count; i++) {
+            animate(&frame, time);
+            time += 1.0f / 60.0f;
+            if (vulkan_renderer_draw(&vk, &frame) != VULKAN_FRAME_PRESENTED) break;
+            double now = now_seconds();
+            animate_ms[i] = 1000.0 * (now - last);
+            last = now;
+            animated++;
+            if (csv) printf("%s,animate,%d,%d,%d,0,%.4f\n", vulkan_present_mode_name(modes[m]), i, frame.width,
+                            frame.height, animate_ms[i]);
+        }
+        vulkan_renderer_finish(&vk);
+        if (vk.error[0]) {
+            fprintf(stderr, "%s", vk.error);
+            failures++;
+            break;
+        }
+
+        printf("Present mode %s: %llu swap chains, %d of %d checked frames wrong\n",
+               vulkan_present_mode_name(modes[m]), (unsigned long long)(vk.swapchains_created - created_before),
+               wrong, checked);
+        report_samples("recreate", recreate_ms, resized);
+        report_samples("resize frame", frame_ms, resized);
+        report_samples("resize total", latency_ms, resized);
+        report_samples("animated frame", animate_ms, animated);
+        if (wrong) failures++;
+    }
+
+    printf("Out of date: %llu, suboptimal: %llu\n", (unsigned long long)vk.out_of_date,
+           (unsigned long long)vk.suboptimal);
+
+    vulkan_renderer_destroy(&vk);
+    free(recreate_ms);
+    free(frame_ms);
+    free(latency_ms);
+    free(animate_ms);
+    free(pixels);
+    return failures ? 1 : 0;
+}